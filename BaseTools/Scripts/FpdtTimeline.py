@@ -0,0 +1,357 @@
+## @file
+# Convert the boot performance records exported by the BootTimelineExport shell
+# application into a Chrome trace-event timeline, and report the critical path
+# and the self time of each module.
+#
+# Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+
+'''
+FpdtTimeline
+'''
+from __future__ import print_function
+
+import sys
+import argparse
+import json
+import struct
+import uuid
+
+#
+# Globals for help information
+#
+__prog__        = 'FpdtTimeline'
+__copyright__   = 'Copyright (c) 2022, Intel Corporation. All rights reserved.'
+__description__ = 'Convert FPDT boot performance records into a boot timeline and report the critical path and module self time.\n'
+
+#
+# File layout of BootTimelineExport
+#
+BOOT_TIMELINE_SIGNATURE = b'BTLN'
+BOOT_TIMELINE_HEADER    = struct.Struct ('<4sHHQIIII')
+BOOT_TIMELINE_NAME      = struct.Struct ('<16s24s')
+
+#
+# FPDT Boot Performance Table and record layouts
+#
+FBPT_SIGNATURE      = b'FBPT'
+FBPT_HEADER         = struct.Struct ('<4sI')
+RECORD_HEADER       = struct.Struct ('<HBB')
+RECORD_COMMON       = struct.Struct ('<HBBHIQ')
+BASIC_BOOT_RECORD   = struct.Struct ('<HBBIQQQQQ')
+
+FPDT_RECORD_TYPE_FIRMWARE_BASIC_BOOT = 0x0002
+FPDT_GUID_EVENT_TYPE                 = 0x1010
+FPDT_DYNAMIC_STRING_EVENT_TYPE       = 0x1011
+FPDT_DUAL_GUID_STRING_EVENT_TYPE     = 0x1012
+FPDT_GUID_QWORD_EVENT_TYPE           = 0x1013
+FPDT_GUID_QWORD_STRING_EVENT_TYPE    = 0x1014
+
+#
+# Core ProgressID pairs, see MdePkg/Include/Library/PerformanceLib.h
+#
+CORE_START_IDS = {
+    0x01: 'StartImage',
+    0x03: 'LoadImage',
+    0x05: 'DriverBinding.Start',
+    0x07: 'DriverBinding.Supported',
+    0x09: 'DriverBinding.Stop',
+    }
+
+CATEGORY_BY_ID = {
+    0x10: 'EventSignal',
+    0x20: 'Callback',
+    0x30: 'Function',
+    0x40: 'InModule',
+    0x50: 'CrossModule',
+    }
+
+class Record (object):
+    def __init__ (self, ProgressId, Timestamp, Guid, Qword = None, String = None, Guid2 = None):
+        self.ProgressId = ProgressId
+        self.Timestamp  = Timestamp
+        self.Guid       = Guid
+        self.Qword      = Qword
+        self.String     = String
+        self.Guid2      = Guid2
+
+class Interval (object):
+    def __init__ (self, Name, Category, Start, End, Guid):
+        self.Name     = Name
+        self.Category = Category
+        self.Start    = Start
+        self.End      = End
+        self.Guid     = Guid
+        self.Children = []
+
+    @property
+    def Duration (self):
+        return self.End - self.Start
+
+    @property
+    def SelfTime (self):
+        return self.Duration - sum (Child.Duration for Child in self.Children)
+
+def GuidString (Buffer):
+    return str (uuid.UUID (bytes_le = bytes (Buffer))).upper ()
+
+def CString (Buffer):
+    return Buffer.split (b'\0', 1)[0].decode ('ascii', 'replace')
+
+def ParseNameTable (Buffer, Offset, Count):
+    Names = {}
+    for Index in range (Count):
+        Guid, Name = BOOT_TIMELINE_NAME.unpack_from (Buffer, Offset + Index * BOOT_TIMELINE_NAME.size)
+        Names[GuidString (Guid)] = CString (Name)
+    return Names
+
+def ParseXrefFile (File):
+    #
+    # Guid.xref produced by the build: "<GUID> <Name>" per line.
+    #
+    Names = {}
+    for Line in File:
+        Fields = Line.split ()
+        if len (Fields) >= 2:
+            try:
+                Names[str (uuid.UUID (Fields[0])).upper ()] = Fields[1]
+            except ValueError:
+                pass
+    return Names
+
+def ParseRecords (Table):
+    Signature, Length = FBPT_HEADER.unpack_from (Table, 0)
+    if Signature != FBPT_SIGNATURE:
+        raise ValueError ('Boot Performance Table signature is not found')
+    Length = min (Length, len (Table))
+
+    Records   = []
+    BasicBoot = None
+    Offset    = FBPT_HEADER.size
+    while Offset + RECORD_HEADER.size <= Length:
+        Type, RecordLength, Revision = RECORD_HEADER.unpack_from (Table, Offset)
+        if RecordLength == 0 or Offset + RecordLength > Length:
+            break
+        Data = Table[Offset:Offset + RecordLength]
+        Offset += RecordLength
+
+        if Type == FPDT_RECORD_TYPE_FIRMWARE_BASIC_BOOT:
+            BasicBoot = BASIC_BOOT_RECORD.unpack_from (Data, 0)
+            continue
+        if Type not in (FPDT_GUID_EVENT_TYPE, FPDT_DYNAMIC_STRING_EVENT_TYPE, FPDT_DUAL_GUID_STRING_EVENT_TYPE,
+                        FPDT_GUID_QWORD_EVENT_TYPE, FPDT_GUID_QWORD_STRING_EVENT_TYPE):
+            continue
+
+        _, _, _, ProgressId, _, Timestamp = RECORD_COMMON.unpack_from (Data, 0)
+        Guid = GuidString (Data[18:34])
+        if Type == FPDT_GUID_EVENT_TYPE:
+            Records.append (Record (ProgressId, Timestamp, Guid))
+        elif Type == FPDT_DYNAMIC_STRING_EVENT_TYPE:
+            Records.append (Record (ProgressId, Timestamp, Guid, String = CString (Data[34:])))
+        elif Type == FPDT_DUAL_GUID_STRING_EVENT_TYPE:
+            Records.append (Record (ProgressId, Timestamp, Guid, String = CString (Data[50:]), Guid2 = GuidString (Data[34:50])))
+        elif Type == FPDT_GUID_QWORD_EVENT_TYPE:
+            Records.append (Record (ProgressId, Timestamp, Guid, Qword = struct.unpack_from ('<Q', Data, 34)[0]))
+        else:
+            Records.append (Record (ProgressId, Timestamp, Guid, Qword = struct.unpack_from ('<Q', Data, 34)[0], String = CString (Data[42:])))
+    return Records, BasicBoot
+
+def LoadFile (File, Names):
+    Buffer = File.read ()
+    if Buffer[:4] == BOOT_TIMELINE_SIGNATURE:
+        _, _, _, Frequency, TableOffset, TableLength, NameOffset, NameCount = BOOT_TIMELINE_HEADER.unpack_from (Buffer, 0)
+        Names.update (ParseNameTable (Buffer, NameOffset, NameCount))
+        Table = Buffer[TableOffset:TableOffset + TableLength]
+    else:
+        #
+        # Accept a raw dump of the Boot Performance Table too.
+        #
+        Table = Buffer
+    return ParseRecords (Table)
+
+def StartIdOf (ProgressId):
+    if ProgressId < 0x10:
+        if ProgressId in CORE_START_IDS:
+            return ProgressId, True
+        if ProgressId - 1 in CORE_START_IDS:
+            return ProgressId - 1, False
+        return ProgressId, None
+    if ProgressId & 0xF == 0:
+        return ProgressId, True
+    return ProgressId & ~0xF, False
+
+def BuildIntervals (Records, Names):
+    Intervals = []
+    Events    = []
+    Open      = {}
+    for Item in Records:
+        StartId, IsStart = StartIdOf (Item.ProgressId)
+        if Item.Timestamp == 0 or IsStart is None:
+            Events.append (Item)
+            continue
+
+        #
+        # StartImage/LoadImage end records may not carry the module, so they
+        # match the most recent start record of the same kind.
+        #
+        if StartId in (0x01, 0x03):
+            Key = (StartId,)
+        elif StartId < 0x10:
+            Key = (StartId, Item.Guid, Item.Qword)
+        else:
+            Key = (StartId, Item.Guid, Item.String)
+
+        if IsStart:
+            Open.setdefault (Key, []).append (Item)
+            continue
+        if not Open.get (Key):
+            Events.append (Item)
+            continue
+
+        Start = Open[Key].pop ()
+        Guid  = Start.Guid if Start.Guid != str (uuid.UUID (int = 0)) else Item.Guid
+        Name  = Start.String or Item.String or Names.get (Guid, Guid)
+        if StartId < 0x10:
+            Category = CORE_START_IDS[StartId]
+        else:
+            Category = CATEGORY_BY_ID.get (StartId, 'Custom')
+        Intervals.append (Interval (Name, Category, Start.Timestamp, Item.Timestamp, Guid))
+
+    for Pending in Open.values ():
+        Events.extend (Pending)
+    return Intervals, Events
+
+def BuildTree (Intervals):
+    #
+    # Nest the intervals by containment. Boot services run on a single
+    # processor, so every interval is either inside or after the previous one.
+    #
+    Roots = []
+    Stack = []
+    for Item in sorted (Intervals, key = lambda Item: (Item.Start, -Item.End)):
+        while Stack and Item.Start >= Stack[-1].End:
+            Stack.pop ()
+        if Stack and Item.End <= Stack[-1].End:
+            Stack[-1].Children.append (Item)
+        else:
+            Roots.append (Item)
+        Stack.append (Item)
+    return Roots
+
+def CriticalPath (Roots):
+    #
+    # The chain of the longest interval on each nesting level.
+    #
+    Path     = []
+    Siblings = Roots
+    while Siblings:
+        Item = max (Siblings, key = lambda Item: Item.Duration)
+        Path.append (Item)
+        Siblings = Item.Children
+    return Path
+
+def SelfTimes (Intervals):
+    Totals = {}
+    for Item in Intervals:
+        Total = Totals.setdefault (Item.Name, [0, 0])
+        Total[0] += Item.SelfTime
+        Total[1] += 1
+    return Totals
+
+def TraceEvents (Intervals, Events, Names):
+    Trace = []
+    for Item in Intervals:
+        Trace.append ({
+            'name': Item.Name,
+            'cat':  Item.Category,
+            'ph':   'X',
+            'ts':   Item.Start / 1000.0,
+            'dur':  Item.Duration / 1000.0,
+            'pid':  0,
+            'tid':  0,
+            'args': {'guid': Item.Guid}
+            })
+    for Item in Events:
+        Trace.append ({
+            'name': Item.String or Names.get (Item.Guid, Item.Guid),
+            'cat':  'Event',
+            'ph':   'i',
+            's':    'g',
+            'ts':   Item.Timestamp / 1000.0,
+            'pid':  0,
+            'tid':  0,
+            'args': {'guid': Item.Guid, 'id': '0x%X' % Item.ProgressId}
+            })
+    return {'traceEvents': Trace, 'displayTimeUnit': 'ms'}
+
+def Analyze (File, Names):
+    Records, BasicBoot = LoadFile (File, Names)
+    Intervals, Events  = BuildIntervals (Records, Names)
+    Roots              = BuildTree (Intervals)
+    return Intervals, Events, Roots, BasicBoot
+
+if __name__ == '__main__':
+    #
+    # Create command line argument parser object
+    #
+    parser = argparse.ArgumentParser (prog = __prog__,
+                                      description = __description__ + __copyright__,
+                                      conflict_handler = 'resolve')
+    parser.add_argument ("InputFile", type = argparse.FileType ('rb'),
+                         help = "File written by the BootTimelineExport shell application, or a raw Boot Performance Table.")
+    parser.add_argument ("-o", "--output", dest = 'OutputFile', type = argparse.FileType ('w'),
+                         help = "Output filename for the Chrome trace-event JSON timeline.")
+    parser.add_argument ("-x", "--xref", dest = 'XrefFile', type = argparse.FileType ('r'), action = 'append', default = [],
+                         help = "Guid.xref file of the firmware build, used to name the modules.")
+    parser.add_argument ("-c", "--compare", dest = 'CompareFile', type = argparse.FileType ('rb'),
+                         help = "Exported file of a baseline boot. The self time difference of each module is reported.")
+    parser.add_argument ("-n", "--top", dest = 'Top', type = int, default = 20,
+                         help = "Number of modules to report. Default is 20.")
+    parser.add_argument ("-v", "--verbose", dest = 'Verbose', action = "store_true",
+                         help = "Increase output messages")
+
+    #
+    # Parse command line arguments
+    #
+    args = parser.parse_args ()
+
+    Names = {}
+    for XrefFile in args.XrefFile:
+        Names.update (ParseXrefFile (XrefFile))
+
+    try:
+        Intervals, Events, Roots, BasicBoot = Analyze (args.InputFile, Names)
+    except (ValueError, struct.error) as Error:
+        print ('FpdtTimeline: error: {Error}'.format (Error = Error))
+        sys.exit (1)
+
+    if args.Verbose:
+        print ('FpdtTimeline: {Intervals} intervals, {Events} unmatched or instant records'.format (Intervals = len (Intervals), Events = len (Events)))
+
+    if BasicBoot is not None:
+        print ('ResetEnd: {Time:.3f} ms, OsLoaderLoadImageStart: {Load:.3f} ms, OsLoaderStartImageStart: {Start:.3f} ms'.format (
+                 Time = BasicBoot[4] / 1e6, Load = BasicBoot[5] / 1e6, Start = BasicBoot[6] / 1e6))
+
+    print ('\nCritical path:')
+    for Depth, Item in enumerate (CriticalPath (Roots)):
+        print ('  {Indent}{Name} ({Category}): {Duration:.3f} ms'.format (
+                 Indent = '  ' * Depth, Name = Item.Name, Category = Item.Category, Duration = Item.Duration / 1e6))
+
+    Totals = SelfTimes (Intervals)
+    print ('\nSelf time:')
+    for Name, (Time, Count) in sorted (Totals.items (), key = lambda Item: -Item[1][0])[:args.Top]:
+        print ('  {Time:12.3f} ms {Count:6d}x  {Name}'.format (Time = Time / 1e6, Count = Count, Name = Name))
+
+    if args.CompareFile:
+        BaseIntervals, _, _, _ = Analyze (args.CompareFile, Names)
+        BaseTotals = SelfTimes (BaseIntervals)
+        Deltas = []
+        for Name in set (Totals) | set (BaseTotals):
+            Deltas.append ((Totals.get (Name, [0, 0])[0] - BaseTotals.get (Name, [0, 0])[0], Name))
+        print ('\nSelf time change against {File}:'.format (File = args.CompareFile.name))
+        for Delta, Name in sorted (Deltas, key = lambda Item: -abs (Item[0]))[:args.Top]:
+            print ('  {Delta:+12.3f} ms  {Name}'.format (Delta = Delta / 1e6, Name = Name))
+
+    if args.OutputFile:
+        json.dump (TraceEvents (Intervals, Events, Names), args.OutputFile, indent = 1)
@@ -0,0 +1,27 @@
+@REM @file
+@REM This script will exec LzmaCompress tool with --chunked option that splits
+@REM the data into chunks compressed independently, so they can be decompressed
+@REM in parallel.
+@REM
+@REM Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+@REM SPDX-License-Identifier: BSD-2-Clause-Patent
+@REM
+
+@echo off
+@setlocal
+
+:Begin
+if "%1"=="" goto End
+if "%1"=="-e" (
+  set FLAG=--chunked
+)
+if "%1"=="-d" (
+  set FLAG=--chunked
+)
+set ARGS=%ARGS% %1
+shift
+goto Begin
+
+:End
+LzmaCompress %ARGS% %FLAG%
+@echo on
@@ -22,11 +22,22 @@
 #include "Sdk/C/LzmaDec.h"
 #include "Sdk/C/LzmaEnc.h"
 #include "Sdk/C/Bra.h"
+#include "Sdk/C/CpuArch.h"
 #include "CommonLib.h"
 #include "ParseInf.h"
 
 #define LZMA_HEADER_SIZE (LZMA_PROPS_SIZE + 8)
 
+//
+// Chunked format, see LZMA_CHUNKED_HEADER in
+// MdeModulePkg/Include/Guid/LzmaDecompress.h: a header, the compressed size of
+// every chunk as a UInt32, then the chunks, each one a complete LZMA stream.
+//
+#define LZMA_CHUNKED_SIGNATURE    0x4B435A4C  // "LZCK"
+#define LZMA_CHUNKED_HEADER_SIZE  16
+#define DEFAULT_CHUNK_SIZE        (1 << 20)
+#define MIN_CHUNK_SIZE            (1 << 12)
+
 typedef enum {
   NoConverter,
   X86Converter,
@@ -41,9 +52,11 @@ const char *kInvalidParamValMessage = "Invalid parameter value";
 
 static BoolInt mQuietMode = False;
 static CONVERTER_TYPE mConType = NoConverter;
+static BoolInt mChunked = False;
 
 UINT64 mDictionarySize = 28;
 UINT64 mCompressionMode = 2;
+UINT64 mChunkSize = DEFAULT_CHUNK_SIZE;
 
 #define UTILITY_NAME "LzmaCompress"
 #define UTILITY_MAJOR_VERSION 0
@@ -60,6 +73,10 @@ void PrintHelp(char *buffer)
              "  -d: decode file\n"
              "  -o FileName, --output FileName: specify the output filename\n"
              "  --f86: enable converter for x86 code\n"
+             "  --chunked: split the data into chunks that are compressed independently,\n"
+             "             so they can be decompressed in parallel\n"
+             "  --chunk-size Size: set the size of a chunk in bytes, at least 4096,\n"
+             "                     default: 1048576 (1MB)\n"
              "  -v, --verbose: increase output messages\n"
              "  -q, --quiet: reduce output messages\n"
              "  --debug [0-9]: set debug level\n"
@@ -174,6 +191,95 @@ Done:
   return res;
 }
 
+static SRes EncodeChunked(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 fileSize, CLzmaEncProps *props)
+{
+  SRes res;
+  size_t inSize = (size_t)fileSize;
+  size_t chunkSize = (size_t)mChunkSize;
+  size_t chunkCount;
+  size_t chunkIndex;
+  size_t chunkOffset;
+  size_t chunkInSize;
+  Byte *inBuffer = 0;
+  Byte *outBuffer = 0;
+  Byte *chunk;
+  size_t outSize;
+  size_t outPos;
+
+  if (fileSize > 0xFFFFFFFF)
+    return SZ_ERROR_PARAM;
+
+  if (inSize != 0) {
+    inBuffer = (Byte *)MyAlloc(inSize);
+    if (inBuffer == 0)
+      return SZ_ERROR_MEM;
+  } else {
+    return SZ_ERROR_INPUT_EOF;
+  }
+
+  if (SeqInStream_Read(inStream, inBuffer, inSize) != SZ_OK) {
+    res = SZ_ERROR_READ;
+    goto Done;
+  }
+
+  chunkCount = inSize / chunkSize + (inSize % chunkSize != 0 ? 1 : 0);
+
+  // we allocate 105% of original size + 64KB for the output of every chunk
+  outSize = LZMA_CHUNKED_HEADER_SIZE + chunkCount * 4 +
+            inSize / 20 * 21 + chunkCount * (LZMA_HEADER_SIZE + (1 << 16));
+  outBuffer = (Byte *)MyAlloc(outSize);
+  if (outBuffer == 0) {
+    res = SZ_ERROR_MEM;
+    goto Done;
+  }
+
+  SetUi32(outBuffer, LZMA_CHUNKED_SIGNATURE);
+  SetUi32(outBuffer + 4, (UInt32)inSize);
+  SetUi32(outBuffer + 8, (UInt32)chunkSize);
+  SetUi32(outBuffer + 12, (UInt32)chunkCount);
+
+  //
+  // The dictionary does not need to be larger than a chunk.
+  //
+  props->reduceSize = chunkSize;
+
+  res = SZ_OK;
+  outPos = LZMA_CHUNKED_HEADER_SIZE + chunkCount * 4;
+  for (chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+    size_t outSizeProcessed;
+    size_t outPropsSize = LZMA_PROPS_SIZE;
+    int i;
+
+    chunkOffset = chunkIndex * chunkSize;
+    chunkInSize = inSize - chunkOffset < chunkSize ? inSize - chunkOffset : chunkSize;
+    chunk = outBuffer + outPos;
+
+    for (i = 0; i < 8; i++)
+      chunk[i + LZMA_PROPS_SIZE] = (Byte)((UInt64)chunkInSize >> (8 * i));
+
+    outSizeProcessed = outSize - outPos - LZMA_HEADER_SIZE;
+    res = LzmaEncode(chunk + LZMA_HEADER_SIZE, &outSizeProcessed,
+        inBuffer + chunkOffset, chunkInSize,
+        props, chunk, &outPropsSize, 0,
+        NULL, &g_Alloc, &g_Alloc);
+
+    if (res != SZ_OK)
+      goto Done;
+
+    SetUi32(outBuffer + LZMA_CHUNKED_HEADER_SIZE + chunkIndex * 4, (UInt32)(LZMA_HEADER_SIZE + outSizeProcessed));
+    outPos += LZMA_HEADER_SIZE + outSizeProcessed;
+  }
+
+  if (outStream->Write(outStream, outBuffer, outPos) != outPos)
+    res = SZ_ERROR_WRITE;
+
+Done:
+  MyFree(outBuffer);
+  MyFree(inBuffer);
+
+  return res;
+}
+
 static SRes Decode(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 fileSize)
 {
   SRes res;
@@ -238,6 +344,92 @@ Done:
   return res;
 }
 
+static SRes DecodeChunked(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 fileSize)
+{
+  SRes res;
+  size_t inSize = (size_t)fileSize;
+  Byte *inBuffer = 0;
+  Byte *outBuffer = 0;
+  size_t outSize;
+  size_t chunkSize;
+  size_t chunkCount;
+  size_t chunkIndex;
+  size_t inPos;
+  ELzmaStatus status;
+
+  if (inSize < LZMA_CHUNKED_HEADER_SIZE)
+    return SZ_ERROR_INPUT_EOF;
+
+  inBuffer = (Byte *)MyAlloc(inSize);
+  if (inBuffer == 0)
+    return SZ_ERROR_MEM;
+
+  if (SeqInStream_Read(inStream, inBuffer, inSize) != SZ_OK) {
+    res = SZ_ERROR_READ;
+    goto Done;
+  }
+
+  outSize = GetUi32(inBuffer + 4);
+  chunkSize = GetUi32(inBuffer + 8);
+  chunkCount = GetUi32(inBuffer + 12);
+  if (GetUi32(inBuffer) != LZMA_CHUNKED_SIGNATURE || chunkSize == 0 ||
+      chunkCount != outSize / chunkSize + (outSize % chunkSize != 0 ? 1 : 0) ||
+      (inSize - LZMA_CHUNKED_HEADER_SIZE) / 4 < chunkCount) {
+    res = SZ_ERROR_DATA;
+    goto Done;
+  }
+
+  if (outSize == 0) {
+    res = SZ_OK;
+    goto Done;
+  }
+
+  outBuffer = (Byte *)MyAlloc(outSize);
+  if (outBuffer == 0) {
+    res = SZ_ERROR_MEM;
+    goto Done;
+  }
+
+  res = SZ_OK;
+  inPos = LZMA_CHUNKED_HEADER_SIZE + chunkCount * 4;
+  for (chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+    size_t chunkInSize = GetUi32(inBuffer + LZMA_CHUNKED_HEADER_SIZE + chunkIndex * 4);
+    size_t chunkOutSize = outSize - chunkIndex * chunkSize < chunkSize ? outSize - chunkIndex * chunkSize : chunkSize;
+    size_t chunkOutProcessed = chunkOutSize;
+    size_t inSizePure;
+
+    if (chunkInSize < LZMA_HEADER_SIZE || chunkInSize > inSize - inPos ||
+        GetUi64(inBuffer + inPos + LZMA_PROPS_SIZE) != chunkOutSize) {
+      res = SZ_ERROR_DATA;
+      goto Done;
+    }
+
+    inSizePure = chunkInSize - LZMA_HEADER_SIZE;
+    res = LzmaDecode(outBuffer + chunkIndex * chunkSize, &chunkOutProcessed,
+        inBuffer + inPos + LZMA_HEADER_SIZE, &inSizePure,
+        inBuffer + inPos, LZMA_PROPS_SIZE, LZMA_FINISH_END, &status, &g_Alloc);
+
+    if (res != SZ_OK)
+      goto Done;
+
+    if (chunkOutProcessed != chunkOutSize) {
+      res = SZ_ERROR_DATA;
+      goto Done;
+    }
+
+    inPos += chunkInSize;
+  }
+
+  if (outStream->Write(outStream, outBuffer, outSize) != outSize)
+    res = SZ_ERROR_WRITE;
+
+Done:
+  MyFree(outBuffer);
+  MyFree(inBuffer);
+
+  return res;
+}
+
 int main2(int numArgs, const char *args[], char *rs)
 {
   CFileSeqInStream inStream;
@@ -272,6 +464,16 @@ int main2(int numArgs, const char *args[], char *rs)
       modeWasSet = True;
     } else if (strcmp(args[param], "--f86") == 0) {
       mConType = X86Converter;
+    } else if (strcmp(args[param], "--chunked") == 0) {
+      mChunked = True;
+    } else if (strcmp(args[param], "--chunk-size") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (AsciiStringToUint64(args[++param], FALSE, &mChunkSize) != EFI_SUCCESS ||
+          mChunkSize < MIN_CHUNK_SIZE || mChunkSize > 0xFFFFFFFF) {
+        return PrintError(rs, kInvalidParamValMessage);
+      }
     } else if (strcmp(args[param], "-o") == 0 ||
                strcmp(args[param], "--output") == 0) {
       if (numArgs < (param + 2)) {
@@ -342,6 +544,10 @@ int main2(int numArgs, const char *args[], char *rs)
     return PrintUserError(rs);
   }
 
+  if (mChunked && (mConType != NoConverter)) {
+    return PrintError(rs, "--f86 cannot be used with --chunked");
+  }
+
   {
     size_t t4 = sizeof(UInt32);
     size_t t8 = sizeof(UInt64);
@@ -364,14 +570,22 @@ int main2(int numArgs, const char *args[], char *rs)
     if (!mQuietMode) {
       printf("Encoding\n");
     }
-    res = Encode(&outStream.vt, &inStream.vt, fileSize, &props);
+    if (mChunked) {
+      res = EncodeChunked(&outStream.vt, &inStream.vt, fileSize, &props);
+    } else {
+      res = Encode(&outStream.vt, &inStream.vt, fileSize, &props);
+    }
   }
   else
   {
     if (!mQuietMode) {
       printf("Decoding\n");
     }
-    res = Decode(&outStream.vt, &inStream.vt, fileSize);
+    if (mChunked) {
+      res = DecodeChunked(&outStream.vt, &inStream.vt, fileSize);
+    } else {
+      res = Decode(&outStream.vt, &inStream.vt, fileSize);
+    }
   }
 
   File_Close(&outStream.file);
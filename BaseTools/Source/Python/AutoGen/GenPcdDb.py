@@ -20,7 +20,7 @@ from Common import GlobalData
 from Common import EdkLogger
 import Common.LongFilePathOs as os
 
-DATABASE_VERSION = 7
+DATABASE_VERSION = 8
 
 gPcdDatabaseAutoGenC = TemplateString("""
 //
@@ -1504,6 +1504,20 @@ def CreatePcdDatabasePhaseSpecificAutoGen (Platform, DynamicPcdList, Phase):
             Dict['EXMAPPING_TABLE_LOCAL_TOKEN'].append(str(GeneratedTokenNumber + 1) + 'U')
             Dict['EXMAPPING_TABLE_GUID_INDEX'].append(str(GuidList.index(TokenSpaceGuid)) + 'U')
 
+    #
+    # Sort the EXMAPPING_TABLE by token space GUID index and then by EX token number,
+    # so that the PCD Driver/PEIM can binary search a dynamic-ex PCD with its
+    # (EX_GUID, EX_TOKEN_NUMBER) pair instead of scanning the whole table.
+    #
+    if Dict['EXMAPPING_TABLE_EXTOKEN']:
+        ExMapping = sorted(
+                        zip(Dict['EXMAPPING_TABLE_EXTOKEN'], Dict['EXMAPPING_TABLE_LOCAL_TOKEN'], Dict['EXMAPPING_TABLE_GUID_INDEX']),
+                        key = lambda Item: (GetIntegerValue(Item[2]), GetIntegerValue(Item[0]))
+                        )
+        Dict['EXMAPPING_TABLE_EXTOKEN']     = [Item[0] for Item in ExMapping]
+        Dict['EXMAPPING_TABLE_LOCAL_TOKEN'] = [Item[1] for Item in ExMapping]
+        Dict['EXMAPPING_TABLE_GUID_INDEX']  = [Item[2] for Item in ExMapping]
+
     if Platform.Platform.PcdInfoFlag:
         for index in range(len(Dict['PCD_TOKENSPACE_MAP'])):
             TokenSpaceIndex = StringTableSize
@@ -80,17 +80,22 @@ typedef struct {
   } Md5;
   union {
     struct {
-      UINT8    Pkcs1v2Encrypt             : 1;
-      UINT8    Pkcs5HashPassword          : 1;
-      UINT8    Pkcs7Verify                : 1;
-      UINT8    VerifyEKUsInPkcs7Signature : 1;
-      UINT8    Pkcs7GetSigners            : 1;
-      UINT8    Pkcs7FreeSigners           : 1;
-      UINT8    Pkcs7Sign                  : 1;
-      UINT8    Pkcs7GetAttachedContent    : 1;
-      UINT8    Pkcs7GetCertificatesList   : 1;
-      UINT8    AuthenticodeVerify         : 1;
-      UINT8    ImageTimestampVerify       : 1;
+      UINT8    Pkcs1v2Encrypt                : 1;
+      UINT8    Pkcs5HashPassword             : 1;
+      UINT8    Pkcs7Verify                   : 1;
+      UINT8    VerifyEKUsInPkcs7Signature    : 1;
+      UINT8    Pkcs7GetSigners               : 1;
+      UINT8    Pkcs7FreeSigners              : 1;
+      UINT8    Pkcs7Sign                     : 1;
+      UINT8    Pkcs7GetAttachedContent       : 1;
+      UINT8    Pkcs7GetCertificatesList      : 1;
+      UINT8    AuthenticodeVerify            : 1;
+      UINT8    ImageTimestampVerify          : 1;
+      UINT8    Pkcs7VerifyContextNew         : 1;
+      UINT8    Pkcs7VerifyContextAddCert     : 1;
+      UINT8    Pkcs7VerifyContextFree        : 1;
+      UINT8    Pkcs7VerifyWithContext        : 1;
+      UINT8    AuthenticodeVerifyWithContext : 1;
     } Services;
     UINT32    Family;
   } Pkcs;
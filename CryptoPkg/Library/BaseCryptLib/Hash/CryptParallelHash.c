@@ -7,87 +7,43 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
 #include "CryptParallelHash.h"
-#include <Library/MmServicesTableLib.h>
-#include <Library/SynchronizationLib.h>
+#include <Library/MpWorkQueueLib.h>
 
 #define PARALLELHASH_CUSTOMIZATION  "ParallelHash"
 
-UINTN      mBlockNum;
-UINTN      mBlockSize;
-UINTN      mLastBlockSize;
-UINT8      *mInput;
-UINTN      mBlockResultSize;
-UINT8      *mBlockHashResult;
-BOOLEAN    *mBlockIsCompleted;
-SPIN_LOCK  *mSpinLockList;
+UINTN    mBlockNum;
+UINTN    mBlockSize;
+UINTN    mLastBlockSize;
+UINT8    *mInput;
+UINTN    mBlockResultSize;
+UINT8    *mBlockHashResult;
+BOOLEAN  *mBlockIsCompleted;
 
 /**
-  Complete computation of digest of each block.
+  Complete computation of digest of one block.
 
-  Each AP perform the function called by BSP.
+  It is executed by the BSP and by the APs, through MpWorkQueueRun().
 
-  @param[in] ProcedureArgument Argument of the procedure.
+  @param[in] Context  Not used.
+  @param[in] Index    Index of the block.
 **/
 VOID
 EFIAPI
-ParallelHashApExecute (
-  IN VOID  *ProcedureArgument
+ParallelHashBlock (
+  IN VOID   *Context,
+  IN UINTN  Index
   )
 {
-  UINTN    Index;
-  BOOLEAN  Status;
-
-  for (Index = 0; Index < mBlockNum; Index++) {
-    if (AcquireSpinLockOrFail (&mSpinLockList[Index])) {
-      //
-      // Completed, try next one.
-      //
-      if (mBlockIsCompleted[Index]) {
-        ReleaseSpinLock (&mSpinLockList[Index]);
-        continue;
-      }
-
-      //
-      // Calculate CShake256 for this block.
-      //
-      Status = CShake256HashAll (
-                 mInput + Index * mBlockSize,
-                 (Index == (mBlockNum - 1)) ? mLastBlockSize : mBlockSize,
-                 mBlockResultSize,
-                 NULL,
-                 0,
-                 NULL,
-                 0,
-                 mBlockHashResult + Index * mBlockResultSize
-                 );
-      if (!EFI_ERROR (Status)) {
-        mBlockIsCompleted[Index] = TRUE;
-      }
-
-      ReleaseSpinLock (&mSpinLockList[Index]);
-    }
-  }
-}
-
-/**
-  Dispatch the block task to each AP in SMM mode.
-
-**/
-VOID
-EFIAPI
-MmDispatchBlockToAP (
-  VOID
-  )
-{
-  UINTN  Index;
-
-  for (Index = 0; Index < gMmst->NumberOfCpus; Index++) {
-    if (Index != gMmst->CurrentlyExecutingCpu) {
-      gMmst->MmStartupThisAp (ParallelHashApExecute, Index, NULL);
-    }
-  }
-
-  return;
+  mBlockIsCompleted[Index] = CShake256HashAll (
+                               mInput + Index * mBlockSize,
+                               (Index == (mBlockNum - 1)) ? mLastBlockSize : mBlockSize,
+                               mBlockResultSize,
+                               NULL,
+                               0,
+                               NULL,
+                               0,
+                               mBlockHashResult + Index * mBlockResultSize
+                               );
 }
 
 /**
@@ -128,7 +84,6 @@ ParallelHash256HashAll (
   UINTN    Index;
   UINT8    *CombinedInput;
   UINTN    CombinedInputSize;
-  BOOLEAN  AllCompleted;
   UINTN    Offset;
   BOOLEAN  ReturnValue;
 
@@ -164,13 +119,12 @@ ParallelHash256HashAll (
   EncSizeL = RightEncode (EncBufL, OutputByteLen * CHAR_BIT);
 
   //
-  // Allocate buffer for combined input (newX), Block completed flag and SpinLock.
+  // Allocate buffer for combined input (newX) and Block completed flag.
   //
   CombinedInputSize = EncSizeB + EncSizeN + EncSizeL + mBlockNum * mBlockResultSize;
   CombinedInput     = AllocateZeroPool (CombinedInputSize);
   mBlockIsCompleted = AllocateZeroPool (mBlockNum * sizeof (BOOLEAN));
-  mSpinLockList     = AllocatePool (mBlockNum * sizeof (SPIN_LOCK));
-  if ((CombinedInput == NULL) || (mBlockIsCompleted == NULL) || (mSpinLockList == NULL)) {
+  if ((CombinedInput == NULL) || (mBlockIsCompleted == NULL)) {
     ReturnValue = FALSE;
     goto Exit;
   }
@@ -188,53 +142,19 @@ ParallelHash256HashAll (
   mLastBlockSize   = InputByteLen % mBlockSize == 0 ? mBlockSize : InputByteLen % mBlockSize;
 
   //
-  // Initialize SpinLock for each result block.
+  // Share the blocks between the BSP and the APs.
   //
-  for (Index = 0; Index < mBlockNum; Index++) {
-    InitializeSpinLock (&mSpinLockList[Index]);
-  }
-
-  //
-  // Dispatch blocklist to each AP.
-  //
-  if (gMmst != NULL) {
-    MmDispatchBlockToAP ();
+  if (RETURN_ERROR (MpWorkQueueRun (ParallelHashBlock, NULL, mBlockNum, 0))) {
+    ReturnValue = FALSE;
+    goto Exit;
   }
 
-  //
-  // Wait until all block hash completed.
-  //
-  do {
-    AllCompleted = TRUE;
-    for (Index = 0; Index < mBlockNum; Index++) {
-      if (AcquireSpinLockOrFail (&mSpinLockList[Index])) {
-        if (!mBlockIsCompleted[Index]) {
-          AllCompleted = FALSE;
-          ReturnValue  = CShake256HashAll (
-                           mInput + Index * mBlockSize,
-                           (Index == (mBlockNum - 1)) ? mLastBlockSize : mBlockSize,
-                           mBlockResultSize,
-                           NULL,
-                           0,
-                           NULL,
-                           0,
-                           mBlockHashResult + Index * mBlockResultSize
-                           );
-          if (ReturnValue) {
-            mBlockIsCompleted[Index] = TRUE;
-          }
-
-          ReleaseSpinLock (&mSpinLockList[Index]);
-          break;
-        }
-
-        ReleaseSpinLock (&mSpinLockList[Index]);
-      } else {
-        AllCompleted = FALSE;
-        break;
-      }
+  for (Index = 0; Index < mBlockNum; Index++) {
+    if (!mBlockIsCompleted[Index]) {
+      ReturnValue = FALSE;
+      goto Exit;
     }
-  } while (!AllCompleted);
+  }
 
   //
   // Fill LeftEncode(n).
@@ -266,10 +186,6 @@ Exit:
     FreePool (CombinedInput);
   }
 
-  if (mSpinLockList != NULL) {
-    FreePool ((VOID *)mSpinLockList);
-  }
-
   if (mBlockIsCompleted != NULL) {
     FreePool (mBlockIsCompleted);
   }
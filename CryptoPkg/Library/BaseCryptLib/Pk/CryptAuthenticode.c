@@ -6,8 +6,8 @@
   This external input must be validated carefully to avoid security issue like
   buffer overflow, integer overflow.
 
-  AuthenticodeVerify() will get PE/COFF Authenticode and will do basic check for
-  data structure.
+  AuthenticodeVerify() and AuthenticodeVerifyWithContext() will get PE/COFF
+  Authenticode and will do basic check for data structure.
 
 Copyright (c) 2011 - 2020, Intel Corporation. All rights reserved.<BR>
 SPDX-License-Identifier: BSD-2-Clause-Patent
@@ -29,9 +29,11 @@ UINT8  mSpcIndirectOidValue[] = {
 
 /**
   Verifies the validity of a PE/COFF Authenticode Signature as described in "Windows
-  Authenticode Portable Executable Signature Format".
+  Authenticode Portable Executable Signature Format", against the trusted
+  certificates of a PKCS#7 verification context.
 
   If AuthData is NULL, then return FALSE.
+  If Context is NULL, then return FALSE.
   If ImageHash is NULL, then return FALSE.
 
   Caution: This function may receive untrusted input.
@@ -41,9 +43,8 @@ UINT8  mSpcIndirectOidValue[] = {
   @param[in]  AuthData     Pointer to the Authenticode Signature retrieved from signed
                            PE/COFF image to be verified.
   @param[in]  DataSize     Size of the Authenticode Signature in bytes.
-  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
-                           is used for certificate chain verification.
-  @param[in]  CertSize     Size of the trusted certificate in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates, created by Pkcs7VerifyContextNew().
   @param[in]  ImageHash    Pointer to the original image file hash value. The procedure
                            for calculating the image hash value is described in Authenticode
                            specification.
@@ -55,11 +56,10 @@ UINT8  mSpcIndirectOidValue[] = {
 **/
 BOOLEAN
 EFIAPI
-AuthenticodeVerify (
+AuthenticodeVerifyWithContext (
   IN  CONST UINT8  *AuthData,
   IN  UINTN        DataSize,
-  IN  CONST UINT8  *TrustedCert,
-  IN  UINTN        CertSize,
+  IN  CONST VOID   *Context,
   IN  CONST UINT8  *ImageHash,
   IN  UINTN        HashSize
   )
@@ -76,11 +76,11 @@ AuthenticodeVerify (
   //
   // Check input parameters.
   //
-  if ((AuthData == NULL) || (TrustedCert == NULL) || (ImageHash == NULL)) {
+  if ((AuthData == NULL) || (Context == NULL) || (ImageHash == NULL)) {
     return FALSE;
   }
 
-  if ((DataSize > INT_MAX) || (CertSize > INT_MAX) || (HashSize > INT_MAX)) {
+  if ((DataSize > INT_MAX) || (HashSize > INT_MAX)) {
     return FALSE;
   }
 
@@ -177,7 +177,7 @@ AuthenticodeVerify (
   //
   // Verifies the PKCS#7 Signed Data in PE/COFF Authenticode Signature
   //
-  Status = (BOOLEAN)Pkcs7Verify (OrigAuthData, DataSize, TrustedCert, CertSize, SpcIndirectDataContent, ContentSize);
+  Status = (BOOLEAN)Pkcs7VerifyWithContext (OrigAuthData, DataSize, Context, SpcIndirectDataContent, ContentSize);
 
 _Exit:
   //
@@ -187,3 +187,69 @@ _Exit:
 
   return Status;
 }
+
+/**
+  Verifies the validity of a PE/COFF Authenticode Signature as described in "Windows
+  Authenticode Portable Executable Signature Format".
+
+  If AuthData is NULL, then return FALSE.
+  If ImageHash is NULL, then return FALSE.
+
+  Caution: This function may receive untrusted input.
+  PE/COFF Authenticode is external input, so this function will do basic check for
+  Authenticode data structure.
+
+  @param[in]  AuthData     Pointer to the Authenticode Signature retrieved from signed
+                           PE/COFF image to be verified.
+  @param[in]  DataSize     Size of the Authenticode Signature in bytes.
+  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                           is used for certificate chain verification.
+  @param[in]  CertSize     Size of the trusted certificate in bytes.
+  @param[in]  ImageHash    Pointer to the original image file hash value. The procedure
+                           for calculating the image hash value is described in Authenticode
+                           specification.
+  @param[in]  HashSize     Size of Image hash value in bytes.
+
+  @retval  TRUE   The specified Authenticode Signature is valid.
+  @retval  FALSE  Invalid Authenticode Signature.
+
+**/
+BOOLEAN
+EFIAPI
+AuthenticodeVerify (
+  IN  CONST UINT8  *AuthData,
+  IN  UINTN        DataSize,
+  IN  CONST UINT8  *TrustedCert,
+  IN  UINTN        CertSize,
+  IN  CONST UINT8  *ImageHash,
+  IN  UINTN        HashSize
+  )
+{
+  VOID     *Context;
+  BOOLEAN  Status;
+
+  //
+  // Check input parameters.
+  //
+  if ((AuthData == NULL) || (TrustedCert == NULL) || (ImageHash == NULL)) {
+    return FALSE;
+  }
+
+  if ((DataSize > INT_MAX) || (CertSize > INT_MAX) || (HashSize > INT_MAX)) {
+    return FALSE;
+  }
+
+  Context = Pkcs7VerifyContextNew ();
+  if (Context == NULL) {
+    return FALSE;
+  }
+
+  Status = FALSE;
+  if (Pkcs7VerifyContextAddCert (Context, TrustedCert, CertSize)) {
+    Status = AuthenticodeVerifyWithContext (AuthData, DataSize, Context, ImageHash, HashSize);
+  }
+
+  Pkcs7VerifyContextFree (Context);
+
+  return Status;
+}
@@ -7,8 +7,8 @@
   This external input must be validated carefully to avoid security issue like
   buffer overflow, integer overflow.
 
-  WrapPkcs7Data(), Pkcs7GetSigners(), Pkcs7Verify() will get UEFI Authenticated
-  Variable and will do basic check for data structure.
+  WrapPkcs7Data(), Pkcs7GetSigners(), Pkcs7Verify(), Pkcs7VerifyWithContext()
+  will get UEFI Authenticated Variable and will do basic check for data structure.
 
 Copyright (c) 2009 - 2019, Intel Corporation. All rights reserved.<BR>
 SPDX-License-Identifier: BSD-2-Clause-Patent
@@ -748,13 +748,129 @@ _Error:
   return Status;
 }
 
+/**
+  Allocates and initializes one PKCS#7 verification context, which holds a set
+  of trusted certificates for Pkcs7VerifyWithContext() and
+  AuthenticodeVerifyWithContext().
+
+  The trusted certificates are decoded once, when they are added to the context,
+  so a context should be kept for as long as the set of trusted certificates is
+  used for verification.
+
+  @return  Pointer to the PKCS#7 verification context that has been initialized.
+           If the allocations fails, Pkcs7VerifyContextNew() returns NULL.
+
+**/
+VOID *
+EFIAPI
+Pkcs7VerifyContextNew (
+  VOID
+  )
+{
+  X509_STORE  *CertStore;
+
+  //
+  // Setup X509 Store for trusted certificates
+  //
+  CertStore = X509_STORE_new ();
+  if (CertStore == NULL) {
+    return NULL;
+  }
+
+  //
+  // Allow partial certificate chains, terminated by a non-self-signed but
+  // still trusted intermediate certificate. Also disable time checks.
+  //
+  X509_STORE_set_flags (
+    CertStore,
+    X509_V_FLAG_PARTIAL_CHAIN | X509_V_FLAG_NO_CHECK_TIME
+    );
+
+  //
+  // OpenSSL PKCS7 Verification by default checks for SMIME (email signing) and
+  // doesn't support the extended key usage for Authenticode Code Signing.
+  // Bypass the certificate purpose checking by enabling any purposes setting.
+  //
+  X509_STORE_set_purpose (CertStore, X509_PURPOSE_ANY);
+
+  return (VOID *)CertStore;
+}
+
+/**
+  Adds a trusted/root certificate to a PKCS#7 verification context.
+
+  If Context or TrustedCert is NULL, then return FALSE.
+  If CertLength overflow, then return FALSE.
+
+  @param[in, out]  Context      Pointer to the PKCS#7 verification context.
+  @param[in]       TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                                is used for certificate chain verification.
+  @param[in]       CertLength   Length of the trusted certificate in bytes.
+
+  @retval  TRUE   The trusted certificate was added to the context.
+  @retval  FALSE  Invalid certificate, or the context cannot hold it.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyContextAddCert (
+  IN OUT  VOID         *Context,
+  IN      CONST UINT8  *TrustedCert,
+  IN      UINTN        CertLength
+  )
+{
+  X509         *Cert;
+  CONST UINT8  *Temp;
+  BOOLEAN      Status;
+
+  if ((Context == NULL) || (TrustedCert == NULL) || (CertLength > INT_MAX)) {
+    return FALSE;
+  }
+
+  //
+  // Read DER-encoded root certificate and Construct X509 Certificate
+  //
+  Temp = TrustedCert;
+  Cert = d2i_X509 (NULL, &Temp, (long)CertLength);
+  if (Cert == NULL) {
+    return FALSE;
+  }
+
+  //
+  // The store takes its own reference on the certificate.
+  //
+  Status = (BOOLEAN)X509_STORE_add_cert ((X509_STORE *)Context, Cert);
+  X509_free (Cert);
+
+  return Status;
+}
+
+/**
+  Release the specified PKCS#7 verification context.
+
+  @param[in]  Context  Pointer to the PKCS#7 verification context to be released.
+
+**/
+VOID
+EFIAPI
+Pkcs7VerifyContextFree (
+  IN  VOID  *Context
+  )
+{
+  X509_STORE_free ((X509_STORE *)Context);
+}
+
 /**
   Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
-  Cryptographic Message Syntax Standard". The input signed data could be wrapped
-  in a ContentInfo structure.
+  Cryptographic Message Syntax Standard", against the trusted certificates of a
+  PKCS#7 verification context. The input signed data could be wrapped in a
+  ContentInfo structure.
 
-  If P7Data, TrustedCert or InData is NULL, then return FALSE.
-  If P7Length, CertLength or DataLength overflow, then return FALSE.
+  The signed data is valid if its certificate chain ends with any of the
+  trusted certificates of the context.
+
+  If P7Data, Context or InData is NULL, then return FALSE.
+  If P7Length or DataLength overflow, then return FALSE.
 
   Caution: This function may receive untrusted input.
   UEFI Authenticated Variable is external input, so this function will do basic
@@ -762,9 +878,8 @@ _Error:
 
   @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
   @param[in]  P7Length     Length of the PKCS#7 message in bytes.
-  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
-                           is used for certificate chain verification.
-  @param[in]  CertLength   Length of the trusted certificate in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates.
   @param[in]  InData       Pointer to the content to be verified.
   @param[in]  DataLength   Length of InData in bytes.
 
@@ -774,11 +889,10 @@ _Error:
 **/
 BOOLEAN
 EFIAPI
-Pkcs7Verify (
+Pkcs7VerifyWithContext (
   IN  CONST UINT8  *P7Data,
   IN  UINTN        P7Length,
-  IN  CONST UINT8  *TrustedCert,
-  IN  UINTN        CertLength,
+  IN  CONST VOID   *Context,
   IN  CONST UINT8  *InData,
   IN  UINTN        DataLength
   )
@@ -786,8 +900,6 @@ Pkcs7Verify (
   PKCS7        *Pkcs7;
   BIO          *DataBio;
   BOOLEAN      Status;
-  X509         *Cert;
-  X509_STORE   *CertStore;
   UINT8        *SignedData;
   CONST UINT8  *Temp;
   UINTN        SignedDataSize;
@@ -796,16 +908,14 @@ Pkcs7Verify (
   //
   // Check input parameters.
   //
-  if ((P7Data == NULL) || (TrustedCert == NULL) || (InData == NULL) ||
-      (P7Length > INT_MAX) || (CertLength > INT_MAX) || (DataLength > INT_MAX))
+  if ((P7Data == NULL) || (Context == NULL) || (InData == NULL) ||
+      (P7Length > INT_MAX) || (DataLength > INT_MAX))
   {
     return FALSE;
   }
 
-  Pkcs7     = NULL;
-  DataBio   = NULL;
-  Cert      = NULL;
-  CertStore = NULL;
+  Pkcs7   = NULL;
+  DataBio = NULL;
 
   //
   // Register & Initialize necessary digest algorithms for PKCS#7 Handling
@@ -861,27 +971,6 @@ Pkcs7Verify (
     goto _Exit;
   }
 
-  //
-  // Read DER-encoded root certificate and Construct X509 Certificate
-  //
-  Temp = TrustedCert;
-  Cert = d2i_X509 (NULL, &Temp, (long)CertLength);
-  if (Cert == NULL) {
-    goto _Exit;
-  }
-
-  //
-  // Setup X509 Store for trusted certificate
-  //
-  CertStore = X509_STORE_new ();
-  if (CertStore == NULL) {
-    goto _Exit;
-  }
-
-  if (!(X509_STORE_add_cert (CertStore, Cert))) {
-    goto _Exit;
-  }
-
   //
   // For generic PKCS#7 handling, InData may be NULL if the content is present
   // in PKCS#7 structure. So ignore NULL checking here.
@@ -891,34 +980,16 @@ Pkcs7Verify (
     goto _Exit;
   }
 
-  //
-  // Allow partial certificate chains, terminated by a non-self-signed but
-  // still trusted intermediate certificate. Also disable time checks.
-  //
-  X509_STORE_set_flags (
-    CertStore,
-    X509_V_FLAG_PARTIAL_CHAIN | X509_V_FLAG_NO_CHECK_TIME
-    );
-
-  //
-  // OpenSSL PKCS7 Verification by default checks for SMIME (email signing) and
-  // doesn't support the extended key usage for Authenticode Code Signing.
-  // Bypass the certificate purpose checking by enabling any purposes setting.
-  //
-  X509_STORE_set_purpose (CertStore, X509_PURPOSE_ANY);
-
   //
   // Verifies the PKCS#7 signedData structure
   //
-  Status = (BOOLEAN)PKCS7_verify (Pkcs7, NULL, CertStore, DataBio, NULL, PKCS7_BINARY);
+  Status = (BOOLEAN)PKCS7_verify (Pkcs7, NULL, (X509_STORE *)Context, DataBio, NULL, PKCS7_BINARY);
 
 _Exit:
   //
   // Release Resources
   //
   BIO_free (DataBio);
-  X509_free (Cert);
-  X509_STORE_free (CertStore);
   PKCS7_free (Pkcs7);
 
   if (!Wrapped) {
@@ -927,3 +998,65 @@ _Exit:
 
   return Status;
 }
+
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard". The input signed data could be wrapped
+  in a ContentInfo structure.
+
+  If P7Data, TrustedCert or InData is NULL, then return FALSE.
+  If P7Length, CertLength or DataLength overflow, then return FALSE.
+
+  Caution: This function may receive untrusted input.
+  UEFI Authenticated Variable is external input, so this function will do basic
+  check for PKCS#7 data structure.
+
+  @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length     Length of the PKCS#7 message in bytes.
+  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                           is used for certificate chain verification.
+  @param[in]  CertLength   Length of the trusted certificate in bytes.
+  @param[in]  InData       Pointer to the content to be verified.
+  @param[in]  DataLength   Length of InData in bytes.
+
+  @retval  TRUE  The specified PKCS#7 signed data is valid.
+  @retval  FALSE Invalid PKCS#7 signed data.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7Verify (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  CONST UINT8  *TrustedCert,
+  IN  UINTN        CertLength,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  VOID     *Context;
+  BOOLEAN  Status;
+
+  //
+  // Check input parameters.
+  //
+  if ((P7Data == NULL) || (TrustedCert == NULL) || (InData == NULL) ||
+      (P7Length > INT_MAX) || (CertLength > INT_MAX) || (DataLength > INT_MAX))
+  {
+    return FALSE;
+  }
+
+  Context = Pkcs7VerifyContextNew ();
+  if (Context == NULL) {
+    return FALSE;
+  }
+
+  Status = FALSE;
+  if (Pkcs7VerifyContextAddCert (Context, TrustedCert, CertLength)) {
+    Status = Pkcs7VerifyWithContext (P7Data, P7Length, Context, InData, DataLength);
+  }
+
+  Pkcs7VerifyContextFree (Context);
+
+  return Status;
+}
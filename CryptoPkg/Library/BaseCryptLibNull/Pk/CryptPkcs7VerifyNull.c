@@ -133,6 +133,95 @@ Pkcs7Verify (
   return FALSE;
 }
 
+/**
+  Allocates and initializes one PKCS#7 verification context, which holds a set
+  of trusted certificates.
+
+  Return NULL to indicate this interface is not supported.
+
+  @retval NULL  This interface is not supported.
+
+**/
+VOID *
+EFIAPI
+Pkcs7VerifyContextNew (
+  VOID
+  )
+{
+  ASSERT (FALSE);
+  return NULL;
+}
+
+/**
+  Adds a trusted/root certificate to a PKCS#7 verification context.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in, out]  Context      Pointer to the PKCS#7 verification context.
+  @param[in]       TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                                is used for certificate chain verification.
+  @param[in]       CertLength   Length of the trusted certificate in bytes.
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyContextAddCert (
+  IN OUT  VOID         *Context,
+  IN      CONST UINT8  *TrustedCert,
+  IN      UINTN        CertLength
+  )
+{
+  ASSERT (FALSE);
+  return FALSE;
+}
+
+/**
+  Release the specified PKCS#7 verification context.
+
+  @param[in]  Context  Pointer to the PKCS#7 verification context to be released.
+
+**/
+VOID
+EFIAPI
+Pkcs7VerifyContextFree (
+  IN  VOID  *Context
+  )
+{
+  ASSERT (FALSE);
+}
+
+/**
+  Verifies the validity of a PKCS#7 signed data against the trusted certificates
+  of a PKCS#7 verification context.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length     Length of the PKCS#7 message in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates.
+  @param[in]  InData       Pointer to the content to be verified.
+  @param[in]  DataLength   Length of InData in bytes.
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyWithContext (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  CONST VOID   *Context,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  ASSERT (FALSE);
+  return FALSE;
+}
+
 /**
   Extracts the attached content from a PKCS#7 signed data if existed. The input signed
   data could be wrapped in a ContentInfo structure.
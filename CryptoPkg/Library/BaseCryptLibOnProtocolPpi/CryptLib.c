@@ -2278,6 +2278,114 @@ Pkcs7Verify (
   CALL_CRYPTO_SERVICE (Pkcs7Verify, (P7Data, P7Length, TrustedCert, CertLength, InData, DataLength), FALSE);
 }
 
+/**
+  Allocates and initializes one PKCS#7 verification context, which holds a set
+  of trusted certificates for Pkcs7VerifyWithContext() and
+  AuthenticodeVerifyWithContext().
+
+  The trusted certificates are decoded once, when they are added to the context,
+  so a context should be kept for as long as the set of trusted certificates is
+  used for verification.
+
+  If this interface is not supported, then return NULL.
+
+  @return  Pointer to the PKCS#7 verification context that has been initialized.
+           If the allocations fails, Pkcs7VerifyContextNew() returns NULL.
+  @retval  NULL  This interface is not supported.
+
+**/
+VOID *
+EFIAPI
+Pkcs7VerifyContextNew (
+  VOID
+  )
+{
+  CALL_CRYPTO_SERVICE (Pkcs7VerifyContextNew, (), NULL);
+}
+
+/**
+  Adds a trusted/root certificate to a PKCS#7 verification context.
+
+  If Context or TrustedCert is NULL, then return FALSE.
+  If CertLength overflow, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in, out]  Context      Pointer to the PKCS#7 verification context.
+  @param[in]       TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                                is used for certificate chain verification.
+  @param[in]       CertLength   Length of the trusted certificate in bytes.
+
+  @retval  TRUE   The trusted certificate was added to the context.
+  @retval  FALSE  Invalid certificate, or the context cannot hold it.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyContextAddCert (
+  IN OUT  VOID         *Context,
+  IN      CONST UINT8  *TrustedCert,
+  IN      UINTN        CertLength
+  )
+{
+  CALL_CRYPTO_SERVICE (Pkcs7VerifyContextAddCert, (Context, TrustedCert, CertLength), FALSE);
+}
+
+/**
+  Release the specified PKCS#7 verification context.
+
+  If this interface is not supported, then ASSERT().
+
+  @param[in]  Context  Pointer to the PKCS#7 verification context to be released.
+
+**/
+VOID
+EFIAPI
+Pkcs7VerifyContextFree (
+  IN  VOID  *Context
+  )
+{
+  CALL_VOID_CRYPTO_SERVICE (Pkcs7VerifyContextFree, (Context));
+}
+
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard", against the trusted certificates of a
+  PKCS#7 verification context. The input signed data could be wrapped in a
+  ContentInfo structure.
+
+  The signed data is valid if its certificate chain ends with any of the
+  trusted certificates of the context.
+
+  If P7Data, Context or InData is NULL, then return FALSE.
+  If P7Length or DataLength overflow, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length     Length of the PKCS#7 message in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates.
+  @param[in]  InData       Pointer to the content to be verified.
+  @param[in]  DataLength   Length of InData in bytes.
+
+  @retval  TRUE  The specified PKCS#7 signed data is valid.
+  @retval  FALSE Invalid PKCS#7 signed data.
+  @retval  FALSE This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyWithContext (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  CONST VOID   *Context,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  CALL_CRYPTO_SERVICE (Pkcs7VerifyWithContext, (P7Data, P7Length, Context, InData, DataLength), FALSE);
+}
+
 /**
   This function receives a PKCS7 formatted signature, and then verifies that
   the specified Enhanced or Extended Key Usages (EKU's) are present in the end-entity
@@ -2393,6 +2501,44 @@ AuthenticodeVerify (
   CALL_CRYPTO_SERVICE (AuthenticodeVerify, (AuthData, DataSize, TrustedCert, CertSize, ImageHash, HashSize), FALSE);
 }
 
+/**
+  Verifies the validity of a PE/COFF Authenticode Signature as described in "Windows
+  Authenticode Portable Executable Signature Format", against the trusted
+  certificates of a PKCS#7 verification context.
+
+  If AuthData is NULL, then return FALSE.
+  If Context is NULL, then return FALSE.
+  If ImageHash is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]  AuthData     Pointer to the Authenticode Signature retrieved from signed
+                           PE/COFF image to be verified.
+  @param[in]  DataSize     Size of the Authenticode Signature in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates, created by Pkcs7VerifyContextNew().
+  @param[in]  ImageHash    Pointer to the original image file hash value. The procedure
+                           for calculating the image hash value is described in Authenticode
+                           specification.
+  @param[in]  HashSize     Size of Image hash value in bytes.
+
+  @retval  TRUE   The specified Authenticode Signature is valid.
+  @retval  FALSE  Invalid Authenticode Signature.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AuthenticodeVerifyWithContext (
+  IN  CONST UINT8  *AuthData,
+  IN  UINTN        DataSize,
+  IN  CONST VOID   *Context,
+  IN  CONST UINT8  *ImageHash,
+  IN  UINTN        HashSize
+  )
+{
+  CALL_CRYPTO_SERVICE (AuthenticodeVerifyWithContext, (AuthData, DataSize, Context, ImageHash, HashSize), FALSE);
+}
+
 /**
   Verifies the validity of a RFC3161 Timestamp CounterSignature embedded in PE/COFF Authenticode
   signature.
@@ -21,7 +21,7 @@
 /// the EDK II Crypto Protocol is extended, this version define must be
 /// increased.
 ///
-#define EDKII_CRYPTO_VERSION  8
+#define EDKII_CRYPTO_VERSION  9
 
 ///
 /// EDK II Crypto Protocol forward declaration
@@ -3486,6 +3486,133 @@ BOOLEAN
   IN       UINTN  CustomByteLen
   );
 
+// ---------------------------------------------
+// PKCS7 verification context
+
+/**
+  Allocates and initializes one PKCS#7 verification context, which holds a set
+  of trusted certificates for Pkcs7VerifyWithContext() and
+  AuthenticodeVerifyWithContext().
+
+  If this interface is not supported, then return NULL.
+
+  @return  Pointer to the PKCS#7 verification context that has been initialized.
+           If the allocations fails, Pkcs7VerifyContextNew() returns NULL.
+  @retval  NULL  This interface is not supported.
+
+**/
+typedef
+VOID *
+(EFIAPI *EDKII_CRYPTO_PKCS7_VERIFY_CONTEXT_NEW)(
+  VOID
+  );
+
+/**
+  Adds a trusted/root certificate to a PKCS#7 verification context.
+
+  If Context or TrustedCert is NULL, then return FALSE.
+  If CertLength overflow, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in, out]  Context      Pointer to the PKCS#7 verification context.
+  @param[in]       TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                                is used for certificate chain verification.
+  @param[in]       CertLength   Length of the trusted certificate in bytes.
+
+  @retval  TRUE   The trusted certificate was added to the context.
+  @retval  FALSE  Invalid certificate, or the context cannot hold it.
+  @retval  FALSE  This interface is not supported.
+
+**/
+typedef
+BOOLEAN
+(EFIAPI *EDKII_CRYPTO_PKCS7_VERIFY_CONTEXT_ADD_CERT)(
+  IN OUT  VOID         *Context,
+  IN      CONST UINT8  *TrustedCert,
+  IN      UINTN        CertLength
+  );
+
+/**
+  Release the specified PKCS#7 verification context.
+
+  If this interface is not supported, then do nothing.
+
+  @param[in]  Context  Pointer to the PKCS#7 verification context to be released.
+
+**/
+typedef
+VOID
+(EFIAPI *EDKII_CRYPTO_PKCS7_VERIFY_CONTEXT_FREE)(
+  IN  VOID  *Context
+  );
+
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard", against the trusted certificates of a
+  PKCS#7 verification context. The input signed data could be wrapped in a
+  ContentInfo structure.
+
+  If P7Data, Context or InData is NULL, then return FALSE.
+  If P7Length or DataLength overflow, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length     Length of the PKCS#7 message in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates.
+  @param[in]  InData       Pointer to the content to be verified.
+  @param[in]  DataLength   Length of InData in bytes.
+
+  @retval  TRUE  The specified PKCS#7 signed data is valid.
+  @retval  FALSE Invalid PKCS#7 signed data.
+  @retval  FALSE This interface is not supported.
+
+**/
+typedef
+BOOLEAN
+(EFIAPI *EDKII_CRYPTO_PKCS7_VERIFY_WITH_CONTEXT)(
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  CONST VOID   *Context,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  );
+
+/**
+  Verifies the validity of a PE/COFF Authenticode Signature as described in "Windows
+  Authenticode Portable Executable Signature Format", against the trusted
+  certificates of a PKCS#7 verification context.
+
+  If AuthData is NULL, then return FALSE.
+  If Context is NULL, then return FALSE.
+  If ImageHash is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]  AuthData     Pointer to the Authenticode Signature retrieved from signed
+                           PE/COFF image to be verified.
+  @param[in]  DataSize     Size of the Authenticode Signature in bytes.
+  @param[in]  Context      Pointer to the PKCS#7 verification context holding the
+                           trusted certificates, created by Pkcs7VerifyContextNew().
+  @param[in]  ImageHash    Pointer to the original image file hash value. The procedure
+                           for calculating the image hash value is described in Authenticode
+                           specification.
+  @param[in]  HashSize     Size of Image hash value in bytes.
+
+  @retval  TRUE   The specified Authenticode Signature is valid.
+  @retval  FALSE  Invalid Authenticode Signature.
+  @retval  FALSE  This interface is not supported.
+
+**/
+typedef
+BOOLEAN
+(EFIAPI *EDKII_CRYPTO_AUTHENTICODE_VERIFY_WITH_CONTEXT)(
+  IN  CONST UINT8  *AuthData,
+  IN  UINTN        DataSize,
+  IN  CONST VOID   *Context,
+  IN  CONST UINT8  *ImageHash,
+  IN  UINTN        HashSize
+  );
+
 ///
 /// EDK II Crypto Protocol
 ///
@@ -3675,6 +3802,12 @@ struct _EDKII_CRYPTO_PROTOCOL {
   EDKII_CRYPTO_RSA_PSS_VERIFY                        RsaPssVerify;
   /// Parallel hash
   EDKII_CRYPTO_PARALLEL_HASH_ALL                     ParallelHash256HashAll;
+  /// PKCS7 verification context
+  EDKII_CRYPTO_PKCS7_VERIFY_CONTEXT_NEW              Pkcs7VerifyContextNew;
+  EDKII_CRYPTO_PKCS7_VERIFY_CONTEXT_ADD_CERT         Pkcs7VerifyContextAddCert;
+  EDKII_CRYPTO_PKCS7_VERIFY_CONTEXT_FREE             Pkcs7VerifyContextFree;
+  EDKII_CRYPTO_PKCS7_VERIFY_WITH_CONTEXT             Pkcs7VerifyWithContext;
+  EDKII_CRYPTO_AUTHENTICODE_VERIFY_WITH_CONTEXT      AuthenticodeVerifyWithContext;
 };
 
 extern GUID  gEdkiiCryptoProtocolGuid;
@@ -992,11 +992,180 @@ TestVerifyAuthenticodeVerify (
   return UNIT_TEST_PASSED;
 }
 
+//
+// Number of image verifications timed by TestVerifyAuthenticodeVerifyWithContext().
+//
+#define AUTHENTICODE_BENCHMARK_COUNT  500
+
+//
+// A signed image: its Authenticode signature, its hash, and the root
+// certificate that verifies the signature.
+//
+typedef struct {
+  UINT8    *AuthData;
+  UINTN    AuthDataSize;
+  UINT8    *ImageHash;
+  UINTN    ImageHashSize;
+  UINT8    *RootCert;
+  UINTN    RootCertSize;
+} AUTHENTICODE_TEST_IMAGE;
+
+//
+// The images verified in turn by the benchmark, so that a result is not the
+// one of a single signature with a single signer.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED AUTHENTICODE_TEST_IMAGE  mAuthenticodeTestImages[] = {
+  { AuthenticodeWithSha1,   sizeof (AuthenticodeWithSha1),   PeSha1Hash,   SHA1_DIGEST_SIZE,   TestRootCert1, sizeof (TestRootCert1) },
+  { AuthenticodeWithSha256, sizeof (AuthenticodeWithSha256), PeSha256Hash, SHA256_DIGEST_SIZE, TestRootCert2, sizeof (TestRootCert2) },
+};
+
+//
+// The verification context of TestVerifyAuthenticodeVerifyWithContext(). It is
+// created and freed outside of the test, so that a failed assertion does not
+// leak it.
+//
+VOID  *mAuthenticodeVerifyContext;
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyAuthenticodeContextPreReq (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  VOID  **VerifyContext;
+
+  VerifyContext  = Context;
+  *VerifyContext = Pkcs7VerifyContextNew ();
+  if (*VerifyContext == NULL) {
+    return UNIT_TEST_ERROR_TEST_FAILED;
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+VOID
+EFIAPI
+TestVerifyAuthenticodeContextCleanUp (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  VOID  **VerifyContext;
+
+  VerifyContext = Context;
+  if (*VerifyContext != NULL) {
+    Pkcs7VerifyContextFree (*VerifyContext);
+    *VerifyContext = NULL;
+  }
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyAuthenticodeVerifyWithContext (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  VOID                     *VerifyContext;
+  BOOLEAN                  Status;
+  UINTN                    Index;
+  UNIT_TEST_BENCHMARK      Timer;
+  AUTHENTICODE_TEST_IMAGE  *Image;
+
+  VerifyContext = *(VOID **)Context;
+
+  //
+  // A context without trusted certificate verifies nothing.
+  //
+  Status = AuthenticodeVerifyWithContext (
+             AuthenticodeWithSha256,
+             sizeof (AuthenticodeWithSha256),
+             VerifyContext,
+             PeSha256Hash,
+             SHA256_DIGEST_SIZE
+             );
+  UT_ASSERT_FALSE (Status);
+
+  //
+  // One context holding both roots verifies the images signed by either of them.
+  //
+  UT_ASSERT_TRUE (Pkcs7VerifyContextAddCert (VerifyContext, TestRootCert1, sizeof (TestRootCert1)));
+  UT_ASSERT_TRUE (Pkcs7VerifyContextAddCert (VerifyContext, TestRootCert2, sizeof (TestRootCert2)));
+
+  Status = AuthenticodeVerifyWithContext (
+             AuthenticodeWithSha1,
+             sizeof (AuthenticodeWithSha1),
+             VerifyContext,
+             PeSha1Hash,
+             SHA1_DIGEST_SIZE
+             );
+  UT_ASSERT_TRUE (Status);
+
+  Status = AuthenticodeVerifyWithContext (
+             AuthenticodeWithSha256,
+             sizeof (AuthenticodeWithSha256),
+             VerifyContext,
+             PeSha256Hash,
+             SHA256_DIGEST_SIZE
+             );
+  UT_ASSERT_TRUE (Status);
+
+  //
+  // The image hash is still checked.
+  //
+  Status = AuthenticodeVerifyWithContext (
+             AuthenticodeWithSha256,
+             sizeof (AuthenticodeWithSha256),
+             VerifyContext,
+             PeSha1Hash,
+             SHA1_DIGEST_SIZE
+             );
+  UT_ASSERT_FALSE (Status);
+
+  //
+  // Compare the rate of image verifications with and without a context, the
+  // images being verified in turn.
+  //
+  UnitTestBenchmarkStart (&Timer);
+  for (Index = 0; Index < AUTHENTICODE_BENCHMARK_COUNT; Index++) {
+    Image  = &mAuthenticodeTestImages[Index % ARRAY_SIZE (mAuthenticodeTestImages)];
+    Status = AuthenticodeVerify (
+               Image->AuthData,
+               Image->AuthDataSize,
+               Image->RootCert,
+               Image->RootCertSize,
+               Image->ImageHash,
+               Image->ImageHashSize
+               );
+    UT_ASSERT_TRUE (Status);
+  }
+
+  UnitTestBenchmarkStop (&Timer);
+  UnitTestBenchmarkLogRate ("AuthenticodeVerify", &Timer, AUTHENTICODE_BENCHMARK_COUNT);
+
+  UnitTestBenchmarkStart (&Timer);
+  for (Index = 0; Index < AUTHENTICODE_BENCHMARK_COUNT; Index++) {
+    Image  = &mAuthenticodeTestImages[Index % ARRAY_SIZE (mAuthenticodeTestImages)];
+    Status = AuthenticodeVerifyWithContext (
+               Image->AuthData,
+               Image->AuthDataSize,
+               VerifyContext,
+               Image->ImageHash,
+               Image->ImageHashSize
+               );
+    UT_ASSERT_TRUE (Status);
+  }
+
+  UnitTestBenchmarkStop (&Timer);
+  UnitTestBenchmarkLogRate ("AuthenticodeVerifyWithContext", &Timer, AUTHENTICODE_BENCHMARK_COUNT);
+
+  return UNIT_TEST_PASSED;
+}
+
 TEST_DESC  mAuthenticodeTest[] = {
   //
   // -----Description--------------------------------------Class----------------------Function-----------------Pre---Post--Context
   //
-  { "TestVerifyAuthenticodeVerify()", "CryptoPkg.BaseCryptLib.Authenticode", TestVerifyAuthenticodeVerify, NULL, NULL, NULL },
+  { "TestVerifyAuthenticodeVerify()",            "CryptoPkg.BaseCryptLib.Authenticode", TestVerifyAuthenticodeVerify,            NULL,                                NULL,                                 NULL                         },
+  { "TestVerifyAuthenticodeVerifyWithContext()", "CryptoPkg.BaseCryptLib.Authenticode", TestVerifyAuthenticodeVerifyWithContext, TestVerifyAuthenticodeContextPreReq, TestVerifyAuthenticodeContextCleanUp, &mAuthenticodeVerifyContext },
 };
 
 UINTN  mAuthenticodeTestNum = ARRAY_SIZE (mAuthenticodeTest);
@@ -11,20 +11,21 @@ SUITE_DESC  mSuiteDesc[] = {
   //
   // Title--------------------------Package-------------------Sup--Tdn----TestNum------------TestDesc
   //
-  { "EKU verify tests",            "CryptoPkg.BaseCryptLib", NULL, NULL, &mPkcs7EkuTestNum,       mPkcs7EkuTest       },
-  { "HASH verify tests",           "CryptoPkg.BaseCryptLib", NULL, NULL, &mHashTestNum,           mHashTest           },
-  { "HMAC verify tests",           "CryptoPkg.BaseCryptLib", NULL, NULL, &mHmacTestNum,           mHmacTest           },
-  { "BlockCipher verify tests",    "CryptoPkg.BaseCryptLib", NULL, NULL, &mBlockCipherTestNum,    mBlockCipherTest    },
-  { "RSA verify tests",            "CryptoPkg.BaseCryptLib", NULL, NULL, &mRsaTestNum,            mRsaTest            },
-  { "RSA PSS verify tests",        "CryptoPkg.BaseCryptLib", NULL, NULL, &mRsaPssTestNum,         mRsaPssTest         },
-  { "RSACert verify tests",        "CryptoPkg.BaseCryptLib", NULL, NULL, &mRsaCertTestNum,        mRsaCertTest        },
-  { "PKCS7 verify tests",          "CryptoPkg.BaseCryptLib", NULL, NULL, &mPkcs7TestNum,          mPkcs7Test          },
-  { "PKCS5 verify tests",          "CryptoPkg.BaseCryptLib", NULL, NULL, &mPkcs5TestNum,          mPkcs5Test          },
-  { "Authenticode verify tests",   "CryptoPkg.BaseCryptLib", NULL, NULL, &mAuthenticodeTestNum,   mAuthenticodeTest   },
-  { "ImageTimestamp verify tests", "CryptoPkg.BaseCryptLib", NULL, NULL, &mImageTimestampTestNum, mImageTimestampTest },
-  { "DH verify tests",             "CryptoPkg.BaseCryptLib", NULL, NULL, &mDhTestNum,             mDhTest             },
-  { "PRNG verify tests",           "CryptoPkg.BaseCryptLib", NULL, NULL, &mPrngTestNum,           mPrngTest           },
-  { "OAEP encrypt verify tests",   "CryptoPkg.BaseCryptLib", NULL, NULL, &mOaepTestNum,           mOaepTest           },
+  { "EKU verify tests",                "CryptoPkg.BaseCryptLib", NULL, NULL, &mPkcs7EkuTestNum,               mPkcs7EkuTest               },
+  { "HASH verify tests",               "CryptoPkg.BaseCryptLib", NULL, NULL, &mHashTestNum,                   mHashTest                   },
+  { "HMAC verify tests",               "CryptoPkg.BaseCryptLib", NULL, NULL, &mHmacTestNum,                   mHmacTest                   },
+  { "BlockCipher verify tests",        "CryptoPkg.BaseCryptLib", NULL, NULL, &mBlockCipherTestNum,            mBlockCipherTest            },
+  { "RSA verify tests",                "CryptoPkg.BaseCryptLib", NULL, NULL, &mRsaTestNum,                    mRsaTest                    },
+  { "RSA PSS verify tests",            "CryptoPkg.BaseCryptLib", NULL, NULL, &mRsaPssTestNum,                 mRsaPssTest                 },
+  { "RSACert verify tests",            "CryptoPkg.BaseCryptLib", NULL, NULL, &mRsaCertTestNum,                mRsaCertTest                },
+  { "PKCS7 verify tests",              "CryptoPkg.BaseCryptLib", NULL, NULL, &mPkcs7TestNum,                  mPkcs7Test                  },
+  { "PKCS5 verify tests",              "CryptoPkg.BaseCryptLib", NULL, NULL, &mPkcs5TestNum,                  mPkcs5Test                  },
+  { "Authenticode verify tests",       "CryptoPkg.BaseCryptLib", NULL, NULL, &mAuthenticodeTestNum,           mAuthenticodeTest           },
+  { "PE/COFF Authenticode hash tests", "CryptoPkg.BaseCryptLib", NULL, NULL, &mPeCoffAuthenticodeHashTestNum, mPeCoffAuthenticodeHashTest },
+  { "ImageTimestamp verify tests",     "CryptoPkg.BaseCryptLib", NULL, NULL, &mImageTimestampTestNum,         mImageTimestampTest         },
+  { "DH verify tests",                 "CryptoPkg.BaseCryptLib", NULL, NULL, &mDhTestNum,                     mDhTest                     },
+  { "PRNG verify tests",               "CryptoPkg.BaseCryptLib", NULL, NULL, &mPrngTestNum,                   mPrngTest                   },
+  { "OAEP encrypt verify tests",       "CryptoPkg.BaseCryptLib", NULL, NULL, &mOaepTestNum,                   mOaepTest                   },
 };
 
 EFI_STATUS
@@ -273,11 +273,89 @@ TestVerifyBLockCiper (
   return UNIT_TEST_PASSED;
 }
 
+UNIT_TEST_STATUS
+EFIAPI
+TestBlockCipherThroughput (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8                      *Data;
+  UINT8                      *Encrypt;
+  UINT8                      *Decrypt;
+  UINTN                      Index;
+  BOOLEAN                    Status;
+  INTN                       Match;
+  UNIT_TEST_BENCHMARK        EncryptTimer;
+  UNIT_TEST_BENCHMARK        DecryptTimer;
+  BLOCK_CIPHER_TEST_CONTEXT  *TestContext;
+
+  TestContext = Context;
+
+  //
+  // Only the CBC mode of AES is supported by BaseCryptLib.
+  //
+  UT_ASSERT_TRUE (TestContext->Ivec != NULL);
+
+  Data    = AllocatePool (THROUGHPUT_TEST_DATA_SIZE);
+  Encrypt = AllocatePool (THROUGHPUT_TEST_DATA_SIZE);
+  Decrypt = AllocatePool (THROUGHPUT_TEST_DATA_SIZE);
+  Status  = (BOOLEAN)((Data != NULL) && (Encrypt != NULL) && (Decrypt != NULL));
+  Match   = -1;
+
+  ZeroMem (&EncryptTimer, sizeof (EncryptTimer));
+  ZeroMem (&DecryptTimer, sizeof (DecryptTimer));
+
+  if (Status) {
+    for (Index = 0; Index < THROUGHPUT_TEST_DATA_SIZE; Index++) {
+      Data[Index] = (UINT8)(Index ^ (Index >> 8) ^ (Index >> 16));
+    }
+
+    Status = TestContext->Init (TestContext->Ctx, TestContext->Key, TestContext->KeySize);
+  }
+
+  if (Status) {
+    UnitTestBenchmarkStart (&EncryptTimer);
+    Status = TestContext->CbcEncrypt (TestContext->Ctx, Data, THROUGHPUT_TEST_DATA_SIZE, TestContext->Ivec, Encrypt);
+    UnitTestBenchmarkStop (&EncryptTimer);
+  }
+
+  if (Status) {
+    UnitTestBenchmarkStart (&DecryptTimer);
+    Status = TestContext->CbcDecrypt (TestContext->Ctx, Encrypt, THROUGHPUT_TEST_DATA_SIZE, TestContext->Ivec, Decrypt);
+    UnitTestBenchmarkStop (&DecryptTimer);
+  }
+
+  if (Status) {
+    Match = CompareMem (Decrypt, Data, THROUGHPUT_TEST_DATA_SIZE);
+  }
+
+  if (Data != NULL) {
+    FreePool (Data);
+  }
+
+  if (Encrypt != NULL) {
+    FreePool (Encrypt);
+  }
+
+  if (Decrypt != NULL) {
+    FreePool (Decrypt);
+  }
+
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_EQUAL (Match, 0);
+
+  UnitTestBenchmarkLogThroughput ("CbcEncrypt", &EncryptTimer, THROUGHPUT_TEST_DATA_SIZE);
+  UnitTestBenchmarkLogThroughput ("CbcDecrypt", &DecryptTimer, THROUGHPUT_TEST_DATA_SIZE);
+
+  return UNIT_TEST_PASSED;
+}
+
 TEST_DESC  mBlockCipherTest[] = {
   //
   // -----Description-------------------------Class-------------------------Function---------------Pre---------------------------Post------------------Context
   //
-  { "TestVerifyAes128Cbc()", "CryptoPkg.BaseCryptLib.BlockCipher", TestVerifyBLockCiper, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mAes128CbcTestCtx },
+  { "TestVerifyAes128Cbc()",     "CryptoPkg.BaseCryptLib.BlockCipher", TestVerifyBLockCiper,      TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mAes128CbcTestCtx },
+  { "TestAes128CbcThroughput()", "CryptoPkg.BaseCryptLib.BlockCipher", TestBlockCipherThroughput, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mAes128CbcTestCtx },
   // These are commented out as these functions have been deprecated, but they have been left in for future reference
   // {"TestVerifyTdesEcb()",    "CryptoPkg.BaseCryptLib.BlockCipher",   TestVerifyBLockCiper, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mTdesEcbTestCtx},
   // {"TestVerifyTdesCbc()",    "CryptoPkg.BaseCryptLib.BlockCipher",   TestVerifyBLockCiper, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mTdesCbcTestCtx},
@@ -13,6 +13,13 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 #define MAX_DIGEST_SIZE  64
 
+//
+// Size of the pieces the throughput tests feed the message to HashUpdate() in.
+// It is not a multiple of the block size, so that the updates also go through
+// the partial block handling.
+//
+#define HASH_THROUGHPUT_UPDATE_SIZE  1000
+
 //
 // Message string for digest validation
 //
@@ -186,17 +193,82 @@ TestVerifyHash (
   return UNIT_TEST_PASSED;
 }
 
+UNIT_TEST_STATUS
+EFIAPI
+TestHashThroughput (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8                *Data;
+  UINTN                Index;
+  UINTN                Size;
+  UINT8                Digest[MAX_DIGEST_SIZE];
+  UINT8                UpdateDigest[MAX_DIGEST_SIZE];
+  BOOLEAN              Status;
+  BOOLEAN              UpdateStatus;
+  UNIT_TEST_BENCHMARK  HashAllTimer;
+  UNIT_TEST_BENCHMARK  UpdateTimer;
+  HASH_TEST_CONTEXT    *HashTestContext;
+
+  HashTestContext = Context;
+
+  Data = AllocatePool (THROUGHPUT_TEST_DATA_SIZE);
+  UT_ASSERT_NOT_NULL (Data);
+
+  for (Index = 0; Index < THROUGHPUT_TEST_DATA_SIZE; Index++) {
+    Data[Index] = (UINT8)(Index ^ (Index >> 8) ^ (Index >> 16));
+  }
+
+  ZeroMem (Digest, MAX_DIGEST_SIZE);
+  ZeroMem (UpdateDigest, MAX_DIGEST_SIZE);
+
+  UnitTestBenchmarkStart (&HashAllTimer);
+  Status = HashTestContext->HashAll (Data, THROUGHPUT_TEST_DATA_SIZE, Digest);
+  UnitTestBenchmarkStop (&HashAllTimer);
+
+  //
+  // Hashing the same message piece by piece must give the same digest.
+  //
+  UnitTestBenchmarkStart (&UpdateTimer);
+  UpdateStatus = HashTestContext->HashInit (HashTestContext->HashCtx);
+  for (Index = 0; UpdateStatus && (Index < THROUGHPUT_TEST_DATA_SIZE); Index += Size) {
+    Size         = MIN (HASH_THROUGHPUT_UPDATE_SIZE, THROUGHPUT_TEST_DATA_SIZE - Index);
+    UpdateStatus = HashTestContext->HashUpdate (HashTestContext->HashCtx, Data + Index, Size);
+  }
+
+  if (UpdateStatus) {
+    UpdateStatus = HashTestContext->HashFinal (HashTestContext->HashCtx, UpdateDigest);
+  }
+
+  UnitTestBenchmarkStop (&UpdateTimer);
+
+  FreePool (Data);
+
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_TRUE (UpdateStatus);
+  UT_ASSERT_MEM_EQUAL (UpdateDigest, Digest, HashTestContext->DigestSize);
+
+  UnitTestBenchmarkLogThroughput ("HashAll", &HashAllTimer, THROUGHPUT_TEST_DATA_SIZE);
+  UnitTestBenchmarkLogThroughput ("HashUpdate", &UpdateTimer, THROUGHPUT_TEST_DATA_SIZE);
+
+  return UNIT_TEST_PASSED;
+}
+
 TEST_DESC  mHashTest[] = {
   //
   // -----Description----------------Class---------------------Function---------------Pre------------------Post------------Context
   //
  #ifdef ENABLE_MD5_DEPRECATED_INTERFACES
-  { "TestVerifyMd5()",    "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mMd5TestCtx    },
+  { "TestVerifyMd5()",        "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash,     TestVerifyHashPreReq, TestVerifyHashCleanUp, &mMd5TestCtx    },
  #endif
-  { "TestVerifySha1()",   "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha1TestCtx   },
-  { "TestVerifySha256()", "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha256TestCtx },
-  { "TestVerifySha384()", "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha384TestCtx },
-  { "TestVerifySha512()", "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha512TestCtx },
+  { "TestVerifySha1()",       "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash,     TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha1TestCtx   },
+  { "TestVerifySha256()",     "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash,     TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha256TestCtx },
+  { "TestVerifySha384()",     "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash,     TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha384TestCtx },
+  { "TestVerifySha512()",     "CryptoPkg.BaseCryptLib.Hash", TestVerifyHash,     TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha512TestCtx },
+  { "TestSha1Throughput()",   "CryptoPkg.BaseCryptLib.Hash", TestHashThroughput, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha1TestCtx   },
+  { "TestSha256Throughput()", "CryptoPkg.BaseCryptLib.Hash", TestHashThroughput, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha256TestCtx },
+  { "TestSha384Throughput()", "CryptoPkg.BaseCryptLib.Hash", TestHashThroughput, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha384TestCtx },
+  { "TestSha512Throughput()", "CryptoPkg.BaseCryptLib.Hash", TestHashThroughput, TestVerifyHashPreReq, TestVerifyHashCleanUp, &mSha512TestCtx },
 };
 
 UINTN  mHashTestNum = ARRAY_SIZE (mHashTest);
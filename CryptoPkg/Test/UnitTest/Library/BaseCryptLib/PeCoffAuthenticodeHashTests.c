@@ -0,0 +1,417 @@
+/** @file
+  Application for PE/COFF Authenticode Hash Validation.
+
+  The test images are built in memory. Their expected digests were computed
+  separately, following the PE/COFF Specification 8.0 Appendix A.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "TestBaseCryptLib.h"
+
+#include <IndustryStandard/PeImage.h>
+#include <Guid/WinCertificate.h>
+#include <Library/PeCoffAuthenticodeHashLib.h>
+
+//
+// Layout of the test images: the headers, .text, .data and .reloc sections,
+// data after the sections, and the certificate table.
+//
+#define TEST_IMAGE_SIZE           0x1F80
+#define TEST_IMAGE_PE_OFFSET      0x80
+#define TEST_IMAGE_HEADERS_SIZE   0x400
+#define TEST_IMAGE_CERT_OFFSET    0x1F00
+#define TEST_IMAGE_CERT_SIZE      0x80
+#define TEST_IMAGE_SECTION_COUNT  3
+
+typedef struct {
+  CHAR8     *Name;
+  UINT32    VirtualAddress;
+  UINT32    PointerToRawData;
+  UINT32    SizeOfRawData;
+} TEST_IMAGE_SECTION;
+
+typedef struct {
+  BOOLEAN    Pe32Plus;
+  //
+  // TRUE if .reloc overlaps .data in the image file, so the stream cannot
+  // hash the sections in file order and falls back to keeping the image.
+  //
+  BOOLEAN    Overlap;
+  UINT8      Digest[SHA256_DIGEST_SIZE];
+} TEST_IMAGE_DESC;
+
+//
+// The sections are not in file order in the section table.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED CONST TEST_IMAGE_SECTION  mTestImageSections[TEST_IMAGE_SECTION_COUNT] = {
+  { ".data",  0x3000, 0x1600, 0x600  },
+  { ".text",  0x1000, 0x400,  0x1200 },
+  { ".reloc", 0x4000, 0x1C00, 0x200  },
+};
+
+//
+// .reloc starts within .data when the sections overlap.
+//
+#define TEST_IMAGE_OVERLAP_RELOC_OFFSET  0x1A00
+
+GLOBAL_REMOVE_IF_UNREFERENCED TEST_IMAGE_DESC  mPe32Image = {
+  FALSE,
+  FALSE,
+  {
+    0x9c, 0x5c, 0xd1, 0x59, 0x33, 0x55, 0x0f, 0x46, 0x33, 0x92, 0x98, 0x0e, 0x70, 0xa0, 0x57, 0x8c,
+    0x8d, 0xe8, 0x17, 0xde, 0x53, 0xdb, 0x85, 0xba, 0xc4, 0x0e, 0xe4, 0x94, 0x59, 0xab, 0x3c, 0x5b
+  }
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED TEST_IMAGE_DESC  mPe32PlusImage = {
+  TRUE,
+  FALSE,
+  {
+    0x18, 0x75, 0x66, 0xa4, 0x86, 0x72, 0x5d, 0x27, 0x13, 0xd2, 0x29, 0x48, 0xf7, 0xa1, 0xf2, 0x4a,
+    0xe5, 0x81, 0x21, 0x2c, 0x24, 0x15, 0x52, 0x3c, 0x4b, 0x5b, 0x13, 0xb6, 0x9e, 0xa5, 0x8d, 0xd0
+  }
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED TEST_IMAGE_DESC  mPe32OverlapImage = {
+  FALSE,
+  TRUE,
+  {
+    0x2a, 0x85, 0xdc, 0xe6, 0x75, 0x8f, 0x5a, 0xe7, 0x07, 0x82, 0xc5, 0x11, 0xb8, 0xe7, 0xd7, 0xcf,
+    0xab, 0x71, 0x89, 0x12, 0x12, 0x95, 0x60, 0xa8, 0x0c, 0x37, 0xf6, 0x26, 0xeb, 0xe3, 0xcd, 0x6d
+  }
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED TEST_IMAGE_DESC  mPe32PlusOverlapImage = {
+  TRUE,
+  TRUE,
+  {
+    0x7d, 0x6b, 0x22, 0xe3, 0xf2, 0xac, 0x47, 0x0b, 0x13, 0xdd, 0x2d, 0xe9, 0xa3, 0x42, 0x17, 0x8d,
+    0x59, 0xa5, 0x72, 0xb8, 0x2f, 0xce, 0xa0, 0xc1, 0xb2, 0xd2, 0x32, 0xd5, 0xea, 0x00, 0x05, 0x1c
+  }
+};
+
+//
+// Chunk sizes of the streams, including chunks that split the headers and the
+// sections, and the whole image in a single chunk.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINTN  mTestChunkSizes[] = {
+  1, 7, 64, 0x3FF, 0x401, 0x1000, TEST_IMAGE_SIZE
+};
+
+/**
+  Build a test image.
+
+  @param[in]  Pe32Plus  TRUE to build a PE32+ image, FALSE for a PE32 image.
+  @param[in]  Overlap   TRUE to make the .reloc section overlap .data.
+
+  @return The image, of TEST_IMAGE_SIZE bytes, or NULL if out of resources.
+**/
+STATIC
+UINT8 *
+BuildTestImage (
+  IN BOOLEAN  Pe32Plus,
+  IN BOOLEAN  Overlap
+  )
+{
+  UINT8                                *Image;
+  UINTN                                Index;
+  EFI_IMAGE_DOS_HEADER                 *DosHdr;
+  EFI_IMAGE_OPTIONAL_HEADER_PTR_UNION  Hdr;
+  EFI_IMAGE_DATA_DIRECTORY             *SecDataDir;
+  EFI_IMAGE_SECTION_HEADER             *Section;
+  WIN_CERTIFICATE                      *Cert;
+
+  Image = AllocateZeroPool (TEST_IMAGE_SIZE);
+  if (Image == NULL) {
+    return NULL;
+  }
+
+  for (Index = TEST_IMAGE_HEADERS_SIZE; Index < TEST_IMAGE_SIZE; Index++) {
+    Image[Index] = (UINT8)(Index * 31 + (Index >> 8));
+  }
+
+  DosHdr           = (EFI_IMAGE_DOS_HEADER *)Image;
+  DosHdr->e_magic  = EFI_IMAGE_DOS_SIGNATURE;
+  DosHdr->e_lfanew = TEST_IMAGE_PE_OFFSET;
+
+  Hdr.Pe32                              = (EFI_IMAGE_NT_HEADERS32 *)(Image + TEST_IMAGE_PE_OFFSET);
+  Hdr.Pe32->Signature                   = EFI_IMAGE_NT_SIGNATURE;
+  Hdr.Pe32->FileHeader.NumberOfSections = TEST_IMAGE_SECTION_COUNT;
+  if (Pe32Plus) {
+    Hdr.Pe32->FileHeader.Machine                     = IMAGE_FILE_MACHINE_X64;
+    Hdr.Pe32->FileHeader.SizeOfOptionalHeader        = sizeof (EFI_IMAGE_OPTIONAL_HEADER64);
+    Hdr.Pe32->FileHeader.Characteristics             = EFI_IMAGE_FILE_EXECUTABLE_IMAGE | EFI_IMAGE_FILE_DLL;
+    Hdr.Pe32Plus->OptionalHeader.Magic               = EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC;
+    Hdr.Pe32Plus->OptionalHeader.AddressOfEntryPoint = 0x1000;
+    Hdr.Pe32Plus->OptionalHeader.SectionAlignment    = 0x1000;
+    Hdr.Pe32Plus->OptionalHeader.FileAlignment       = 0x200;
+    Hdr.Pe32Plus->OptionalHeader.SizeOfImage         = 0x5000;
+    Hdr.Pe32Plus->OptionalHeader.SizeOfHeaders       = TEST_IMAGE_HEADERS_SIZE;
+    Hdr.Pe32Plus->OptionalHeader.CheckSum            = 0x12345678;
+    Hdr.Pe32Plus->OptionalHeader.Subsystem           = EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION;
+    Hdr.Pe32Plus->OptionalHeader.NumberOfRvaAndSizes = EFI_IMAGE_NUMBER_OF_DIRECTORY_ENTRIES;
+    SecDataDir                                       = &Hdr.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY];
+  } else {
+    Hdr.Pe32->FileHeader.Machine                 = IMAGE_FILE_MACHINE_I386;
+    Hdr.Pe32->FileHeader.SizeOfOptionalHeader    = sizeof (EFI_IMAGE_OPTIONAL_HEADER32);
+    Hdr.Pe32->FileHeader.Characteristics         = EFI_IMAGE_FILE_EXECUTABLE_IMAGE | EFI_IMAGE_FILE_32BIT_MACHINE | EFI_IMAGE_FILE_DLL;
+    Hdr.Pe32->OptionalHeader.Magic               = EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC;
+    Hdr.Pe32->OptionalHeader.AddressOfEntryPoint = 0x1000;
+    Hdr.Pe32->OptionalHeader.SectionAlignment    = 0x1000;
+    Hdr.Pe32->OptionalHeader.FileAlignment       = 0x200;
+    Hdr.Pe32->OptionalHeader.SizeOfImage         = 0x5000;
+    Hdr.Pe32->OptionalHeader.SizeOfHeaders       = TEST_IMAGE_HEADERS_SIZE;
+    Hdr.Pe32->OptionalHeader.CheckSum            = 0x12345678;
+    Hdr.Pe32->OptionalHeader.Subsystem           = EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION;
+    Hdr.Pe32->OptionalHeader.NumberOfRvaAndSizes = EFI_IMAGE_NUMBER_OF_DIRECTORY_ENTRIES;
+    SecDataDir                                   = &Hdr.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY];
+  }
+
+  SecDataDir->VirtualAddress = TEST_IMAGE_CERT_OFFSET;
+  SecDataDir->Size           = TEST_IMAGE_CERT_SIZE;
+
+  Section = (EFI_IMAGE_SECTION_HEADER *)((UINT8 *)&Hdr.Pe32->OptionalHeader + Hdr.Pe32->FileHeader.SizeOfOptionalHeader);
+  for (Index = 0; Index < TEST_IMAGE_SECTION_COUNT; Index++, Section++) {
+    CopyMem (Section->Name, mTestImageSections[Index].Name, AsciiStrLen (mTestImageSections[Index].Name));
+    Section->Misc.VirtualSize = mTestImageSections[Index].SizeOfRawData;
+    Section->VirtualAddress   = mTestImageSections[Index].VirtualAddress;
+    Section->SizeOfRawData    = mTestImageSections[Index].SizeOfRawData;
+    Section->PointerToRawData = mTestImageSections[Index].PointerToRawData;
+    if (Overlap && (AsciiStrCmp (mTestImageSections[Index].Name, ".reloc") == 0)) {
+      Section->PointerToRawData = TEST_IMAGE_OVERLAP_RELOC_OFFSET;
+    }
+  }
+
+  Cert                   = (WIN_CERTIFICATE *)(Image + TEST_IMAGE_CERT_OFFSET);
+  Cert->dwLength         = TEST_IMAGE_CERT_SIZE;
+  Cert->wRevision        = 0x0200;
+  Cert->wCertificateType = WIN_CERT_TYPE_PKCS_SIGNED_DATA;
+
+  return Image;
+}
+
+/**
+  Add a part of the image to the SHA-256 hash.
+
+  @param[in] HashContext  The SHA-256 context.
+  @param[in] Data         The data to hash.
+  @param[in] DataSize     The size, in bytes, of Data.
+
+  @retval RETURN_SUCCESS  The data is hashed.
+  @retval RETURN_ABORTED  The data cannot be hashed.
+**/
+STATIC
+RETURN_STATUS
+EFIAPI
+TestHashUpdate (
+  IN VOID        *HashContext,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  )
+{
+  return Sha256Update (HashContext, Data, DataSize) ? RETURN_SUCCESS : RETURN_ABORTED;
+}
+
+/**
+  Fail the hash of any part of the image.
+
+  @param[in] HashContext  Unused.
+  @param[in] Data         Unused.
+  @param[in] DataSize     Unused.
+
+  @retval RETURN_DEVICE_ERROR  Always.
+**/
+STATIC
+RETURN_STATUS
+EFIAPI
+TestHashUpdateError (
+  IN VOID        *HashContext,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  )
+{
+  return RETURN_DEVICE_ERROR;
+}
+
+/**
+  Stream an image in chunks of a fixed size to an Authenticode hash stream.
+
+  @param[in]  Image        The image.
+  @param[in]  ImageSize    The number of bytes of the image to stream.
+  @param[in]  StreamSize   The size of the image passed to the stream.
+  @param[in]  ChunkSize    The size of the chunks.
+  @param[in]  HashUpdate   The function that hashes the data.
+  @param[in]  HashContext  The context passed to HashUpdate.
+
+  @return The status of the first call that failed, or of
+          PeCoffAuthenticodeHashFinal().
+**/
+STATIC
+RETURN_STATUS
+StreamTestImage (
+  IN CONST UINT8                       *Image,
+  IN UINTN                             ImageSize,
+  IN UINTN                             StreamSize,
+  IN UINTN                             ChunkSize,
+  IN PE_COFF_AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN VOID                              *HashContext
+  )
+{
+  RETURN_STATUS  Status;
+  VOID           *Stream;
+  UINTN          Offset;
+
+  Status = PeCoffAuthenticodeHashStart (StreamSize, HashUpdate, HashContext, &Stream);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  for (Offset = 0; Offset < ImageSize; Offset += ChunkSize) {
+    Status = PeCoffAuthenticodeHashUpdate (Stream, Image + Offset, MIN (ChunkSize, ImageSize - Offset));
+    if (RETURN_ERROR (Status)) {
+      PeCoffAuthenticodeHashAbort (Stream);
+      return Status;
+    }
+  }
+
+  return PeCoffAuthenticodeHashFinal (Stream);
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyPeCoffAuthenticodeHash (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  TEST_IMAGE_DESC  *TestImage;
+  UINT8            *Image;
+  VOID             *HashCtx;
+  UINT8            Digest[SHA256_DIGEST_SIZE];
+  RETURN_STATUS    Status;
+  UINTN            Index;
+
+  TestImage = (TEST_IMAGE_DESC *)Context;
+
+  Image = BuildTestImage (TestImage->Pe32Plus, TestImage->Overlap);
+  UT_ASSERT_NOT_NULL (Image);
+
+  HashCtx = AllocatePool (Sha256GetContextSize ());
+  UT_ASSERT_NOT_NULL (HashCtx);
+
+  //
+  // The image in a single buffer.
+  //
+  UT_ASSERT_TRUE (Sha256Init (HashCtx));
+  Status = PeCoffAuthenticodeHashImage (Image, TEST_IMAGE_SIZE, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_SUCCESS);
+  UT_ASSERT_TRUE (Sha256Final (HashCtx, Digest));
+  UT_ASSERT_MEM_EQUAL (Digest, TestImage->Digest, SHA256_DIGEST_SIZE);
+
+  //
+  // The image streamed in chunks of several sizes gives the same digest.
+  //
+  for (Index = 0; Index < ARRAY_SIZE (mTestChunkSizes); Index++) {
+    UT_ASSERT_TRUE (Sha256Init (HashCtx));
+    Status = StreamTestImage (Image, TEST_IMAGE_SIZE, TEST_IMAGE_SIZE, mTestChunkSizes[Index], TestHashUpdate, HashCtx);
+    UT_LOG_INFO ("Chunk size 0x%x: %r\n", mTestChunkSizes[Index], Status);
+    UT_ASSERT_STATUS_EQUAL (Status, RETURN_SUCCESS);
+    UT_ASSERT_TRUE (Sha256Final (HashCtx, Digest));
+    UT_ASSERT_MEM_EQUAL (Digest, TestImage->Digest, SHA256_DIGEST_SIZE);
+  }
+
+  FreePool (HashCtx);
+  FreePool (Image);
+
+  return UNIT_TEST_PASSED;
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyPeCoffAuthenticodeHashErrors (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8                   *Image;
+  VOID                    *HashCtx;
+  VOID                    *Stream;
+  RETURN_STATUS           Status;
+  EFI_IMAGE_NT_HEADERS32  *Hdr;
+
+  Image = BuildTestImage (FALSE, FALSE);
+  UT_ASSERT_NOT_NULL (Image);
+
+  HashCtx = AllocatePool (Sha256GetContextSize ());
+  UT_ASSERT_NOT_NULL (HashCtx);
+  UT_ASSERT_TRUE (Sha256Init (HashCtx));
+
+  //
+  // A stream that ends early is not complete.
+  //
+  Status = StreamTestImage (Image, TEST_IMAGE_SIZE - 1, TEST_IMAGE_SIZE, 0x100, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_NOT_READY);
+
+  //
+  // A stream can end within the headers.
+  //
+  Status = StreamTestImage (Image, 0x10, TEST_IMAGE_SIZE, 0x100, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_NOT_READY);
+
+  //
+  // More data than the size of the image is rejected.
+  //
+  Status = StreamTestImage (Image, TEST_IMAGE_SIZE, TEST_IMAGE_SIZE - 1, 0x100, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_BAD_BUFFER_SIZE);
+
+  //
+  // The error of the hash function is returned, by both interfaces.
+  //
+  Status = PeCoffAuthenticodeHashImage (Image, TEST_IMAGE_SIZE, TestHashUpdateError, NULL);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_DEVICE_ERROR);
+  Status = StreamTestImage (Image, TEST_IMAGE_SIZE, TEST_IMAGE_SIZE, 0x100, TestHashUpdateError, NULL);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_DEVICE_ERROR);
+
+  //
+  // Invalid images are rejected.
+  //
+  Hdr                              = (EFI_IMAGE_NT_HEADERS32 *)(Image + TEST_IMAGE_PE_OFFSET);
+  Hdr->FileHeader.NumberOfSections = 0x100;
+  Status                           = PeCoffAuthenticodeHashImage (Image, TEST_IMAGE_SIZE, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_UNSUPPORTED);
+  Status = StreamTestImage (Image, TEST_IMAGE_SIZE, TEST_IMAGE_SIZE, 0x100, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_UNSUPPORTED);
+
+  Hdr->FileHeader.NumberOfSections = TEST_IMAGE_SECTION_COUNT;
+  Hdr->Signature                   = 0;
+  Status                           = StreamTestImage (Image, TEST_IMAGE_SIZE, TEST_IMAGE_SIZE, 0x100, TestHashUpdate, HashCtx);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_UNSUPPORTED);
+
+  //
+  // A stream can be aborted at any time.
+  //
+  Status = PeCoffAuthenticodeHashStart (TEST_IMAGE_SIZE, TestHashUpdate, HashCtx, &Stream);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_SUCCESS);
+  Status = PeCoffAuthenticodeHashUpdate (Stream, Image, 0x10);
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_SUCCESS);
+  PeCoffAuthenticodeHashAbort (Stream);
+
+  FreePool (HashCtx);
+  FreePool (Image);
+
+  return UNIT_TEST_PASSED;
+}
+
+TEST_DESC  mPeCoffAuthenticodeHashTest[] = {
+  //
+  // -----Description-----------------------------------------------Class----------------------------------------Function---------------------------------Pre---Post--Context
+  //
+  { "TestVerifyPeCoffAuthenticodeHash() PE32",                       "CryptoPkg.BaseCryptLib.PeCoffAuthenticodeHash", TestVerifyPeCoffAuthenticodeHash,       NULL, NULL, &mPe32Image            },
+  { "TestVerifyPeCoffAuthenticodeHash() PE32+",                      "CryptoPkg.BaseCryptLib.PeCoffAuthenticodeHash", TestVerifyPeCoffAuthenticodeHash,       NULL, NULL, &mPe32PlusImage        },
+  { "TestVerifyPeCoffAuthenticodeHash() PE32 overlapping sections",  "CryptoPkg.BaseCryptLib.PeCoffAuthenticodeHash", TestVerifyPeCoffAuthenticodeHash,       NULL, NULL, &mPe32OverlapImage     },
+  { "TestVerifyPeCoffAuthenticodeHash() PE32+ overlapping sections", "CryptoPkg.BaseCryptLib.PeCoffAuthenticodeHash", TestVerifyPeCoffAuthenticodeHash,       NULL, NULL, &mPe32PlusOverlapImage },
+  { "TestVerifyPeCoffAuthenticodeHashErrors()",                      "CryptoPkg.BaseCryptLib.PeCoffAuthenticodeHash", TestVerifyPeCoffAuthenticodeHashErrors, NULL, NULL, NULL                   },
+};
+
+UINTN  mPeCoffAuthenticodeHashTestNum = ARRAY_SIZE (mPeCoffAuthenticodeHashTest);
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/UefiLib.h>
 #include <Library/DebugLib.h>
 #include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
 #include <Library/PrintLib.h>
 #include <Library/BaseCryptLib.h>
 #include <Library/BaseLib.h>
@@ -71,6 +72,9 @@ extern TEST_DESC  mPkcs5Test[];
 extern UINTN      mAuthenticodeTestNum;
 extern TEST_DESC  mAuthenticodeTest[];
 
+extern UINTN      mPeCoffAuthenticodeHashTestNum;
+extern TEST_DESC  mPeCoffAuthenticodeHashTest[];
+
 extern UINTN      mImageTimestampTestNum;
 extern TEST_DESC  mImageTimestampTest[];
 
@@ -86,6 +90,11 @@ extern TEST_DESC  mOaepTest[];
 extern UINTN      mRsaPssTestNum;
 extern TEST_DESC  mRsaPssTest[];
 
+//
+// Size of the buffers processed by the throughput tests.
+//
+#define THROUGHPUT_TEST_DATA_SIZE  SIZE_1MB
+
 /** Creates a framework you can use */
 EFI_STATUS
 EFIAPI
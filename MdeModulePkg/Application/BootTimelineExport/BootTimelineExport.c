@@ -0,0 +1,320 @@
+/** @file
+  Shell application to export the boot performance records of the FPDT.
+
+  The Boot Performance Table holds the PEI, DXE, SMM and BDS performance records
+  produced by the PerformanceLib instances. This application writes the whole
+  table, together with a module GUID to name map of the loaded images, into a
+  file that BaseTools/Scripts/FpdtTimeline.py turns into a boot timeline.
+
+  Usage: BootTimelineExport <FileName>
+
+Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <IndustryStandard/Acpi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/DebugLib.h>
+#include <Library/UefiLib.h>
+#include <Library/PeCoffGetEntryPointLib.h>
+#include <Protocol/LoadedImage.h>
+#include <Protocol/Shell.h>
+#include <Protocol/ShellParameters.h>
+#include <Guid/Performance.h>
+#include <Guid/FirmwarePerformance.h>
+#include <Guid/ExtendedFirmwarePerformance.h>
+
+#define BOOT_TIMELINE_SIGNATURE  SIGNATURE_32 ('B', 'T', 'L', 'N')
+#define BOOT_TIMELINE_REVISION   1
+
+#pragma pack(1)
+
+///
+/// Header of the exported file. It is followed by the Boot Performance Table
+/// and by NameCount BOOT_TIMELINE_NAME entries.
+///
+typedef struct {
+  UINT32    Signature;
+  UINT16    Revision;
+  UINT16    HeaderLength;
+  ///
+  /// Frequency of the performance counter, or 0 if it is unknown.
+  ///
+  UINT64    Frequency;
+  UINT32    TableOffset;
+  UINT32    TableLength;
+  UINT32    NameOffset;
+  UINT32    NameCount;
+} BOOT_TIMELINE_HEADER;
+
+typedef struct {
+  EFI_GUID    ModuleGuid;
+  CHAR8       Name[FPDT_STRING_EVENT_RECORD_NAME_LENGTH];
+} BOOT_TIMELINE_NAME;
+
+#pragma pack()
+
+/**
+  Get the module name from the PDB file name of an image.
+
+  @param  ImageBase     The base address of the image.
+  @param  Name          The buffer to receive the Null-terminated ASCII name.
+
+  @retval TRUE          The name is found.
+  @retval FALSE         The image has no PDB file name.
+**/
+BOOLEAN
+GetImageName (
+  IN  VOID   *ImageBase,
+  OUT CHAR8  *Name
+  )
+{
+  CHAR8  *PdbFileName;
+  UINTN  StartIndex;
+  UINTN  Index;
+
+  PdbFileName = PeCoffLoaderGetPdbPointer (ImageBase);
+  if (PdbFileName == NULL) {
+    return FALSE;
+  }
+
+  StartIndex = 0;
+  for (Index = 0; PdbFileName[Index] != 0; Index++) {
+    if ((PdbFileName[Index] == '\\') || (PdbFileName[Index] == '/')) {
+      StartIndex = Index + 1;
+    }
+  }
+
+  //
+  // Copy the PDB file name without path and extension.
+  //
+  for (Index = 0; Index < FPDT_STRING_EVENT_RECORD_NAME_LENGTH - 1; Index++) {
+    if ((PdbFileName[StartIndex + Index] == 0) || (PdbFileName[StartIndex + Index] == '.')) {
+      break;
+    }
+
+    Name[Index] = PdbFileName[StartIndex + Index];
+  }
+
+  Name[Index] = 0;
+  return TRUE;
+}
+
+/**
+  Build the module GUID to name map of all the loaded images.
+
+  @param  NameTable     Return the allocated name map.
+  @param  NameCount     Return the number of entries in the name map.
+
+  @retval EFI_SUCCESS   The name map is built.
+  @retval Others        The loaded images cannot be enumerated.
+**/
+EFI_STATUS
+BuildNameTable (
+  OUT BOOT_TIMELINE_NAME  **NameTable,
+  OUT UINTN               *NameCount
+  )
+{
+  EFI_STATUS                 Status;
+  EFI_HANDLE                 *HandleBuffer;
+  UINTN                      HandleCount;
+  UINTN                      Index;
+  EFI_LOADED_IMAGE_PROTOCOL  *LoadedImage;
+  EFI_GUID                   *ModuleGuid;
+  BOOT_TIMELINE_NAME         *Entry;
+
+  *NameTable = NULL;
+  *NameCount = 0;
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiLoadedImageProtocolGuid,
+                  NULL,
+                  &HandleCount,
+                  &HandleBuffer
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  *NameTable = AllocateZeroPool (HandleCount * sizeof (BOOT_TIMELINE_NAME));
+  if (*NameTable == NULL) {
+    FreePool (HandleBuffer);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < HandleCount; Index++) {
+    Status = gBS->HandleProtocol (
+                    HandleBuffer[Index],
+                    &gEfiLoadedImageProtocolGuid,
+                    (VOID **)&LoadedImage
+                    );
+    if (EFI_ERROR (Status) || (LoadedImage->FilePath == NULL)) {
+      continue;
+    }
+
+    //
+    // The performance records identify images loaded from a firmware volume
+    // by the FFS file name.
+    //
+    ModuleGuid = EfiGetNameGuidFromFwVolDevicePathNode ((MEDIA_FW_VOL_FILEPATH_DEVICE_PATH *)LoadedImage->FilePath);
+    if (ModuleGuid == NULL) {
+      continue;
+    }
+
+    Entry = &(*NameTable)[*NameCount];
+    if (GetImageName (LoadedImage->ImageBase, Entry->Name)) {
+      CopyGuid (&Entry->ModuleGuid, ModuleGuid);
+      (*NameCount)++;
+    }
+  }
+
+  FreePool (HandleBuffer);
+  return EFI_SUCCESS;
+}
+
+/**
+  Write a buffer to a file through the Shell protocol.
+
+  @param  FileName      The name of the file.
+  @param  BufferSize    The size of Buffer.
+  @param  Buffer        The data to write.
+
+  @retval EFI_SUCCESS   The file is written.
+  @retval Others        The file cannot be written.
+**/
+EFI_STATUS
+WriteFileFromBuffer (
+  IN CHAR16  *FileName,
+  IN UINTN   BufferSize,
+  IN VOID    *Buffer
+  )
+{
+  EFI_STATUS          Status;
+  EFI_SHELL_PROTOCOL  *ShellProtocol;
+  SHELL_FILE_HANDLE   Handle;
+
+  Status = gBS->LocateProtocol (&gEfiShellProtocolGuid, NULL, (VOID **)&ShellProtocol);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Delete the old file first, so that no stale data is left after the new content.
+  //
+  Status = ShellProtocol->OpenFileByName (FileName, &Handle, EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE);
+  if (!EFI_ERROR (Status)) {
+    ShellProtocol->DeleteFile (Handle);
+  }
+
+  Status = ShellProtocol->OpenFileByName (
+                            FileName,
+                            &Handle,
+                            EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE
+                            );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = ShellProtocol->WriteFile (Handle, &BufferSize, Buffer);
+  ShellProtocol->CloseFile (Handle);
+  return Status;
+}
+
+/**
+  The application entry point.
+
+  @param  ImageHandle   The image handle.
+  @param  SystemTable   The system table.
+
+  @retval EFI_SUCCESS            The boot timeline is exported.
+  @retval EFI_INVALID_PARAMETER  The file name is missing.
+  @retval EFI_NOT_FOUND          The FPDT is not found.
+  @retval Others                 The boot timeline cannot be exported.
+**/
+EFI_STATUS
+EFIAPI
+BootTimelineExportEntrypoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS                     Status;
+  EFI_SHELL_PARAMETERS_PROTOCOL  *ShellParameters;
+  FIRMWARE_PERFORMANCE_TABLE     *FirmwarePerformanceTable;
+  BOOT_PERFORMANCE_TABLE         *BootPerformanceTable;
+  PERFORMANCE_PROPERTY           *PerformanceProperty;
+  BOOT_TIMELINE_NAME             *NameTable;
+  UINTN                          NameCount;
+  BOOT_TIMELINE_HEADER           *Header;
+  UINTN                          BufferSize;
+
+  Status = gBS->HandleProtocol (
+                  ImageHandle,
+                  &gEfiShellParametersProtocolGuid,
+                  (VOID **)&ShellParameters
+                  );
+  if (EFI_ERROR (Status) || (ShellParameters->Argc != 2)) {
+    Print (L"Usage: BootTimelineExport <FileName>\n");
+    return EFI_INVALID_PARAMETER;
+  }
+
+  FirmwarePerformanceTable = (FIRMWARE_PERFORMANCE_TABLE *)EfiLocateFirstAcpiTable (
+                                                             EFI_ACPI_5_0_FIRMWARE_PERFORMANCE_DATA_TABLE_SIGNATURE
+                                                             );
+  if ((FirmwarePerformanceTable == NULL) || (FirmwarePerformanceTable->BootPointerRecord.BootPerformanceTablePointer == 0)) {
+    Print (L"BootTimelineExport: FPDT Boot Performance Table is not found\n");
+    return EFI_NOT_FOUND;
+  }
+
+  BootPerformanceTable = (BOOT_PERFORMANCE_TABLE *)(UINTN)FirmwarePerformanceTable->BootPointerRecord.BootPerformanceTablePointer;
+
+  Status = BuildNameTable (&NameTable, &NameCount);
+  if (EFI_ERROR (Status)) {
+    NameTable = NULL;
+    NameCount = 0;
+  }
+
+  BufferSize = sizeof (BOOT_TIMELINE_HEADER) + BootPerformanceTable->Header.Length + NameCount * sizeof (BOOT_TIMELINE_NAME);
+  Header     = AllocateZeroPool (BufferSize);
+  if (Header == NULL) {
+    if (NameTable != NULL) {
+      FreePool (NameTable);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Header->Signature    = BOOT_TIMELINE_SIGNATURE;
+  Header->Revision     = BOOT_TIMELINE_REVISION;
+  Header->HeaderLength = sizeof (BOOT_TIMELINE_HEADER);
+  Status               = EfiGetSystemConfigurationTable (&gPerformanceProtocolGuid, (VOID **)&PerformanceProperty);
+  if (!EFI_ERROR (Status)) {
+    Header->Frequency = PerformanceProperty->Frequency;
+  }
+
+  Header->TableOffset = sizeof (BOOT_TIMELINE_HEADER);
+  Header->TableLength = BootPerformanceTable->Header.Length;
+  Header->NameOffset  = Header->TableOffset + Header->TableLength;
+  Header->NameCount   = (UINT32)NameCount;
+  CopyMem ((UINT8 *)Header + Header->TableOffset, BootPerformanceTable, Header->TableLength);
+  if (NameTable != NULL) {
+    CopyMem ((UINT8 *)Header + Header->NameOffset, NameTable, NameCount * sizeof (BOOT_TIMELINE_NAME));
+    FreePool (NameTable);
+  }
+
+  Status = WriteFileFromBuffer (ShellParameters->Argv[1], BufferSize, Header);
+  if (EFI_ERROR (Status)) {
+    Print (L"BootTimelineExport: Failed to write %s - %r\n", ShellParameters->Argv[1], Status);
+  } else {
+    Print (L"BootTimelineExport: %d bytes of boot performance records written to %s\n", Header->TableLength, ShellParameters->Argv[1]);
+  }
+
+  FreePool (Header);
+  return Status;
+}
@@ -38,6 +38,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/DevicePathLib.h>
 #include <Library/PcdLib.h>
+#include <Library/PrintLib.h>
+#include <Library/PerformanceLib.h>
 
 #include <IndustryStandard/Pci.h>
 #include <IndustryStandard/PeImage.h>
@@ -49,6 +51,11 @@ typedef struct _PCI_BAR        PCI_BAR;
 #define EFI_PCI_RID(Bus, Device, Function)  (((UINT32)Bus << 8) + ((UINT32)Device << 3) + (UINT32)Function)
 #define EFI_PCI_BUS_OF_RID(RID)             ((UINT32)RID >> 8)
 
+//
+// Length of the performance token naming a root bridge, e.g. "PciScanBus 0000:00".
+//
+#define PCI_PERF_TOKEN_LENGTH  32
+
 #define     EFI_PCI_IOV_POLICY_ARI    0x0001
 #define     EFI_PCI_IOV_POLICY_SRIOV  0x0002
 #define     EFI_PCI_IOV_POLICY_MRIOV  0x0004
@@ -159,6 +166,27 @@ struct _PCI_BAR {
 
 #define PCI_IO_DEVICE_SIGNATURE  SIGNATURE_32 ('p', 'c', 'i', 'o')
 
+//
+// Maximum number of capabilities kept in the shadow of a capability list.
+// Longer lists are always walked in configuration space.
+//
+#define PCI_CAPABILITY_SHADOW_MAX_ENTRIES  0x40
+
+typedef struct {
+  UINT16    CapabilityId;
+  UINT16    Offset;
+  UINT16    NextRegBlock;
+} PCI_CAPABILITY_SHADOW_ENTRY;
+
+//
+// Shadow of a capability list in configuration space. Capability lists are
+// static, so the shadow is valid until the device is reset or removed.
+//
+typedef struct {
+  UINTN                          Count;
+  PCI_CAPABILITY_SHADOW_ENTRY    Entry[PCI_CAPABILITY_SHADOW_MAX_ENTRIES];
+} PCI_CAPABILITY_SHADOW;
+
 struct _PCI_IO_DEVICE {
   UINT32                                       Signature;
   EFI_HANDLE                                   Handle;
@@ -281,6 +309,13 @@ struct _PCI_IO_DEVICE {
   UINT16                                       BridgeIoAlignment;
   UINT32                                       ResizableBarOffset;
   UINT32                                       ResizableBarNumber;
+
+  //
+  // Shadows of the capability list and of the PCI Express extended capability
+  // list, used when PcdPciBusConfigSpaceShadow is TRUE.
+  //
+  PCI_CAPABILITY_SHADOW                        *CapabilityShadow;
+  PCI_CAPABILITY_SHADOW                        *ExpressCapabilityShadow;
 };
 
 #define PCI_IO_DEVICE_FROM_PCI_IO_THIS(a) \
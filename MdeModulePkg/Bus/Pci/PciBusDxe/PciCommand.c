@@ -8,6 +8,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "PciBus.h"
 
+//
+// Number of configuration space reads served by the capability shadows.
+//
+UINT64  mPciCapabilityShadowReadsAvoided = 0;
+
 /**
   Operate the PCI register via PciIo function interface.
 
@@ -89,6 +94,159 @@ PciCapabilitySupport (
   return FALSE;
 }
 
+/**
+  Drop the shadows of the capability lists of the PCI device.
+
+  It must be called when the capability lists may have changed, e.g. after
+  the device is reset.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+
+**/
+VOID
+InvalidateCapabilityShadow (
+  IN PCI_IO_DEVICE  *PciIoDevice
+  )
+{
+  if (PciIoDevice->CapabilityShadow != NULL) {
+    FreePool (PciIoDevice->CapabilityShadow);
+    PciIoDevice->CapabilityShadow = NULL;
+  }
+
+  if (PciIoDevice->ExpressCapabilityShadow != NULL) {
+    FreePool (PciIoDevice->ExpressCapabilityShadow);
+    PciIoDevice->ExpressCapabilityShadow = NULL;
+  }
+}
+
+/**
+  Drop the shadows of the capability lists of the bridge and of all the
+  devices behind it.
+
+  @param Bridge            A pointer to the PCI_IO_DEVICE of the bridge.
+
+**/
+VOID
+InvalidateCapabilityShadowOnBridge (
+  IN PCI_IO_DEVICE  *Bridge
+  )
+{
+  LIST_ENTRY     *CurrentLink;
+  PCI_IO_DEVICE  *Temp;
+
+  InvalidateCapabilityShadow (Bridge);
+
+  CurrentLink = Bridge->ChildList.ForwardLink;
+  while (CurrentLink != NULL && CurrentLink != &Bridge->ChildList) {
+    Temp = PCI_IO_DEVICE_FROM_LINK (CurrentLink);
+    InvalidateCapabilityShadowOnBridge (Temp);
+    CurrentLink = CurrentLink->ForwardLink;
+  }
+}
+
+/**
+  Dump the number of configuration space reads avoided by the capability shadows.
+
+**/
+VOID
+DumpCapabilityShadowStatistics (
+  VOID
+  )
+{
+  if (FeaturePcdGet (PcdPciBusConfigSpaceShadow)) {
+    DEBUG ((DEBUG_INFO, "PciBus: %ld capability config reads served from shadow\n", mPciCapabilityShadowReadsAvoided));
+  }
+}
+
+/**
+  Search a capability in the shadow of a capability list.
+
+  @param Shadow            The shadow of the capability list.
+  @param CapId             The capability ID.
+  @param Offset            On input, the offset of the capability to start with,
+                           or 0 to start with the first capability.
+                           On output, the offset of the capability found.
+  @param NextRegBlock      The offset of the next capability.
+
+  @retval EFI_SUCCESS      The capability is found.
+  @retval EFI_NOT_FOUND    The capability is not in the list.
+  @retval EFI_UNSUPPORTED  The start offset is not in the list, the list must
+                           be walked in configuration space.
+
+**/
+EFI_STATUS
+SearchCapabilityShadow (
+  IN     PCI_CAPABILITY_SHADOW  *Shadow,
+  IN     UINT16                 CapId,
+  IN OUT UINT32                 *Offset,
+  OUT    UINT32                 *NextRegBlock
+  )
+{
+  UINTN  Index;
+
+  Index = 0;
+  if (*Offset != 0) {
+    while ((Index < Shadow->Count) && (Shadow->Entry[Index].Offset != *Offset)) {
+      Index++;
+    }
+
+    if (Index == Shadow->Count) {
+      return EFI_UNSUPPORTED;
+    }
+  } else {
+    //
+    // The capability pointer read is avoided too.
+    //
+    mPciCapabilityShadowReadsAvoided++;
+  }
+
+  for ( ; Index < Shadow->Count; Index++) {
+    mPciCapabilityShadowReadsAvoided++;
+    if (Shadow->Entry[Index].CapabilityId == CapId) {
+      *Offset       = Shadow->Entry[Index].Offset;
+      *NextRegBlock = Shadow->Entry[Index].NextRegBlock;
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_NOT_FOUND;
+}
+
+/**
+  Append a capability to the shadow of a capability list.
+
+  The shadow is dropped when the list is too long to be kept.
+
+  @param Shadow            The shadow of the capability list.
+  @param CapId             The capability ID.
+  @param Offset            The offset of the capability.
+  @param NextRegBlock      The offset of the next capability.
+
+**/
+VOID
+AppendCapabilityShadow (
+  IN OUT PCI_CAPABILITY_SHADOW  **Shadow,
+  IN     UINT16                 CapId,
+  IN     UINT32                 Offset,
+  IN     UINT32                 NextRegBlock
+  )
+{
+  if (*Shadow == NULL) {
+    return;
+  }
+
+  if ((*Shadow)->Count == PCI_CAPABILITY_SHADOW_MAX_ENTRIES) {
+    FreePool (*Shadow);
+    *Shadow = NULL;
+    return;
+  }
+
+  (*Shadow)->Entry[(*Shadow)->Count].CapabilityId = CapId;
+  (*Shadow)->Entry[(*Shadow)->Count].Offset       = (UINT16)Offset;
+  (*Shadow)->Entry[(*Shadow)->Count].NextRegBlock = (UINT16)NextRegBlock;
+  (*Shadow)->Count++;
+}
+
 /**
   Locate capability register block per capability ID.
 
@@ -110,9 +268,15 @@ LocateCapabilityRegBlock (
   OUT UINT8         *NextRegBlock OPTIONAL
   )
 {
-  UINT8   CapabilityPtr;
-  UINT16  CapabilityEntry;
-  UINT8   CapabilityID;
+  EFI_STATUS             Status;
+  UINT8                  CapabilityPtr;
+  UINT16                 CapabilityEntry;
+  UINT8                  CapabilityID;
+  UINT32                 ShadowOffset;
+  UINT32                 ShadowNextRegBlock;
+  PCI_CAPABILITY_SHADOW  *Shadow;
+  BOOLEAN                Recording;
+  BOOLEAN                Found;
 
   //
   // To check the capability of this device supports
@@ -121,6 +285,32 @@ LocateCapabilityRegBlock (
     return EFI_UNSUPPORTED;
   }
 
+  Shadow    = NULL;
+  Recording = FALSE;
+  Found     = FALSE;
+  if (FeaturePcdGet (PcdPciBusConfigSpaceShadow)) {
+    if (PciIoDevice->CapabilityShadow != NULL) {
+      ShadowOffset = *Offset;
+      Status       = SearchCapabilityShadow (PciIoDevice->CapabilityShadow, CapId, &ShadowOffset, &ShadowNextRegBlock);
+      if (Status != EFI_UNSUPPORTED) {
+        if (!EFI_ERROR (Status)) {
+          *Offset = (UINT8)ShadowOffset;
+          if (NextRegBlock != NULL) {
+            *NextRegBlock = (UINT8)ShadowNextRegBlock;
+          }
+        }
+
+        return Status;
+      }
+    } else if (*Offset == 0) {
+      //
+      // Record the whole list while walking it for the first time.
+      //
+      Shadow    = AllocateZeroPool (sizeof (PCI_CAPABILITY_SHADOW));
+      Recording = (BOOLEAN)(Shadow != NULL);
+    }
+  }
+
   if (*Offset != 0) {
     CapabilityPtr = *Offset;
   } else {
@@ -154,14 +344,24 @@ LocateCapabilityRegBlock (
                              );
 
     CapabilityID = (UINT8)CapabilityEntry;
+    AppendCapabilityShadow (&Shadow, CapabilityID, CapabilityPtr, (UINT8)(CapabilityEntry >> 8));
+    if (Found && (Shadow == NULL)) {
+      return EFI_SUCCESS;
+    }
 
-    if (CapabilityID == CapId) {
+    if ((CapabilityID == CapId) && !Found) {
       *Offset = CapabilityPtr;
       if (NextRegBlock != NULL) {
         *NextRegBlock = (UINT8)(CapabilityEntry >> 8);
       }
 
-      return EFI_SUCCESS;
+      //
+      // Keep walking only to record the rest of the list.
+      //
+      Found = TRUE;
+      if (Shadow == NULL) {
+        return EFI_SUCCESS;
+      }
     }
 
     //
@@ -175,7 +375,19 @@ LocateCapabilityRegBlock (
     CapabilityPtr = (UINT8)(CapabilityEntry >> 8);
   }
 
-  return EFI_NOT_FOUND;
+  //
+  // Only a list recorded by this walk replaces the shadow. Shadow is NULL if
+  // the list could not be recorded completely.
+  //
+  if (Recording) {
+    if (PciIoDevice->CapabilityShadow != NULL) {
+      FreePool (PciIoDevice->CapabilityShadow);
+    }
+
+    PciIoDevice->CapabilityShadow = Shadow;
+  }
+
+  return Found ? EFI_SUCCESS : EFI_NOT_FOUND;
 }
 
 /**
@@ -199,10 +411,15 @@ LocatePciExpressCapabilityRegBlock (
   OUT UINT32            *NextRegBlock OPTIONAL
   )
 {
-  EFI_STATUS  Status;
-  UINT32      CapabilityPtr;
-  UINT32      CapabilityEntry;
-  UINT16      CapabilityID;
+  EFI_STATUS             Status;
+  UINT32                 CapabilityPtr;
+  UINT32                 CapabilityEntry;
+  UINT16                 CapabilityID;
+  UINT32                 ShadowOffset;
+  UINT32                 ShadowNextRegBlock;
+  PCI_CAPABILITY_SHADOW  *Shadow;
+  BOOLEAN                Recording;
+  BOOLEAN                Found;
 
   //
   // To check the capability of this device supports
@@ -211,6 +428,32 @@ LocatePciExpressCapabilityRegBlock (
     return EFI_UNSUPPORTED;
   }
 
+  Shadow    = NULL;
+  Recording = FALSE;
+  Found     = FALSE;
+  if (FeaturePcdGet (PcdPciBusConfigSpaceShadow)) {
+    if (PciIoDevice->ExpressCapabilityShadow != NULL) {
+      ShadowOffset = *Offset & 0xFFC;
+      Status       = SearchCapabilityShadow (PciIoDevice->ExpressCapabilityShadow, CapId, &ShadowOffset, &ShadowNextRegBlock);
+      if (Status != EFI_UNSUPPORTED) {
+        if (!EFI_ERROR (Status)) {
+          *Offset = ShadowOffset;
+          if (NextRegBlock != NULL) {
+            *NextRegBlock = ShadowNextRegBlock;
+          }
+        }
+
+        return Status;
+      }
+    } else if (*Offset == 0) {
+      //
+      // Record the whole list while walking it for the first time.
+      //
+      Shadow    = AllocateZeroPool (sizeof (PCI_CAPABILITY_SHADOW));
+      Recording = (BOOLEAN)(Shadow != NULL);
+    }
+  }
+
   if (*Offset != 0) {
     CapabilityPtr = *Offset;
   } else {
@@ -230,10 +473,23 @@ LocatePciExpressCapabilityRegBlock (
                                               &CapabilityEntry
                                               );
     if (EFI_ERROR (Status)) {
+      //
+      // Do not keep a list which cannot be read completely.
+      //
+      if (Shadow != NULL) {
+        FreePool (Shadow);
+        Shadow = NULL;
+      }
+
       break;
     }
 
     if (CapabilityEntry == MAX_UINT32) {
+      if (Shadow != NULL) {
+        FreePool (Shadow);
+        Shadow = NULL;
+      }
+
       DEBUG ((
         DEBUG_WARN,
         "%a: [%02x|%02x|%02x] failed to access config space at offset 0x%x\n",
@@ -247,18 +503,40 @@ LocatePciExpressCapabilityRegBlock (
     }
 
     CapabilityID = (UINT16)CapabilityEntry;
+    AppendCapabilityShadow (&Shadow, CapabilityID, CapabilityPtr, (CapabilityEntry >> 20) & 0xFFF);
+    if (Found && (Shadow == NULL)) {
+      return EFI_SUCCESS;
+    }
 
-    if (CapabilityID == CapId) {
+    if ((CapabilityID == CapId) && !Found) {
       *Offset = CapabilityPtr;
       if (NextRegBlock != NULL) {
         *NextRegBlock = (CapabilityEntry >> 20) & 0xFFF;
       }
 
-      return EFI_SUCCESS;
+      //
+      // Keep walking only to record the rest of the list.
+      //
+      Found = TRUE;
+      if (Shadow == NULL) {
+        return EFI_SUCCESS;
+      }
     }
 
     CapabilityPtr = (CapabilityEntry >> 20) & 0xFFF;
   }
 
-  return EFI_NOT_FOUND;
+  //
+  // Only a list recorded by this walk replaces the shadow. Shadow is NULL if
+  // the list could not be recorded completely.
+  //
+  if (Recording) {
+    if (PciIoDevice->ExpressCapabilityShadow != NULL) {
+      FreePool (PciIoDevice->ExpressCapabilityShadow);
+    }
+
+    PciIoDevice->ExpressCapabilityShadow = Shadow;
+  }
+
+  return Found ? EFI_SUCCESS : EFI_NOT_FOUND;
 }
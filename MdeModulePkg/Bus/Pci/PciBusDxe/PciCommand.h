@@ -110,6 +110,41 @@ LocateCapabilityRegBlock (
   OUT UINT8         *NextRegBlock OPTIONAL
   );
 
+/**
+  Drop the shadows of the capability lists of the PCI device.
+
+  It must be called when the capability lists may have changed, e.g. after
+  the device is reset.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+
+**/
+VOID
+InvalidateCapabilityShadow (
+  IN PCI_IO_DEVICE  *PciIoDevice
+  );
+
+/**
+  Drop the shadows of the capability lists of the bridge and of all the
+  devices behind it.
+
+  @param Bridge            A pointer to the PCI_IO_DEVICE of the bridge.
+
+**/
+VOID
+InvalidateCapabilityShadowOnBridge (
+  IN PCI_IO_DEVICE  *Bridge
+  );
+
+/**
+  Dump the number of configuration space reads avoided by the capability shadows.
+
+**/
+VOID
+DumpCapabilityShadowStatistics (
+  VOID
+  );
+
 /**
   Locate PciExpress capability register block per capability ID.
 
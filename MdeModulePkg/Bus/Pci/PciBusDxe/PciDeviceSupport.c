@@ -104,6 +104,8 @@ FreePciDevice (
     FreePool (PciIoDevice->BusNumberRanges);
   }
 
+  InvalidateCapabilityShadow (PciIoDevice);
+
   FreePool (PciIoDevice);
 }
 
@@ -577,6 +579,11 @@ DeRegisterPciDevice (
     //
     PciIoDevice->Registered = FALSE;
     PciIoDevice->Handle     = NULL;
+
+    //
+    // The device may be removed or replaced before it is registered again.
+    //
+    InvalidateCapabilityShadow (PciIoDevice);
   } else {
     //
     // Handle may be closed before
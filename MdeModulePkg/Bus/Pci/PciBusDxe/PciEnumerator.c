@@ -98,6 +98,8 @@ PciEnumerator (
     return Status;
   }
 
+  DumpCapabilityShadowStatistics ();
+
   return EFI_SUCCESS;
 }
 
@@ -129,6 +131,7 @@ PciRootBridgeEnumerator (
   UINT8                              Desc;
   UINT64                             AddrLen;
   UINT64                             AddrRangeMin;
+  CHAR8                              PerfToken[PCI_PERF_TOKEN_LENGTH];
 
   SubBusNumber   = 0;
   StartBusNumber = 0;
@@ -200,6 +203,18 @@ PciRootBridgeEnumerator (
   //
   SubBusNumber = StartBusNumber;
 
+  //
+  // Measure the bus scan of each root bridge separately.
+  //
+  AsciiSPrint (
+    PerfToken,
+    sizeof (PerfToken),
+    "PciScanBus %04x:%02x",
+    RootBridgeDev->PciRootBridgeIo->SegmentNumber,
+    StartBusNumber
+    );
+  PERF_INMODULE_BEGIN (PerfToken);
+
   //
   // Reset all assigned PCI bus number
   //
@@ -218,6 +233,8 @@ PciRootBridgeEnumerator (
              &PaddedBusRange
              );
 
+  PERF_INMODULE_END (PerfToken);
+
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -1864,6 +1881,12 @@ PreprocessController (
   EFI_HANDLE                                        RootBridgeHandle;
   EFI_HANDLE                                        HostBridgeHandle;
   EFI_STATUS                                        Status;
+  PCI_IO_DEVICE                                     *Controller;
+
+  //
+  // Once the controller is created, it is the one passed as Bridge.
+  //
+  Controller = Bridge;
 
   //
   // Get the host bridge handle
@@ -1960,6 +1983,17 @@ PreprocessController (
                             );
   }
 
+  //
+  // The platform and the host bridge may reset the controller, so its
+  // capability lists are walked again afterwards.
+  //
+  if ((Controller->BusNumber == Bus) &&
+      (Controller->DeviceNumber == Device) &&
+      (Controller->FunctionNumber == Func))
+  {
+    InvalidateCapabilityShadow (Controller);
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -2064,6 +2098,12 @@ PciHotPlugRequestNotify (
       *NumberOfChildren = 0;
     }
 
+    //
+    // The devices behind the hot-plug controller may have been replaced or
+    // reset since their capability lists were walked.
+    //
+    InvalidateCapabilityShadowOnBridge (Bridge);
+
     if (IsListEmpty (&Bridge->ChildList)) {
       Status = PciBridgeEnumerator (Bridge);
 
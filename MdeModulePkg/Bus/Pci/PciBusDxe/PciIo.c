@@ -1770,6 +1770,12 @@ PciIoAttributes (
     Status                   = EFI_SUCCESS;
   }
 
+  //
+  // Drivers change the attributes around a reset or a power state change of
+  // the controller, which may change its capability lists.
+  //
+  InvalidateCapabilityShadow (PciIoDevice);
+
   if (EFI_ERROR (Status)) {
     REPORT_STATUS_CODE_WITH_DEVICE_PATH (
       EFI_ERROR_CODE | EFI_ERROR_MINOR,
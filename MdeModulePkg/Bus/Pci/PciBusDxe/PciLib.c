@@ -1529,6 +1529,7 @@ PciHostBridgeEnumerator (
   LIST_ENTRY                         RootBridgeList;
   LIST_ENTRY                         *Link;
   EFI_STATUS                         RootBridgeEnumerationStatus;
+  CHAR8                              PerfToken[PCI_PERF_TOKEN_LENGTH];
 
   if (FeaturePcdGet (PcdPciBusHotplugDeviceSupport)) {
     InitializeHotPlugSupport ();
@@ -1732,10 +1733,19 @@ PciHostBridgeEnumerator (
     // A database that records all the information about pci device subject to this
     // root bridge will then be created
     //
+    AsciiSPrint (
+      PerfToken,
+      sizeof (PerfToken),
+      "PciCollectInfo %04x:%02x",
+      PciRootBridgeIo->SegmentNumber,
+      MinBus
+      );
+    PERF_INMODULE_BEGIN (PerfToken);
     Status = PciPciDeviceInfoCollector (
                RootBridgeDev,
                (UINT8)MinBus
                );
+    PERF_INMODULE_END (PerfToken);
 
     if (EFI_ERROR (Status)) {
       return Status;
@@ -76,6 +76,11 @@ ResetPowerManagementFeature (
                                       1,
                                       &PowerManagementCSR
                                       );
+
+    //
+    // A transition from D3hot to D0 may reset the function.
+    //
+    InvalidateCapabilityShadow (PciIoDevice);
   }
 
   return Status;
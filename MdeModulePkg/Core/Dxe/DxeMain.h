@@ -1154,6 +1154,15 @@ CoreDisconnectController (
   IN  EFI_HANDLE  ChildHandle        OPTIONAL
   );
 
+/**
+  Dump the statistics of the Driver Binding Supported() result cache.
+
+**/
+VOID
+CoreDumpDriverSupportedCacheStatistics (
+  VOID
+  );
+
 /**
   Allocates pages from the memory map.
 
@@ -782,6 +782,8 @@ CoreExitBootServices (
 
   gMemoryMapTerminated = TRUE;
 
+  CoreDumpDriverSupportedCacheStatistics ();
+
   //
   // Notify other drivers that we are exiting boot services.
   //
@@ -9,6 +9,21 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include "DxeMain.h"
 #include "Handle.h"
 
+//
+// Supported() result cache. Both tables are hashed on a pointer.
+//
+#define DRIVER_SUPPORTED_CACHE_BUCKETS  256
+#define DRIVER_SUPPORTED_CACHE_HASH(Pointer) \
+  ((((UINTN)(Pointer)) >> 3) & (DRIVER_SUPPORTED_CACHE_BUCKETS - 1))
+
+LIST_ENTRY  mDriverBindingIndexTable[DRIVER_SUPPORTED_CACHE_BUCKETS];
+LIST_ENTRY  mDriverSupportedCacheTable[DRIVER_SUPPORTED_CACHE_BUCKETS];
+BOOLEAN     mDriverSupportedCacheInitialized = FALSE;
+UINTN       mDriverBindingIndexCount         = 0;
+UINTN       mDriverSupportedCacheGeneration  = 0;
+UINT64      mDriverSupportedCacheProbes      = 0;
+UINT64      mDriverSupportedCacheSkips       = 0;
+
 //
 // Driver Support Functions
 //
@@ -368,6 +383,271 @@ AddSortedDriverBindingProtocol (
   }
 }
 
+/**
+  Return the index of a Driver Binding Protocol in the Supported() result cache.
+
+  A new index is assigned when the Driver Binding Protocol is seen for the first
+  time, or when a protocol interface was installed, uninstalled or reinstalled
+  on the handle it is installed on.
+
+  @param  DriverBinding  The Driver Binding Protocol.
+
+  @return The index of DriverBinding, or MAX_UINTN if it cannot be cached.
+
+**/
+UINTN
+CoreGetDriverBindingIndex (
+  IN EFI_DRIVER_BINDING_PROTOCOL  *DriverBinding
+  )
+{
+  LIST_ENTRY            *Bucket;
+  LIST_ENTRY            *Link;
+  DRIVER_BINDING_INDEX  *Entry;
+  EFI_HANDLE            DriverBindingHandle;
+  UINTN                 ModificationCount;
+
+  DriverBindingHandle = DriverBinding->DriverBindingHandle;
+  ModificationCount   = ((IHANDLE *)DriverBindingHandle)->ModificationCount;
+  Bucket              = &mDriverBindingIndexTable[DRIVER_SUPPORTED_CACHE_HASH (DriverBinding)];
+  for (Link = Bucket->ForwardLink; Link != Bucket; Link = Link->ForwardLink) {
+    Entry = CR (Link, DRIVER_BINDING_INDEX, Link, DRIVER_BINDING_INDEX_SIGNATURE);
+    if (Entry->DriverBinding == DriverBinding) {
+      if ((Entry->DriverBindingHandle != DriverBindingHandle) ||
+          (Entry->ModificationCount != ModificationCount))
+      {
+        //
+        // Indexes are never reused, so stale results of the old index are ignored.
+        //
+        Entry->DriverBindingHandle = DriverBindingHandle;
+        Entry->ModificationCount   = ModificationCount;
+        Entry->Index               = mDriverBindingIndexCount++;
+      }
+
+      return Entry->Index;
+    }
+  }
+
+  Entry = AllocatePool (sizeof (DRIVER_BINDING_INDEX));
+  if (Entry == NULL) {
+    return MAX_UINTN;
+  }
+
+  Entry->Signature           = DRIVER_BINDING_INDEX_SIGNATURE;
+  Entry->DriverBinding       = DriverBinding;
+  Entry->DriverBindingHandle = DriverBindingHandle;
+  Entry->ModificationCount   = ModificationCount;
+  Entry->Index               = mDriverBindingIndexCount++;
+  InsertTailList (Bucket, &Entry->Link);
+
+  return Entry->Index;
+}
+
+/**
+  Return the Supported() result cache of a controller.
+
+  The cached results are dropped if a protocol interface was installed,
+  uninstalled or reinstalled on the controller, or if DisconnectController()
+  was called, since the results were recorded.
+
+  @param  ControllerHandle  The handle of the controller.
+
+  @return The Supported() result cache of ControllerHandle, or NULL if it cannot
+          be allocated.
+
+**/
+DRIVER_SUPPORTED_CACHE *
+CoreGetDriverSupportedCache (
+  IN EFI_HANDLE  ControllerHandle
+  )
+{
+  LIST_ENTRY              *Bucket;
+  LIST_ENTRY              *Link;
+  DRIVER_SUPPORTED_CACHE  *Cache;
+  UINTN                   Index;
+  UINTN                   ModificationCount;
+
+  if (!mDriverSupportedCacheInitialized) {
+    for (Index = 0; Index < DRIVER_SUPPORTED_CACHE_BUCKETS; Index++) {
+      InitializeListHead (&mDriverBindingIndexTable[Index]);
+      InitializeListHead (&mDriverSupportedCacheTable[Index]);
+    }
+
+    mDriverSupportedCacheInitialized = TRUE;
+  }
+
+  ModificationCount = ((IHANDLE *)ControllerHandle)->ModificationCount;
+  Bucket            = &mDriverSupportedCacheTable[DRIVER_SUPPORTED_CACHE_HASH (ControllerHandle)];
+  for (Link = Bucket->ForwardLink; Link != Bucket; Link = Link->ForwardLink) {
+    Cache = CR (Link, DRIVER_SUPPORTED_CACHE, Link, DRIVER_SUPPORTED_CACHE_SIGNATURE);
+    if (Cache->ControllerHandle == ControllerHandle) {
+      if ((Cache->ModificationCount != ModificationCount) || (Cache->Generation != mDriverSupportedCacheGeneration)) {
+        ZeroMem (Cache->Bitmap, Cache->BitmapSize);
+        Cache->ModificationCount = ModificationCount;
+        Cache->Generation        = mDriverSupportedCacheGeneration;
+      }
+
+      return Cache;
+    }
+  }
+
+  Cache = AllocateZeroPool (sizeof (DRIVER_SUPPORTED_CACHE));
+  if (Cache == NULL) {
+    return NULL;
+  }
+
+  Cache->Signature         = DRIVER_SUPPORTED_CACHE_SIGNATURE;
+  Cache->ControllerHandle  = ControllerHandle;
+  Cache->ModificationCount = ModificationCount;
+  Cache->Generation        = mDriverSupportedCacheGeneration;
+  InsertTailList (Bucket, &Cache->Link);
+
+  return Cache;
+}
+
+/**
+  Free the Supported() result cache entries that refer to a handle that is
+  being freed.
+
+  A new handle may be allocated at the same address later, so neither the
+  results recorded for the handle as a controller, nor the indexes of the
+  Driver Binding Protocols installed on it, may outlive it.
+
+  @param  Handle  The handle that is being freed.
+
+**/
+VOID
+CoreFreeDriverSupportedCache (
+  IN IHANDLE  *Handle
+  )
+{
+  LIST_ENTRY              *Bucket;
+  LIST_ENTRY              *Link;
+  DRIVER_SUPPORTED_CACHE  *Cache;
+  DRIVER_BINDING_INDEX    *Entry;
+  UINTN                   Index;
+
+  if (!mDriverSupportedCacheInitialized) {
+    return;
+  }
+
+  Bucket = &mDriverSupportedCacheTable[DRIVER_SUPPORTED_CACHE_HASH (Handle)];
+  for (Link = Bucket->ForwardLink; Link != Bucket; Link = Link->ForwardLink) {
+    Cache = CR (Link, DRIVER_SUPPORTED_CACHE, Link, DRIVER_SUPPORTED_CACHE_SIGNATURE);
+    if (Cache->ControllerHandle == (EFI_HANDLE)Handle) {
+      RemoveEntryList (&Cache->Link);
+      if (Cache->Bitmap != NULL) {
+        CoreFreePool (Cache->Bitmap);
+      }
+
+      Cache->Signature = 0;
+      CoreFreePool (Cache);
+      break;
+    }
+  }
+
+  //
+  // The Driver Binding Protocols are hashed by their address, so all the
+  // buckets are searched. Handles are rarely freed, compared to how often
+  // Supported() is called.
+  //
+  for (Index = 0; Index < DRIVER_SUPPORTED_CACHE_BUCKETS; Index++) {
+    Bucket = &mDriverBindingIndexTable[Index];
+    for (Link = Bucket->ForwardLink; Link != Bucket; ) {
+      Entry = CR (Link, DRIVER_BINDING_INDEX, Link, DRIVER_BINDING_INDEX_SIGNATURE);
+      Link  = Link->ForwardLink;
+      if (Entry->DriverBindingHandle == (EFI_HANDLE)Handle) {
+        RemoveEntryList (&Entry->Link);
+        Entry->Signature = 0;
+        CoreFreePool (Entry);
+      }
+    }
+  }
+}
+
+/**
+  Check whether Supported() of a Driver Binding Protocol returned EFI_UNSUPPORTED
+  for the controller before.
+
+  @param  Cache          The Supported() result cache of the controller.
+  @param  DriverBinding  The Driver Binding Protocol.
+
+  @retval TRUE   DriverBinding does not support the controller.
+  @retval FALSE  Supported() of DriverBinding must be called.
+
+**/
+BOOLEAN
+CoreIsDriverUnsupportedCached (
+  IN DRIVER_SUPPORTED_CACHE       *Cache,
+  IN EFI_DRIVER_BINDING_PROTOCOL  *DriverBinding
+  )
+{
+  UINTN  Index;
+
+  Index = CoreGetDriverBindingIndex (DriverBinding);
+  if ((Index == MAX_UINTN) || (Index / 8 >= Cache->BitmapSize)) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)((Cache->Bitmap[Index / 8] & (1 << (Index % 8))) != 0);
+}
+
+/**
+  Record that Supported() of a Driver Binding Protocol returned EFI_UNSUPPORTED
+  for the controller.
+
+  @param  Cache          The Supported() result cache of the controller.
+  @param  DriverBinding  The Driver Binding Protocol.
+
+**/
+VOID
+CoreCacheDriverUnsupported (
+  IN DRIVER_SUPPORTED_CACHE       *Cache,
+  IN EFI_DRIVER_BINDING_PROTOCOL  *DriverBinding
+  )
+{
+  UINTN  Index;
+  UINTN  NewBitmapSize;
+  UINT8  *NewBitmap;
+
+  Index = CoreGetDriverBindingIndex (DriverBinding);
+  if (Index == MAX_UINTN) {
+    return;
+  }
+
+  if (Index / 8 >= Cache->BitmapSize) {
+    NewBitmapSize = (mDriverBindingIndexCount + 63) / 8;
+    NewBitmap     = ReallocatePool (Cache->BitmapSize, NewBitmapSize, Cache->Bitmap);
+    if (NewBitmap == NULL) {
+      return;
+    }
+
+    ZeroMem (NewBitmap + Cache->BitmapSize, NewBitmapSize - Cache->BitmapSize);
+    Cache->Bitmap     = NewBitmap;
+    Cache->BitmapSize = NewBitmapSize;
+  }
+
+  Cache->Bitmap[Index / 8] |= (UINT8)(1 << (Index % 8));
+}
+
+/**
+  Dump the statistics of the Supported() result cache.
+
+**/
+VOID
+CoreDumpDriverSupportedCacheStatistics (
+  VOID
+  )
+{
+  if (FeaturePcdGet (PcdDriverBindingSupportedCache)) {
+    DEBUG ((
+      DEBUG_INFO,
+      "Driver Binding Supported() cache: %ld probes, %ld skipped\n",
+      mDriverSupportedCacheProbes,
+      mDriverSupportedCacheSkips
+      ));
+  }
+}
+
 /**
   Connects a controller to a driver.
 
@@ -415,6 +695,7 @@ CoreConnectSingleController (
   UINTN                                      SortIndex;
   BOOLEAN                                    OneStarted;
   BOOLEAN                                    DriverFound;
+  DRIVER_SUPPORTED_CACHE                     *SupportedCache;
 
   //
   // Initialize local variables
@@ -619,6 +900,15 @@ CoreConnectSingleController (
     }
   }
 
+  //
+  // EFI_UNSUPPORTED from Supported() without a RemainingDevicePath only depends
+  // on the controller, so it is cached until the controller is modified.
+  //
+  SupportedCache = NULL;
+  if (FeaturePcdGet (PcdDriverBindingSupportedCache) && (RemainingDevicePath == NULL)) {
+    SupportedCache = CoreGetDriverSupportedCache (ControllerHandle);
+  }
+
   //
   // Loop until no more drivers can be started on ControllerHandle
   //
@@ -634,6 +924,14 @@ CoreConnectSingleController (
     for (Index = 0; (Index < NumberOfSortedDriverBindingProtocols) && !DriverFound; Index++) {
       if (SortedDriverBindingProtocols[Index] != NULL) {
         DriverBinding = SortedDriverBindingProtocols[Index];
+        if (SupportedCache != NULL) {
+          mDriverSupportedCacheProbes++;
+          if (CoreIsDriverUnsupportedCached (SupportedCache, DriverBinding)) {
+            mDriverSupportedCacheSkips++;
+            continue;
+          }
+        }
+
         PERF_DRIVER_BINDING_SUPPORT_BEGIN (DriverBinding->DriverBindingHandle, ControllerHandle);
         Status = DriverBinding->Supported (
                                   DriverBinding,
@@ -641,10 +939,27 @@ CoreConnectSingleController (
                                   RemainingDevicePath
                                   );
         PERF_DRIVER_BINDING_SUPPORT_END (DriverBinding->DriverBindingHandle, ControllerHandle);
+        if ((Status == EFI_UNSUPPORTED) && (SupportedCache != NULL)) {
+          //
+          // Supported() may have modified ControllerHandle, so look up the
+          // cache again rather than record the result in a stale one.
+          //
+          SupportedCache = CoreGetDriverSupportedCache (ControllerHandle);
+          if (SupportedCache != NULL) {
+            CoreCacheDriverUnsupported (SupportedCache, DriverBinding);
+          }
+        }
+
         if (!EFI_ERROR (Status)) {
           SortedDriverBindingProtocols[Index] = NULL;
           DriverFound                         = TRUE;
 
+          //
+          // Start() may modify or even destroy ControllerHandle, so do not use
+          // the cache for the remaining Driver Binding Protocols.
+          //
+          SupportedCache = NULL;
+
           //
           // A driver was found that supports ControllerHandle, so attempt to start the driver
           // on ControllerHandle.
@@ -765,6 +1080,12 @@ CoreDisconnectController (
     return Status;
   }
 
+  //
+  // Stopping drivers releases protocols they opened BY_DRIVER, which may make
+  // other drivers support controllers they did not support before.
+  //
+  mDriverSupportedCacheGeneration++;
+
   //
   // Make sure ChildHandle is valid if it is not NULL
   //
@@ -441,6 +441,7 @@ CoreInstallProtocolInterfaceNotify (
   // protocol list for this handle
   //
   InsertHeadList (&Handle->Protocols, &Prot->Link);
+  Handle->ModificationCount++;
 
   //
   // Add this protocol interface to the tail of the
@@ -756,6 +757,7 @@ CoreUninstallProtocolInterface (
     // Remove the protocol interface from the handle
     //
     RemoveEntryList (&Prot->Link);
+    Handle->ModificationCount++;
 
     //
     // Free the memory
@@ -771,6 +773,7 @@ CoreUninstallProtocolInterface (
   if (IsListEmpty (&Handle->Protocols)) {
     Handle->Signature = 0;
     RemoveEntryList (&Handle->AllHandles);
+    CoreFreeDriverSupportedCache (Handle);
     CoreFreePool (Handle);
   }
 
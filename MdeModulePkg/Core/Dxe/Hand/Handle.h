@@ -23,6 +23,9 @@ typedef struct {
   UINTN         LocateRequest;
   /// The Handle Database Key value when this handle was last created or modified
   UINT64        Key;
+  /// Incremented each time a protocol interface is installed, uninstalled or
+  /// reinstalled on this handle
+  UINTN         ModificationCount;
 } IHANDLE;
 
 #define ASSERT_IS_HANDLE(a)  ASSERT((a)->Signature == EFI_HANDLE_SIGNATURE)
@@ -242,6 +245,55 @@ CoreValidateHandle (
   IN  EFI_HANDLE  UserHandle
   );
 
+/**
+  Free the Supported() result cache entries that refer to a handle that is
+  being freed.
+
+  @param  Handle  The handle that is being freed.
+
+**/
+VOID
+CoreFreeDriverSupportedCache (
+  IN IHANDLE  *Handle
+  );
+
+#define DRIVER_BINDING_INDEX_SIGNATURE  SIGNATURE_32('d','b','i','x')
+
+///
+/// DRIVER_BINDING_INDEX - assigns a compact index to a Driver Binding Protocol,
+/// used as the bit position in the Supported() result cache.
+///
+typedef struct {
+  UINTN                          Signature;
+  /// Link Entry inserted to a bucket of mDriverBindingIndexTable
+  LIST_ENTRY                     Link;
+  EFI_DRIVER_BINDING_PROTOCOL    *DriverBinding;
+  EFI_HANDLE                     DriverBindingHandle;
+  /// The ModificationCount of DriverBindingHandle when the index was assigned
+  UINTN                          ModificationCount;
+  UINTN                          Index;
+} DRIVER_BINDING_INDEX;
+
+#define DRIVER_SUPPORTED_CACHE_SIGNATURE  SIGNATURE_32('d','s','c','e')
+
+///
+/// DRIVER_SUPPORTED_CACHE - the Driver Binding Protocols whose Supported()
+/// returned EFI_UNSUPPORTED for a controller, while the controller was unchanged.
+///
+typedef struct {
+  UINTN         Signature;
+  /// Link Entry inserted to a bucket of mDriverSupportedCacheTable
+  LIST_ENTRY    Link;
+  EFI_HANDLE    ControllerHandle;
+  /// The ModificationCount of ControllerHandle when the results were recorded
+  UINTN         ModificationCount;
+  /// The DisconnectController() generation when the results were recorded
+  UINTN         Generation;
+  /// Bit N is set if the driver binding with index N is not supported
+  UINTN         BitmapSize;
+  UINT8         *Bitmap;
+} DRIVER_SUPPORTED_CACHE;
+
 //
 // Externs
 //
@@ -248,6 +248,7 @@ CoreReinstallProtocolInterface (
   //
   gHandleDatabaseKey++;
   Handle->Key = gHandleDatabaseKey;
+  Handle->ModificationCount++;
 
   //
   // Release the lock and connect all drivers to UserHandle
@@ -1242,12 +1242,14 @@ CoreLoadImageCommon (
     //
     // Get the source file buffer by its device path.
     //
+    PERF_INMODULE_BEGIN ("DxeLoadImageRead");
     FHand.Source = GetFileBufferByFilePath (
                      BootPolicy,
                      FilePath,
                      &FHand.SourceSize,
                      &AuthenticationStatus
                      );
+    PERF_INMODULE_END ("DxeLoadImageRead");
     if (FHand.Source == NULL) {
       Status = EFI_NOT_FOUND;
     } else {
@@ -1266,6 +1268,11 @@ CoreLoadImageCommon (
     goto Done;
   }
 
+  //
+  // The verification and the measurement of the image are done by the
+  // security handlers, each of them passing over the whole file buffer.
+  //
+  PERF_INMODULE_BEGIN ("DxeLoadImageVerify");
   if (gSecurity2 != NULL) {
     //
     // Verify File Authentication through the Security2 Architectural Protocol
@@ -1304,6 +1311,8 @@ CoreLoadImageCommon (
                                   );
   }
 
+  PERF_INMODULE_END ("DxeLoadImageVerify");
+
   //
   // Check Security Status.
   //
@@ -1376,7 +1385,9 @@ CoreLoadImageCommon (
   //
   // Load the image.  If EntryPoint is Null, it will not be set.
   //
+  PERF_INMODULE_BEGIN ("DxeLoadImagePeLoad");
   Status = CoreLoadPeImage (BootPolicy, &FHand, Image, DstBuffer, EntryPoint, Attribute);
+  PERF_INMODULE_END ("DxeLoadImagePeLoad");
   if (EFI_ERROR (Status)) {
     if ((Status == EFI_BUFFER_TOO_SMALL) || (Status == EFI_OUT_OF_RESOURCES)) {
       if (NumberOfPages != NULL) {
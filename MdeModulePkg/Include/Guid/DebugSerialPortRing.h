@@ -0,0 +1,78 @@
+/** @file
+  GUID and data structure of the GUIDed HOB which holds the debug message ring
+  buffer shared by the PEI and DXE instances of DebugLibSerialPortRing.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __DEBUG_SERIAL_PORT_RING_H__
+#define __DEBUG_SERIAL_PORT_RING_H__
+
+///
+/// Global ID of the GUIDed HOB that starts with a structure of type
+/// EDKII_DEBUG_SERIAL_PORT_RING, followed by Size bytes of message data.
+///
+///  <pre>
+///  +-------------+-------------------------------------------------+
+///  | Ring header | Message data                                    |
+///  +-------------+-------------------------------------------------+
+///                ^          ^                   ^                  ^
+///                +-- Tail --+                   |                  |
+///                +------------ Head ------------+                  |
+///                +---------------------- Size ---------------------+
+///  </pre>
+///
+#define EDKII_DEBUG_SERIAL_PORT_RING_GUID \
+  { \
+    0x7e5b70d0, 0xaf5e, 0x4084, { 0xaa, 0x2d, 0xf1, 0xcc, 0x8d, 0x1a, 0xce, 0x00 } \
+  }
+
+///
+/// Messages are not queued any more, and are written to the serial port directly.
+///
+#define EDKII_DEBUG_SERIAL_PORT_RING_FLAG_DIRECT  BIT0
+
+///
+/// The ring buffer header. It only holds fixed size fields, so the HOB built by
+/// a 32-bit PEI phase can be consumed by a 64-bit DXE phase.
+///
+typedef struct {
+  ///
+  /// The size of the message data in bytes.
+  ///
+  UINT32             Size;
+  ///
+  /// The offset in the message data where the next message is written.
+  ///
+  UINT32             Head;
+  ///
+  /// The offset in the message data of the oldest message not yet written out.
+  ///
+  UINT32             Tail;
+  ///
+  /// The number of bytes queued in the message data.
+  ///
+  UINT32             Used;
+  ///
+  /// EDKII_DEBUG_SERIAL_PORT_RING_FLAG_* bits.
+  ///
+  UINT32             Flags;
+  ///
+  /// Non-zero while a caller owns Head, Tail and Used.
+  ///
+  volatile UINT32    Lock;
+  ///
+  /// Non-zero while a caller writes queued messages to the serial port.
+  ///
+  volatile UINT32    Draining;
+  ///
+  /// Non-zero once a DXE module drains the ring buffer periodically.
+  ///
+  volatile UINT32    DrainOwned;
+} EDKII_DEBUG_SERIAL_PORT_RING;
+
+extern EFI_GUID  gEdkiiDebugSerialPortRingHobGuid;
+
+#endif
@@ -23,7 +23,41 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define LZMAF86_CUSTOM_DECOMPRESS_GUID  \
   { 0xD42AE6BD, 0x1352, 0x4bfb, { 0x90, 0x9A, 0xCA, 0x72, 0xA6, 0xEA, 0xE8, 0x89 } }
 
+///
+/// The Global ID used to identify a section of an FFS file of type
+/// EFI_SECTION_GUID_DEFINED, whose contents have been split into chunks that
+/// are compressed independently using LZMA, so they can be decompressed in
+/// parallel.
+///
+#define LZMA_CHUNKED_CUSTOM_DECOMPRESS_GUID  \
+  { 0x65F0C31E, 0x3DD7, 0x4E7D, { 0x98, 0x63, 0x68, 0xAE, 0x3C, 0x41, 0x4B, 0x9B } }
+
+#define LZMA_CHUNKED_SIGNATURE  SIGNATURE_32 ('L', 'Z', 'C', 'K')
+
+///
+/// The data of a section identified by LZMA_CHUNKED_CUSTOM_DECOMPRESS_GUID
+/// starts with this header. It is followed by an index of ChunkCount UINT32,
+/// the compressed size of each chunk, and then by the chunks in order.
+///
+/// Every chunk is a complete LZMA stream, including its own header, of
+/// ChunkSize bytes of the decompressed data. Only the last chunk may be
+/// smaller. All the fields are little endian.
+///
+typedef struct {
+  UINT32    Signature;
+  ///
+  /// The size, in bytes, of the decompressed data.
+  ///
+  UINT32    DecompressedSize;
+  ///
+  /// The size, in bytes, of the decompressed data of a chunk.
+  ///
+  UINT32    ChunkSize;
+  UINT32    ChunkCount;
+} LZMA_CHUNKED_HEADER;
+
 extern GUID  gLzmaCustomDecompressGuid;
 extern GUID  gLzmaF86CustomDecompressGuid;
+extern GUID  gLzmaChunkedCustomDecompressGuid;
 
 #endif
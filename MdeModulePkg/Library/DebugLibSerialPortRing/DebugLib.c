@@ -0,0 +1,498 @@
+/** @file
+  Debug library instance which queues debug messages in a ring buffer and
+  writes them to the serial port in batches.
+
+  The ring buffer lives in a GUIDed HOB, so messages queued in the PEI phase
+  are carried over to the DXE phase and written out in order. ASSERT() and
+  DEBUG_ERROR messages drain the ring buffer and are written out immediately.
+
+  Copyright (c) 2006 - 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "DebugLibSerialPortRing.h"
+
+//
+// VA_LIST can not initialize to NULL for all compiler, so we use this to
+// indicate a null VA_LIST
+//
+VA_LIST  mVaListNull;
+
+/**
+  Try to take the lock of the ring buffer.
+
+  The lock is never waited for. A caller which interrupted the lock owner would
+  otherwise dead lock.
+
+  @param  Ring  The debug message ring buffer.
+
+  @retval TRUE   The lock is taken.
+  @retval FALSE  The lock is owned by another caller.
+
+**/
+BOOLEAN
+InternalAcquireDebugSerialPortRing (
+  IN EDKII_DEBUG_SERIAL_PORT_RING  *Ring
+  )
+{
+  return (BOOLEAN)(InterlockedCompareExchange32 (&Ring->Lock, 0, 1) == 0);
+}
+
+/**
+  Release the lock of the ring buffer.
+
+  @param  Ring  The debug message ring buffer.
+
+**/
+VOID
+InternalReleaseDebugSerialPortRing (
+  IN EDKII_DEBUG_SERIAL_PORT_RING  *Ring
+  )
+{
+  MemoryFence ();
+  Ring->Lock = 0;
+}
+
+/**
+  Write all messages queued in the ring buffer to the serial port.
+
+  @param  Ring   The debug message ring buffer.
+  @param  Force  TRUE to write the messages out even if the caller interrupted
+                 another caller which owns the ring buffer. Only used when the
+                 interrupted caller never resumes.
+
+**/
+VOID
+InternalFlushDebugSerialPortRing (
+  IN EDKII_DEBUG_SERIAL_PORT_RING  *Ring,
+  IN BOOLEAN                       Force
+  )
+{
+  UINT8   *Data;
+  UINT8   Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+  UINT32  Count;
+  UINT32  FirstCount;
+
+  //
+  // Only one caller may write queued messages at a time, to keep them in order.
+  //
+  if ((InterlockedCompareExchange32 (&Ring->Draining, 0, 1) != 0) && !Force) {
+    return;
+  }
+
+  if (Force) {
+    //
+    // The owner of the lock never resumes, take the lock over. A message it
+    // was queueing at the time may be written out partially.
+    //
+    Ring->Lock = 0;
+  }
+
+  Data = (UINT8 *)(Ring + 1);
+  while (InternalAcquireDebugSerialPortRing (Ring)) {
+    //
+    // Copy a chunk out of the ring buffer, so the lock is not held while the
+    // serial port is busy.
+    //
+    Count = MIN (Ring->Used, sizeof (Buffer));
+    if (Count != 0) {
+      FirstCount = MIN (Count, Ring->Size - Ring->Tail);
+      CopyMem (Buffer, &Data[Ring->Tail], FirstCount);
+      CopyMem (&Buffer[FirstCount], Data, Count - FirstCount);
+      Ring->Tail = (Ring->Tail + Count) % Ring->Size;
+      Ring->Used = Ring->Used - Count;
+    }
+
+    InternalReleaseDebugSerialPortRing (Ring);
+
+    if (Count == 0) {
+      break;
+    }
+
+    SerialPortWrite (Buffer, Count);
+  }
+
+  MemoryFence ();
+  Ring->Draining = 0;
+}
+
+/**
+  Queue a message in the ring buffer, or write it to the serial port if it
+  cannot be queued.
+
+  @param  Buffer   The message to write.
+  @param  Length   The number of bytes in Buffer.
+  @param  Urgent   TRUE to drain the ring buffer and write the message to the
+                   serial port immediately.
+
+**/
+VOID
+InternalDebugSerialPortRingWrite (
+  IN CONST CHAR8  *Buffer,
+  IN UINTN        Length,
+  IN BOOLEAN      Urgent
+  )
+{
+  EDKII_DEBUG_SERIAL_PORT_RING  *Ring;
+  UINT8                         *Data;
+  UINT32                        FirstCount;
+
+  Ring = InternalGetDebugSerialPortRing ();
+  if ((Ring == NULL) || ((Ring->Flags & EDKII_DEBUG_SERIAL_PORT_RING_FLAG_DIRECT) != 0)) {
+    SerialPortWrite ((UINT8 *)Buffer, Length);
+    return;
+  }
+
+  if (Urgent || (Length > Ring->Size - Ring->Used)) {
+    InternalFlushDebugSerialPortRing (Ring, FALSE);
+  }
+
+  if (!Urgent && InternalAcquireDebugSerialPortRing (Ring)) {
+    if (Length <= Ring->Size - Ring->Used) {
+      Data       = (UINT8 *)(Ring + 1);
+      FirstCount = MIN ((UINT32)Length, Ring->Size - Ring->Head);
+      CopyMem (&Data[Ring->Head], Buffer, FirstCount);
+      CopyMem (Data, &Buffer[FirstCount], Length - FirstCount);
+      Ring->Head = (Ring->Head + (UINT32)Length) % Ring->Size;
+      Ring->Used = Ring->Used + (UINT32)Length;
+      InternalReleaseDebugSerialPortRing (Ring);
+      return;
+    }
+
+    InternalReleaseDebugSerialPortRing (Ring);
+  }
+
+  //
+  // The message is urgent, or the ring buffer is busy or still full.
+  //
+  SerialPortWrite ((UINT8 *)Buffer, Length);
+}
+
+/**
+  Prints a debug message to the debug output device if the specified error level is enabled.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and the
+  associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel  The error level of the debug message.
+  @param  Format      Format string for the debug message to print.
+  @param  ...         Variable argument list whose contents are accessed
+                      based on the format string specified by Format.
+
+**/
+VOID
+EFIAPI
+DebugPrint (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  ...
+  )
+{
+  VA_LIST  Marker;
+
+  VA_START (Marker, Format);
+  DebugVPrint (ErrorLevel, Format, Marker);
+  VA_END (Marker);
+}
+
+/**
+  Prints a debug message to the debug output device if the specified
+  error level is enabled base on Null-terminated format string and a
+  VA_LIST argument list or a BASE_LIST argument list.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and
+  the associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel      The error level of the debug message.
+  @param  Format          Format string for the debug message to print.
+  @param  VaListMarker    VA_LIST marker for the variable argument list.
+  @param  BaseListMarker  BASE_LIST marker for the variable argument list.
+
+**/
+VOID
+DebugPrintMarker (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  IN  VA_LIST      VaListMarker,
+  IN  BASE_LIST    BaseListMarker
+  )
+{
+  CHAR8  Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+
+  //
+  // If Format is NULL, then ASSERT().
+  //
+  ASSERT (Format != NULL);
+
+  //
+  // Check driver debug mask value and global mask
+  //
+  if ((ErrorLevel & GetDebugPrintErrorLevel ()) == 0) {
+    return;
+  }
+
+  //
+  // Convert the DEBUG() message to an ASCII String
+  //
+  if (BaseListMarker == NULL) {
+    AsciiVSPrint (Buffer, sizeof (Buffer), Format, VaListMarker);
+  } else {
+    AsciiBSPrint (Buffer, sizeof (Buffer), Format, BaseListMarker);
+  }
+
+  //
+  // Queue the print string, error messages are sent to the Serial Port at once
+  //
+  InternalDebugSerialPortRingWrite (Buffer, AsciiStrLen (Buffer), (BOOLEAN)((ErrorLevel & DEBUG_ERROR) != 0));
+}
+
+/**
+  Prints a debug message to the debug output device if the specified
+  error level is enabled.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and
+  the associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel    The error level of the debug message.
+  @param  Format        Format string for the debug message to print.
+  @param  VaListMarker  VA_LIST marker for the variable argument list.
+
+**/
+VOID
+EFIAPI
+DebugVPrint (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  IN  VA_LIST      VaListMarker
+  )
+{
+  DebugPrintMarker (ErrorLevel, Format, VaListMarker, NULL);
+}
+
+/**
+  Prints a debug message to the debug output device if the specified
+  error level is enabled.
+  This function use BASE_LIST which would provide a more compatible
+  service than VA_LIST.
+
+  If any bit in ErrorLevel is also set in DebugPrintErrorLevelLib function
+  GetDebugPrintErrorLevel (), then print the message specified by Format and
+  the associated variable argument list to the debug output device.
+
+  If Format is NULL, then ASSERT().
+
+  @param  ErrorLevel      The error level of the debug message.
+  @param  Format          Format string for the debug message to print.
+  @param  BaseListMarker  BASE_LIST marker for the variable argument list.
+
+**/
+VOID
+EFIAPI
+DebugBPrint (
+  IN  UINTN        ErrorLevel,
+  IN  CONST CHAR8  *Format,
+  IN  BASE_LIST    BaseListMarker
+  )
+{
+  DebugPrintMarker (ErrorLevel, Format, mVaListNull, BaseListMarker);
+}
+
+/**
+  Prints an assert message containing a filename, line number, and description.
+  This may be followed by a breakpoint or a dead loop.
+
+  Print a message of the form "ASSERT <FileName>(<LineNumber>): <Description>\n"
+  to the debug output device.  If DEBUG_PROPERTY_ASSERT_BREAKPOINT_ENABLED bit of
+  PcdDebugProperyMask is set then CpuBreakpoint() is called. Otherwise, if
+  DEBUG_PROPERTY_ASSERT_DEADLOOP_ENABLED bit of PcdDebugProperyMask is set then
+  CpuDeadLoop() is called.  If neither of these bits are set, then this function
+  returns immediately after the message is printed to the debug output device.
+  DebugAssert() must actively prevent recursion.  If DebugAssert() is called while
+  processing another DebugAssert(), then DebugAssert() must return immediately.
+
+  If FileName is NULL, then a <FileName> string of "(NULL) Filename" is printed.
+  If Description is NULL, then a <Description> string of "(NULL) Description" is printed.
+
+  @param  FileName     The pointer to the name of the source file that generated the assert condition.
+  @param  LineNumber   The line number in the source file that generated the assert condition
+  @param  Description  The pointer to the description of the assert condition.
+
+**/
+VOID
+EFIAPI
+DebugAssert (
+  IN CONST CHAR8  *FileName,
+  IN UINTN        LineNumber,
+  IN CONST CHAR8  *Description
+  )
+{
+  CHAR8                         Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+  EDKII_DEBUG_SERIAL_PORT_RING  *Ring;
+
+  //
+  // Generate the ASSERT() message in Ascii format
+  //
+  AsciiSPrint (Buffer, sizeof (Buffer), "ASSERT [%a] %a(%d): %a\n", gEfiCallerBaseName, FileName, LineNumber, Description);
+
+  //
+  // A breakpoint or dead loop follows, so the queued messages are written out
+  // even if this ASSERT() interrupted the caller which was writing them.
+  //
+  Ring = InternalGetDebugSerialPortRing ();
+  if ((Ring != NULL) &&
+      ((PcdGet8 (PcdDebugPropertyMask) & (DEBUG_PROPERTY_ASSERT_BREAKPOINT_ENABLED | DEBUG_PROPERTY_ASSERT_DEADLOOP_ENABLED)) != 0))
+  {
+    InternalFlushDebugSerialPortRing (Ring, TRUE);
+  }
+
+  //
+  // Drain the queued messages and send the assert message to the Serial Port
+  //
+  InternalDebugSerialPortRingWrite (Buffer, AsciiStrLen (Buffer), TRUE);
+
+  //
+  // Generate a Breakpoint, DeadLoop, or NOP based on PCD settings
+  //
+  if ((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_ASSERT_BREAKPOINT_ENABLED) != 0) {
+    CpuBreakpoint ();
+  } else if ((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_ASSERT_DEADLOOP_ENABLED) != 0) {
+    CpuDeadLoop ();
+  }
+}
+
+/**
+  Fills a target buffer with PcdDebugClearMemoryValue, and returns the target buffer.
+
+  This function fills Length bytes of Buffer with the value specified by
+  PcdDebugClearMemoryValue, and returns Buffer.
+
+  If Buffer is NULL, then ASSERT().
+  If Length is greater than (MAX_ADDRESS - Buffer + 1), then ASSERT().
+
+  @param   Buffer  The pointer to the target buffer to be filled with PcdDebugClearMemoryValue.
+  @param   Length  The number of bytes in Buffer to fill with zeros PcdDebugClearMemoryValue.
+
+  @return  Buffer  The pointer to the target buffer filled with PcdDebugClearMemoryValue.
+
+**/
+VOID *
+EFIAPI
+DebugClearMemory (
+  OUT VOID  *Buffer,
+  IN UINTN  Length
+  )
+{
+  //
+  // If Buffer is NULL, then ASSERT().
+  //
+  ASSERT (Buffer != NULL);
+
+  //
+  // SetMem() checks for the the ASSERT() condition on Length and returns Buffer
+  //
+  return SetMem (Buffer, Length, PcdGet8 (PcdDebugClearMemoryValue));
+}
+
+/**
+  Returns TRUE if ASSERT() macros are enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugAssertEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_DEBUG_ASSERT_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if DEBUG() macros are enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_DEBUG_PRINT_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_DEBUG_PRINT_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_DEBUG_PRINT_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugPrintEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_DEBUG_PRINT_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if DEBUG_CODE() macros are enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_DEBUG_CODE_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_DEBUG_CODE_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_DEBUG_CODE_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugCodeEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_DEBUG_CODE_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if DEBUG_CLEAR_MEMORY() macro is enabled.
+
+  This function returns TRUE if the DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED bit of
+  PcdDebugProperyMask is set.  Otherwise FALSE is returned.
+
+  @retval  TRUE    The DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED bit of PcdDebugProperyMask is set.
+  @retval  FALSE   The DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED bit of PcdDebugProperyMask is clear.
+
+**/
+BOOLEAN
+EFIAPI
+DebugClearMemoryEnabled (
+  VOID
+  )
+{
+  return (BOOLEAN)((PcdGet8 (PcdDebugPropertyMask) & DEBUG_PROPERTY_CLEAR_MEMORY_ENABLED) != 0);
+}
+
+/**
+  Returns TRUE if any one of the bit is set both in ErrorLevel and PcdFixedDebugPrintErrorLevel.
+
+  This function compares the bit mask of ErrorLevel and PcdFixedDebugPrintErrorLevel.
+
+  @retval  TRUE    Current ErrorLevel is supported.
+  @retval  FALSE   Current ErrorLevel is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+DebugPrintLevelEnabled (
+  IN  CONST UINTN  ErrorLevel
+  )
+{
+  return (BOOLEAN)((ErrorLevel & PcdGet32 (PcdFixedDebugPrintErrorLevel)) != 0);
+}
@@ -0,0 +1,56 @@
+/** @file
+  Internal definitions of the Debug library instance which queues debug
+  messages in a ring buffer before they are written to the serial port.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __DEBUG_LIB_SERIAL_PORT_RING_H__
+#define __DEBUG_LIB_SERIAL_PORT_RING_H__
+
+#include <Uefi/UefiBaseType.h>
+#include <Guid/DebugSerialPortRing.h>
+#include <Library/DebugLib.h>
+#include <Library/BaseLib.h>
+#include <Library/PrintLib.h>
+#include <Library/PcdLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/SerialPortLib.h>
+#include <Library/DebugPrintErrorLevelLib.h>
+#include <Library/SynchronizationLib.h>
+
+//
+// Define the maximum debug and assert message length that this library supports
+//
+#define MAX_DEBUG_MESSAGE_LENGTH  0x100
+
+/**
+  Return the debug message ring buffer of the current phase.
+
+  @return The ring buffer, or NULL if messages are written to the serial port
+          directly.
+
+**/
+EDKII_DEBUG_SERIAL_PORT_RING *
+InternalGetDebugSerialPortRing (
+  VOID
+  );
+
+/**
+  Write all messages queued in the ring buffer to the serial port.
+
+  @param  Ring   The debug message ring buffer.
+  @param  Force  TRUE to write the messages out even if the caller interrupted
+                 another caller which owns the ring buffer. Only used when the
+                 interrupted caller never resumes.
+
+**/
+VOID
+InternalFlushDebugSerialPortRing (
+  IN EDKII_DEBUG_SERIAL_PORT_RING  *Ring,
+  IN BOOLEAN                       Force
+  );
+
+#endif
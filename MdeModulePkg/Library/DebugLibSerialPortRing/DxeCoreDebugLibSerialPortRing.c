@@ -0,0 +1,74 @@
+/** @file
+  DXE Core support of the Debug library instance which queues debug messages
+  in a ring buffer. The DXE Core writes out the messages queued by the PEI
+  phase when it starts. It queues its own messages only while a DXE driver
+  drains the ring buffer, and writes them to the serial port directly
+  otherwise.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+
+#include "DebugLibSerialPortRing.h"
+
+#include <Library/HobLib.h>
+
+EDKII_DEBUG_SERIAL_PORT_RING  *mDebugSerialPortRing = NULL;
+
+/**
+  The constructor function initialize the Serial Port Library, locates the
+  ring buffer HOB and writes out the messages queued by the PEI phase.
+
+  @param  ImageHandle   The firmware allocated handle for the EFI image.
+  @param  SystemTable   A pointer to the EFI System Table.
+
+  @retval RETURN_SUCCESS   The serial port is initialized.
+  @retval others           Errors from SerialPortInitialize().
+
+**/
+RETURN_STATUS
+EFIAPI
+DxeCoreDebugLibSerialPortRingConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  RETURN_STATUS      Status;
+  EFI_HOB_GUID_TYPE  *GuidHob;
+
+  Status = SerialPortInitialize ();
+
+  GuidHob = GetFirstGuidHob (&gEdkiiDebugSerialPortRingHobGuid);
+  if (GuidHob != NULL) {
+    mDebugSerialPortRing = (EDKII_DEBUG_SERIAL_PORT_RING *)GET_GUID_HOB_DATA (GuidHob);
+    InternalFlushDebugSerialPortRing (mDebugSerialPortRing, FALSE);
+  }
+
+  return Status;
+}
+
+/**
+  Return the debug message ring buffer of the current phase.
+
+  @return The ring buffer, or NULL if messages are written to the serial port
+          directly.
+
+**/
+EDKII_DEBUG_SERIAL_PORT_RING *
+InternalGetDebugSerialPortRing (
+  VOID
+  )
+{
+  //
+  // Nothing drains the ring buffer before the first DXE driver which links
+  // this library instance is loaded, or after it is unloaded.
+  //
+  if ((mDebugSerialPortRing == NULL) || (mDebugSerialPortRing->DrainOwned == 0)) {
+    return NULL;
+  }
+
+  return mDebugSerialPortRing;
+}
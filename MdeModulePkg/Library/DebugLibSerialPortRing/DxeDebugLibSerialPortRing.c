@@ -0,0 +1,351 @@
+/** @file
+  DXE driver support of the Debug library instance which queues debug messages
+  in a ring buffer.
+
+  The first DXE driver which links this instance owns the draining of the ring
+  buffer. It drains the messages queued by the PEI phase, the DXE Core and the
+  other DXE drivers from a periodic timer at TPL_CALLBACK, before ResetSystem()
+  resets the platform, and stops queueing when ExitBootServices() is called.
+  While no DXE driver owns the draining, messages are written to the serial
+  port directly.
+
+  The HOB list is located through the EFI System Table rather than through a
+  HobLib instance, as the constructor of DxeHobLib depends on DebugLib.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+
+#include "DebugLibSerialPortRing.h"
+
+#include <Guid/HobList.h>
+#include <Guid/EventGroup.h>
+#include <Protocol/ResetNotification.h>
+#include <Library/HobLib.h>
+
+//
+// Period of the timer event which drains the ring buffer, in 100ns units (10ms).
+//
+#define DEBUG_SERIAL_PORT_RING_DRAIN_PERIOD  100000
+
+EDKII_DEBUG_SERIAL_PORT_RING     *mDebugSerialPortRing             = NULL;
+EFI_BOOT_SERVICES                *mDebugSerialPortRingBootServices = NULL;
+EFI_EVENT                        mDebugSerialPortRingTimerEvent    = NULL;
+EFI_EVENT                        mDebugSerialPortRingExitBootEvent = NULL;
+EFI_EVENT                        mDebugSerialPortRingResetEvent    = NULL;
+VOID                             *mDebugSerialPortRingResetRegistration;
+EFI_RESET_NOTIFICATION_PROTOCOL  *mDebugSerialPortRingResetNotify = NULL;
+
+/**
+  Return the debug message ring buffer of the current phase.
+
+  @return The ring buffer, or NULL if messages are written to the serial port
+          directly.
+
+**/
+EDKII_DEBUG_SERIAL_PORT_RING *
+InternalGetDebugSerialPortRing (
+  VOID
+  )
+{
+  if ((mDebugSerialPortRing == NULL) || (mDebugSerialPortRing->DrainOwned == 0)) {
+    return NULL;
+  }
+
+  return mDebugSerialPortRing;
+}
+
+/**
+  Timer notification function which drains the ring buffer.
+
+  @param  Event         Event whose notification function is being invoked.
+  @param  Context       Pointer to the notification function's context.
+
+**/
+VOID
+EFIAPI
+DebugSerialPortRingDrainNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  InternalFlushDebugSerialPortRing (mDebugSerialPortRing, FALSE);
+}
+
+/**
+  Reset notification function which drains the ring buffer before the platform
+  is reset, as the ring buffer does not survive the reset.
+
+  @param[in]  ResetType     The type of reset to perform.
+  @param[in]  ResetStatus   The status code for the reset.
+  @param[in]  DataSize      The size, in bytes, of ResetData.
+  @param[in]  ResetData     Data of the reset.
+
+**/
+VOID
+EFIAPI
+DebugSerialPortRingResetNotify (
+  IN EFI_RESET_TYPE  ResetType,
+  IN EFI_STATUS      ResetStatus,
+  IN UINTN           DataSize,
+  IN VOID            *ResetData OPTIONAL
+  )
+{
+  InternalFlushDebugSerialPortRing (mDebugSerialPortRing, FALSE);
+}
+
+/**
+  Register the reset notification function once the Reset Notification
+  Protocol is installed.
+
+  @param  Event         Event whose notification function is being invoked.
+  @param  Context       Pointer to the notification function's context.
+
+**/
+VOID
+EFIAPI
+DebugSerialPortRingResetProtocolNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EFI_STATUS                       Status;
+  EFI_RESET_NOTIFICATION_PROTOCOL  *ResetNotify;
+
+  Status = mDebugSerialPortRingBootServices->LocateProtocol (
+                                               &gEfiResetNotificationProtocolGuid,
+                                               NULL,
+                                               (VOID **)&ResetNotify
+                                               );
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = ResetNotify->RegisterResetNotify (ResetNotify, DebugSerialPortRingResetNotify);
+  if (!EFI_ERROR (Status)) {
+    mDebugSerialPortRingResetNotify = ResetNotify;
+  }
+
+  mDebugSerialPortRingBootServices->CloseEvent (Event);
+  mDebugSerialPortRingResetEvent = NULL;
+}
+
+/**
+  Drain the ring buffer and write all following messages to the serial port
+  directly, as the ring buffer lives in boot services memory.
+
+  @param  Event         Event whose notification function is being invoked.
+  @param  Context       Pointer to the notification function's context.
+
+**/
+VOID
+EFIAPI
+DebugSerialPortRingExitBootServicesNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  InternalFlushDebugSerialPortRing (mDebugSerialPortRing, FALSE);
+  mDebugSerialPortRing->Flags |= EDKII_DEBUG_SERIAL_PORT_RING_FLAG_DIRECT;
+}
+
+/**
+  Locate the ring buffer HOB through the EFI System Table.
+
+  @param  SystemTable   A pointer to the EFI System Table.
+
+  @return The ring buffer, or NULL if the PEI phase did not create it.
+
+**/
+EDKII_DEBUG_SERIAL_PORT_RING *
+LocateDebugSerialPortRing (
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  UINTN                 Index;
+  EFI_PEI_HOB_POINTERS  Hob;
+
+  Hob.Raw = NULL;
+  for (Index = 0; Index < SystemTable->NumberOfTableEntries; Index++) {
+    if (CompareGuid (&gEfiHobListGuid, &SystemTable->ConfigurationTable[Index].VendorGuid)) {
+      Hob.Raw = SystemTable->ConfigurationTable[Index].VendorTable;
+      break;
+    }
+  }
+
+  if (Hob.Raw == NULL) {
+    return NULL;
+  }
+
+  while (!END_OF_HOB_LIST (Hob)) {
+    if ((GET_HOB_TYPE (Hob) == EFI_HOB_TYPE_GUID_EXTENSION) &&
+        CompareGuid (&gEdkiiDebugSerialPortRingHobGuid, &Hob.Guid->Name))
+    {
+      return (EDKII_DEBUG_SERIAL_PORT_RING *)GET_GUID_HOB_DATA (Hob.Guid);
+    }
+
+    Hob.Raw = GET_NEXT_HOB (Hob);
+  }
+
+  return NULL;
+}
+
+/**
+  The constructor function initialize the Serial Port Library, locates the
+  ring buffer HOB and takes the ownership of the draining if no other DXE
+  driver owns it.
+
+  @param  ImageHandle   The firmware allocated handle for the EFI image.
+  @param  SystemTable   A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS   The serial port is initialized.
+  @retval others        Errors from SerialPortInitialize().
+
+**/
+EFI_STATUS
+EFIAPI
+DxeDebugLibSerialPortRingConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS                    Status;
+  EDKII_DEBUG_SERIAL_PORT_RING  *Ring;
+
+  Status = SerialPortInitialize ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Ring = LocateDebugSerialPortRing (SystemTable);
+  if ((Ring == NULL) || ((Ring->Flags & EDKII_DEBUG_SERIAL_PORT_RING_FLAG_DIRECT) != 0)) {
+    return EFI_SUCCESS;
+  }
+
+  mDebugSerialPortRing = Ring;
+
+  if (InterlockedCompareExchange32 (&Ring->DrainOwned, 0, 1) != 0) {
+    return EFI_SUCCESS;
+  }
+
+  mDebugSerialPortRingBootServices = SystemTable->BootServices;
+
+  Status = mDebugSerialPortRingBootServices->CreateEvent (
+                                               EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                                               TPL_CALLBACK,
+                                               DebugSerialPortRingDrainNotify,
+                                               NULL,
+                                               &mDebugSerialPortRingTimerEvent
+                                               );
+  if (!EFI_ERROR (Status)) {
+    Status = mDebugSerialPortRingBootServices->SetTimer (
+                                                 mDebugSerialPortRingTimerEvent,
+                                                 TimerPeriodic,
+                                                 DEBUG_SERIAL_PORT_RING_DRAIN_PERIOD
+                                                 );
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = mDebugSerialPortRingBootServices->CreateEventEx (
+                                                 EVT_NOTIFY_SIGNAL,
+                                                 TPL_NOTIFY,
+                                                 DebugSerialPortRingExitBootServicesNotify,
+                                                 NULL,
+                                                 &gEfiEventExitBootServicesGuid,
+                                                 &mDebugSerialPortRingExitBootEvent
+                                                 );
+  }
+
+  if (EFI_ERROR (Status)) {
+    //
+    // Without the events queued messages would be delayed until the ring
+    // buffer is full, so write messages of this boot to the serial port.
+    //
+    if (mDebugSerialPortRingTimerEvent != NULL) {
+      mDebugSerialPortRingBootServices->CloseEvent (mDebugSerialPortRingTimerEvent);
+      mDebugSerialPortRingTimerEvent = NULL;
+    }
+
+    InternalFlushDebugSerialPortRing (Ring, FALSE);
+    Ring->Flags |= EDKII_DEBUG_SERIAL_PORT_RING_FLAG_DIRECT;
+    mDebugSerialPortRingBootServices = NULL;
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Drain the ring buffer before ResetSystem() resets the platform. Without the
+  // Reset Notification Protocol only messages queued since the last timer tick
+  // are lost on a reset, so the draining goes on if it cannot be registered.
+  //
+  Status = mDebugSerialPortRingBootServices->CreateEvent (
+                                               EVT_NOTIFY_SIGNAL,
+                                               TPL_CALLBACK,
+                                               DebugSerialPortRingResetProtocolNotify,
+                                               NULL,
+                                               &mDebugSerialPortRingResetEvent
+                                               );
+  if (!EFI_ERROR (Status)) {
+    Status = mDebugSerialPortRingBootServices->RegisterProtocolNotify (
+                                                 &gEfiResetNotificationProtocolGuid,
+                                                 mDebugSerialPortRingResetEvent,
+                                                 &mDebugSerialPortRingResetRegistration
+                                                 );
+    if (!EFI_ERROR (Status)) {
+      mDebugSerialPortRingBootServices->SignalEvent (mDebugSerialPortRingResetEvent);
+    } else {
+      mDebugSerialPortRingBootServices->CloseEvent (mDebugSerialPortRingResetEvent);
+      mDebugSerialPortRingResetEvent = NULL;
+    }
+  }
+
+  //
+  // Write out what was queued by the PEI phase and the DXE Core.
+  //
+  InternalFlushDebugSerialPortRing (Ring, FALSE);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  The destructor function drains the ring buffer and gives up the ownership of
+  the draining, so the next DXE driver which is loaded takes it over.
+
+  @param  ImageHandle   The firmware allocated handle for the EFI image.
+  @param  SystemTable   A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS   The destructor always returns EFI_SUCCESS.
+
+**/
+EFI_STATUS
+EFIAPI
+DxeDebugLibSerialPortRingDestructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  if (mDebugSerialPortRingBootServices == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  mDebugSerialPortRingBootServices->CloseEvent (mDebugSerialPortRingTimerEvent);
+  mDebugSerialPortRingBootServices->CloseEvent (mDebugSerialPortRingExitBootEvent);
+  if (mDebugSerialPortRingResetEvent != NULL) {
+    mDebugSerialPortRingBootServices->CloseEvent (mDebugSerialPortRingResetEvent);
+  }
+
+  if (mDebugSerialPortRingResetNotify != NULL) {
+    mDebugSerialPortRingResetNotify->UnregisterResetNotify (
+                                       mDebugSerialPortRingResetNotify,
+                                       DebugSerialPortRingResetNotify
+                                       );
+  }
+
+  InternalFlushDebugSerialPortRing (mDebugSerialPortRing, FALSE);
+  MemoryFence ();
+  mDebugSerialPortRing->DrainOwned = 0;
+
+  return EFI_SUCCESS;
+}
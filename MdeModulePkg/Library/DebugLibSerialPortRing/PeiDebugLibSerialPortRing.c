@@ -0,0 +1,89 @@
+/** @file
+  PEI phase support of the Debug library instance which queues debug messages
+  in a ring buffer. The ring buffer is created in a GUIDed HOB by the first
+  PEIM which prints a debug message.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiPei.h>
+
+#include "DebugLibSerialPortRing.h"
+
+#include <Library/HobLib.h>
+#include <Library/PeiServicesLib.h>
+
+/**
+  The constructor function initialize the Serial Port Library
+
+  @param  FileHandle   The handle of FFS header the loaded driver.
+  @param  PeiServices  The pointer to the PEI services.
+
+  @retval RETURN_SUCCESS   The serial port is initialized.
+  @retval others           Errors from SerialPortInitialize().
+
+**/
+RETURN_STATUS
+EFIAPI
+PeiDebugLibSerialPortRingConstructor (
+  IN EFI_PEI_FILE_HANDLE     FileHandle,
+  IN CONST EFI_PEI_SERVICES  **PeiServices
+  )
+{
+  return SerialPortInitialize ();
+}
+
+/**
+  Return the debug message ring buffer of the current phase.
+
+  @return The ring buffer, or NULL if messages are written to the serial port
+          directly.
+
+**/
+EDKII_DEBUG_SERIAL_PORT_RING *
+InternalGetDebugSerialPortRing (
+  VOID
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_HOB_GUID_TYPE             *GuidHob;
+  EDKII_DEBUG_SERIAL_PORT_RING  *Ring;
+  UINT32                        Size;
+
+  Size = FixedPcdGet32 (PcdDebugSerialPortRingSize);
+  if (Size == 0) {
+    return NULL;
+  }
+
+  GuidHob = GetFirstGuidHob (&gEdkiiDebugSerialPortRingHobGuid);
+  if (GuidHob != NULL) {
+    return (EDKII_DEBUG_SERIAL_PORT_RING *)GET_GUID_HOB_DATA (GuidHob);
+  }
+
+  //
+  // A HOB is limited to 64KB, leave room for the HOB and ring headers.
+  //
+  Size = MIN (Size, SIZE_64KB - SIZE_4KB);
+
+  //
+  // Create the HOB through PEI services rather than BuildGuidHob(), which
+  // ASSERT()s and would recurse into this library when out of HOB space.
+  //
+  Status = PeiServicesCreateHob (
+             EFI_HOB_TYPE_GUID_EXTENSION,
+             (UINT16)(sizeof (EFI_HOB_GUID_TYPE) + sizeof (EDKII_DEBUG_SERIAL_PORT_RING) + Size),
+             (VOID **)&GuidHob
+             );
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  CopyGuid (&GuidHob->Name, &gEdkiiDebugSerialPortRingHobGuid);
+  Ring = (EDKII_DEBUG_SERIAL_PORT_RING *)GET_GUID_HOB_DATA (GuidHob);
+  ZeroMem (Ring, sizeof (EDKII_DEBUG_SERIAL_PORT_RING));
+  Ring->Size = Size;
+
+  return Ring;
+}
@@ -59,12 +59,15 @@ typedef struct {
 HANDLE_GUID_MAP  mCacheHandleGuidTable[CACHE_HANDLE_GUID_COUNT];
 UINTN            mCachePairCount = 0;
 
+FPDT_OPEN_RECORD_STACK  mOpenStartImageRecords;
+FPDT_OPEN_RECORD_STACK  mOpenLoadImageRecords;
+
 UINT32  mLoadImageCount       = 0;
 UINT32  mPerformanceLength    = 0;
 UINT32  mMaxPerformanceLength = 0;
 UINT32  mBootRecordSize       = 0;
 UINTN   mBootRecordMaxSize    = 0;
-UINT32  mCachedLength         = 0;
+UINT32  mRawTimestampOffset   = 0;
 
 BOOLEAN  mFpdtBufferIsReported = FALSE;
 BOOLEAN  mLackSpaceIsReported  = FALSE;
@@ -100,6 +103,9 @@ GetFpdtRecordPtr (
   IN OUT FPDT_RECORD_PTR  *FpdtRecordPtr
   )
 {
+  UINT32  NewLength;
+  UINT8   *NewBuffer;
+
   if (mFpdtBufferIsReported) {
     //
     // Append Boot records to the boot performance table.
@@ -119,19 +125,22 @@ GetFpdtRecordPtr (
     }
   } else {
     //
-    // Check if pre-allocated buffer is full
+    // Check if pre-allocated buffer is full. The buffer is doubled, so that the
+    // number of reallocations, each copying all records, stays logarithmic.
     //
     if (mPerformanceLength + RecordSize > mMaxPerformanceLength) {
-      mPerformancePointer = ReallocatePool (
-                              mPerformanceLength,
-                              mPerformanceLength + RecordSize + FIRMWARE_RECORD_BUFFER,
-                              mPerformancePointer
-                              );
-      if (mPerformancePointer == NULL) {
+      NewLength = MAX (mMaxPerformanceLength * 2, mPerformanceLength + RecordSize + FIRMWARE_RECORD_BUFFER);
+      NewBuffer = ReallocatePool (
+                    mPerformanceLength,
+                    NewLength,
+                    mPerformancePointer
+                    );
+      if (NewBuffer == NULL) {
         return EFI_OUT_OF_RESOURCES;
       }
 
-      mMaxPerformanceLength = mPerformanceLength + RecordSize + FIRMWARE_RECORD_BUFFER;
+      mPerformancePointer   = NewBuffer;
+      mMaxPerformanceLength = NewLength;
     }
 
     //
@@ -143,6 +152,147 @@ GetFpdtRecordPtr (
   return EFI_SUCCESS;
 }
 
+/**
+  Remember the FPDT record which is about to be inserted as a start record
+  waiting for its end record.
+
+  @param  Stack          The stack of the start records of the same kind.
+  @param  Tracked        TRUE if the start record and its end record update
+                         each other, so that PopOpenFpdtRecord() returns it.
+
+**/
+VOID
+PushOpenFpdtRecord (
+  IN OUT FPDT_OPEN_RECORD_STACK  *Stack,
+  IN     BOOLEAN                 Tracked
+  )
+{
+  if (Stack->Count < FPDT_OPEN_RECORD_DEPTH) {
+    if (!Tracked) {
+      Stack->Offset[Stack->Count] = FPDT_OPEN_RECORD_UNTRACKED;
+    } else if (mFpdtBufferIsReported) {
+      Stack->Offset[Stack->Count] = mBootRecordSize;
+    } else {
+      Stack->Offset[Stack->Count] = mPerformanceLength;
+    }
+  }
+
+  //
+  // Too deep nesting is still counted, to keep the outer records matched.
+  //
+  Stack->Count++;
+}
+
+/**
+  Get the most recent start record which is waiting for its end record.
+
+  @param  Stack          The stack of the start records of the same kind.
+  @param  FpdtRecordPtr  Pointer to the start record.
+
+  @retval TRUE           The start record is found.
+  @retval FALSE          There is no start record waiting for the end record,
+                         or it is not tracked.
+**/
+BOOLEAN
+PopOpenFpdtRecord (
+  IN OUT FPDT_OPEN_RECORD_STACK  *Stack,
+  OUT    FPDT_RECORD_PTR         *FpdtRecordPtr
+  )
+{
+  if (Stack->Count == 0) {
+    return FALSE;
+  }
+
+  Stack->Count--;
+  if ((Stack->Count >= FPDT_OPEN_RECORD_DEPTH) ||
+      (Stack->Offset[Stack->Count] == FPDT_OPEN_RECORD_UNTRACKED))
+  {
+    return FALSE;
+  }
+
+  if (mFpdtBufferIsReported) {
+    FpdtRecordPtr->RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mBootRecordBuffer + Stack->Offset[Stack->Count]);
+  } else {
+    FpdtRecordPtr->RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mPerformancePointer + Stack->Offset[Stack->Count]);
+  }
+
+  return TRUE;
+}
+
+/**
+  Adjust the offsets of the start records after the records were moved.
+
+  @param  Stack          The stack of the start records of the same kind.
+  @param  Delta          The number of bytes the records were moved by.
+
+**/
+VOID
+RebaseOpenFpdtRecords (
+  IN OUT FPDT_OPEN_RECORD_STACK  *Stack,
+  IN     UINT32                  Delta
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < MIN (Stack->Count, FPDT_OPEN_RECORD_DEPTH); Index++) {
+    if (Stack->Offset[Index] != FPDT_OPEN_RECORD_UNTRACKED) {
+      Stack->Offset[Index] += Delta;
+    }
+  }
+}
+
+/**
+  Convert the raw performance counter values in the FPDT records to nanoseconds.
+
+  @param  RecordBuffer   Pointer to the first FPDT record.
+  @param  RecordLength   The length of the FPDT records.
+
+**/
+VOID
+ConvertFpdtRecordTimestamps (
+  IN UINT8   *RecordBuffer,
+  IN UINT32  RecordLength
+  )
+{
+  FPDT_RECORD_PTR  FpdtRecordPtr;
+  UINT8            *RecordEnd;
+
+  //
+  // All the extended FPDT records share the same layout up to the Timestamp.
+  //
+  RecordEnd = RecordBuffer + RecordLength;
+  while (RecordBuffer + sizeof (FPDT_GUID_EVENT_RECORD) <= RecordEnd) {
+    FpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)RecordBuffer;
+    if (FpdtRecordPtr.RecordHeader->Length == 0) {
+      break;
+    }
+
+    if (FpdtRecordPtr.GuidEvent->Timestamp != 0) {
+      FpdtRecordPtr.GuidEvent->Timestamp = GetTimeInNanoSecond (FpdtRecordPtr.GuidEvent->Timestamp);
+    }
+
+    RecordBuffer += FpdtRecordPtr.RecordHeader->Length;
+  }
+}
+
+/**
+  Convert the timestamps of the DXE records which still hold the raw
+  performance counter value to nanoseconds. The records inserted after this
+  call get nanoseconds directly.
+
+**/
+VOID
+ConvertRawFpdtRecords (
+  VOID
+  )
+{
+  if (FeaturePcdGet (PcdEdkiiFpdtDeferTimestampConversion) && (mPerformancePointer != NULL)) {
+    ConvertFpdtRecordTimestamps (mPerformancePointer + mRawTimestampOffset, mPerformanceLength - mRawTimestampOffset);
+  }
+
+  mRawTimestampOffset = mPerformanceLength;
+}
+
 /**
 Check whether the Token is a known one which is uesed by core.
 
@@ -415,6 +565,8 @@ AllocateBootPerformanceTable (
   // Fill Boot records from boot drivers.
   //
   if (mPerformancePointer != NULL) {
+    RebaseOpenFpdtRecords (&mOpenStartImageRecords, mAcpiBootPerformanceTable->Header.Length);
+    RebaseOpenFpdtRecords (&mOpenLoadImageRecords, mAcpiBootPerformanceTable->Header.Length);
     CopyMem (BootPerformanceData, mPerformancePointer, mPerformanceLength);
     mAcpiBootPerformanceTable->Header.Length += mPerformanceLength;
     BootPerformanceData                       = BootPerformanceData + mPerformanceLength;
@@ -975,6 +1127,7 @@ InsertFpdtRecord (
   CHAR8            ModuleName[FPDT_STRING_EVENT_RECORD_NAME_LENGTH];
   FPDT_RECORD_PTR  FpdtRecordPtr;
   FPDT_RECORD_PTR  CachedFpdtRecordPtr;
+  BOOLEAN          HasCachedRecord;
   UINT64           TimeStamp;
   CONST CHAR8      *StringPtr;
   UINTN            DestMax;
@@ -982,8 +1135,9 @@ InsertFpdtRecord (
   EFI_STATUS       Status;
   UINT16           ProgressId;
 
-  StringPtr  = NULL;
-  ProgressId = 0;
+  StringPtr       = NULL;
+  ProgressId      = 0;
+  HasCachedRecord = FALSE;
   ZeroMem (ModuleName, sizeof (ModuleName));
 
   //
@@ -1031,12 +1185,17 @@ InsertFpdtRecord (
 
   //
   // 3. Get the TimeStamp.
+  //    Records in the DXE buffer may keep the raw counter value, which is
+  //    converted to nanoseconds once when the buffer is reported.
   //
   if (Ticker == 0) {
-    Ticker    = GetPerformanceCounter ();
-    TimeStamp = GetTimeInNanoSecond (Ticker);
-  } else if (Ticker == 1) {
+    Ticker = GetPerformanceCounter ();
+  }
+
+  if (Ticker == 1) {
     TimeStamp = 0;
+  } else if (FeaturePcdGet (PcdEdkiiFpdtDeferTimestampConversion) && !mFpdtBufferIsReported) {
+    TimeStamp = Ticker;
   } else {
     TimeStamp = GetTimeInNanoSecond (Ticker);
   }
@@ -1052,12 +1211,12 @@ InsertFpdtRecord (
       //
       // Cache the offset of start image start record and use to update the start image end record if needed.
       //
-      if ((Attribute == PerfEntry) && (PerfId == MODULE_START_ID)) {
-        if (mFpdtBufferIsReported) {
-          mCachedLength = mBootRecordSize;
-        } else {
-          mCachedLength = mPerformanceLength;
+      if (PerfId == MODULE_START_ID) {
+        if (Attribute == PerfEntry) {
+          PushOpenFpdtRecord (&mOpenStartImageRecords, TRUE);
         }
+      } else {
+        HasCachedRecord = PopOpenFpdtRecord (&mOpenStartImageRecords, &CachedFpdtRecordPtr);
       }
 
       if (!PcdGetBool (PcdEdkiiFpdtStringRecordEnableOnly)) {
@@ -1067,15 +1226,8 @@ InsertFpdtRecord (
         FpdtRecordPtr.GuidEvent->ProgressID      = PerfId;
         FpdtRecordPtr.GuidEvent->Timestamp       = TimeStamp;
         CopyMem (&FpdtRecordPtr.GuidEvent->Guid, &ModuleGuid, sizeof (FpdtRecordPtr.GuidEvent->Guid));
-        if ((CallerIdentifier == NULL) && (PerfId == MODULE_END_ID) && (mCachedLength != 0)) {
-          if (mFpdtBufferIsReported) {
-            CachedFpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mBootRecordBuffer + mCachedLength);
-          } else {
-            CachedFpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mPerformancePointer + mCachedLength);
-          }
-
+        if ((CallerIdentifier == NULL) && HasCachedRecord) {
           CopyMem (&FpdtRecordPtr.GuidEvent->Guid, &CachedFpdtRecordPtr.GuidEvent->Guid, sizeof (FpdtRecordPtr.GuidEvent->Guid));
-          mCachedLength = 0;
         }
       }
 
@@ -1089,14 +1241,14 @@ InsertFpdtRecord (
         mLoadImageCount++;
         //
         // Cache the offset of load image start record and use to be updated by the load image end record if needed.
+        // Only a start record without a caller, i.e. whose image is not known yet, is updated. The other ones are
+        // pushed untracked, so that their end records do not pop and update an outer start record.
         //
-        if ((CallerIdentifier == NULL) && (Attribute == PerfEntry)) {
-          if (mFpdtBufferIsReported) {
-            mCachedLength = mBootRecordSize;
-          } else {
-            mCachedLength = mPerformanceLength;
-          }
+        if (Attribute == PerfEntry) {
+          PushOpenFpdtRecord (&mOpenLoadImageRecords, (BOOLEAN)(CallerIdentifier == NULL));
         }
+      } else {
+        HasCachedRecord = PopOpenFpdtRecord (&mOpenLoadImageRecords, &CachedFpdtRecordPtr);
       }
 
       if (!PcdGetBool (PcdEdkiiFpdtStringRecordEnableOnly)) {
@@ -1107,15 +1259,8 @@ InsertFpdtRecord (
         FpdtRecordPtr.GuidQwordEvent->Timestamp       = TimeStamp;
         FpdtRecordPtr.GuidQwordEvent->Qword           = mLoadImageCount;
         CopyMem (&FpdtRecordPtr.GuidQwordEvent->Guid, &ModuleGuid, sizeof (FpdtRecordPtr.GuidQwordEvent->Guid));
-        if ((PerfId == MODULE_LOADIMAGE_END_ID) && (mCachedLength != 0)) {
-          if (mFpdtBufferIsReported) {
-            CachedFpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mBootRecordBuffer + mCachedLength);
-          } else {
-            CachedFpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mPerformancePointer + mCachedLength);
-          }
-
+        if (HasCachedRecord) {
           CopyMem (&CachedFpdtRecordPtr.GuidQwordEvent->Guid, &ModuleGuid, sizeof (CachedFpdtRecordPtr.GuidQwordEvent->Guid));
-          mCachedLength = 0;
         }
       }
 
@@ -1275,13 +1420,7 @@ InsertFpdtRecord (
       FpdtRecordPtr.DynamicStringEvent->Header.Length = (UINT8)(sizeof (FPDT_DYNAMIC_STRING_EVENT_RECORD)+ STRING_SIZE);
     }
 
-    if (((PerfId == MODULE_LOADIMAGE_END_ID) || (PerfId == MODULE_END_ID)) && (mCachedLength != 0)) {
-      if (mFpdtBufferIsReported) {
-        CachedFpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mBootRecordBuffer + mCachedLength);
-      } else {
-        CachedFpdtRecordPtr.RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(mPerformancePointer + mCachedLength);
-      }
-
+    if (HasCachedRecord) {
       if (PerfId == MODULE_LOADIMAGE_END_ID) {
         DestMax   = CachedFpdtRecordPtr.DynamicStringEvent->Header.Length - sizeof (FPDT_DYNAMIC_STRING_EVENT_RECORD);
         StringLen = AsciiStrLen (StringPtr);
@@ -1301,8 +1440,6 @@ InsertFpdtRecord (
         CopyMem (&FpdtRecordPtr.DynamicStringEvent->Guid, &CachedFpdtRecordPtr.DynamicStringEvent->Guid, sizeof (CachedFpdtRecordPtr.DynamicStringEvent->Guid));
         AsciiStrnCpyS (FpdtRecordPtr.DynamicStringEvent->String, DestMax, CachedFpdtRecordPtr.DynamicStringEvent->String, StringLen);
       }
-
-      mCachedLength = 0;
     }
   }
 
@@ -1391,6 +1528,12 @@ ReportFpdtRecordBuffer (
   UINT64      BPDTAddr;
 
   if (!mFpdtBufferIsReported) {
+    //
+    // Convert the raw timestamps first, so that the records are in nanoseconds
+    // even if the boot performance table cannot be allocated.
+    //
+    ConvertRawFpdtRecords ();
+
     Status = AllocateBootPerformanceTable ();
     if (!EFI_ERROR (Status)) {
       BPDTAddr = (UINT64)(UINTN)mAcpiBootPerformanceTable;
@@ -1493,6 +1636,7 @@ DxeCorePerformanceLibConstructor (
   // Dump normal PEI performance records
   //
   InternalGetPeiPerformance (GetHobList ());
+  mRawTimestampOffset = mPerformanceLength;
 
   //
   // Install the protocol interfaces for DXE performance library instance.
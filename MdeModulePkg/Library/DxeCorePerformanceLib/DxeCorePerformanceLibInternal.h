@@ -44,6 +44,20 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DxeServicesLib.h>
 #include <Library/PeCoffGetEntryPointLib.h>
 
+#define FPDT_OPEN_RECORD_DEPTH      0x10
+#define FPDT_OPEN_RECORD_UNTRACKED  MAX_UINT32
+
+//
+// Offsets of the start records which are waiting for their end records.
+// StartImage() can be nested, e.g. when an application starts a driver.
+// A start record whose end record updates nothing is kept as
+// FPDT_OPEN_RECORD_UNTRACKED, so every end record pops its own start record.
+//
+typedef struct {
+  UINTN     Count;
+  UINT32    Offset[FPDT_OPEN_RECORD_DEPTH];
+} FPDT_OPEN_RECORD_STACK;
+
 /**
   Create performance record with event description and a timestamp.
 
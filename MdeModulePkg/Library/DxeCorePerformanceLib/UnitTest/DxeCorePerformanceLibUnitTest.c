@@ -0,0 +1,761 @@
+/** @file
+  Host-based unit tests of the FPDT record handling of DxeCorePerformanceLib.
+
+  The tests create records through CreatePerformanceMeasurement() behind mock
+  boot and runtime services, report them as at EndOfDxe, and check the record
+  timestamps, whether or not the boot performance table can be allocated.
+  They also check the matching of nested StartImage() records, and measure
+  the cost of one record.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include "../DxeCorePerformanceLibInternal.h"
+
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+#define UNIT_TEST_APP_NAME     "DxeCorePerformanceLib Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// The mock timer runs at 100 MHz.
+//
+#define TEST_NANOSECONDS_PER_TICK  10
+
+#define TEST_RECORD_COUNT        4
+#define TEST_BENCHMARK_RECORDS   0x10000
+#define TEST_FIRST_TIMESTAMP     1000
+#define TEST_TIMESTAMP_INTERVAL  100
+
+//
+// Globals of DxeCorePerformanceLib.
+//
+extern BOOT_PERFORMANCE_TABLE  *mAcpiBootPerformanceTable;
+extern FPDT_OPEN_RECORD_STACK  mOpenStartImageRecords;
+extern FPDT_OPEN_RECORD_STACK  mOpenLoadImageRecords;
+extern UINTN                   mCachePairCount;
+extern UINT32                  mPerformanceLength;
+extern UINT32                  mMaxPerformanceLength;
+extern UINT32                  mBootRecordSize;
+extern UINTN                   mBootRecordMaxSize;
+extern UINT32                  mRawTimestampOffset;
+extern BOOLEAN                 mFpdtBufferIsReported;
+extern BOOLEAN                 mLackSpaceIsReported;
+extern UINT8                   *mPerformancePointer;
+extern UINT8                   *mBootRecordBuffer;
+
+VOID
+EFIAPI
+ReportFpdtRecordBuffer (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
+VOID
+ConvertRawFpdtRecords (
+  VOID
+  );
+
+EFI_BOOT_SERVICES     *gBS;
+EFI_RUNTIME_SERVICES  *gRT;
+
+STATIC EFI_BOOT_SERVICES     mBootServices;
+STATIC EFI_RUNTIME_SERVICES  mRuntimeServices;
+STATIC UINT64                mPerformanceCounter;
+STATIC BOOLEAN               mAllocatePagesFails;
+STATIC VOID                  *mAllocatedPages;
+STATIC UINTN                 mAllocatedPageCount;
+
+STATIC EFI_GUID  mOuterImageGuid = {
+  0x6c2cbd9c, 0x5a8d, 0x4d4b, { 0x9d, 0x1b, 0x45, 0x0a, 0x6a, 0x61, 0x2e, 0x10 }
+};
+STATIC EFI_GUID  mInnerImageGuid = {
+  0x0d6cbb2d, 0x7b2b, 0x4f6e, { 0x8f, 0x6e, 0x2c, 0x77, 0x4b, 0x36, 0x9b, 0x21 }
+};
+
+/**
+  The images are not loaded, so the handles carry no protocol.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockHandleProtocol (
+  IN  EFI_HANDLE  Handle,
+  IN  EFI_GUID    *Protocol,
+  OUT VOID        **Interface
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  The images are not loaded, so the handles carry no protocol.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockOpenProtocol (
+  IN  EFI_HANDLE  Handle,
+  IN  EFI_GUID    *Protocol,
+  OUT VOID        **Interface  OPTIONAL,
+  IN  EFI_HANDLE  AgentHandle,
+  IN  EFI_HANDLE  ControllerHandle,
+  IN  UINT32      Attributes
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  There is no SMM, so no SMM records are collected.
+
+  @retval EFI_NOT_FOUND  Always.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockLocateProtocol (
+  IN  EFI_GUID  *Protocol,
+  IN  VOID      *Registration  OPTIONAL,
+  OUT VOID      **Interface
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+/**
+  There is no boot performance table of a previous boot to reuse.
+
+  @retval EFI_NOT_FOUND  Always.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockGetVariable (
+  IN     CHAR16    *VariableName,
+  IN     EFI_GUID  *VendorGuid,
+  OUT    UINT32    *Attributes  OPTIONAL,
+  IN OUT UINTN     *DataSize,
+  OUT    VOID      *Data        OPTIONAL
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+/**
+  Read the mock performance counter, which advances one tick per read.
+
+  @return The current value of the counter.
+
+**/
+UINT64
+EFIAPI
+GetPerformanceCounter (
+  VOID
+  )
+{
+  return mPerformanceCounter++;
+}
+
+/**
+  Get the properties of the mock performance counter.
+
+  @param  StartValue   The first value the counter returns.
+  @param  EndValue     The last value the counter returns.
+
+  @return The frequency of the counter in Hz.
+
+**/
+UINT64
+EFIAPI
+GetPerformanceCounterProperties (
+  OUT UINT64  *StartValue  OPTIONAL,
+  OUT UINT64  *EndValue    OPTIONAL
+  )
+{
+  if (StartValue != NULL) {
+    *StartValue = 0;
+  }
+
+  if (EndValue != NULL) {
+    *EndValue = MAX_UINT64;
+  }
+
+  return DivU64x32 (1000000000, TEST_NANOSECONDS_PER_TICK);
+}
+
+/**
+  Convert ticks of the mock performance counter to nanoseconds.
+
+  @param  Ticks   The number of ticks.
+
+  @return The number of nanoseconds.
+
+**/
+UINT64
+EFIAPI
+GetTimeInNanoSecond (
+  IN UINT64  Ticks
+  )
+{
+  return MultU64x32 (Ticks, TEST_NANOSECONDS_PER_TICK);
+}
+
+/**
+  There are no HOBs.
+
+  @return NULL.
+
+**/
+VOID *
+EFIAPI
+GetHobList (
+  VOID
+  )
+{
+  return NULL;
+}
+
+/**
+  There are no HOBs, so no PEI records are collected.
+
+  @param  Guid       The GUID to match with in the HOB list.
+  @param  HobStart   A pointer to a Guid.
+
+  @return NULL.
+
+**/
+VOID *
+EFIAPI
+GetNextGuidHob (
+  IN CONST EFI_GUID  *Guid,
+  IN CONST VOID      *HobStart
+  )
+{
+  return NULL;
+}
+
+/**
+  Allocate the boot performance table, unless the test makes it fail.
+
+  @param  MemoryType   The type of memory to allocate.
+  @param  Pages        The number of pages to allocate.
+
+  @return The allocated pages, or NULL.
+
+**/
+VOID *
+EFIAPI
+AllocatePeiAccessiblePages (
+  IN EFI_MEMORY_TYPE  MemoryType,
+  IN UINTN            Pages
+  )
+{
+  if (mAllocatePagesFails || (mAllocatedPages != NULL)) {
+    return NULL;
+  }
+
+  mAllocatedPages     = AllocatePages (Pages);
+  mAllocatedPageCount = Pages;
+  return mAllocatedPages;
+}
+
+/**
+  There is no firmware volume.
+
+  @retval EFI_NOT_FOUND  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+GetSectionFromAnyFv (
+  IN  CONST EFI_GUID    *NameGuid,
+  IN  EFI_SECTION_TYPE  SectionType,
+  IN  UINTN             SectionInstance,
+  OUT VOID              **Buffer,
+  OUT UINTN             *Size
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+/**
+  There is no configuration table.
+
+  @retval EFI_NOT_FOUND  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+EfiGetSystemConfigurationTable (
+  IN  EFI_GUID  *TableGuid,
+  OUT VOID      **Table
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+/**
+  There is no global variable.
+
+  @retval EFI_NOT_FOUND  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+GetEfiGlobalVariable2 (
+  IN CONST CHAR16  *Name,
+  OUT VOID         **Value,
+  OUT UINTN        *Size OPTIONAL
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+/**
+  The handles have no device path.
+
+  @return NULL.
+
+**/
+EFI_DEVICE_PATH_PROTOCOL *
+EFIAPI
+DevicePathFromHandle (
+  IN EFI_HANDLE  Handle
+  )
+{
+  return NULL;
+}
+
+/**
+  There is no device path to convert.
+
+  @return NULL.
+
+**/
+CHAR16 *
+EFIAPI
+ConvertDevicePathToText (
+  IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN BOOLEAN                         DisplayOnly,
+  IN BOOLEAN                         AllowShortcuts
+  )
+{
+  return NULL;
+}
+
+/**
+  Get a record of a record buffer.
+
+  @param[in]  Buffer     The record buffer.
+  @param[in]  Length     The length of the records in the buffer.
+  @param[in]  Index      The index of the record.
+
+  @return The record, or NULL if the buffer has not as many records.
+
+**/
+STATIC
+EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *
+GetRecord (
+  IN UINT8   *Buffer,
+  IN UINT32  Length,
+  IN UINTN   Index
+  )
+{
+  EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER  *Header;
+  UINT8                                        *End;
+
+  End = Buffer + Length;
+  while (Buffer + sizeof (*Header) <= End) {
+    Header = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)Buffer;
+    if (Header->Length == 0) {
+      break;
+    }
+
+    if (Index == 0) {
+      return Header;
+    }
+
+    Index--;
+    Buffer += Header->Length;
+  }
+
+  return NULL;
+}
+
+/**
+  Create in-module records with known timestamps.
+
+  @retval UNIT_TEST_PASSED             The records were created.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A record could not be created.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+CreateTimedRecords (
+  VOID
+  )
+{
+  UINTN       Index;
+  EFI_STATUS  Status;
+
+  for (Index = 0; Index < TEST_RECORD_COUNT; Index++) {
+    Status = CreatePerformanceMeasurement (
+               &mOuterImageGuid,
+               NULL,
+               "Timed",
+               TEST_FIRST_TIMESTAMP + Index * TEST_TIMESTAMP_INTERVAL,
+               0,
+               (Index % 2 == 0) ? PERF_INMODULE_START_ID : PERF_INMODULE_END_ID,
+               PerfEntry
+               );
+    UT_ASSERT_NOT_EFI_ERROR (Status);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that the records created by CreateTimedRecords() hold nanoseconds.
+
+  @param[in]  Buffer     The record buffer.
+  @param[in]  Length     The length of the records in the buffer.
+
+  @retval UNIT_TEST_PASSED             The timestamps are in nanoseconds.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A timestamp is not.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+CheckTimedRecords (
+  IN UINT8   *Buffer,
+  IN UINT32  Length
+  )
+{
+  UINTN            Index;
+  FPDT_RECORD_PTR  Record;
+
+  for (Index = 0; Index < TEST_RECORD_COUNT; Index++) {
+    Record.RecordHeader = GetRecord (Buffer, Length, Index);
+    UT_ASSERT_NOT_NULL (Record.RecordHeader);
+    UT_ASSERT_EQUAL (Record.RecordHeader->Type, FPDT_DYNAMIC_STRING_EVENT_TYPE);
+    UT_ASSERT_EQUAL (
+      Record.DynamicStringEvent->Timestamp,
+      (TEST_FIRST_TIMESTAMP + Index * TEST_TIMESTAMP_INTERVAL) * TEST_NANOSECONDS_PER_TICK
+      );
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Put DxeCorePerformanceLib back to its state before the first record.
+
+  @param[in]  Context    Unused.
+
+**/
+STATIC
+VOID
+EFIAPI
+ResetPerformanceLib (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  if (mPerformancePointer != NULL) {
+    FreePool (mPerformancePointer);
+  }
+
+  if (mAllocatedPages != NULL) {
+    FreePages (mAllocatedPages, mAllocatedPageCount);
+  }
+
+  mAcpiBootPerformanceTable = NULL;
+  mPerformancePointer       = NULL;
+  mBootRecordBuffer         = NULL;
+  mAllocatedPages           = NULL;
+  mAllocatedPageCount       = 0;
+  mPerformanceLength        = 0;
+  mMaxPerformanceLength     = 0;
+  mBootRecordSize           = 0;
+  mBootRecordMaxSize        = 0;
+  mRawTimestampOffset       = 0;
+  mCachePairCount           = 0;
+  mFpdtBufferIsReported     = FALSE;
+  mLackSpaceIsReported      = FALSE;
+  mAllocatePagesFails       = FALSE;
+  mPerformanceCounter       = TEST_FIRST_TIMESTAMP;
+  ZeroMem (&mOpenStartImageRecords, sizeof (mOpenStartImageRecords));
+  ZeroMem (&mOpenLoadImageRecords, sizeof (mOpenLoadImageRecords));
+}
+
+/**
+  Reset DxeCorePerformanceLib before a test.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED    Always.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ResetPerformanceLibPrerequisite (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  ResetPerformanceLib (Context);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  The records copied into the boot performance table at EndOfDxe hold
+  nanoseconds.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestTimestampsConvertedIntoTable (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS  TestStatus;
+
+  TestStatus = CreateTimedRecords ();
+  if (TestStatus != UNIT_TEST_PASSED) {
+    return TestStatus;
+  }
+
+  ReportFpdtRecordBuffer (NULL, NULL);
+
+  UT_ASSERT_TRUE (mFpdtBufferIsReported);
+  UT_ASSERT_NOT_NULL (mAcpiBootPerformanceTable);
+  UT_ASSERT_TRUE (mPerformancePointer == NULL);
+  return CheckTimedRecords (
+           (UINT8 *)(mAcpiBootPerformanceTable + 1),
+           mAcpiBootPerformanceTable->Header.Length - sizeof (*mAcpiBootPerformanceTable)
+           );
+}
+
+/**
+  The records left in the DXE buffer, when the boot performance table cannot
+  be allocated at EndOfDxe, hold nanoseconds too.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestTimestampsConvertedWithoutTable (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS  TestStatus;
+
+  TestStatus = CreateTimedRecords ();
+  if (TestStatus != UNIT_TEST_PASSED) {
+    return TestStatus;
+  }
+
+  mAllocatePagesFails = TRUE;
+  ReportFpdtRecordBuffer (NULL, NULL);
+
+  UT_ASSERT_TRUE (mFpdtBufferIsReported);
+  UT_ASSERT_TRUE (mAcpiBootPerformanceTable == NULL);
+  UT_ASSERT_NOT_NULL (mPerformancePointer);
+  return CheckTimedRecords (mPerformancePointer, mPerformanceLength);
+}
+
+/**
+  The end record of a nested StartImage() gets the GUID of the inner image,
+  and the end record of the outer StartImage() the GUID of the outer image.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestNestedStartImageRecords (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FPDT_RECORD_PTR  Record;
+
+  UT_ASSERT_NOT_EFI_ERROR (CreatePerformanceMeasurement (&mOuterImageGuid, NULL, NULL, 0, 0, MODULE_START_ID, PerfEntry));
+  UT_ASSERT_NOT_EFI_ERROR (CreatePerformanceMeasurement (&mInnerImageGuid, NULL, NULL, 0, 0, MODULE_START_ID, PerfEntry));
+  UT_ASSERT_NOT_EFI_ERROR (CreatePerformanceMeasurement (NULL, NULL, NULL, 0, 0, MODULE_END_ID, PerfEntry));
+  UT_ASSERT_NOT_EFI_ERROR (CreatePerformanceMeasurement (NULL, NULL, NULL, 0, 0, MODULE_END_ID, PerfEntry));
+  UT_ASSERT_EQUAL (mOpenStartImageRecords.Count, 0);
+
+  Record.RecordHeader = GetRecord (mPerformancePointer, mPerformanceLength, 2);
+  UT_ASSERT_NOT_NULL (Record.RecordHeader);
+  UT_ASSERT_EQUAL (Record.GuidEvent->ProgressID, MODULE_END_ID);
+  UT_ASSERT_TRUE (CompareGuid (&Record.GuidEvent->Guid, &mInnerImageGuid));
+
+  Record.RecordHeader = GetRecord (mPerformancePointer, mPerformanceLength, 3);
+  UT_ASSERT_NOT_NULL (Record.RecordHeader);
+  UT_ASSERT_EQUAL (Record.GuidEvent->ProgressID, MODULE_END_ID);
+  UT_ASSERT_TRUE (CompareGuid (&Record.GuidEvent->Guid, &mOuterImageGuid));
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Measure the cost of creating one record in the DXE buffer, and of
+  converting its timestamp at EndOfDxe.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestRecordCost (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_BENCHMARK  Benchmark;
+  UINTN                Index;
+  EFI_STATUS           Status;
+
+  Status = EFI_SUCCESS;
+  UnitTestBenchmarkStart (&Benchmark);
+  for (Index = 0; Index < TEST_BENCHMARK_RECORDS && !EFI_ERROR (Status); Index++) {
+    Status = CreatePerformanceMeasurement (
+               &mOuterImageGuid,
+               NULL,
+               "Benchmark",
+               0,
+               0,
+               (Index % 2 == 0) ? PERF_INMODULE_START_ID : PERF_INMODULE_END_ID,
+               PerfEntry
+               );
+  }
+
+  UnitTestBenchmarkStop (&Benchmark);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UnitTestBenchmarkLogRate ("FPDT record creation", &Benchmark, TEST_BENCHMARK_RECORDS);
+
+  UnitTestBenchmarkStart (&Benchmark);
+  ConvertRawFpdtRecords ();
+  UnitTestBenchmarkStop (&Benchmark);
+  UnitTestBenchmarkLogRate ("FPDT timestamp conversion", &Benchmark, TEST_BENCHMARK_RECORDS);
+
+  UT_ASSERT_EQUAL (mRawTimestampOffset, mPerformanceLength);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  DxeCorePerformanceLib FPDT records and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      FpdtRecordTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  mBootServices.HandleProtocol = MockHandleProtocol;
+  mBootServices.OpenProtocol   = MockOpenProtocol;
+  mBootServices.LocateProtocol = MockLocateProtocol;
+  mRuntimeServices.GetVariable = MockGetVariable;
+  gBS                          = &mBootServices;
+  gRT                          = &mRuntimeServices;
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the FPDT record Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&FpdtRecordTests, Framework, "FPDT Record Tests", "DxeCorePerformanceLib.FpdtRecord", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for FpdtRecordTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------Description--------------Name----------Function--------Pre---Post-------------------Context-----------
+  //
+  AddTestCase (FpdtRecordTests, "Records reported at EndOfDxe hold nanoseconds", "ConvertedIntoTable", TestTimestampsConvertedIntoTable, ResetPerformanceLibPrerequisite, ResetPerformanceLib, NULL);
+  AddTestCase (FpdtRecordTests, "Records kept when the table cannot be allocated hold nanoseconds", "ConvertedWithoutTable", TestTimestampsConvertedWithoutTable, ResetPerformanceLibPrerequisite, ResetPerformanceLib, NULL);
+  AddTestCase (FpdtRecordTests, "Nested StartImage end records get their own image GUID", "NestedStartImage", TestNestedStartImageRecords, ResetPerformanceLibPrerequisite, ResetPerformanceLib, NULL);
+  AddTestCase (FpdtRecordTests, "Cost of one record", "RecordCost", TestRecordCost, ResetPerformanceLibPrerequisite, ResetPerformanceLib, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
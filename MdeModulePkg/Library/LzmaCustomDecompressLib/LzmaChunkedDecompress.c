@@ -0,0 +1,335 @@
+/** @file
+  Chunked LZMA Decompress interfaces.
+
+  The chunks of the data are independent LZMA streams, which are decompressed
+  in parallel on the processors made available by MpWorkQueueLib.
+
+  A chunk only needs its LZMA state while it is decompressed, so the scratch
+  buffer holds at most LZMA_CHUNKED_MAX_SLOTS states rather than one per chunk.
+  A processor claims a free state, or slot, for each chunk and releases it
+  afterwards, so no more chunks than slots are decompressed at the same time.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "LzmaDecompressLibInternal.h"
+#include "Sdk/C/7zTypes.h"
+#include "Sdk/C/LzmaDec.h"
+
+#include <Library/MpWorkQueueLib.h>
+#include <Library/SynchronizationLib.h>
+
+#define LZMA_HEADER_SIZE  (LZMA_PROPS_SIZE + 8)
+
+//
+// The size of the busy flags of the slots, which keeps the LZMA states that
+// follow them aligned.
+//
+#define LZMA_SLOT_FLAGS_SIZE(SlotCount)  ALIGN_VALUE ((SlotCount) * sizeof (UINT32), sizeof (UINT64))
+
+typedef struct {
+  CONST UINT8      *Source;
+  UINT32           SourceSize;
+  UINT8            *Destination;
+  RETURN_STATUS    Status;
+} LZMA_CHUNK;
+
+typedef struct {
+  LZMA_CHUNK         *Chunks;
+  //
+  // A slot is busy while a processor decompresses a chunk with its LZMA state.
+  //
+  volatile UINT32    *SlotBusy;
+  UINT8              *SlotScratch;
+  UINT32             SlotCount;
+  UINT32             ChunkScratch;
+} LZMA_CHUNKED_CONTEXT;
+
+/**
+  Return the number of slots, that is of LZMA states, in the scratch buffer.
+
+  The number only depends on the header of the data, as the scratch buffer
+  sized by LzmaChunkedUefiDecompressGetInfo() must hold the slots used by
+  LzmaChunkedUefiDecompress(). The number of processors may change between
+  the two calls, when the MP Services are installed or an AP is enabled.
+
+  @param  ChunkCount  The number of chunks.
+
+  @return The number of slots.
+**/
+STATIC
+UINT32
+LzmaChunkedGetSlotCount (
+  IN UINT32  ChunkCount
+  )
+{
+  return MIN (ChunkCount, LZMA_CHUNKED_MAX_SLOTS);
+}
+
+/**
+  Check the header and the index of chunked LZMA data.
+
+  @param  Source          The source buffer containing the compressed data.
+  @param  SourceSize      The size, in bytes, of the source buffer.
+  @param  ChunkScratch    The size, in bytes, of the scratch buffer needed by
+                          one chunk.
+
+  @retval  RETURN_SUCCESS            The header and the index are valid.
+  @retval  RETURN_INVALID_PARAMETER  The header or the index is not valid.
+  @retval  RETURN_UNSUPPORTED        The first chunk is bigger than 4GB.
+**/
+STATIC
+RETURN_STATUS
+LzmaChunkedCheckHeader (
+  IN  CONST VOID  *Source,
+  IN  UINTN       SourceSize,
+  OUT UINT32      *ChunkScratch
+  )
+{
+  CONST LZMA_CHUNKED_HEADER  *Header;
+  CONST UINT32               *ChunkSizes;
+  UINTN                      Offset;
+  UINT32                     DecodedSize;
+
+  Header = (CONST LZMA_CHUNKED_HEADER *)Source;
+  if ((SourceSize < sizeof (LZMA_CHUNKED_HEADER)) ||
+      (Header->Signature != LZMA_CHUNKED_SIGNATURE) ||
+      (Header->ChunkSize == 0))
+  {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (Header->ChunkCount != Header->DecompressedSize / Header->ChunkSize +
+      ((Header->DecompressedSize % Header->ChunkSize != 0) ? 1 : 0))
+  {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if ((SourceSize - sizeof (LZMA_CHUNKED_HEADER)) / sizeof (UINT32) < Header->ChunkCount) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  *ChunkScratch = 0;
+  if (Header->ChunkCount == 0) {
+    return RETURN_SUCCESS;
+  }
+
+  //
+  // The scratch buffer needed by a chunk does not depend on its data, so the
+  // one of the first chunk is used for all of them.
+  //
+  ChunkSizes = (CONST UINT32 *)(Header + 1);
+  Offset     = sizeof (LZMA_CHUNKED_HEADER) + Header->ChunkCount * sizeof (UINT32);
+  if ((ChunkSizes[0] < LZMA_HEADER_SIZE) || (ChunkSizes[0] > SourceSize - Offset)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  return LzmaUefiDecompressGetInfo (
+           (CONST UINT8 *)Source + Offset,
+           ChunkSizes[0],
+           &DecodedSize,
+           ChunkScratch
+           );
+}
+
+/**
+  Decompress one chunk of chunked LZMA data.
+
+  It may be executed on an AP. A processor holds a single slot at a time, so
+  a free slot is found at the latest when another processor completes its
+  chunk.
+
+  @param[in] Context     The LZMA_CHUNKED_CONTEXT.
+  @param[in] ChunkIndex  The index of the chunk to decompress.
+**/
+STATIC
+VOID
+EFIAPI
+LzmaChunkedDecompressChunk (
+  IN VOID   *Context,
+  IN UINTN  ChunkIndex
+  )
+{
+  LZMA_CHUNKED_CONTEXT  *ChunkedContext;
+  LZMA_CHUNK            *Chunk;
+  UINT32                Slot;
+
+  ChunkedContext = (LZMA_CHUNKED_CONTEXT *)Context;
+  Chunk          = &ChunkedContext->Chunks[ChunkIndex];
+
+  Slot = (UINT32)(ChunkIndex % ChunkedContext->SlotCount);
+  while (InterlockedCompareExchange32 (&ChunkedContext->SlotBusy[Slot], 0, 1) != 0) {
+    Slot = (Slot + 1) % ChunkedContext->SlotCount;
+    CpuPause ();
+  }
+
+  Chunk->Status = LzmaUefiDecompress (
+                    Chunk->Source,
+                    Chunk->SourceSize,
+                    Chunk->Destination,
+                    ChunkedContext->SlotScratch + (UINTN)Slot * ChunkedContext->ChunkScratch
+                    );
+
+  InterlockedCompareExchange32 (&ChunkedContext->SlotBusy[Slot], 1, 0);
+}
+
+/**
+  Given a chunked Lzma compressed source buffer, this function retrieves the
+  size of the uncompressed buffer and the size of the scratch buffer required
+  to decompress the compressed source buffer.
+
+  The scratch buffer holds the descriptor of every chunk, and an LZMA state for
+  each chunk up to LZMA_CHUNKED_MAX_SLOTS.
+
+  @param  Source          The source buffer containing the compressed data.
+  @param  SourceSize      The size, in bytes, of the source buffer.
+  @param  DestinationSize A pointer to the size, in bytes, of the uncompressed buffer
+                          that will be generated when the compressed buffer specified
+                          by Source and SourceSize is decompressed.
+  @param  ScratchSize     A pointer to the size, in bytes, of the scratch buffer that
+                          is required to decompress the compressed buffer specified
+                          by Source and SourceSize.
+
+  @retval  RETURN_SUCCESS The size of the uncompressed data was returned
+                          in DestinationSize and the size of the scratch
+                          buffer was returned in ScratchSize.
+  @retval  RETURN_INVALID_PARAMETER
+                          The header or the index of the chunks is not valid.
+  @retval  RETURN_UNSUPPORTED
+                          The size of the scratch buffer does not fit in a
+                          UINT32.
+**/
+RETURN_STATUS
+EFIAPI
+LzmaChunkedUefiDecompressGetInfo (
+  IN  CONST VOID  *Source,
+  IN  UINT32      SourceSize,
+  OUT UINT32      *DestinationSize,
+  OUT UINT32      *ScratchSize
+  )
+{
+  RETURN_STATUS              Status;
+  CONST LZMA_CHUNKED_HEADER  *Header;
+  UINT32                     ChunkScratch;
+  UINT32                     SlotCount;
+  UINT64                     TotalScratch;
+
+  Status = LzmaChunkedCheckHeader (Source, SourceSize, &ChunkScratch);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  Header       = (CONST LZMA_CHUNKED_HEADER *)Source;
+  SlotCount    = LzmaChunkedGetSlotCount (Header->ChunkCount);
+  TotalScratch = MultU64x32 (sizeof (LZMA_CHUNK), Header->ChunkCount) +
+                 LZMA_SLOT_FLAGS_SIZE ((UINT64)SlotCount) +
+                 MultU64x32 (ChunkScratch, SlotCount);
+  if (TotalScratch > MAX_UINT32) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  *DestinationSize = Header->DecompressedSize;
+  *ScratchSize     = (UINT32)TotalScratch;
+  return RETURN_SUCCESS;
+}
+
+/**
+  Decompresses a chunked Lzma compressed source buffer.
+
+  The index of the chunks and the header of every chunk are checked first, so
+  that no chunk is decompressed out of its part of Destination. The chunks are
+  then decompressed in parallel with MpWorkQueueRun(), or one after the other
+  if no other processor is available.
+
+  @param  Source      The source buffer containing the compressed data.
+  @param  SourceSize  The size of source buffer.
+  @param  Destination The destination buffer to store the decompressed data
+  @param  Scratch     A temporary scratch buffer that is used to perform the decompression.
+                      This is an optional parameter that may be NULL if the
+                      required scratch buffer size is 0.
+
+  @retval  RETURN_SUCCESS Decompression completed successfully, and
+                          the uncompressed buffer is returned in Destination.
+  @retval  RETURN_INVALID_PARAMETER
+                          The source buffer specified by Source is corrupted
+                          (not in a valid compressed format).
+**/
+RETURN_STATUS
+EFIAPI
+LzmaChunkedUefiDecompress (
+  IN CONST VOID  *Source,
+  IN UINTN       SourceSize,
+  IN OUT VOID    *Destination,
+  IN OUT VOID    *Scratch
+  )
+{
+  RETURN_STATUS              Status;
+  CONST LZMA_CHUNKED_HEADER  *Header;
+  CONST UINT32               *ChunkSizes;
+  LZMA_CHUNKED_CONTEXT       Context;
+  LZMA_CHUNK                 *Chunks;
+  UINT32                     ChunkScratch;
+  UINTN                      Offset;
+  UINT32                     Index;
+  UINT32                     DecodedSize;
+  UINT32                     Unused;
+
+  Status = LzmaChunkedCheckHeader (Source, SourceSize, &ChunkScratch);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  Header = (CONST LZMA_CHUNKED_HEADER *)Source;
+  if (Header->ChunkCount == 0) {
+    return RETURN_SUCCESS;
+  }
+
+  ChunkSizes = (CONST UINT32 *)(Header + 1);
+  Chunks     = (LZMA_CHUNK *)Scratch;
+  Offset     = sizeof (LZMA_CHUNKED_HEADER) + Header->ChunkCount * sizeof (UINT32);
+
+  Context.Chunks       = Chunks;
+  Context.SlotCount    = LzmaChunkedGetSlotCount (Header->ChunkCount);
+  Context.SlotBusy     = (volatile UINT32 *)(Chunks + Header->ChunkCount);
+  Context.SlotScratch  = (UINT8 *)Context.SlotBusy + LZMA_SLOT_FLAGS_SIZE (Context.SlotCount);
+  Context.ChunkScratch = ChunkScratch;
+  ZeroMem ((VOID *)Context.SlotBusy, Context.SlotCount * sizeof (UINT32));
+
+  for (Index = 0; Index < Header->ChunkCount; Index++) {
+    if ((ChunkSizes[Index] < LZMA_HEADER_SIZE) || (ChunkSizes[Index] > SourceSize - Offset)) {
+      return RETURN_INVALID_PARAMETER;
+    }
+
+    //
+    // The size of every chunk is checked, as LzmaUefiDecompress() writes as
+    // many bytes as the header of the chunk tells.
+    //
+    Status = LzmaUefiDecompressGetInfo ((CONST UINT8 *)Source + Offset, ChunkSizes[Index], &DecodedSize, &Unused);
+    if (RETURN_ERROR (Status) ||
+        (DecodedSize != MIN (Header->ChunkSize, Header->DecompressedSize - Index * Header->ChunkSize)))
+    {
+      return RETURN_INVALID_PARAMETER;
+    }
+
+    Chunks[Index].Source      = (CONST UINT8 *)Source + Offset;
+    Chunks[Index].SourceSize  = ChunkSizes[Index];
+    Chunks[Index].Destination = (UINT8 *)Destination + Index * Header->ChunkSize;
+    Chunks[Index].Status      = RETURN_ABORTED;
+    Offset                   += ChunkSizes[Index];
+  }
+
+  Status = MpWorkQueueRun (LzmaChunkedDecompressChunk, &Context, Header->ChunkCount, 0);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  for (Index = 0; Index < Header->ChunkCount; Index++) {
+    if (RETURN_ERROR (Chunks[Index].Status)) {
+      return RETURN_INVALID_PARAMETER;
+    }
+  }
+
+  return RETURN_SUCCESS;
+}
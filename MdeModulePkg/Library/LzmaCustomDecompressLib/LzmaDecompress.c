@@ -70,6 +70,15 @@ SzFree (
 
 #define LZMA_HEADER_SIZE  (LZMA_PROPS_SIZE + 8)
 
+//
+// The size of the probabilities that LzmaDecode() allocates from the scratch
+// buffer, as LzmaProps_GetNumProbs() of LzmaDec.c computes it. It is the only
+// allocation made while decoding, and it grows with lc + lp.
+//
+#define LZMA_NUM_BASE_PROBS  1984
+#define LZMA_PROBS_SIZE(Props) \
+  ((LZMA_NUM_BASE_PROBS + ((UINT32)0x300 << ((Props)->lc + (Props)->lp))) * sizeof (CLzmaProb))
+
 /**
   Get the size of the uncompressed buffer by parsing EncodeData header.
 
@@ -175,7 +184,8 @@ LzmaUefiDecompressGetInfo (
                           the uncompressed buffer is returned in Destination.
   @retval  RETURN_INVALID_PARAMETER
                           The source buffer specified by Source is corrupted
-                          (not in a valid compressed format).
+                          (not in a valid compressed format), or its
+                          properties need more than the scratch buffer.
 **/
 RETURN_STATUS
 EFIAPI
@@ -191,6 +201,18 @@ LzmaUefiDecompress (
   SizeT             DecodedBufSize;
   SizeT             EncodedDataSize;
   ISzAllocWithData  AllocFuncs;
+  CLzmaProps        Props;
+
+  //
+  // The properties byte is checked before decoding, so that a corrupted one
+  // is reported as such rather than as a failed allocation in SzAlloc().
+  //
+  if ((SourceSize < LZMA_HEADER_SIZE) ||
+      (LzmaProps_Decode (&Props, Source, LZMA_PROPS_SIZE) != SZ_OK) ||
+      (LZMA_PROBS_SIZE (&Props) > SCRATCH_BUFFER_REQUEST_SIZE))
+  {
+    return RETURN_INVALID_PARAMETER;
+  }
 
   AllocFuncs.Functions.Alloc = SzAlloc;
   AllocFuncs.Functions.Free  = SzFree;
@@ -17,6 +17,12 @@
 #include <Library/ExtractGuidedSectionLib.h>
 #include <Guid/LzmaDecompress.h>
 
+//
+// The maximum number of LZMA states in the scratch buffer of chunked LZMA
+// data, which is the maximum number of chunks decompressed at the same time.
+//
+#define LZMA_CHUNKED_MAX_SLOTS  8
+
 /**
   Given a Lzma compressed source buffer, this function retrieves the size of
   the uncompressed buffer and the size of the scratch buffer required
@@ -80,7 +86,8 @@ LzmaUefiDecompressGetInfo (
                           the uncompressed buffer is returned in Destination.
   @retval  RETURN_INVALID_PARAMETER
                           The source buffer specified by Source is corrupted
-                          (not in a valid compressed format).
+                          (not in a valid compressed format), or its
+                          properties need more than the scratch buffer.
 **/
 RETURN_STATUS
 EFIAPI
@@ -91,4 +98,116 @@ LzmaUefiDecompress (
   IN OUT VOID    *Scratch
   );
 
+/**
+  Given a chunked Lzma compressed source buffer, this function retrieves the
+  size of the uncompressed buffer and the size of the scratch buffer required
+  to decompress the compressed source buffer.
+
+  The scratch buffer holds the descriptor of every chunk, and an LZMA state for
+  each chunk up to LZMA_CHUNKED_MAX_SLOTS.
+
+  @param  Source          The source buffer containing the compressed data.
+  @param  SourceSize      The size, in bytes, of the source buffer.
+  @param  DestinationSize A pointer to the size, in bytes, of the uncompressed buffer
+                          that will be generated when the compressed buffer specified
+                          by Source and SourceSize is decompressed.
+  @param  ScratchSize     A pointer to the size, in bytes, of the scratch buffer that
+                          is required to decompress the compressed buffer specified
+                          by Source and SourceSize.
+
+  @retval  RETURN_SUCCESS The size of the uncompressed data was returned
+                          in DestinationSize and the size of the scratch
+                          buffer was returned in ScratchSize.
+  @retval  RETURN_INVALID_PARAMETER
+                          The header or the index of the chunks is not valid.
+  @retval  RETURN_UNSUPPORTED
+                          The size of the scratch buffer does not fit in a
+                          UINT32.
+**/
+RETURN_STATUS
+EFIAPI
+LzmaChunkedUefiDecompressGetInfo (
+  IN  CONST VOID  *Source,
+  IN  UINT32      SourceSize,
+  OUT UINT32      *DestinationSize,
+  OUT UINT32      *ScratchSize
+  );
+
+/**
+  Decompresses a chunked Lzma compressed source buffer.
+
+  The index of the chunks and the header of every chunk are checked first, so
+  that no chunk is decompressed out of its part of Destination. The chunks are
+  then decompressed in parallel with MpWorkQueueRun(), or one after the other
+  if no other processor is available.
+
+  @param  Source      The source buffer containing the compressed data.
+  @param  SourceSize  The size of source buffer.
+  @param  Destination The destination buffer to store the decompressed data
+  @param  Scratch     A temporary scratch buffer that is used to perform the decompression.
+                      This is an optional parameter that may be NULL if the
+                      required scratch buffer size is 0.
+
+  @retval  RETURN_SUCCESS Decompression completed successfully, and
+                          the uncompressed buffer is returned in Destination.
+  @retval  RETURN_INVALID_PARAMETER
+                          The source buffer specified by Source is corrupted
+                          (not in a valid compressed format).
+**/
+RETURN_STATUS
+EFIAPI
+LzmaChunkedUefiDecompress (
+  IN CONST VOID  *Source,
+  IN UINTN       SourceSize,
+  IN OUT VOID    *Destination,
+  IN OUT VOID    *Scratch
+  );
+
+/**
+  Examines a GUIDed section compressed with LZMA and returns the size of the
+  decoded buffer and the size of an scratch buffer required to actually decode
+  the data in a GUIDed section.
+
+  @param[in]  InputSection       A pointer to a GUIDed section of an FFS formatted file.
+  @param[out] OutputBufferSize   A pointer to the size, in bytes, of an output buffer required
+                                 if the buffer specified by InputSection were decoded.
+  @param[out] ScratchBufferSize  A pointer to the size, in bytes, required as scratch space
+                                 if the buffer specified by InputSection were decoded.
+  @param[out] SectionAttribute   A pointer to the attributes of the GUIDed section. See the Attributes
+                                 field of EFI_GUID_DEFINED_SECTION in the PI Specification.
+
+  @retval  RETURN_SUCCESS            The information about InputSection was returned.
+  @retval  RETURN_INVALID_PARAMETER  The information can not be retrieved from the section specified by InputSection.
+**/
+RETURN_STATUS
+EFIAPI
+LzmaGuidedSectionGetInfo (
+  IN  CONST VOID  *InputSection,
+  OUT UINT32      *OutputBufferSize,
+  OUT UINT32      *ScratchBufferSize,
+  OUT UINT16      *SectionAttribute
+  );
+
+/**
+  Decompress a LZMA compressed GUIDed section into a caller allocated output buffer.
+
+  @param[in]  InputSection  A pointer to a GUIDed section of an FFS formatted file.
+  @param[out] OutputBuffer  A pointer to a buffer that contains the result of a decode operation.
+  @param[out] ScratchBuffer A caller allocated buffer that may be required by this function
+                            as a scratch buffer to perform the decode operation.
+  @param[out] AuthenticationStatus
+                            A pointer to the authentication status of the decoded output buffer.
+
+  @retval  RETURN_SUCCESS            The buffer specified by InputSection was decoded.
+  @retval  RETURN_INVALID_PARAMETER  The section specified by InputSection can not be decoded.
+**/
+RETURN_STATUS
+EFIAPI
+LzmaGuidedSectionExtraction (
+  IN CONST  VOID    *InputSection,
+  OUT       VOID    **OutputBuffer,
+  OUT       VOID    *ScratchBuffer         OPTIONAL,
+  OUT       UINT32  *AuthenticationStatus
+  );
+
 #endif
@@ -0,0 +1,989 @@
+/** @file
+  Unit tests of the chunked LZMA decompression.
+
+  The test vectors are compressed by the LzmaCompress tool of BaseTools, and
+  decompressed by LzmaChunkedUefiDecompress(), as valid, truncated and
+  corrupted streams.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+
+#include "../LzmaDecompressLibInternal.h"
+
+#define UNIT_TEST_APP_NAME     "Chunked LZMA Decompress Unit Test Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+///
+/// The size of the data compressed in the test vectors.
+///
+#define DECOMPRESS_TEST_DATA_SIZE  0x4000
+
+///
+/// The size of the LZMA properties, and of the header of an LZMA stream.
+///
+#define LZMA_PROPS_SIZE   5
+#define LZMA_HEADER_SIZE  (LZMA_PROPS_SIZE + 8)
+
+///
+/// The size of the scratch buffer needed by one LZMA stream.
+///
+#define LZMA_STREAM_SCRATCH_SIZE  SIZE_64KB
+
+typedef struct {
+  CONST UINT8    *Data;
+  UINTN          Size;
+  UINT32         ChunkSize;
+} LZMA_CHUNKED_TEST_VECTOR;
+
+//
+// Strings that look like the content of a firmware volume.
+//
+STATIC CONST CHAR8  *mTestDataStrings[] = {
+  "MZ",
+  "PE\0\0",
+  ".text",
+  ".data",
+  ".reloc",
+  "_FVH",
+  "EFI_STATUS",
+  "gEfiFirmwareVolume2ProtocolGuid",
+  "ASSERT_EFI_ERROR (Status = %r)\n",
+  "DxeCore",
+};
+
+/**
+  Generate the data that is compressed in the test vectors.
+
+  The data mixes strings, repeated strings, padding and random bytes, like the
+  sections of a firmware volume.
+
+  @param[out]  Buffer  The buffer to fill.
+  @param[in]   Size    The size, in bytes, of Buffer.
+**/
+STATIC
+VOID
+GenerateTestData (
+  OUT UINT8  *Buffer,
+  IN  UINTN  Size
+  )
+{
+  UINT32       Seed;
+  UINTN        Index;
+  UINTN        Offset;
+  UINTN        Length;
+  UINTN        Distance;
+  CONST CHAR8  *String;
+
+  Seed  = 0x5EED;
+  Index = 0;
+  while (Index < Size) {
+    Seed = Seed * 1103515245 + 12345;
+    switch ((Seed >> 16) % 4) {
+      case 0:
+        String = mTestDataStrings[(Seed >> 20) % ARRAY_SIZE (mTestDataStrings)];
+        Length = MIN (AsciiStrLen (String) + 1, Size - Index);
+        CopyMem (Buffer + Index, String, Length);
+        break;
+
+      case 1:
+        //
+        // Repeat the data found at most 4KB before.
+        //
+        if (Index == 0) {
+          Length = 0;
+          break;
+        }
+
+        Length   = MIN (3 + (Seed >> 24) % 32, Size - Index);
+        Distance = 1 + (Seed >> 8) % MIN (Index, 4096);
+        for (Offset = 0; Offset < Length; Offset++) {
+          Buffer[Index + Offset] = Buffer[Index + Offset - Distance];
+        }
+
+        break;
+
+      case 2:
+        Length = MIN (1 + (Seed >> 24) % 64, Size - Index);
+        SetMem (Buffer + Index, Length, ((Seed & BIT8) != 0) ? 0xFF : 0x00);
+        break;
+
+      default:
+        Buffer[Index] = (UINT8)(Seed >> 24);
+        Length        = 1;
+        break;
+    }
+
+    Index += Length;
+  }
+}
+
+//
+// The data of GenerateTestData(), compressed by
+// BaseTools/Source/C/LzmaCompress with --chunked --chunk-size 4096.
+//
+STATIC CONST UINT8  mLzmaChunked4KData[] = {
+  0x4c, 0x5a, 0x43, 0x4b, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2b, 0x02, 0x00, 0x00, 0x73, 0x02, 0x00, 0x00, 0x7d, 0x02, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00,
+  0x5d, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xee,
+  0x42, 0xb9, 0x94, 0x59, 0x70, 0xa7, 0xf5, 0xc9, 0xd4, 0xa1, 0xa9, 0x43, 0x31, 0xd3, 0x75, 0x86,
+  0x74, 0xba, 0x02, 0xd4, 0x6c, 0xe5, 0x82, 0x12, 0x42, 0xc4, 0xa4, 0x27, 0x38, 0xae, 0xd6, 0xb7,
+  0x8b, 0x33, 0xad, 0xad, 0x21, 0xdd, 0xbc, 0x23, 0xc9, 0x02, 0x97, 0x09, 0x58, 0x0f, 0xf9, 0xcb,
+  0x87, 0x97, 0x71, 0x53, 0x30, 0xc4, 0x26, 0x4c, 0x73, 0xc9, 0x79, 0x57, 0xea, 0x99, 0x26, 0x11,
+  0xab, 0x31, 0xb9, 0xa5, 0x98, 0xf0, 0x0f, 0x4f, 0xf1, 0x5f, 0xff, 0xcc, 0x52, 0x27, 0xd7, 0x4f,
+  0xa9, 0x50, 0x7b, 0x7c, 0x72, 0x80, 0xf4, 0x2c, 0x05, 0x9a, 0x10, 0xb9, 0x78, 0x59, 0xff, 0x02,
+  0xbf, 0xfc, 0x04, 0x3b, 0xfb, 0xd1, 0xfb, 0xbd, 0x3c, 0x07, 0xcc, 0x2a, 0x3d, 0x15, 0xd2, 0xf8,
+  0xa5, 0x53, 0x27, 0xa9, 0x42, 0xf4, 0xee, 0x36, 0xa1, 0x35, 0x3b, 0xbc, 0x52, 0xb5, 0x61, 0x53,
+  0x98, 0x8c, 0x2b, 0xe5, 0x82, 0x1a, 0x45, 0x1c, 0xf7, 0x3d, 0x20, 0xd6, 0xd2, 0x5c, 0xc0, 0x8a,
+  0xb7, 0x3b, 0x04, 0xe3, 0x64, 0x31, 0x6f, 0x10, 0x8f, 0x28, 0x61, 0x06, 0xb2, 0xf7, 0x78, 0xf5,
+  0x3e, 0x14, 0x8d, 0x8d, 0xa3, 0x8b, 0x2e, 0xd6, 0xb6, 0x24, 0xdc, 0x7d, 0xb6, 0xd5, 0xe0, 0xa9,
+  0x5c, 0x9a, 0xf6, 0x16, 0x3e, 0xf3, 0x90, 0x55, 0xb5, 0xb2, 0x3d, 0xe8, 0xca, 0x7b, 0x61, 0xf0,
+  0xf4, 0x08, 0x14, 0xd7, 0xdc, 0x19, 0x2b, 0x2e, 0x4f, 0xcc, 0x0b, 0x3e, 0x8a, 0x74, 0xe2, 0x54,
+  0xc2, 0x7e, 0xce, 0xbe, 0x54, 0xde, 0x8d, 0xfc, 0x53, 0xd0, 0x42, 0xe9, 0x75, 0x16, 0x69, 0x34,
+  0x24, 0x01, 0x95, 0xdb, 0x3d, 0x60, 0xb5, 0x8a, 0x69, 0x7f, 0x9d, 0x45, 0x99, 0xe3, 0x61, 0xed,
+  0x03, 0x50, 0xa8, 0x73, 0xa2, 0xe1, 0xe9, 0x9e, 0x2f, 0x41, 0xc3, 0x26, 0x9e, 0x2d, 0xaf, 0x61,
+  0x26, 0x8b, 0xd6, 0x2f, 0xb9, 0xef, 0xca, 0x32, 0xf7, 0x4c, 0xae, 0x35, 0x3f, 0x94, 0xb4, 0x48,
+  0x52, 0x1f, 0x3b, 0x54, 0x4e, 0x78, 0xc3, 0x2c, 0x4a, 0x9b, 0x19, 0x6f, 0x64, 0x3f, 0x58, 0x61,
+  0xc7, 0xba, 0xbf, 0x83, 0xde, 0x63, 0x86, 0xfa, 0xd5, 0x0b, 0x8a, 0x28, 0x23, 0x8d, 0xd5, 0x87,
+  0x8c, 0x20, 0x1f, 0x76, 0x38, 0xf7, 0x9d, 0xc9, 0xc7, 0x67, 0x20, 0x44, 0x67, 0x8a, 0xed, 0xc8,
+  0x8d, 0x94, 0x75, 0x92, 0xb1, 0xf7, 0xc2, 0xd1, 0xb6, 0x40, 0xc8, 0x0e, 0xa2, 0x82, 0x8f, 0xeb,
+  0x5d, 0x80, 0x21, 0x19, 0x15, 0xea, 0xe9, 0xf3, 0xbc, 0x7e, 0xb6, 0x28, 0x9e, 0x72, 0xce, 0x9b,
+  0x88, 0xe3, 0x77, 0x7e, 0x53, 0xf4, 0x64, 0xe3, 0x6b, 0xb3, 0x17, 0xbb, 0x37, 0xe9, 0xd0, 0x98,
+  0xae, 0xad, 0x99, 0xf8, 0x03, 0xe9, 0x26, 0xaf, 0x4d, 0x5f, 0xcc, 0x0f, 0xb3, 0xae, 0x93, 0x33,
+  0x72, 0xaa, 0x2e, 0xb3, 0xda, 0xf6, 0xfc, 0x32, 0xb3, 0xa3, 0xee, 0x75, 0x5e, 0x65, 0x80, 0x08,
+  0x12, 0x71, 0x4c, 0xdc, 0xe5, 0x5d, 0x88, 0x2e, 0x13, 0x7a, 0x41, 0xe6, 0x9f, 0xf4, 0xb4, 0x7f,
+  0xad, 0x30, 0xc4, 0x9b, 0x3a, 0xe6, 0x40, 0x2d, 0x68, 0x90, 0xcf, 0x69, 0x8f, 0x3d, 0x7a, 0x9e,
+  0x66, 0x32, 0x43, 0x99, 0xe0, 0xcd, 0x3f, 0x79, 0x7b, 0x39, 0x46, 0xb5, 0x26, 0xca, 0xa2, 0x5f,
+  0x8f, 0x34, 0x83, 0x13, 0x35, 0x11, 0x57, 0xfa, 0x4b, 0x4b, 0xbe, 0x33, 0xc0, 0x37, 0x8e, 0xeb,
+  0x57, 0x1d, 0x45, 0x6b, 0x3a, 0x01, 0x8e, 0xfc, 0x48, 0xad, 0x2a, 0x05, 0x42, 0xfd, 0xb8, 0x3e,
+  0xed, 0x85, 0x2d, 0xc4, 0x6b, 0xff, 0x88, 0xec, 0x3e, 0xb7, 0x15, 0xa1, 0xce, 0x35, 0xf0, 0x44,
+  0x46, 0xc0, 0x52, 0x7e, 0xbe, 0xb8, 0x65, 0x8e, 0x27, 0x0e, 0xe3, 0x0e, 0xc7, 0x52, 0x20, 0x51,
+  0x3e, 0x66, 0x56, 0x39, 0xa2, 0x6c, 0x9b, 0x01, 0x07, 0xd5, 0xcc, 0xa8, 0xd0, 0x2b, 0x95, 0x1c,
+  0xfc, 0xd6, 0x1b, 0xd9, 0x57, 0x6e, 0xae, 0xdd, 0xf7, 0x60, 0x00, 0x5d, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x33, 0x2d, 0x20, 0x94, 0xf0,
+  0x8a, 0x53, 0x79, 0x00, 0x41, 0x8e, 0xf6, 0x2a, 0xcc, 0x74, 0x7f, 0x6b, 0x11, 0x5f, 0x08, 0x42,
+  0xf3, 0xa4, 0xd9, 0xc0, 0xc7, 0xe2, 0x2e, 0x17, 0x73, 0x9f, 0x36, 0x0e, 0x85, 0xf5, 0xcd, 0xfd,
+  0xa0, 0x79, 0x0a, 0x12, 0xf7, 0x5d, 0x68, 0xce, 0xbe, 0x4e, 0xf4, 0xfa, 0xa2, 0xdb, 0x60, 0x33,
+  0xc9, 0xda, 0xb9, 0xdd, 0xdb, 0x57, 0xc1, 0xf6, 0xdd, 0xff, 0x02, 0x98, 0x1a, 0xe1, 0x5a, 0x3e,
+  0x03, 0x79, 0x61, 0xc7, 0x25, 0x8f, 0x34, 0xc5, 0x76, 0xe6, 0x82, 0x6a, 0x3a, 0x5f, 0x2f, 0xad,
+  0xa5, 0x66, 0xe9, 0xc0, 0x22, 0x79, 0x6d, 0xbb, 0x8d, 0x02, 0x7e, 0xca, 0xdc, 0x17, 0xcf, 0x85,
+  0x77, 0x5d, 0xc4, 0x49, 0xaf, 0x15, 0x51, 0x83, 0x7d, 0xd5, 0x51, 0x28, 0x73, 0x76, 0x70, 0xfa,
+  0xc3, 0x0a, 0x2a, 0x5e, 0x42, 0xa2, 0x6e, 0x8b, 0x72, 0xd6, 0xbe, 0x96, 0x49, 0x46, 0x47, 0x0a,
+  0x64, 0xcf, 0xc6, 0xbd, 0x1c, 0xde, 0xf9, 0xe0, 0x68, 0x3b, 0x3b, 0x1e, 0x41, 0x1e, 0xcb, 0x3d,
+  0x61, 0xf8, 0x11, 0x73, 0x86, 0xc9, 0x66, 0x9d, 0x70, 0xe7, 0x96, 0x46, 0x38, 0x66, 0x3d, 0xc0,
+  0xb2, 0xdc, 0x0f, 0xe2, 0x5e, 0x6c, 0x8b, 0x20, 0x04, 0x3b, 0x60, 0x23, 0xe9, 0x77, 0x05, 0x8f,
+  0x61, 0xac, 0x6f, 0xf7, 0x40, 0x9b, 0xd1, 0x9a, 0x15, 0xc0, 0x65, 0x68, 0xbf, 0x5b, 0x17, 0x1c,
+  0xea, 0x2f, 0x93, 0xfc, 0xe2, 0xb9, 0xe8, 0xe4, 0x74, 0x46, 0x02, 0xac, 0xf6, 0xe6, 0xc2, 0x24,
+  0x01, 0x94, 0x35, 0x6d, 0xf8, 0x64, 0x1d, 0x2c, 0xa6, 0x33, 0x24, 0x99, 0x1b, 0x91, 0x57, 0xf2,
+  0xa3, 0xde, 0xb9, 0x63, 0xf6, 0xd6, 0x3c, 0xb0, 0x71, 0xcb, 0xc1, 0xff, 0xcb, 0x50, 0x2e, 0x97,
+  0x7d, 0x7b, 0xea, 0xd4, 0x0b, 0x49, 0xa0, 0x43, 0xf8, 0x20, 0xad, 0x70, 0x45, 0xfa, 0xeb, 0xb8,
+  0x89, 0x53, 0xa1, 0xab, 0x52, 0x6f, 0x1c, 0xb2, 0xdb, 0x75, 0x2c, 0x22, 0xd2, 0xd5, 0xcc, 0x3c,
+  0x3a, 0xdd, 0xb3, 0xc0, 0x20, 0x6c, 0xeb, 0xd9, 0xa0, 0xa9, 0x50, 0x47, 0x3f, 0x95, 0x24, 0x49,
+  0xa2, 0x4e, 0xe7, 0xc5, 0xd2, 0x20, 0xc1, 0x00, 0x9d, 0xce, 0xd4, 0x72, 0xe0, 0xee, 0x94, 0x41,
+  0xc1, 0x67, 0x86, 0x5a, 0x90, 0x57, 0xbf, 0xd6, 0x5a, 0x9c, 0x0c, 0x56, 0xa4, 0xe4, 0xfa, 0xfd,
+  0xdc, 0x98, 0x9a, 0x0f, 0xb4, 0x46, 0x61, 0x65, 0x52, 0xf2, 0x48, 0x9c, 0x56, 0xca, 0xf6, 0x52,
+  0xbc, 0xe8, 0x3f, 0x7a, 0xc2, 0x65, 0xb6, 0xce, 0x55, 0x7b, 0x89, 0xd5, 0x5e, 0xcb, 0x5c, 0x78,
+  0xfe, 0x7c, 0x28, 0xb5, 0x59, 0x2e, 0x8c, 0xba, 0xc2, 0x48, 0x40, 0x8d, 0x88, 0xcf, 0xff, 0x6d,
+  0x08, 0x6a, 0x21, 0xc0, 0xff, 0x09, 0x66, 0x2d, 0x0c, 0xda, 0x68, 0x8f, 0x21, 0x09, 0xfc, 0x71,
+  0xe7, 0x5b, 0x1e, 0xc5, 0xa4, 0xef, 0x8c, 0x7f, 0x35, 0x68, 0xe6, 0xbc, 0x0a, 0x38, 0x37, 0xcd,
+  0xfa, 0x85, 0x28, 0x12, 0xba, 0x3a, 0x02, 0xc0, 0xeb, 0x12, 0xb3, 0xe9, 0x52, 0xe4, 0x0d, 0x74,
+  0xd7, 0xe6, 0xa3, 0x68, 0x1b, 0x66, 0x8e, 0x9b, 0xdd, 0xfd, 0xf7, 0x13, 0x73, 0x0a, 0x01, 0x32,
+  0x6f, 0x3c, 0xaf, 0x0f, 0x3a, 0xe1, 0x2e, 0x19, 0x62, 0xe1, 0x26, 0xb8, 0x21, 0xba, 0xcf, 0x36,
+  0x85, 0x93, 0x05, 0xf5, 0x0d, 0xb9, 0xa3, 0x36, 0xb1, 0xb0, 0xec, 0x20, 0x6b, 0xf5, 0xbd, 0x7e,
+  0x09, 0xa6, 0xb2, 0x0e, 0x5c, 0xd1, 0x9d, 0x94, 0xb5, 0xdd, 0x5a, 0x1c, 0xdc, 0x1d, 0x98, 0xe0,
+  0xf4, 0x5f, 0x2d, 0xb6, 0xe6, 0x9b, 0xff, 0x89, 0x9f, 0x12, 0xee, 0x66, 0xf0, 0xa1, 0xe1, 0x32,
+  0x2a, 0x38, 0x9e, 0x17, 0xe7, 0x24, 0x1a, 0x9a, 0x71, 0x93, 0x65, 0x41, 0x09, 0x0b, 0x70, 0xae,
+  0x10, 0xe2, 0x1d, 0xb5, 0x03, 0xcb, 0x3d, 0xcc, 0xda, 0x65, 0x3c, 0x23, 0x04, 0x1d, 0x7f, 0x6f,
+  0x4e, 0x9f, 0x88, 0x98, 0x0d, 0xf3, 0x91, 0x5a, 0xc3, 0xeb, 0x2f, 0xd7, 0x58, 0xcc, 0x33, 0xbd,
+  0xe6, 0xa0, 0xe4, 0x9f, 0x83, 0xcd, 0x8b, 0xf2, 0x50, 0x50, 0xd3, 0xd4, 0xc3, 0xe2, 0xc5, 0x1f,
+  0x04, 0xe9, 0x8a, 0xb9, 0x08, 0xfe, 0x8e, 0xd8, 0xe7, 0x75, 0x14, 0xfe, 0xa8, 0xdd, 0x1b, 0x69,
+  0x25, 0x64, 0xa0, 0x2d, 0x1d, 0xe3, 0x80, 0xe3, 0x46, 0x1d, 0x99, 0x3d, 0x86, 0xb4, 0xf8, 0x51,
+  0x1c, 0x2e, 0xfa, 0xd3, 0x41, 0x22, 0x19, 0x15, 0x08, 0x07, 0xd9, 0x22, 0x00, 0x00, 0x5d, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x9e, 0x0a, 0xc9,
+  0x3a, 0x86, 0x3a, 0x63, 0xab, 0x10, 0xf9, 0xae, 0x3c, 0x6f, 0xf8, 0x47, 0xf3, 0x60, 0x81, 0x66,
+  0x79, 0xeb, 0x4b, 0xd7, 0x19, 0x2c, 0xa6, 0xb6, 0x09, 0x54, 0xbe, 0x7d, 0x69, 0x0c, 0x0b, 0x8b,
+  0xf9, 0x01, 0x4c, 0x00, 0xf4, 0x6e, 0x44, 0x0a, 0x51, 0xa6, 0x47, 0xd0, 0xaf, 0x7c, 0xcc, 0x23,
+  0xcb, 0x56, 0xe5, 0xef, 0xa9, 0x56, 0x5f, 0xe0, 0xb4, 0x18, 0x1b, 0x4c, 0x2b, 0x85, 0x3e, 0xf3,
+  0x95, 0xc1, 0xb7, 0xab, 0xa1, 0xbd, 0xbf, 0x44, 0x56, 0x99, 0x52, 0x96, 0x39, 0xf1, 0xc6, 0x43,
+  0x73, 0xa6, 0xde, 0x58, 0x2b, 0x1e, 0x51, 0x0e, 0x4b, 0x0a, 0x5c, 0x20, 0x88, 0x1d, 0x0e, 0x8d,
+  0xaf, 0xc8, 0x3a, 0xac, 0x58, 0x41, 0xbe, 0x8b, 0x76, 0x9f, 0x0d, 0xee, 0x9e, 0xe3, 0xf0, 0x10,
+  0x4a, 0x3d, 0x87, 0xf8, 0x22, 0xbb, 0x4c, 0xb9, 0x4f, 0xfd, 0xb8, 0x0f, 0xc7, 0x90, 0xcf, 0xd5,
+  0x4d, 0x4d, 0xe3, 0x9c, 0xff, 0x9e, 0xde, 0x02, 0xd6, 0xb0, 0xd3, 0xe0, 0x83, 0x92, 0x5e, 0x22,
+  0x23, 0x1e, 0xe5, 0xd8, 0x2e, 0xa1, 0xf2, 0xf6, 0x55, 0x3a, 0x83, 0x28, 0xe1, 0x50, 0x75, 0xa8,
+  0xd9, 0x2b, 0x48, 0x31, 0x98, 0xad, 0x1e, 0x34, 0x7c, 0x1f, 0x87, 0x13, 0x27, 0xdf, 0x7a, 0x69,
+  0xc9, 0x66, 0x08, 0xbb, 0xb8, 0x9d, 0x3e, 0xf4, 0x31, 0x0f, 0x4d, 0x3b, 0xc4, 0x8f, 0xef, 0xce,
+  0x74, 0x09, 0x35, 0x94, 0x78, 0xfd, 0x58, 0xcc, 0x3f, 0x04, 0xeb, 0x13, 0x75, 0xd1, 0x03, 0xf0,
+  0x4b, 0x0e, 0x0f, 0x27, 0xb1, 0x53, 0x21, 0x70, 0x91, 0x2e, 0x0c, 0x8a, 0x9c, 0x6d, 0x3d, 0x8f,
+  0x2a, 0xee, 0xc0, 0x41, 0xd0, 0x96, 0x9f, 0x4c, 0xad, 0xf6, 0x0c, 0xd8, 0x7c, 0xd8, 0x2c, 0x92,
+  0x90, 0xd2, 0x4d, 0x89, 0xdc, 0xc7, 0x19, 0x13, 0xd2, 0xd9, 0x9a, 0x63, 0xd8, 0x88, 0xb9, 0xc7,
+  0xa8, 0xcb, 0x30, 0x8b, 0x1c, 0xe6, 0x1a, 0xde, 0xd6, 0x50, 0xa9, 0x89, 0x65, 0x07, 0xc1, 0x61,
+  0x04, 0xb5, 0x08, 0x47, 0xd2, 0xc7, 0xc5, 0xc5, 0x3a, 0xb4, 0x5d, 0xa1, 0x54, 0x29, 0x89, 0x5e,
+  0x86, 0xbb, 0xf6, 0xf9, 0x56, 0x33, 0xa6, 0x63, 0xc6, 0xf7, 0x9a, 0x7a, 0x35, 0x78, 0x09, 0x29,
+  0x3a, 0xe5, 0xd5, 0xb8, 0x3a, 0x6a, 0xc1, 0x8c, 0x0e, 0x7a, 0x9c, 0xb4, 0x5e, 0xde, 0x10, 0xff,
+  0x33, 0x69, 0xe3, 0x14, 0xfd, 0x99, 0xc9, 0x5f, 0x53, 0x9f, 0x10, 0xfb, 0x9f, 0xa5, 0x66, 0x31,
+  0x35, 0x5c, 0x3e, 0x26, 0xa9, 0xaa, 0x37, 0xe7, 0x05, 0x5b, 0xa8, 0xa9, 0xb1, 0x3f, 0xf9, 0x40,
+  0x79, 0x01, 0xd8, 0xa3, 0xea, 0xd9, 0x46, 0xd2, 0xfc, 0xd0, 0x63, 0xe9, 0xc3, 0x9e, 0x38, 0x32,
+  0x95, 0x61, 0xf9, 0xdd, 0x59, 0x13, 0xc0, 0x2a, 0x06, 0xb2, 0xc8, 0x8a, 0xa2, 0xa2, 0x06, 0xa3,
+  0x98, 0xba, 0x99, 0xd8, 0x62, 0x03, 0x86, 0xec, 0x48, 0xda, 0xf5, 0x90, 0x72, 0xc2, 0x98, 0x50,
+  0xe5, 0xae, 0x56, 0x01, 0x17, 0x95, 0xe3, 0xd9, 0xc8, 0x4a, 0x5d, 0x3a, 0x4f, 0xe7, 0x4f, 0xb8,
+  0x72, 0x37, 0xf9, 0xa4, 0xb4, 0xa6, 0x99, 0x21, 0xe6, 0xdc, 0x81, 0x88, 0x6a, 0x0e, 0xe3, 0x95,
+  0x9f, 0x8d, 0xc5, 0xff, 0x9b, 0x40, 0x9c, 0x5b, 0x65, 0xe5, 0xb7, 0xf6, 0x26, 0x12, 0x1d, 0xcc,
+  0x81, 0xde, 0xae, 0x3b, 0x82, 0xd6, 0x35, 0x64, 0xc7, 0xc3, 0x8c, 0xf3, 0xbf, 0x58, 0xee, 0xd4,
+  0x93, 0x02, 0x38, 0xe3, 0x17, 0x87, 0xb4, 0x82, 0x66, 0xcd, 0x60, 0xa8, 0x3e, 0x73, 0xaa, 0xc5,
+  0x4c, 0xb1, 0x38, 0x1f, 0x62, 0x47, 0x42, 0x68, 0x47, 0xb2, 0x9e, 0xba, 0xe9, 0x3a, 0x98, 0x8f,
+  0xa6, 0xc0, 0xa4, 0x71, 0xe4, 0xe0, 0x5d, 0x81, 0xdc, 0x6f, 0x28, 0x63, 0xba, 0x4f, 0xe6, 0x1a,
+  0xf0, 0x6b, 0x90, 0xab, 0x66, 0x8a, 0x75, 0xf1, 0x5a, 0x48, 0x32, 0x24, 0x9c, 0x8e, 0x4c, 0x39,
+  0x87, 0x03, 0x90, 0x7a, 0x8b, 0xa8, 0xce, 0x59, 0x52, 0x40, 0x18, 0x34, 0xde, 0xf3, 0x0b, 0x0e,
+  0x24, 0x5e, 0x9b, 0x25, 0xa3, 0x1c, 0x13, 0xdd, 0xd8, 0x9d, 0x95, 0x01, 0xb1, 0xe9, 0x4b, 0xc8,
+  0x66, 0xf0, 0x08, 0xf2, 0x33, 0x5a, 0x49, 0x16, 0xe1, 0xd8, 0xaf, 0x36, 0x63, 0x5b, 0x1b, 0x39,
+  0x93, 0xee, 0xa1, 0x85, 0x0f, 0x66, 0xb3, 0xcf, 0xd4, 0x44, 0x04, 0xf9, 0x38, 0x5d, 0x87, 0xba,
+  0xb5, 0x9f, 0x61, 0x72, 0x2b, 0xb9, 0x04, 0x76, 0xed, 0xb3, 0x1b, 0x53, 0x94, 0x95, 0xab, 0x69,
+  0x1a, 0x2c, 0xa1, 0x99, 0x17, 0xe8, 0x80, 0x96, 0x81, 0x9c, 0x66, 0x5d, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x41, 0xbe, 0xef, 0xe3, 0x60,
+  0x49, 0x71, 0x4c, 0x39, 0x0a, 0xa4, 0x93, 0xfa, 0x4f, 0xc9, 0x74, 0x8e, 0x7d, 0xd3, 0x55, 0x74,
+  0xcb, 0x9a, 0x68, 0x9d, 0x50, 0x8e, 0x70, 0xe8, 0x10, 0xd8, 0xea, 0x1e, 0x00, 0x07, 0x87, 0x47,
+  0x7d, 0x11, 0x33, 0x8e, 0x5d, 0xa0, 0x46, 0x8c, 0xdf, 0xb9, 0x41, 0xd1, 0x36, 0xf8, 0x6d, 0x35,
+  0x15, 0xf5, 0xb4, 0xbb, 0x9e, 0x63, 0x6b, 0xaa, 0x01, 0xb1, 0xe3, 0x61, 0xec, 0x92, 0x88, 0x77,
+  0xe7, 0x25, 0x7e, 0x60, 0x73, 0xb9, 0x6f, 0xe9, 0x08, 0x1c, 0x7c, 0x3e, 0x54, 0x92, 0x80, 0xfe,
+  0x96, 0x63, 0xdf, 0xac, 0x96, 0xe4, 0x83, 0x43, 0x2d, 0xbc, 0x62, 0xc9, 0x4b, 0x01, 0x6f, 0xa7,
+  0x28, 0x5c, 0x14, 0x9c, 0xcc, 0x2f, 0x48, 0x04, 0x6a, 0xd8, 0x7b, 0xa5, 0xfc, 0xc2, 0xc8, 0x88,
+  0x06, 0x07, 0x0a, 0x87, 0x0d, 0xe4, 0x25, 0x60, 0x1d, 0x7b, 0x2e, 0xc6, 0xbf, 0x3e, 0x3a, 0x93,
+  0xbb, 0xb9, 0xe7, 0xb5, 0x79, 0x86, 0x57, 0x32, 0x8c, 0x9a, 0x64, 0x9a, 0x58, 0x87, 0xa0, 0x5b,
+  0x67, 0xe9, 0x9f, 0xc7, 0x22, 0xa7, 0x6b, 0x0d, 0x98, 0x59, 0x0b, 0x5a, 0xc9, 0x80, 0x60, 0x80,
+  0x93, 0x9d, 0x9d, 0x6f, 0x14, 0xa9, 0x5f, 0x5d, 0x84, 0x83, 0xc4, 0x14, 0x3c, 0x60, 0xd7, 0xe7,
+  0x7d, 0x78, 0x47, 0x22, 0x44, 0x42, 0xc1, 0x52, 0xc9, 0x79, 0x33, 0x25, 0xf2, 0x54, 0xa6, 0x6f,
+  0x6a, 0x2a, 0x2e, 0x40, 0xb9, 0x46, 0xbd, 0x6e, 0x36, 0x2c, 0x16, 0x7c, 0x92, 0xd4, 0xb9, 0xab,
+  0x21, 0x3b, 0x4f, 0x09, 0xf4, 0xed, 0x4a, 0xd7, 0xf9, 0xe4, 0x66, 0x5a, 0x0a, 0x3e, 0xb5, 0x96,
+  0xd6, 0x62, 0xc8, 0x7a, 0x80, 0x38, 0x9b, 0xbc, 0x92, 0xa8, 0x0b, 0x9f, 0x18, 0x33, 0x0b, 0xc9,
+  0x0a, 0xf6, 0x9d, 0xef, 0x03, 0x5c, 0x40, 0x1c, 0x5f, 0x35, 0x77, 0x4e, 0x4b, 0x3c, 0xa9, 0x9c,
+  0xb1, 0x0c, 0x08, 0xe6, 0x38, 0xf9, 0xe8, 0x1a, 0x17, 0x9a, 0xd5, 0x96, 0xb2, 0x98, 0x8a, 0x38,
+  0xa7, 0x6f, 0x30, 0x19, 0x77, 0xdd, 0x79, 0xc2, 0xef, 0x73, 0xc9, 0x16, 0x5f, 0x38, 0x50, 0x9d,
+  0x2a, 0xe9, 0x97, 0x7f, 0xb5, 0xfe, 0xbc, 0x03, 0xb6, 0xd7, 0xff, 0xa6, 0xa2, 0xb8, 0x37, 0xc0,
+  0x31, 0xb0, 0xc9, 0x95, 0x08, 0xde, 0xef, 0x80, 0xd2, 0x5f, 0xf2, 0xc8, 0xbf, 0x30, 0x41, 0xab,
+  0x65, 0xe7, 0xd6, 0x7c, 0x66, 0x43, 0x0a, 0xc9, 0xe5, 0x5e, 0x9b, 0x71, 0x85, 0xb3, 0x9d, 0x0b,
+  0x5d, 0xb5, 0x91, 0x59, 0x90, 0x8e, 0x9f, 0x47, 0xd7, 0x3c, 0x0e, 0xf1, 0x00, 0x1b, 0x10, 0x88,
+  0x20, 0x9f, 0xe1, 0x07, 0x4a, 0x75, 0x91, 0x89, 0xad, 0x9e, 0x65, 0xc8, 0xcf, 0xd6, 0x24, 0x2a,
+  0x97, 0xd0, 0x00, 0xfe, 0x9d, 0xbf, 0xd6, 0x69, 0x2f, 0x45, 0x25, 0xb5, 0xca, 0x55, 0x75, 0x9d,
+  0xe5, 0x40, 0x09, 0xc3, 0x03, 0x74, 0xcb, 0x6a, 0xe4, 0xc1, 0x1b, 0x63, 0x86, 0xbf, 0x35, 0x55,
+  0x19, 0x52, 0x72, 0x6c, 0x33, 0x61, 0x28, 0x63, 0x56, 0xc5, 0x62, 0x15, 0x56, 0xf3, 0xff, 0x16,
+  0xc1, 0x8e, 0xfe, 0xbd, 0x90, 0xe6, 0xf7, 0x70, 0x68, 0x7e, 0x4c, 0x4c, 0x6f, 0xfc, 0x01, 0x0a,
+  0x64, 0x3e, 0xad, 0xd1, 0xb3, 0x44, 0x74, 0x30, 0x56, 0xd1, 0x65, 0xdd, 0x9b, 0x25, 0xf8, 0xe0,
+  0x80, 0x88, 0xe7, 0xeb, 0xe3, 0x62, 0xc1, 0x1b, 0x62, 0x37, 0xff, 0x5f, 0x8c, 0x00, 0xd4, 0x4b,
+  0xab, 0x72, 0x31, 0xf4, 0xb3, 0xdb, 0xb2, 0x89, 0x9b, 0x57, 0xcf, 0x17, 0xa8, 0xb7, 0x58, 0xbb,
+  0x69, 0x99, 0x52, 0xd9, 0xf7, 0x02, 0xaa, 0xd1, 0x63, 0xcb, 0x1a, 0xa8, 0x84, 0x31, 0x63, 0x69,
+  0x27, 0xf5, 0xdc, 0x94, 0xde, 0xe2, 0x48, 0x0d, 0xee, 0xea, 0x70, 0x90, 0x32, 0xe4, 0xb4, 0x54,
+  0x95, 0xbc, 0xb3, 0x92, 0xbd, 0x80, 0x9f, 0x54, 0x56, 0xe6, 0x49, 0xa1, 0x24, 0x8d, 0xef, 0xc6,
+  0x01, 0xaf, 0x2e, 0x19, 0xa9, 0x40, 0x94, 0xf4, 0x9b, 0xfa, 0xdb, 0x0c, 0xd3, 0x9f, 0xf1, 0x94,
+  0xa7, 0x2c, 0xda, 0x37, 0xa9, 0x41, 0x80, 0x9a, 0x7f, 0x04, 0x42, 0x67, 0x9a, 0xbe, 0x5f, 0x11,
+  0xbe, 0x00, 0x6f, 0x96, 0xff, 0x5e, 0x13, 0x6c, 0xc2, 0x25, 0x0d, 0x46, 0xd9, 0x44, 0x12, 0x45,
+  0xad, 0xa1, 0x87, 0xda, 0x85, 0x7e, 0xba, 0x9a, 0x4d, 0x52, 0xaf, 0x3b, 0x2c, 0x5b, 0x63, 0x06,
+  0xb4, 0x71, 0x28, 0x9a, 0x58, 0x02, 0x97, 0xfe, 0x11, 0x97, 0xa3, 0x7a, 0x3e, 0x5d, 0xb8, 0x87,
+  0xd1, 0x4a, 0xea, 0x40, 0x77, 0x18, 0x0b, 0xe7, 0xf0, 0xb0, 0x1a, 0x55, 0x33, 0x22, 0xe2, 0x65,
+  0xb2, 0xa8, 0x1e, 0x47, 0x0c, 0x48, 0x86, 0x4c, 0x6e, 0x57, 0x20, 0x72, 0x7f, 0x6b, 0x9b, 0x14,
+};
+
+//
+// The data of GenerateTestData(), compressed by
+// BaseTools/Source/C/LzmaCompress with --chunked --chunk-size 6144.
+//
+STATIC CONST UINT8  mLzmaChunked6KData[] = {
+  0x4c, 0x5a, 0x43, 0x4b, 0x00, 0x40, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x11, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00, 0x5d, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xee, 0x42, 0xb9, 0x94, 0x59,
+  0x70, 0xa7, 0xf5, 0xc9, 0xd4, 0xa1, 0xa9, 0x43, 0x31, 0xd3, 0x75, 0x86, 0x74, 0xba, 0x02, 0xd4,
+  0x6c, 0xe5, 0x82, 0x12, 0x42, 0xc4, 0xa4, 0x27, 0x38, 0xae, 0xd6, 0xb7, 0x8b, 0x33, 0xad, 0xad,
+  0x21, 0xdd, 0xbc, 0x23, 0xc9, 0x02, 0x97, 0x09, 0x58, 0x0f, 0xf9, 0xcb, 0x87, 0x97, 0x71, 0x53,
+  0x30, 0xc4, 0x26, 0x4c, 0x73, 0xc9, 0x79, 0x57, 0xea, 0x99, 0x26, 0x11, 0xab, 0x31, 0xb9, 0xa5,
+  0x98, 0xf0, 0x0f, 0x4f, 0xf1, 0x5f, 0xff, 0xcc, 0x52, 0x27, 0xd7, 0x4f, 0xa9, 0x50, 0x7b, 0x7c,
+  0x72, 0x80, 0xf4, 0x2c, 0x05, 0x9a, 0x10, 0xb9, 0x78, 0x59, 0xff, 0x02, 0xbf, 0xfc, 0x04, 0x3b,
+  0xfb, 0xd1, 0xfb, 0xbd, 0x3c, 0x07, 0xcc, 0x2a, 0x3d, 0x15, 0xd2, 0xf8, 0xa5, 0x53, 0x27, 0xa9,
+  0x42, 0xf4, 0xee, 0x36, 0xa1, 0x35, 0x3b, 0xbc, 0x52, 0xb5, 0x61, 0x53, 0x98, 0x8c, 0x2b, 0xe5,
+  0x82, 0x1a, 0x45, 0x1c, 0xf7, 0x3d, 0x20, 0xd6, 0xd2, 0x5c, 0xc0, 0x8a, 0xb7, 0x3b, 0x04, 0xe3,
+  0x64, 0x31, 0x6f, 0x10, 0x8f, 0x28, 0x61, 0x06, 0xb2, 0xf7, 0x78, 0xf5, 0x3e, 0x14, 0x8d, 0x8d,
+  0xa3, 0x8b, 0x2e, 0xd6, 0xb6, 0x24, 0xdc, 0x7d, 0xb6, 0xd5, 0xe0, 0xa9, 0x5c, 0x9a, 0xf6, 0x16,
+  0x3e, 0xf3, 0x90, 0x55, 0xb5, 0xb2, 0x3d, 0xe8, 0xca, 0x7b, 0x61, 0xf0, 0xf4, 0x08, 0x14, 0xd7,
+  0xdc, 0x19, 0x2b, 0x2e, 0x4f, 0xcc, 0x0b, 0x3e, 0x8a, 0x74, 0xe2, 0x54, 0xc2, 0x7e, 0xce, 0xbe,
+  0x54, 0xde, 0x8d, 0xfc, 0x53, 0xd0, 0x42, 0xe9, 0x75, 0x16, 0x69, 0x34, 0x24, 0x01, 0x95, 0xdb,
+  0x3d, 0x60, 0xb5, 0x8a, 0x69, 0x7f, 0x9d, 0x45, 0x99, 0xe3, 0x61, 0xed, 0x03, 0x50, 0xa8, 0x73,
+  0xa2, 0xe1, 0xe9, 0x9e, 0x2f, 0x41, 0xc3, 0x26, 0x9e, 0x2d, 0xaf, 0x61, 0x26, 0x8b, 0xd6, 0x2f,
+  0xb9, 0xef, 0xca, 0x32, 0xf7, 0x4c, 0xae, 0x35, 0x3f, 0x94, 0xb4, 0x48, 0x52, 0x1f, 0x3b, 0x54,
+  0x4e, 0x78, 0xc3, 0x2c, 0x4a, 0x9b, 0x19, 0x6f, 0x64, 0x3f, 0x58, 0x61, 0xc7, 0xba, 0xbf, 0x83,
+  0xde, 0x63, 0x86, 0xfa, 0xd5, 0x0b, 0x8a, 0x28, 0x23, 0x8d, 0xd5, 0x87, 0x8c, 0x20, 0x1f, 0x76,
+  0x38, 0xf7, 0x9d, 0xc9, 0xc7, 0x67, 0x20, 0x44, 0x67, 0x8a, 0xed, 0xc8, 0x8d, 0x94, 0x75, 0x92,
+  0xb1, 0xf7, 0xc2, 0xd1, 0xb6, 0x40, 0xc8, 0x0e, 0xa2, 0x82, 0x8f, 0xeb, 0x5d, 0x80, 0x21, 0x19,
+  0x15, 0xea, 0xe9, 0xf3, 0xbc, 0x7e, 0xb6, 0x28, 0x9e, 0x72, 0xce, 0x9b, 0x88, 0xe3, 0x77, 0x7e,
+  0x53, 0xf4, 0x64, 0xe3, 0x6b, 0xb3, 0x17, 0xbb, 0x37, 0xe9, 0xd0, 0x98, 0xae, 0xad, 0x99, 0xf8,
+  0x03, 0xe9, 0x26, 0xaf, 0x4d, 0x5f, 0xcc, 0x0f, 0xb3, 0xae, 0x93, 0x33, 0x72, 0xaa, 0x2e, 0xb3,
+  0xda, 0xf6, 0xfc, 0x32, 0xb3, 0xa3, 0xee, 0x75, 0x5e, 0x65, 0x80, 0x08, 0x12, 0x71, 0x4c, 0xdc,
+  0xe5, 0x5d, 0x88, 0x2e, 0x13, 0x7a, 0x41, 0xe6, 0x9f, 0xf4, 0xb4, 0x7f, 0xad, 0x30, 0xc4, 0x9b,
+  0x3a, 0xe6, 0x40, 0x2d, 0x68, 0x90, 0xcf, 0x69, 0x8f, 0x3d, 0x7a, 0x9e, 0x66, 0x32, 0x43, 0x99,
+  0xe0, 0xcd, 0x3f, 0x79, 0x7b, 0x39, 0x46, 0xb5, 0x26, 0xca, 0xa2, 0x5f, 0x8f, 0x34, 0x83, 0x13,
+  0x35, 0x11, 0x57, 0xfa, 0x4b, 0x4b, 0xbe, 0x33, 0xc0, 0x37, 0x8e, 0xeb, 0x57, 0x1d, 0x45, 0x6b,
+  0x3a, 0x01, 0x8e, 0xfc, 0x48, 0xad, 0x2a, 0x05, 0x42, 0xfd, 0xb8, 0x3e, 0xed, 0x85, 0x2d, 0xc4,
+  0x6b, 0xff, 0x88, 0xec, 0x3e, 0xb7, 0x15, 0xa1, 0xce, 0x35, 0xf0, 0x44, 0x46, 0xc0, 0x52, 0x7e,
+  0xbe, 0xb8, 0x65, 0x8e, 0x27, 0x0e, 0xe3, 0x0e, 0xc7, 0x52, 0x20, 0x51, 0x3e, 0x66, 0x56, 0x39,
+  0xa2, 0x6c, 0x9b, 0x01, 0x07, 0xd5, 0xcc, 0xa8, 0xd0, 0x2b, 0x95, 0x1c, 0xfc, 0xd6, 0x1b, 0xd9,
+  0x57, 0x6e, 0xac, 0xb0, 0xff, 0xa3, 0x21, 0xa7, 0x1d, 0x4d, 0xbf, 0x36, 0xe9, 0x04, 0x60, 0x70,
+  0x21, 0x5b, 0x45, 0xe2, 0x6e, 0xc2, 0x08, 0x24, 0xcc, 0x8e, 0xcc, 0x6b, 0x25, 0x30, 0xeb, 0x2a,
+  0x64, 0xd1, 0xf6, 0xca, 0x68, 0x63, 0x13, 0x97, 0x88, 0x38, 0xdb, 0x40, 0x22, 0xb9, 0xc3, 0x52,
+  0x3a, 0xc2, 0x14, 0xa3, 0xe1, 0x8c, 0x9f, 0xe2, 0x62, 0x67, 0x55, 0x94, 0x8c, 0xcf, 0x81, 0x92,
+  0x91, 0x65, 0xe4, 0x4b, 0xff, 0x46, 0xbd, 0xb6, 0x73, 0x81, 0x65, 0x8d, 0xa2, 0xf6, 0xcf, 0xbb,
+  0x06, 0xe8, 0xad, 0xc6, 0xa6, 0x80, 0x55, 0x1a, 0xdb, 0xf7, 0x1b, 0x87, 0x43, 0x4d, 0x84, 0x89,
+  0xd0, 0x05, 0xae, 0x9a, 0x66, 0x36, 0x4d, 0x4f, 0xda, 0x1b, 0xcc, 0xfd, 0x98, 0x80, 0x3e, 0x24,
+  0x1f, 0xc0, 0xd2, 0x61, 0xc3, 0x05, 0xdf, 0x32, 0xcf, 0x7a, 0x32, 0x25, 0x2b, 0x9b, 0xa4, 0xfd,
+  0x19, 0x21, 0x72, 0x47, 0xb8, 0x9d, 0xb4, 0xbb, 0xb0, 0xbb, 0x33, 0xb7, 0x75, 0x68, 0x7a, 0x32,
+  0xd6, 0x7f, 0x24, 0xd9, 0x23, 0xea, 0xdc, 0x6c, 0x40, 0x31, 0x4d, 0x37, 0x65, 0x6b, 0x59, 0xc7,
+  0xdd, 0x77, 0x42, 0x59, 0x78, 0xcb, 0x65, 0xbc, 0x36, 0xdf, 0x49, 0x82, 0x55, 0xf5, 0xf4, 0xe2,
+  0xf5, 0xd2, 0x10, 0x68, 0xa6, 0x44, 0x75, 0x46, 0x7c, 0x90, 0xb5, 0x3b, 0x34, 0xf4, 0xfb, 0xd3,
+  0x22, 0x5d, 0x12, 0x5e, 0x11, 0x12, 0xb6, 0xbf, 0x4b, 0xb7, 0xcb, 0x3c, 0xcd, 0x5d, 0xd6, 0x3c,
+  0x8f, 0xab, 0xe8, 0xf8, 0x34, 0x93, 0x08, 0x36, 0xdc, 0xcd, 0x15, 0xa6, 0xba, 0x12, 0x0a, 0x56,
+  0x51, 0x66, 0x81, 0xc4, 0x33, 0xe1, 0xd9, 0xea, 0x20, 0xa4, 0x6b, 0x70, 0x00, 0x5d, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xee, 0x48, 0x50, 0x22,
+  0x80, 0x1a, 0x0f, 0x6d, 0xcb, 0xe8, 0x06, 0x47, 0x92, 0x06, 0xdb, 0x57, 0x64, 0x12, 0x20, 0xac,
+  0x50, 0x6d, 0x1d, 0x54, 0x2e, 0x42, 0x45, 0x88, 0x3d, 0x1f, 0xed, 0xe7, 0xa0, 0x2f, 0x46, 0x7b,
+  0x58, 0xb5, 0x17, 0x47, 0x10, 0x9c, 0xaa, 0xd5, 0xd0, 0x7e, 0xcd, 0xf7, 0xa0, 0x42, 0x03, 0x8e,
+  0x4d, 0xf6, 0x93, 0x5e, 0x45, 0x1d, 0x61, 0x4d, 0x2d, 0xd7, 0x9d, 0xdf, 0x9b, 0xef, 0x4d, 0x79,
+  0xa0, 0x29, 0x05, 0x93, 0x38, 0x99, 0x13, 0x1f, 0xdd, 0x4b, 0xdb, 0xb2, 0xeb, 0x86, 0xde, 0x16,
+  0xd2, 0xb4, 0xc1, 0xa8, 0xae, 0xd3, 0x54, 0xb4, 0x1b, 0xc7, 0x15, 0xaa, 0xe8, 0xde, 0x4f, 0xd6,
+  0xf5, 0x64, 0xdc, 0x49, 0xa6, 0x27, 0xed, 0xc2, 0x62, 0xc9, 0xd9, 0xd5, 0xc4, 0xf0, 0xbe, 0x92,
+  0x36, 0x0f, 0x1b, 0x74, 0x48, 0x9d, 0xc9, 0x63, 0x2e, 0xd3, 0x9b, 0xe5, 0x0e, 0xc1, 0x52, 0x39,
+  0xe1, 0x34, 0xa3, 0x7a, 0x17, 0x66, 0x7c, 0xad, 0x00, 0x91, 0xfb, 0x60, 0x42, 0xba, 0xbf, 0x5d,
+  0x93, 0xc2, 0x5c, 0x53, 0x60, 0xc8, 0x9a, 0x57, 0x6a, 0x12, 0x01, 0x64, 0x80, 0x9a, 0x23, 0xae,
+  0xba, 0x47, 0xb0, 0x8d, 0x2b, 0x69, 0x5d, 0xa2, 0x69, 0x3c, 0x4d, 0xbc, 0xf7, 0x8f, 0x72, 0x31,
+  0x0d, 0xb7, 0x4b, 0xc7, 0x5b, 0x92, 0x4a, 0xc1, 0x7b, 0xc2, 0xd5, 0x40, 0x40, 0x2c, 0x4e, 0x24,
+  0x78, 0xe9, 0x37, 0xfb, 0xa8, 0x82, 0x78, 0xe0, 0x09, 0x96, 0xb5, 0x03, 0x8d, 0xe7, 0xb1, 0x7a,
+  0x5b, 0xaa, 0x55, 0x35, 0x2f, 0x0f, 0xda, 0x51, 0xdb, 0x70, 0xcf, 0x17, 0x37, 0x7b, 0x50, 0x58,
+  0xfa, 0xaa, 0x5f, 0xde, 0x99, 0x0f, 0x04, 0x00, 0x20, 0x57, 0xbe, 0x82, 0xbc, 0xaf, 0x55, 0x9a,
+  0x93, 0xb7, 0x5b, 0xbb, 0x80, 0xcd, 0xd0, 0xc7, 0x0d, 0xc7, 0xbc, 0x8e, 0xb0, 0xf9, 0x65, 0x72,
+  0x0b, 0x12, 0x6d, 0x8e, 0x98, 0xb4, 0x52, 0xf4, 0x09, 0x93, 0x99, 0x16, 0x82, 0x0b, 0x06, 0xd6,
+  0x0f, 0x5c, 0x49, 0x56, 0x9c, 0x0c, 0xe0, 0x2e, 0x48, 0x1c, 0x93, 0x10, 0x38, 0x1b, 0x45, 0xc8,
+  0xed, 0xb0, 0xd2, 0xd5, 0xf2, 0xc5, 0x7e, 0x23, 0xc4, 0x66, 0xe0, 0xc2, 0xbd, 0x1d, 0x9a, 0x4d,
+  0x3e, 0x30, 0xb1, 0x9a, 0x64, 0xb4, 0xea, 0xce, 0x65, 0xf7, 0x00, 0x01, 0x8c, 0x79, 0x21, 0xd0,
+  0x41, 0xb9, 0x24, 0x67, 0xd4, 0x96, 0xd1, 0x1d, 0xf9, 0x67, 0x66, 0xf6, 0x4e, 0xb4, 0x41, 0x74,
+  0x3f, 0x05, 0x9b, 0xe7, 0xdb, 0x75, 0x87, 0x86, 0x8e, 0xff, 0xda, 0xf0, 0x4d, 0x62, 0x05, 0xf6,
+  0xff, 0x33, 0x1d, 0x9b, 0x3f, 0x37, 0x89, 0xff, 0x39, 0x91, 0x09, 0x1c, 0x5f, 0x4e, 0x61, 0x3b,
+  0x7a, 0x3b, 0xd4, 0xb5, 0xcf, 0xf6, 0x04, 0xee, 0x1b, 0xec, 0x68, 0x93, 0x86, 0x3c, 0xb5, 0xed,
+  0x26, 0xec, 0x59, 0xae, 0x39, 0x0e, 0xf8, 0xf6, 0xd6, 0xad, 0xbe, 0xa0, 0x83, 0xdf, 0x4a, 0x88,
+  0x17, 0x41, 0x67, 0xbd, 0xa3, 0x53, 0x6c, 0x96, 0x26, 0x79, 0x70, 0x66, 0xc7, 0xe5, 0x7d, 0xf2,
+  0xce, 0x86, 0x82, 0x3e, 0x81, 0x13, 0xa2, 0x0d, 0x6e, 0x75, 0x36, 0x70, 0x6f, 0x26, 0xc5, 0x9e,
+  0x25, 0x17, 0x9b, 0xfb, 0x7e, 0xc5, 0x3d, 0xf3, 0x59, 0x5e, 0x56, 0x6f, 0xb6, 0x8d, 0x01, 0x58,
+  0xa6, 0x10, 0xf2, 0x66, 0xf1, 0x66, 0x53, 0xf9, 0x44, 0xa7, 0xed, 0xf5, 0x8c, 0xc8, 0x4c, 0x0d,
+  0xc0, 0x4e, 0x93, 0x5a, 0x05, 0x78, 0xeb, 0x74, 0x31, 0xa9, 0x3f, 0xc0, 0xe3, 0x31, 0xfd, 0x8c,
+  0xf7, 0xf9, 0x13, 0xfe, 0xf1, 0x24, 0x32, 0xab, 0xcf, 0x1c, 0x94, 0xb9, 0xf7, 0xac, 0x83, 0x60,
+  0x5a, 0x5b, 0x2d, 0xda, 0xb2, 0x2c, 0xe0, 0xe3, 0x1c, 0x0d, 0x1d, 0x23, 0x54, 0x95, 0x0f, 0x00,
+  0xd8, 0xa8, 0x31, 0x64, 0x5a, 0xf8, 0x3a, 0xe0, 0x2e, 0x6a, 0x27, 0xda, 0xf4, 0x36, 0x96, 0x2b,
+  0x97, 0xd1, 0xd5, 0x53, 0x29, 0x93, 0xd0, 0x5e, 0x47, 0xb3, 0xcc, 0x60, 0xaf, 0x0b, 0xeb, 0x87,
+  0x80, 0x70, 0x60, 0xdf, 0x11, 0x77, 0xe2, 0xf5, 0x20, 0x18, 0x5e, 0x08, 0x2a, 0x3f, 0x2c, 0x33,
+  0xe0, 0x7c, 0xbf, 0xc7, 0x24, 0xd9, 0x3e, 0xaa, 0x75, 0x37, 0xf3, 0xe1, 0x3a, 0xa1, 0x13, 0xb6,
+  0xd1, 0x49, 0xa2, 0xc8, 0x31, 0xdf, 0xfc, 0xec, 0x67, 0xef, 0xf8, 0x14, 0x1f, 0xfd, 0x9d, 0x81,
+  0xed, 0x4d, 0x6f, 0x20, 0xa9, 0xa2, 0x25, 0x92, 0xe2, 0xf4, 0x12, 0x38, 0xeb, 0x09, 0x0d, 0xb6,
+  0xcd, 0x75, 0x9c, 0xa2, 0xbb, 0x5e, 0x90, 0x80, 0xd1, 0x39, 0x6e, 0x03, 0x0a, 0xa8, 0xff, 0x88,
+  0x8f, 0x4a, 0x56, 0x6d, 0xdd, 0xd0, 0x20, 0x96, 0x14, 0x71, 0x40, 0xae, 0xe4, 0x50, 0x40, 0xf7,
+  0xdf, 0xba, 0xe6, 0x60, 0x91, 0x32, 0x4c, 0xa9, 0x80, 0x82, 0x6a, 0x39, 0x61, 0xf7, 0xad, 0x56,
+  0x3e, 0x3b, 0x9c, 0x85, 0x63, 0x0c, 0x39, 0x3a, 0xa7, 0xcf, 0x7f, 0x18, 0x57, 0x99, 0x40, 0x3d,
+  0x68, 0x1e, 0x12, 0x40, 0x0f, 0x81, 0x28, 0xe3, 0x0e, 0xef, 0x2a, 0x37, 0x35, 0x09, 0xd2, 0xa9,
+  0x13, 0x92, 0xb2, 0x3b, 0x97, 0x47, 0x23, 0x90, 0xf7, 0xcf, 0xd9, 0xb0, 0xfa, 0x5e, 0x1d, 0x53,
+  0x2b, 0xf6, 0xe3, 0xce, 0xc7, 0x55, 0x00, 0xdf, 0x1e, 0x95, 0x17, 0x35, 0xbc, 0x4f, 0x40, 0x2b,
+  0x33, 0xdc, 0x09, 0x2a, 0x21, 0x7c, 0xf9, 0x6a, 0x58, 0x35, 0x7c, 0x8d, 0x7d, 0xb6, 0x3d, 0x12,
+  0x3b, 0xc7, 0x75, 0xad, 0x78, 0xb4, 0xb8, 0xd5, 0x50, 0x78, 0xe6, 0x7d, 0x4a, 0x41, 0xc9, 0xc9,
+  0x50, 0x07, 0xe2, 0xa8, 0x97, 0xc9, 0xb2, 0xdd, 0xc8, 0x57, 0xbf, 0x8b, 0xd6, 0x95, 0xd6, 0xf2,
+  0x9e, 0xda, 0xb6, 0x58, 0x3f, 0x9b, 0x7b, 0xc2, 0x03, 0x77, 0x08, 0xe8, 0xf3, 0xe5, 0x83, 0xc5,
+  0xe9, 0x85, 0xc1, 0xfb, 0xe8, 0x2b, 0x90, 0x28, 0xb1, 0xed, 0x5e, 0x0e, 0x2d, 0x41, 0x43, 0xf0,
+  0x99, 0x70, 0x11, 0x8a, 0xe1, 0xfa, 0x7c, 0xee, 0xbe, 0x90, 0xda, 0x2e, 0x11, 0xe8, 0xc7, 0xc5,
+  0x34, 0xf4, 0x11, 0x41, 0x81, 0x01, 0x30, 0x68, 0x32, 0xe1, 0xf0, 0x41, 0x9d, 0x56, 0xe2, 0x4c,
+  0x00, 0x5d, 0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6c, 0x41, 0xbe, 0xef, 0xe3, 0x60, 0x49, 0x71, 0x4c, 0x39, 0x0a, 0xa4, 0x93, 0xfa, 0x4f, 0xc9,
+  0x74, 0x8e, 0x7d, 0xd3, 0x55, 0x74, 0xcb, 0x9a, 0x68, 0x9d, 0x50, 0x8e, 0x70, 0xe8, 0x10, 0xd8,
+  0xea, 0x1e, 0x00, 0x07, 0x87, 0x47, 0x7d, 0x11, 0x33, 0x8e, 0x5d, 0xa0, 0x46, 0x8c, 0xdf, 0xb9,
+  0x41, 0xd1, 0x36, 0xf8, 0x6d, 0x35, 0x15, 0xf5, 0xb4, 0xbb, 0x9e, 0x63, 0x6b, 0xaa, 0x01, 0xb1,
+  0xe3, 0x61, 0xec, 0x92, 0x88, 0x77, 0xe7, 0x25, 0x7e, 0x60, 0x73, 0xb9, 0x6f, 0xe9, 0x08, 0x1c,
+  0x7c, 0x3e, 0x54, 0x92, 0x80, 0xfe, 0x96, 0x63, 0xdf, 0xac, 0x96, 0xe4, 0x83, 0x43, 0x2d, 0xbc,
+  0x62, 0xc9, 0x4b, 0x01, 0x6f, 0xa7, 0x28, 0x5c, 0x14, 0x9c, 0xcc, 0x2f, 0x48, 0x04, 0x6a, 0xd8,
+  0x7b, 0xa5, 0xfc, 0xc2, 0xc8, 0x88, 0x06, 0x07, 0x0a, 0x87, 0x0d, 0xe4, 0x25, 0x60, 0x1d, 0x7b,
+  0x2e, 0xc6, 0xbf, 0x3e, 0x3a, 0x93, 0xbb, 0xb9, 0xe7, 0xb5, 0x79, 0x86, 0x57, 0x32, 0x8c, 0x9a,
+  0x64, 0x9a, 0x58, 0x87, 0xa0, 0x5b, 0x67, 0xe9, 0x9f, 0xc7, 0x22, 0xa7, 0x6b, 0x0d, 0x98, 0x59,
+  0x0b, 0x5a, 0xc9, 0x80, 0x60, 0x80, 0x93, 0x9d, 0x9d, 0x6f, 0x14, 0xa9, 0x5f, 0x5d, 0x84, 0x83,
+  0xc4, 0x14, 0x3c, 0x60, 0xd7, 0xe7, 0x7d, 0x78, 0x47, 0x22, 0x44, 0x42, 0xc1, 0x52, 0xc9, 0x79,
+  0x33, 0x25, 0xf2, 0x54, 0xa6, 0x6f, 0x6a, 0x2a, 0x2e, 0x40, 0xb9, 0x46, 0xbd, 0x6e, 0x36, 0x2c,
+  0x16, 0x7c, 0x92, 0xd4, 0xb9, 0xab, 0x21, 0x3b, 0x4f, 0x09, 0xf4, 0xed, 0x4a, 0xd7, 0xf9, 0xe4,
+  0x66, 0x5a, 0x0a, 0x3e, 0xb5, 0x96, 0xd6, 0x62, 0xc8, 0x7a, 0x80, 0x38, 0x9b, 0xbc, 0x92, 0xa8,
+  0x0b, 0x9f, 0x18, 0x33, 0x0b, 0xc9, 0x0a, 0xf6, 0x9d, 0xef, 0x03, 0x5c, 0x40, 0x1c, 0x5f, 0x35,
+  0x77, 0x4e, 0x4b, 0x3c, 0xa9, 0x9c, 0xb1, 0x0c, 0x08, 0xe6, 0x38, 0xf9, 0xe8, 0x1a, 0x17, 0x9a,
+  0xd5, 0x96, 0xb2, 0x98, 0x8a, 0x38, 0xa7, 0x6f, 0x30, 0x19, 0x77, 0xdd, 0x79, 0xc2, 0xef, 0x73,
+  0xc9, 0x16, 0x5f, 0x38, 0x50, 0x9d, 0x2a, 0xe9, 0x97, 0x7f, 0xb5, 0xfe, 0xbc, 0x03, 0xb6, 0xd7,
+  0xff, 0xa6, 0xa2, 0xb8, 0x37, 0xc0, 0x31, 0xb0, 0xc9, 0x95, 0x08, 0xde, 0xef, 0x80, 0xd2, 0x5f,
+  0xf2, 0xc8, 0xbf, 0x30, 0x41, 0xab, 0x65, 0xe7, 0xd6, 0x7c, 0x66, 0x43, 0x0a, 0xc9, 0xe5, 0x5e,
+  0x9b, 0x71, 0x85, 0xb3, 0x9d, 0x0b, 0x5d, 0xb5, 0x91, 0x59, 0x90, 0x8e, 0x9f, 0x47, 0xd7, 0x3c,
+  0x0e, 0xf1, 0x00, 0x1b, 0x10, 0x88, 0x20, 0x9f, 0xe1, 0x07, 0x4a, 0x75, 0x91, 0x89, 0xad, 0x9e,
+  0x65, 0xc8, 0xcf, 0xd6, 0x24, 0x2a, 0x97, 0xd0, 0x00, 0xfe, 0x9d, 0xbf, 0xd6, 0x69, 0x2f, 0x45,
+  0x25, 0xb5, 0xca, 0x55, 0x75, 0x9d, 0xe5, 0x40, 0x09, 0xc3, 0x03, 0x74, 0xcb, 0x6a, 0xe4, 0xc1,
+  0x1b, 0x63, 0x86, 0xbf, 0x35, 0x55, 0x19, 0x52, 0x72, 0x6c, 0x33, 0x61, 0x28, 0x63, 0x56, 0xc5,
+  0x62, 0x15, 0x56, 0xf3, 0xff, 0x16, 0xc1, 0x8e, 0xfe, 0xbd, 0x90, 0xe6, 0xf7, 0x70, 0x68, 0x7e,
+  0x4c, 0x4c, 0x6f, 0xfc, 0x01, 0x0a, 0x64, 0x3e, 0xad, 0xd1, 0xb3, 0x44, 0x74, 0x30, 0x56, 0xd1,
+  0x65, 0xdd, 0x9b, 0x25, 0xf8, 0xe0, 0x80, 0x88, 0xe7, 0xeb, 0xe3, 0x62, 0xc1, 0x1b, 0x62, 0x37,
+  0xff, 0x5f, 0x8c, 0x00, 0xd4, 0x4b, 0xab, 0x72, 0x31, 0xf4, 0xb3, 0xdb, 0xb2, 0x89, 0x9b, 0x57,
+  0xcf, 0x17, 0xa8, 0xb7, 0x58, 0xbb, 0x69, 0x99, 0x52, 0xd9, 0xf7, 0x02, 0xaa, 0xd1, 0x63, 0xcb,
+  0x1a, 0xa8, 0x84, 0x31, 0x63, 0x69, 0x27, 0xf5, 0xdc, 0x94, 0xde, 0xe2, 0x48, 0x0d, 0xee, 0xea,
+  0x70, 0x90, 0x32, 0xe4, 0xb4, 0x54, 0x95, 0xbc, 0xb3, 0x92, 0xbd, 0x80, 0x9f, 0x54, 0x56, 0xe6,
+  0x49, 0xa1, 0x24, 0x8d, 0xef, 0xc6, 0x01, 0xaf, 0x2e, 0x19, 0xa9, 0x40, 0x94, 0xf4, 0x9b, 0xfa,
+  0xdb, 0x0c, 0xd3, 0x9f, 0xf1, 0x94, 0xa7, 0x2c, 0xda, 0x37, 0xa9, 0x41, 0x80, 0x9a, 0x7f, 0x04,
+  0x42, 0x67, 0x9a, 0xbe, 0x5f, 0x11, 0xbe, 0x00, 0x6f, 0x96, 0xff, 0x5e, 0x13, 0x6c, 0xc2, 0x25,
+  0x0d, 0x46, 0xd9, 0x44, 0x12, 0x45, 0xad, 0xa1, 0x87, 0xda, 0x85, 0x7e, 0xba, 0x9a, 0x4d, 0x52,
+  0xaf, 0x3b, 0x2c, 0x5b, 0x63, 0x06, 0xb4, 0x71, 0x28, 0x9a, 0x58, 0x02, 0x97, 0xfe, 0x11, 0x97,
+  0xa3, 0x7a, 0x3e, 0x5d, 0xb8, 0x87, 0xd1, 0x4a, 0xea, 0x40, 0x77, 0x18, 0x0b, 0xe7, 0xf0, 0xb0,
+  0x1a, 0x55, 0x33, 0x22, 0xe2, 0x65, 0xb2, 0xa8, 0x1e, 0x47, 0x0c, 0x48, 0x86, 0x4c, 0x6e, 0x57,
+  0x20, 0x72, 0x7f, 0x6b, 0x9b, 0x14,
+};
+
+//
+// The data of GenerateTestData(), compressed by
+// BaseTools/Source/C/LzmaCompress with --chunked --chunk-size 16384.
+//
+STATIC CONST UINT8  mLzmaChunked16KData[] = {
+  0x4c, 0x5a, 0x43, 0x4b, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x54, 0x07, 0x00, 0x00, 0x5d, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xee, 0x42, 0xb9, 0x94, 0x59, 0x70, 0xa7, 0xf5, 0xc9, 0xd4, 0xa1, 0xa9, 0x43,
+  0x31, 0xd3, 0x75, 0x86, 0x74, 0xba, 0x02, 0xd4, 0x6c, 0xe5, 0x82, 0x12, 0x42, 0xc4, 0xa4, 0x27,
+  0x38, 0xae, 0xd6, 0xb7, 0x8b, 0x33, 0xad, 0xad, 0x21, 0xdd, 0xbc, 0x23, 0xc9, 0x02, 0x97, 0x09,
+  0x58, 0x0f, 0xf9, 0xcb, 0x87, 0x97, 0x71, 0x53, 0x30, 0xc4, 0x26, 0x4c, 0x73, 0xc9, 0x79, 0x57,
+  0xea, 0x99, 0x26, 0x11, 0xab, 0x31, 0xb9, 0xa5, 0x98, 0xf0, 0x0f, 0x4f, 0xf1, 0x5f, 0xff, 0xcc,
+  0x52, 0x27, 0xd7, 0x4f, 0xa9, 0x50, 0x7b, 0x7c, 0x72, 0x80, 0xf4, 0x2c, 0x05, 0x9a, 0x10, 0xb9,
+  0x78, 0x59, 0xff, 0x02, 0xbf, 0xfc, 0x04, 0x3b, 0xfb, 0xd1, 0xfb, 0xbd, 0x3c, 0x07, 0xcc, 0x2a,
+  0x3d, 0x15, 0xd2, 0xf8, 0xa5, 0x53, 0x27, 0xa9, 0x42, 0xf4, 0xee, 0x36, 0xa1, 0x35, 0x3b, 0xbc,
+  0x52, 0xb5, 0x61, 0x53, 0x98, 0x8c, 0x2b, 0xe5, 0x82, 0x1a, 0x45, 0x1c, 0xf7, 0x3d, 0x20, 0xd6,
+  0xd2, 0x5c, 0xc0, 0x8a, 0xb7, 0x3b, 0x04, 0xe3, 0x64, 0x31, 0x6f, 0x10, 0x8f, 0x28, 0x61, 0x06,
+  0xb2, 0xf7, 0x78, 0xf5, 0x3e, 0x14, 0x8d, 0x8d, 0xa3, 0x8b, 0x2e, 0xd6, 0xb6, 0x24, 0xdc, 0x7d,
+  0xb6, 0xd5, 0xe0, 0xa9, 0x5c, 0x9a, 0xf6, 0x16, 0x3e, 0xf3, 0x90, 0x55, 0xb5, 0xb2, 0x3d, 0xe8,
+  0xca, 0x7b, 0x61, 0xf0, 0xf4, 0x08, 0x14, 0xd7, 0xdc, 0x19, 0x2b, 0x2e, 0x4f, 0xcc, 0x0b, 0x3e,
+  0x8a, 0x74, 0xe2, 0x54, 0xc2, 0x7e, 0xce, 0xbe, 0x54, 0xde, 0x8d, 0xfc, 0x53, 0xd0, 0x42, 0xe9,
+  0x75, 0x16, 0x69, 0x34, 0x24, 0x01, 0x95, 0xdb, 0x3d, 0x60, 0xb5, 0x8a, 0x69, 0x7f, 0x9d, 0x45,
+  0x99, 0xe3, 0x61, 0xed, 0x03, 0x50, 0xa8, 0x73, 0xa2, 0xe1, 0xe9, 0x9e, 0x2f, 0x41, 0xc3, 0x26,
+  0x9e, 0x2d, 0xaf, 0x61, 0x26, 0x8b, 0xd6, 0x2f, 0xb9, 0xef, 0xca, 0x32, 0xf7, 0x4c, 0xae, 0x35,
+  0x3f, 0x94, 0xb4, 0x48, 0x52, 0x1f, 0x3b, 0x54, 0x4e, 0x78, 0xc3, 0x2c, 0x4a, 0x9b, 0x19, 0x6f,
+  0x64, 0x3f, 0x58, 0x61, 0xc7, 0xba, 0xbf, 0x83, 0xde, 0x63, 0x86, 0xfa, 0xd5, 0x0b, 0x8a, 0x28,
+  0x23, 0x8d, 0xd5, 0x87, 0x8c, 0x20, 0x1f, 0x76, 0x38, 0xf7, 0x9d, 0xc9, 0xc7, 0x67, 0x20, 0x44,
+  0x67, 0x8a, 0xed, 0xc8, 0x8d, 0x94, 0x75, 0x92, 0xb1, 0xf7, 0xc2, 0xd1, 0xb6, 0x40, 0xc8, 0x0e,
+  0xa2, 0x82, 0x8f, 0xeb, 0x5d, 0x80, 0x21, 0x19, 0x15, 0xea, 0xe9, 0xf3, 0xbc, 0x7e, 0xb6, 0x28,
+  0x9e, 0x72, 0xce, 0x9b, 0x88, 0xe3, 0x77, 0x7e, 0x53, 0xf4, 0x64, 0xe3, 0x6b, 0xb3, 0x17, 0xbb,
+  0x37, 0xe9, 0xd0, 0x98, 0xae, 0xad, 0x99, 0xf8, 0x03, 0xe9, 0x26, 0xaf, 0x4d, 0x5f, 0xcc, 0x0f,
+  0xb3, 0xae, 0x93, 0x33, 0x72, 0xaa, 0x2e, 0xb3, 0xda, 0xf6, 0xfc, 0x32, 0xb3, 0xa3, 0xee, 0x75,
+  0x5e, 0x65, 0x80, 0x08, 0x12, 0x71, 0x4c, 0xdc, 0xe5, 0x5d, 0x88, 0x2e, 0x13, 0x7a, 0x41, 0xe6,
+  0x9f, 0xf4, 0xb4, 0x7f, 0xad, 0x30, 0xc4, 0x9b, 0x3a, 0xe6, 0x40, 0x2d, 0x68, 0x90, 0xcf, 0x69,
+  0x8f, 0x3d, 0x7a, 0x9e, 0x66, 0x32, 0x43, 0x99, 0xe0, 0xcd, 0x3f, 0x79, 0x7b, 0x39, 0x46, 0xb5,
+  0x26, 0xca, 0xa2, 0x5f, 0x8f, 0x34, 0x83, 0x13, 0x35, 0x11, 0x57, 0xfa, 0x4b, 0x4b, 0xbe, 0x33,
+  0xc0, 0x37, 0x8e, 0xeb, 0x57, 0x1d, 0x45, 0x6b, 0x3a, 0x01, 0x8e, 0xfc, 0x48, 0xad, 0x2a, 0x05,
+  0x42, 0xfd, 0xb8, 0x3e, 0xed, 0x85, 0x2d, 0xc4, 0x6b, 0xff, 0x88, 0xec, 0x3e, 0xb7, 0x15, 0xa1,
+  0xce, 0x35, 0xf0, 0x44, 0x46, 0xc0, 0x52, 0x7e, 0xbe, 0xb8, 0x65, 0x8e, 0x27, 0x0e, 0xe3, 0x0e,
+  0xc7, 0x52, 0x20, 0x51, 0x3e, 0x66, 0x56, 0x39, 0xa2, 0x6c, 0x9b, 0x01, 0x07, 0xd5, 0xcc, 0xa8,
+  0xd0, 0x2b, 0x95, 0x1c, 0xfc, 0xd6, 0x1b, 0xd9, 0x57, 0x6e, 0xac, 0xb0, 0xff, 0xa3, 0x21, 0xa7,
+  0x1d, 0x4d, 0xbf, 0x36, 0xe9, 0x04, 0x60, 0x70, 0x21, 0x5b, 0x45, 0xe2, 0x6e, 0xc2, 0x08, 0x24,
+  0xcc, 0x8e, 0xcc, 0x6b, 0x25, 0x30, 0xeb, 0x2a, 0x64, 0xd1, 0xf6, 0xca, 0x68, 0x63, 0x13, 0x97,
+  0x88, 0x38, 0xdb, 0x40, 0x22, 0xb9, 0xc3, 0x52, 0x3a, 0xc2, 0x14, 0xa3, 0xe1, 0x8c, 0x9f, 0xe2,
+  0x62, 0x67, 0x55, 0x94, 0x8c, 0xcf, 0x81, 0x92, 0x91, 0x65, 0xe4, 0x4b, 0xff, 0x46, 0xbd, 0xb6,
+  0x73, 0x81, 0x65, 0x8d, 0xa2, 0xf6, 0xcf, 0xbb, 0x06, 0xe8, 0xad, 0xc6, 0xa6, 0x80, 0x55, 0x1a,
+  0xdb, 0xf7, 0x1b, 0x87, 0x43, 0x4d, 0x84, 0x89, 0xd0, 0x05, 0xae, 0x9a, 0x66, 0x36, 0x4d, 0x4f,
+  0xda, 0x1b, 0xcc, 0xfd, 0x98, 0x80, 0x3e, 0x24, 0x1f, 0xc0, 0xd2, 0x61, 0xc3, 0x05, 0xdf, 0x32,
+  0xcf, 0x7a, 0x32, 0x25, 0x2b, 0x9b, 0xa4, 0xfd, 0x19, 0x21, 0x72, 0x47, 0xb8, 0x9d, 0xb4, 0xbb,
+  0xb0, 0xbb, 0x33, 0xb7, 0x75, 0x68, 0x7a, 0x32, 0xd6, 0x7f, 0x24, 0xd9, 0x23, 0xea, 0xdc, 0x6c,
+  0x40, 0x31, 0x4d, 0x37, 0x65, 0x6b, 0x59, 0xc7, 0xdd, 0x77, 0x42, 0x59, 0x78, 0xcb, 0x65, 0xbc,
+  0x36, 0xdf, 0x49, 0x82, 0x55, 0xf5, 0xf4, 0xe2, 0xf5, 0xd2, 0x10, 0x68, 0xa6, 0x44, 0x75, 0x46,
+  0x7c, 0x90, 0xb5, 0x3b, 0x34, 0xf4, 0xfb, 0xd3, 0x22, 0x5d, 0x12, 0x5e, 0x11, 0x12, 0xb6, 0xbf,
+  0x4b, 0xb7, 0xcb, 0x3c, 0xcd, 0x5d, 0xd6, 0x3c, 0x8f, 0xab, 0xe8, 0xf8, 0x34, 0x93, 0x08, 0x36,
+  0xdc, 0xcd, 0x15, 0xa6, 0xba, 0x12, 0x0a, 0x56, 0x51, 0x66, 0x81, 0xc4, 0x33, 0xe1, 0xd9, 0xea,
+  0xa4, 0x75, 0x53, 0xa3, 0x69, 0x4e, 0xe6, 0x8b, 0xec, 0xe1, 0xb5, 0x54, 0x57, 0x53, 0x2c, 0x5d,
+  0xfc, 0x82, 0x5a, 0x43, 0xb6, 0x68, 0xd3, 0xcf, 0x86, 0xa4, 0x90, 0x4f, 0x3b, 0x78, 0x24, 0xa7,
+  0xbe, 0x12, 0xa9, 0xad, 0x7b, 0x7f, 0x59, 0xce, 0x8c, 0xd3, 0x45, 0xac, 0x8a, 0x61, 0xb5, 0x4a,
+  0xb2, 0x87, 0xef, 0x23, 0xd4, 0xde, 0x59, 0xab, 0x25, 0x29, 0xa7, 0x39, 0x01, 0x83, 0x98, 0x56,
+  0xb2, 0xcc, 0xe2, 0x5d, 0xdc, 0xc7, 0x12, 0x06, 0xf1, 0xc9, 0xcf, 0x6e, 0x9f, 0xd9, 0x8e, 0x75,
+  0x54, 0xf5, 0x51, 0x63, 0x03, 0x07, 0x5e, 0xef, 0x8e, 0x33, 0x9a, 0x15, 0xe4, 0x50, 0xa7, 0x82,
+  0xaf, 0x51, 0x7c, 0x5c, 0x5d, 0xe4, 0xac, 0x1d, 0x64, 0xee, 0xc8, 0x46, 0x4e, 0x18, 0x61, 0x95,
+  0xd9, 0xa7, 0x44, 0x04, 0x35, 0xe0, 0xb1, 0xb1, 0x8f, 0x9b, 0x36, 0xdf, 0x06, 0x5c, 0x7d, 0x3e,
+  0x09, 0x44, 0xc0, 0x95, 0x8b, 0x18, 0x53, 0x32, 0x1e, 0xb8, 0xcb, 0xa1, 0x95, 0xaa, 0xc1, 0x6e,
+  0xc4, 0x16, 0x55, 0x36, 0xfe, 0xa0, 0xf7, 0x5b, 0xff, 0xe8, 0x27, 0xe7, 0xb4, 0x43, 0xa3, 0xff,
+  0xa4, 0x3e, 0x02, 0xf4, 0x16, 0x04, 0x28, 0x2e, 0x16, 0x5e, 0x77, 0xfe, 0x03, 0x00, 0x57, 0xf8,
+  0x23, 0xbe, 0x09, 0xd0, 0x15, 0xd5, 0x56, 0x17, 0x88, 0xf1, 0xc5, 0x72, 0x3a, 0x2c, 0x4d, 0x21,
+  0xed, 0x81, 0xb8, 0xac, 0x3f, 0xe5, 0x9d, 0x77, 0xd2, 0xe5, 0x92, 0xab, 0x0a, 0xd4, 0xd9, 0x4e,
+  0x85, 0x92, 0xfc, 0xeb, 0x32, 0x4d, 0xd4, 0x0f, 0x72, 0x50, 0xc6, 0x4f, 0x3e, 0x33, 0xc2, 0x38,
+  0xd4, 0xba, 0x0a, 0x6e, 0x0b, 0x3c, 0x81, 0xa8, 0xb7, 0xcc, 0x9e, 0xf4, 0xa0, 0xff, 0xb5, 0x9c,
+  0x17, 0x4e, 0xdc, 0x21, 0x48, 0x5e, 0x38, 0x31, 0x80, 0xb6, 0x99, 0x61, 0x7c, 0x85, 0xa8, 0x31,
+  0x01, 0xb2, 0xf1, 0xec, 0x8f, 0xe3, 0x5a, 0x05, 0x8e, 0x2f, 0xdc, 0xac, 0x35, 0xed, 0x54, 0xff,
+  0xa9, 0xd5, 0x94, 0xec, 0x65, 0xf4, 0xbb, 0x9f, 0xb3, 0xcb, 0x06, 0x00, 0x4e, 0x6d, 0xff, 0x10,
+  0x8d, 0x3b, 0x0a, 0x0d, 0x0f, 0x53, 0xbe, 0xf1, 0xce, 0xa6, 0x4a, 0x56, 0x38, 0x88, 0x2a, 0x41,
+  0x04, 0x28, 0xf6, 0xc2, 0x13, 0xf6, 0x7a, 0xa5, 0x65, 0x3e, 0x6b, 0x5b, 0x14, 0x03, 0x8e, 0xc8,
+  0xa6, 0x9d, 0xff, 0x0a, 0x10, 0x59, 0xd5, 0xe5, 0x79, 0xf5, 0xd1, 0xcf, 0x3e, 0x12, 0xbf, 0x7a,
+  0xd3, 0xfc, 0xd3, 0x49, 0x36, 0x0d, 0x1c, 0x2b, 0xc7, 0x42, 0x00, 0xf9, 0x9f, 0x05, 0x58, 0x9d,
+  0x5f, 0x47, 0x33, 0x27, 0x1c, 0x98, 0x29, 0x6d, 0xaa, 0xd6, 0xaa, 0x9b, 0x6a, 0x38, 0x13, 0x4f,
+  0x95, 0x71, 0xea, 0x87, 0x28, 0x5a, 0xa5, 0x93, 0x29, 0x2c, 0x62, 0x04, 0xef, 0xd7, 0xe4, 0xce,
+  0xc8, 0xf0, 0x56, 0x88, 0x90, 0x7a, 0x7d, 0x6d, 0xab, 0xfd, 0xb1, 0xe9, 0xc3, 0x07, 0x59, 0xe9,
+  0xf0, 0x2b, 0x0c, 0x74, 0x1b, 0x76, 0xee, 0x47, 0xf2, 0x75, 0xf2, 0xad, 0x41, 0xa3, 0xdf, 0x0e,
+  0x7d, 0xb0, 0xf2, 0x1a, 0x34, 0x67, 0x8d, 0xad, 0xf1, 0x21, 0x28, 0xca, 0x59, 0x05, 0x73, 0x9d,
+  0xea, 0xfb, 0x5b, 0x40, 0x88, 0x65, 0x28, 0x12, 0x74, 0xa4, 0xa4, 0x3e, 0xdc, 0xfe, 0x8e, 0x97,
+  0xdf, 0x9f, 0x0b, 0x0d, 0xa3, 0xdf, 0x03, 0x22, 0xc6, 0x33, 0xd7, 0x76, 0x1d, 0x81, 0x0d, 0x8b,
+  0x7c, 0xca, 0xd8, 0xb0, 0x0c, 0x0c, 0x4f, 0x58, 0x45, 0x37, 0x85, 0x08, 0x2b, 0x2b, 0xd8, 0x8b,
+  0xed, 0xac, 0x3d, 0x2a, 0x8a, 0xac, 0x46, 0xe6, 0x93, 0xef, 0x34, 0x1c, 0xdf, 0x5a, 0xbe, 0xeb,
+  0xbb, 0x50, 0xea, 0xa4, 0x9e, 0xb9, 0x80, 0xc2, 0x37, 0xb0, 0xe6, 0xb0, 0x83, 0xbf, 0xa5, 0x82,
+  0x52, 0xe0, 0xb8, 0x64, 0x24, 0x6c, 0x74, 0x70, 0xf3, 0x8b, 0x4b, 0x02, 0x59, 0x27, 0xec, 0xec,
+  0xd4, 0x9e, 0xe8, 0x8d, 0x87, 0xe0, 0x8d, 0x95, 0x26, 0xf4, 0x01, 0x3b, 0xbf, 0x42, 0x69, 0xd9,
+  0xee, 0xd2, 0xbe, 0xd6, 0x20, 0xa4, 0x3c, 0x13, 0xd3, 0x77, 0x72, 0x31, 0x8c, 0xfd, 0x0c, 0xf0,
+  0x5d, 0xdf, 0x98, 0xe7, 0xce, 0x96, 0x88, 0xcf, 0x0d, 0x6d, 0x48, 0xb6, 0xfc, 0x72, 0x9b, 0xbd,
+  0x1c, 0xa8, 0x1e, 0x8f, 0x35, 0x4d, 0xbe, 0x7d, 0x1e, 0x64, 0x8e, 0xf2, 0x17, 0x19, 0x09, 0xd7,
+  0xf0, 0xe7, 0x1d, 0x6d, 0x9e, 0x7c, 0x9a, 0x91, 0x91, 0x45, 0xea, 0xdf, 0xf9, 0x3e, 0x9b, 0x16,
+  0x3a, 0x2f, 0x8d, 0xd8, 0xe3, 0xf7, 0x21, 0x10, 0xb7, 0x7c, 0x4d, 0x67, 0x36, 0x7a, 0xf3, 0x84,
+  0x52, 0x4e, 0x02, 0x34, 0x70, 0xf0, 0xdc, 0x29, 0x75, 0xdd, 0x26, 0x7c, 0x9b, 0xc7, 0x11, 0x9c,
+  0xaa, 0xd4, 0x34, 0x96, 0x0c, 0x52, 0x52, 0x67, 0xd2, 0x8c, 0x42, 0xc0, 0x20, 0xd0, 0x29, 0x35,
+  0x6d, 0x60, 0x71, 0x15, 0x6c, 0x87, 0x96, 0x80, 0x22, 0x0a, 0xd2, 0x65, 0x62, 0xe2, 0x6f, 0x59,
+  0x7d, 0xe1, 0x6f, 0x89, 0x50, 0x75, 0xe8, 0x70, 0x40, 0x9a, 0x6e, 0x28, 0xc2, 0x42, 0x6c, 0x7c,
+  0xe9, 0x98, 0x08, 0x68, 0x6a, 0x40, 0x1c, 0x78, 0x6d, 0xee, 0x0e, 0x08, 0x4b, 0xf8, 0x07, 0xd5,
+  0x0f, 0x0d, 0xca, 0xb6, 0x26, 0x57, 0xa6, 0x4f, 0xbc, 0xd0, 0xae, 0xf4, 0xde, 0x4f, 0x96, 0x80,
+  0xfc, 0xb2, 0x2e, 0x9c, 0x98, 0x1f, 0x84, 0x47, 0x53, 0x72, 0x36, 0xac, 0x6e, 0x3d, 0x7e, 0x15,
+  0xc1, 0x7f, 0x16, 0xe6, 0x97, 0x4f, 0x54, 0x72, 0xd9, 0xc5, 0xa6, 0xc4, 0x30, 0x76, 0x2f, 0x33,
+  0x5b, 0x07, 0x21, 0xa7, 0x83, 0x8e, 0xd4, 0xa8, 0xcf, 0x65, 0xd9, 0x23, 0x31, 0x2e, 0x27, 0xb7,
+  0xe4, 0xdb, 0xb3, 0x50, 0x47, 0x32, 0x68, 0xa3, 0xa9, 0xd9, 0xc4, 0x82, 0xbc, 0x3e, 0x7f, 0xac,
+  0x7a, 0x42, 0xda, 0xf8, 0x01, 0x07, 0x9e, 0x4f, 0x39, 0x3c, 0x45, 0xdc, 0x7b, 0x91, 0xa7, 0x41,
+  0x4d, 0xf5, 0x5f, 0xdf, 0xff, 0x72, 0xcb, 0xf0, 0x2c, 0x0a, 0x15, 0xc5, 0x80, 0xa2, 0x32, 0xd4,
+  0x91, 0x30, 0x45, 0x75, 0xa6, 0x6e, 0x78, 0x10, 0x25, 0x28, 0xf6, 0x77, 0xbb, 0x84, 0x92, 0xd1,
+  0xbc, 0xc7, 0xc4, 0x0b, 0x79, 0x21, 0x1f, 0x70, 0x75, 0x3b, 0x21, 0x1d, 0x06, 0x55, 0x10, 0xd3,
+  0xa7, 0x2d, 0x0b, 0x17, 0x3f, 0x8d, 0x00, 0x1b, 0x64, 0x1f, 0xaa, 0x17, 0x73, 0x9d, 0x97, 0x7b,
+  0x4f, 0xe0, 0xd7, 0x71, 0xf2, 0xc4, 0xcd, 0x04, 0xe3, 0xcc, 0x2e, 0x1c, 0x68, 0x2f, 0xd1, 0x97,
+  0x98, 0x7e, 0x6a, 0x79, 0x25, 0x3b, 0xd5, 0x3d, 0x81, 0x94, 0x81, 0x21, 0x90, 0x00, 0xb5, 0xbc,
+  0x29, 0x6f, 0xa5, 0x7a, 0x58, 0x4a, 0x12, 0x8d, 0x7a, 0x22, 0xf2, 0xc5, 0x8c, 0x36, 0x7a, 0xa7,
+  0x03, 0x6d, 0xb4, 0x3d, 0xc5, 0xfe, 0x9b, 0x69, 0xf5, 0xa1, 0xd7, 0xbd, 0x05, 0xe0, 0xf6, 0xe7,
+  0xd1, 0xf6, 0x61, 0xb7, 0x6f, 0x79, 0xb4, 0xc4, 0x5b, 0xc3, 0x1d, 0x7d, 0xf3, 0x9c, 0xd5, 0x7a,
+  0x63, 0x99, 0x41, 0xce, 0x3d, 0xa7, 0xa1, 0x55, 0x6a, 0x7c, 0xa6, 0x7d, 0xf9, 0x70, 0x9b, 0x65,
+  0x06, 0x18, 0xa1, 0x54, 0xa5, 0xd3, 0x48, 0x28, 0x76, 0x0c, 0xf0, 0x6c, 0x98, 0x51, 0xd2, 0x5e,
+  0xf6, 0x48, 0x47, 0x75, 0x14, 0xc7, 0x06, 0x0e, 0x57, 0xcc, 0xc1, 0xa2, 0x63, 0xa3, 0x4c, 0x5f,
+  0xdd, 0x7d, 0x76, 0x91, 0xd9, 0x5b, 0x07, 0x41, 0xeb, 0x81, 0x64, 0x0a, 0x32, 0x81, 0xcf, 0x09,
+  0xeb, 0xe2, 0xd2, 0xa7, 0x41, 0x06, 0x29, 0x8e, 0x5f, 0xa0, 0xea, 0xbd, 0x41, 0x62, 0x96, 0x3d,
+  0x46, 0x39, 0xdd, 0xcd, 0x39, 0x68, 0x4b, 0x3b, 0x26, 0x06, 0x06, 0xde, 0xd2, 0xbd, 0x41, 0x71,
+  0xba, 0xae, 0xc3, 0x34, 0xdc, 0x39, 0xfe, 0x29, 0xd6, 0xd9, 0x32, 0x2d, 0xaf, 0xaa, 0xfd, 0x7e,
+  0x8f, 0xa8, 0x0a, 0x9e, 0x5d, 0xeb, 0xba, 0x5a, 0xf4, 0xbb, 0xbe, 0x94, 0xc2, 0x8e, 0x95, 0x11,
+  0x98, 0x24, 0x4a, 0xb0, 0x94, 0xb8, 0x84, 0xab, 0xb5, 0x79, 0xc5, 0x86, 0x63, 0xcb, 0xee, 0x8f,
+  0xd0, 0xde, 0xb2, 0xbe, 0x35, 0x4e, 0x1c, 0xb1,
+};
+
+STATIC CONST LZMA_CHUNKED_TEST_VECTOR  mTestVectors[] = {
+  { mLzmaChunked4KData,  sizeof (mLzmaChunked4KData),  SIZE_4KB  },
+  { mLzmaChunked6KData,  sizeof (mLzmaChunked6KData),  0x1800    },
+  { mLzmaChunked16KData, sizeof (mLzmaChunked16KData), SIZE_16KB },
+};
+
+/**
+  Decompress chunked LZMA data into a new buffer.
+
+  The scratch buffer is allocated with the size returned by
+  LzmaChunkedUefiDecompressGetInfo(), and freed before returning.
+
+  @param[in]   Source           The compressed data.
+  @param[in]   SourceSize       The size, in bytes, of Source.
+  @param[out]  Destination      The decompressed data, or NULL on error. Freed
+                                by the caller.
+  @param[out]  DestinationSize  The size, in bytes, of Destination.
+  @param[out]  ScratchSize      The size, in bytes, of the scratch buffer.
+
+  @return The status of LzmaChunkedUefiDecompressGetInfo() if it fails, or of
+          LzmaChunkedUefiDecompress().
+**/
+STATIC
+RETURN_STATUS
+DecompressChunked (
+  IN  CONST VOID  *Source,
+  IN  UINTN       SourceSize,
+  OUT UINT8       **Destination,
+  OUT UINT32      *DestinationSize,
+  OUT UINT32      *ScratchSize
+  )
+{
+  RETURN_STATUS  Status;
+  VOID           *Scratch;
+
+  *Destination = NULL;
+  Status       = LzmaChunkedUefiDecompressGetInfo (Source, (UINT32)SourceSize, DestinationSize, ScratchSize);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  *Destination = AllocatePool (MAX (*DestinationSize, 1));
+  Scratch      = AllocatePool (MAX (*ScratchSize, 1));
+  if ((*Destination == NULL) || (Scratch == NULL)) {
+    Status = RETURN_OUT_OF_RESOURCES;
+  } else {
+    Status = LzmaChunkedUefiDecompress (Source, SourceSize, *Destination, Scratch);
+  }
+
+  if (Scratch != NULL) {
+    FreePool (Scratch);
+  }
+
+  if (RETURN_ERROR (Status) && (*Destination != NULL)) {
+    FreePool (*Destination);
+    *Destination = NULL;
+  }
+
+  return Status;
+}
+
+/**
+  Decompress a copy of a test vector, with one byte replaced.
+
+  @param[in]  Vector  The test vector.
+  @param[in]  Offset  The offset of the byte to replace.
+  @param[in]  Value   The new value of the byte.
+
+  @return The status of DecompressChunked().
+**/
+STATIC
+RETURN_STATUS
+DecompressCorrupted (
+  IN CONST LZMA_CHUNKED_TEST_VECTOR  *Vector,
+  IN UINTN                           Offset,
+  IN UINT8                           Value
+  )
+{
+  RETURN_STATUS  Status;
+  UINT8          *Source;
+  UINT8          *Destination;
+  UINT32         DestinationSize;
+  UINT32         ScratchSize;
+
+  Source = AllocateCopyPool (Vector->Size, Vector->Data);
+  if (Source == NULL) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  Source[Offset] = Value;
+  Status         = DecompressChunked (Source, Vector->Size, &Destination, &DestinationSize, &ScratchSize);
+  if (Destination != NULL) {
+    FreePool (Destination);
+  }
+
+  FreePool (Source);
+  return Status;
+}
+
+/**
+  Check that every test vector is decompressed into GenerateTestData(), with
+  an LZMA state per chunk, up to LZMA_CHUNKED_MAX_SLOTS, in the scratch buffer.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressVectorTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8                      *Expected;
+  UINT8                      *Destination;
+  UINT32                     DestinationSize;
+  UINT32                     ScratchSize;
+  UINTN                      Index;
+  CONST LZMA_CHUNKED_HEADER  *Header;
+  UINT32                     SlotCount;
+  BOOLEAN                    Match;
+
+  Expected = AllocatePool (DECOMPRESS_TEST_DATA_SIZE);
+  UT_ASSERT_NOT_NULL (Expected);
+  GenerateTestData (Expected, DECOMPRESS_TEST_DATA_SIZE);
+
+  for (Index = 0; Index < ARRAY_SIZE (mTestVectors); Index++) {
+    Header = (CONST LZMA_CHUNKED_HEADER *)mTestVectors[Index].Data;
+    UT_ASSERT_EQUAL (Header->ChunkSize, mTestVectors[Index].ChunkSize);
+
+    UT_ASSERT_NOT_EFI_ERROR (
+      DecompressChunked (mTestVectors[Index].Data, mTestVectors[Index].Size, &Destination, &DestinationSize, &ScratchSize)
+      );
+    UT_ASSERT_EQUAL (DestinationSize, DECOMPRESS_TEST_DATA_SIZE);
+
+    //
+    // The number of LZMA states only depends on the number of chunks.
+    //
+    SlotCount = MIN (Header->ChunkCount, LZMA_CHUNKED_MAX_SLOTS);
+    UT_ASSERT_TRUE (ScratchSize >= SlotCount * LZMA_STREAM_SCRATCH_SIZE);
+    UT_ASSERT_TRUE (ScratchSize < (SlotCount + 1) * LZMA_STREAM_SCRATCH_SIZE);
+
+    Match = (BOOLEAN)(CompareMem (Destination, Expected, DECOMPRESS_TEST_DATA_SIZE) == 0);
+    FreePool (Destination);
+    UT_ASSERT_TRUE (Match);
+  }
+
+  FreePool (Expected);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that every truncation of the test vectors is rejected.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressTruncatedTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RETURN_STATUS  Status;
+  UINT8          *Source;
+  UINT8          *Destination;
+  UINT32         DestinationSize;
+  UINT32         ScratchSize;
+  UINTN          Index;
+  UINTN          Size;
+
+  for (Index = 0; Index < ARRAY_SIZE (mTestVectors); Index++) {
+    for (Size = 0; Size < mTestVectors[Index].Size; Size++) {
+      //
+      // The truncated data is copied, so that a read past its end is caught
+      // by the address sanitizer.
+      //
+      Source = AllocateCopyPool (MAX (Size, 1), mTestVectors[Index].Data);
+      UT_ASSERT_NOT_NULL (Source);
+      Status = DecompressChunked (Source, Size, &Destination, &DestinationSize, &ScratchSize);
+      FreePool (Source);
+
+      UT_ASSERT_STATUS_EQUAL (Status, RETURN_INVALID_PARAMETER);
+      UT_ASSERT_TRUE (Destination == NULL);
+    }
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that a corrupted header or index of the chunks is rejected.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressCorruptedIndexTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CONST LZMA_CHUNKED_TEST_VECTOR  *Vector;
+  CONST LZMA_CHUNKED_HEADER       *Header;
+  UINTN                           Index;
+  UINTN                           Offset;
+  UINTN                           IndexEnd;
+
+  for (Index = 0; Index < ARRAY_SIZE (mTestVectors); Index++) {
+    Vector   = &mTestVectors[Index];
+    Header   = (CONST LZMA_CHUNKED_HEADER *)Vector->Data;
+    IndexEnd = sizeof (LZMA_CHUNKED_HEADER) + Header->ChunkCount * sizeof (UINT32);
+
+    //
+    // Every byte of the signature, of the sizes and of the index is
+    // incremented, so that the least significant byte of a size gives a size
+    // that is still plausible. A bigger ChunkSize is valid for data of a
+    // single chunk, so it is skipped there.
+    //
+    for (Offset = 0; Offset < IndexEnd; Offset++) {
+      if ((Header->ChunkCount == 1) &&
+          (Offset >= OFFSET_OF (LZMA_CHUNKED_HEADER, ChunkSize)) &&
+          (Offset < OFFSET_OF (LZMA_CHUNKED_HEADER, ChunkCount)))
+      {
+        continue;
+      }
+
+      UT_ASSERT_STATUS_EQUAL (
+        DecompressCorrupted (Vector, Offset, (UINT8)(Vector->Data[Offset] + 1)),
+        RETURN_INVALID_PARAMETER
+        );
+    }
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that a chunk with corrupted LZMA properties is rejected, rather than
+  failing an allocation from the scratch buffer.
+
+  The properties byte of every chunk is replaced by an invalid value, and by a
+  valid value with lc + lp too large for the scratch buffer.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressCorruptedPropertiesTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CONST LZMA_CHUNKED_TEST_VECTOR  *Vector;
+  CONST LZMA_CHUNKED_HEADER       *Header;
+  CONST UINT32                    *ChunkSizes;
+  UINTN                           Index;
+  UINTN                           Chunk;
+  UINTN                           Offset;
+
+  for (Index = 0; Index < ARRAY_SIZE (mTestVectors); Index++) {
+    Vector     = &mTestVectors[Index];
+    Header     = (CONST LZMA_CHUNKED_HEADER *)Vector->Data;
+    ChunkSizes = (CONST UINT32 *)(Header + 1);
+    Offset     = sizeof (LZMA_CHUNKED_HEADER) + Header->ChunkCount * sizeof (UINT32);
+
+    for (Chunk = 0; Chunk < Header->ChunkCount; Chunk++) {
+      //
+      // (pb * 5 + lp) * 9 + lc, with pb = 5, is out of range.
+      //
+      UT_ASSERT_STATUS_EQUAL (DecompressCorrupted (Vector, Offset, 225), RETURN_INVALID_PARAMETER);
+
+      //
+      // lc = 8 and lp = 4 need 6MB of probabilities.
+      //
+      UT_ASSERT_STATUS_EQUAL (DecompressCorrupted (Vector, Offset, (4 * 9) + 8), RETURN_INVALID_PARAMETER);
+
+      Offset += ChunkSizes[Chunk];
+    }
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that corrupted compressed data is decompressed, or rejected, without
+  writing out of the destination buffer.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressCorruptedDataTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CONST LZMA_CHUNKED_TEST_VECTOR  *Vector;
+  CONST LZMA_CHUNKED_HEADER       *Header;
+  RETURN_STATUS                   Status;
+  UINTN                           Index;
+  UINTN                           Offset;
+  UINTN                           Rejected;
+
+  for (Index = 0; Index < ARRAY_SIZE (mTestVectors); Index++) {
+    Vector   = &mTestVectors[Index];
+    Header   = (CONST LZMA_CHUNKED_HEADER *)Vector->Data;
+    Rejected = 0;
+
+    for (Offset = sizeof (LZMA_CHUNKED_HEADER) + Header->ChunkCount * sizeof (UINT32);
+         Offset < Vector->Size;
+         Offset += 7)
+    {
+      Status = DecompressCorrupted (Vector, Offset, (UINT8)(Vector->Data[Offset] ^ BIT3));
+      UT_ASSERT_TRUE ((Status == RETURN_SUCCESS) || (Status == RETURN_INVALID_PARAMETER));
+      if (Status == RETURN_INVALID_PARAMETER) {
+        Rejected++;
+      }
+    }
+
+    UT_ASSERT_NOT_EQUAL (Rejected, 0);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  chunked LZMA decompression and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Fw;
+  UNIT_TEST_SUITE_HANDLE      DecompressTests;
+
+  Fw = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Fw, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the Chunked LZMA Decompress Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&DecompressTests, Fw, "Chunked LZMA Decompress", "LzmaChunkedDecompress", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DecompressTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // --------------Suite----------Description-----------------------------------Class Name----------Function---------------------------Pre---Post--Context
+  AddTestCase (DecompressTests, "Decompress the tool output at several chunk sizes", "Vector", DecompressVectorTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Reject truncated streams", "Truncated", DecompressTruncatedTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Reject a corrupted header or index", "CorruptedIndex", DecompressCorruptedIndexTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Reject corrupted LZMA properties", "CorruptedProperties", DecompressCorruptedPropertiesTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Decompress corrupted chunks safely", "CorruptedData", DecompressCorruptedDataTest, NULL, NULL, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Fw);
+
+EXIT:
+  if (Fw) {
+    FreeUnitTestFramework (Fw);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
@@ -849,6 +849,197 @@ BmCachePartitionDevicePath (
   }
 }
 
+/**
+  Check whether the device path contains a hard drive media device path node.
+
+  @param DevicePath  The device path to check.
+
+  @retval TRUE   The device path points to a partition.
+  @retval FALSE  The device path doesn't point to a partition.
+**/
+BOOLEAN
+BmIsPartitionDevicePath (
+  IN EFI_DEVICE_PATH_PROTOCOL  *DevicePath
+  )
+{
+  while (!IsDevicePathEnd (DevicePath)) {
+    if ((DevicePathType (DevicePath) == MEDIA_DEVICE_PATH) &&
+        (DevicePathSubType (DevicePath) == MEDIA_HARDDRIVE_DP))
+    {
+      return TRUE;
+    }
+
+    DevicePath = NextDevicePathNode (DevicePath);
+  }
+
+  return FALSE;
+}
+
+/**
+  Rebuild the 'HDPS' partition scan cache from the partitions found by a full scan.
+
+  The cache holds the device path of every partition that carries a file system.
+  The hard drive media device path node of each instance holds the disk and partition
+  identity (GPT partition GUID or MBR signature), so a later short-form boot path can
+  be resolved by connecting only the matched instance. The cache is rebuilt on every
+  full scan, which drops the partitions whose media was removed or repartitioned.
+
+  @param BlockIoBuffer       The handles supporting the Block IO protocol.
+  @param BlockIoHandleCount  The number of handles in BlockIoBuffer.
+**/
+VOID
+BmUpdatePartitionScanCache (
+  IN EFI_HANDLE  *BlockIoBuffer,
+  IN UINTN       BlockIoHandleCount
+  )
+{
+  EFI_STATUS                Status;
+  UINTN                     Index;
+  EFI_DEVICE_PATH_PROTOCOL  *BlockIoDevicePath;
+  EFI_DEVICE_PATH_PROTOCOL  *ScanCache;
+  EFI_DEVICE_PATH_PROTOCOL  *OldScanCache;
+  UINTN                     OldScanCacheSize;
+  EFI_DEVICE_PATH_PROTOCOL  *TempDevicePath;
+  VOID                      *FileSystem;
+
+  ScanCache = NULL;
+  for (Index = 0; Index < BlockIoHandleCount; Index++) {
+    BlockIoDevicePath = DevicePathFromHandle (BlockIoBuffer[Index]);
+    if ((BlockIoDevicePath == NULL) || !BmIsPartitionDevicePath (BlockIoDevicePath)) {
+      continue;
+    }
+
+    Status = gBS->HandleProtocol (BlockIoBuffer[Index], &gEfiSimpleFileSystemProtocolGuid, &FileSystem);
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    TempDevicePath = ScanCache;
+    ScanCache      = AppendDevicePathInstance (ScanCache, BlockIoDevicePath);
+    if (TempDevicePath != NULL) {
+      FreePool (TempDevicePath);
+    }
+  }
+
+  //
+  // Only write the variable when the partition layout changed.
+  //
+  GetVariable2 (L"HDPS", &mBmHardDriveBootVariableGuid, (VOID **)&OldScanCache, &OldScanCacheSize);
+  if ((ScanCache == NULL) && (OldScanCache == NULL)) {
+    return;
+  }
+
+  if ((ScanCache == NULL) || (OldScanCache == NULL) ||
+      (GetDevicePathSize (ScanCache) != OldScanCacheSize) ||
+      (CompareMem (ScanCache, OldScanCache, OldScanCacheSize) != 0))
+  {
+    //
+    // Failing to save only impacts performance next time expanding the short-form device path
+    //
+    gRT->SetVariable (
+           L"HDPS",
+           &mBmHardDriveBootVariableGuid,
+           (ScanCache == NULL) ? 0 : EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_NON_VOLATILE,
+           (ScanCache == NULL) ? 0 : GetDevicePathSize (ScanCache),
+           ScanCache
+           );
+  }
+
+  if (ScanCache != NULL) {
+    FreePool (ScanCache);
+  }
+
+  if (OldScanCache != NULL) {
+    FreePool (OldScanCache);
+  }
+}
+
+/**
+  Expand a device path that starts with a hard drive media device path node from
+  the 'HDPS' partition scan cache, by connecting only the cached partition whose
+  hard drive media device path node matches.
+
+  A stale instance fails to connect or to expand, and the caller falls back to the
+  full scan which rebuilds the cache.
+
+  @param FilePath          The device path pointing to a load option.
+                           It starts with a hard drive media device path node.
+  @param CachedDevicePath  The 'HDDP' device path cache, which is updated with the
+                           matched partition.
+
+  @return The full device path pointing to the load option, or NULL if the cache
+          has no usable match.
+**/
+EFI_DEVICE_PATH_PROTOCOL *
+BmExpandPartitionScanCache (
+  IN     EFI_DEVICE_PATH_PROTOCOL  *FilePath,
+  IN OUT EFI_DEVICE_PATH_PROTOCOL  **CachedDevicePath
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *ScanCache;
+  UINTN                     ScanCacheSize;
+  EFI_DEVICE_PATH_PROTOCOL  *TempNewDevicePath;
+  EFI_DEVICE_PATH_PROTOCOL  *TempDevicePath;
+  EFI_DEVICE_PATH_PROTOCOL  *Instance;
+  EFI_DEVICE_PATH_PROTOCOL  *FullPath;
+  UINTN                     Size;
+
+  GetVariable2 (L"HDPS", &mBmHardDriveBootVariableGuid, (VOID **)&ScanCache, &ScanCacheSize);
+  if (ScanCache == NULL) {
+    return NULL;
+  }
+
+  if (!IsDevicePathValid (ScanCache, ScanCacheSize)) {
+    FreePool (ScanCache);
+    gRT->SetVariable (L"HDPS", &mBmHardDriveBootVariableGuid, 0, 0, NULL);
+    return NULL;
+  }
+
+  FullPath          = NULL;
+  TempNewDevicePath = ScanCache;
+  do {
+    Instance = GetNextDevicePathInstance (&TempNewDevicePath, &Size);
+    if (Instance == NULL) {
+      break;
+    }
+
+    if (BmMatchPartitionDevicePathNode (Instance, (HARDDRIVE_DEVICE_PATH *)FilePath)) {
+      Status = EfiBootManagerConnectDevicePath (Instance, NULL);
+      if (!EFI_ERROR (Status)) {
+        TempDevicePath = AppendDevicePath (Instance, NextDevicePathNode (FilePath));
+        FullPath       = BmGetNextLoadOptionDevicePath (TempDevicePath, NULL);
+        FreePool (TempDevicePath);
+      }
+
+      if (FullPath != NULL) {
+        //
+        // Save the matched partition to 'HDDP' so the next boot finds it first.
+        //
+        BmCachePartitionDevicePath (CachedDevicePath, Instance);
+        gRT->SetVariable (
+               L"HDDP",
+               &mBmHardDriveBootVariableGuid,
+               EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_NON_VOLATILE,
+               GetDevicePathSize (*CachedDevicePath),
+               *CachedDevicePath
+               );
+      }
+
+      //
+      // The partition identity is unique, no other instance can match.
+      //
+      FreePool (Instance);
+      break;
+    }
+
+    FreePool (Instance);
+  } while (TempNewDevicePath != NULL);
+
+  FreePool (ScanCache);
+  return FullPath;
+}
+
 /**
   Expand a device path that starts with a hard drive media device path node to be a
   full device path that includes the full hardware path to the device. We need
@@ -970,6 +1161,20 @@ BmExpandPartitionDevicePath (
     } while (TempNewDevicePath != NULL);
   }
 
+  //
+  // Try the partitions recorded by the last full scan before connecting all devices.
+  //
+  if (FeaturePcdGet (PcdBootManagerPartitionScanCache)) {
+    FullPath = BmExpandPartitionScanCache (FilePath, &CachedDevicePath);
+    if (FullPath != NULL) {
+      if (CachedDevicePath != NULL) {
+        FreePool (CachedDevicePath);
+      }
+
+      return FullPath;
+    }
+  }
+
   //
   // If we get here we fail to find or 'HDDP' not exist, and now we need
   // to search all devices in the system for a matched partition
@@ -981,6 +1186,10 @@ BmExpandPartitionDevicePath (
     BlockIoBuffer      = NULL;
   }
 
+  if (FeaturePcdGet (PcdBootManagerPartitionScanCache)) {
+    BmUpdatePartitionScanCache (BlockIoBuffer, BlockIoHandleCount);
+  }
+
   //
   // Loop through all the device handles that support the BLOCK_IO Protocol
   //
@@ -8,12 +8,149 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "InternalBm.h"
 
+/**
+  Compare two handles by their address.
+
+  @param Left   Pointer to the first handle.
+  @param Right  Pointer to the second handle.
+
+  @retval <0  The first handle is below the second one.
+  @retval 0   The handles are the same.
+  @retval >0  The first handle is above the second one.
+**/
+INTN
+EFIAPI
+BmCompareHandle (
+  IN CONST VOID  *Left,
+  IN CONST VOID  *Right
+  )
+{
+  UINTN  LeftHandle;
+  UINTN  RightHandle;
+
+  LeftHandle  = (UINTN)*(CONST EFI_HANDLE *)Left;
+  RightHandle = (UINTN)*(CONST EFI_HANDLE *)Right;
+  if (LeftHandle < RightHandle) {
+    return -1;
+  }
+
+  return (LeftHandle > RightHandle) ? 1 : 0;
+}
+
+/**
+  Check whether the handle is in the handle buffer sorted by BmCompareHandle().
+
+  @param Handle        The handle to look for.
+  @param HandleBuffer  The sorted handle buffer.
+  @param HandleCount   The number of handles in HandleBuffer.
+
+  @retval TRUE   The handle is in the handle buffer.
+  @retval FALSE  The handle is not in the handle buffer.
+**/
+BOOLEAN
+BmIsHandleInSortedBuffer (
+  IN EFI_HANDLE  Handle,
+  IN EFI_HANDLE  *HandleBuffer,
+  IN UINTN       HandleCount
+  )
+{
+  UINTN  Low;
+  UINTN  High;
+  UINTN  Middle;
+  INTN   Result;
+
+  Low  = 0;
+  High = HandleCount;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    Result = BmCompareHandle (&Handle, &HandleBuffer[Middle]);
+    if (Result == 0) {
+      return TRUE;
+    }
+
+    if (Result < 0) {
+      High = Middle;
+    } else {
+      Low = Middle + 1;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Return the handles on which the protocol of a protocol notification was
+  installed or reinstalled since the last call, sorted by BmCompareHandle().
+
+  @param Registration  The registration key of the protocol notification.
+  @param HandleCount   Return the number of handles.
+
+  @return The sorted handle buffer, or NULL if there are no such handles. The
+          caller is responsible to free the buffer.
+**/
+EFI_HANDLE *
+BmGetNotifiedHandles (
+  IN  VOID   *Registration,
+  OUT UINTN  *HandleCount
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  Handle;
+  EFI_HANDLE  *HandleBuffer;
+  EFI_HANDLE  *NewHandleBuffer;
+  UINTN       BufferCount;
+  UINTN       BufferSize;
+
+  *HandleCount = 0;
+  HandleBuffer = NULL;
+  BufferCount  = 0;
+  while (TRUE) {
+    //
+    // Each call returns the next handle the protocol was installed on.
+    //
+    BufferSize = sizeof (Handle);
+    Status     = gBS->LocateHandle (ByRegisterNotify, NULL, Registration, &BufferSize, &Handle);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    if (*HandleCount == BufferCount) {
+      NewHandleBuffer = ReallocatePool (
+                          BufferCount * sizeof (EFI_HANDLE),
+                          (BufferCount + 32) * sizeof (EFI_HANDLE),
+                          HandleBuffer
+                          );
+      if (NewHandleBuffer == NULL) {
+        break;
+      }
+
+      HandleBuffer = NewHandleBuffer;
+      BufferCount += 32;
+    }
+
+    HandleBuffer[(*HandleCount)++] = Handle;
+  }
+
+  if (*HandleCount != 0) {
+    PerformQuickSort (HandleBuffer, *HandleCount, sizeof (EFI_HANDLE), BmCompareHandle);
+  }
+
+  return HandleBuffer;
+}
+
 /**
   Connect all the drivers to all the controllers.
 
   This function makes sure all the current system drivers manage the correspoinding
   controllers if have. And at the same time, makes sure all the system controllers
   have driver to manage it if have.
+
+  When PcdBootManagerIncrementalConnectAll is TRUE, a pass which follows the
+  dispatch of new DXE drivers only connects the handles which were not present
+  in the previous pass, or on which a Device Path Protocol was installed since,
+  unless a Driver Binding Protocol was installed since the previous pass. The
+  Device Path Protocol notification also catches a controller handle which was
+  freed and re-created at the same address as a handle of the previous pass.
 **/
 VOID
 BmConnectAllDriversToAllControllers (
@@ -24,8 +161,63 @@ BmConnectAllDriversToAllControllers (
   UINTN       HandleCount;
   EFI_HANDLE  *HandleBuffer;
   UINTN       Index;
+  UINTN       PreviousHandleCount;
+  EFI_HANDLE  *PreviousHandleBuffer;
+  UINTN       NotifiedHandleCount;
+  EFI_HANDLE  *NotifiedHandleBuffer;
+  EFI_EVENT   DriverBindingEvent;
+  VOID        *DriverBindingRegistration;
+  EFI_EVENT   DevicePathEvent;
+  VOID        *DevicePathRegistration;
+  BOOLEAN     ConnectAllHandles;
+  UINT32      Pass;
+
+  PreviousHandleCount       = 0;
+  PreviousHandleBuffer      = NULL;
+  NotifiedHandleCount       = 0;
+  NotifiedHandleBuffer      = NULL;
+  DriverBindingEvent        = NULL;
+  DriverBindingRegistration = NULL;
+  DevicePathEvent           = NULL;
+  DevicePathRegistration    = NULL;
+  Pass                      = 0;
+
+  if (FeaturePcdGet (PcdBootManagerIncrementalConnectAll)) {
+    DriverBindingEvent = EfiCreateProtocolNotifyEvent (
+                           &gEfiDriverBindingProtocolGuid,
+                           TPL_CALLBACK,
+                           EfiEventEmptyFunction,
+                           NULL,
+                           &DriverBindingRegistration
+                           );
+    DevicePathEvent = EfiCreateProtocolNotifyEvent (
+                        &gEfiDevicePathProtocolGuid,
+                        TPL_CALLBACK,
+                        EfiEventEmptyFunction,
+                        NULL,
+                        &DevicePathRegistration
+                        );
+  }
 
   do {
+    //
+    // Already connected handles only need to be connected again when there
+    // are new drivers which may manage them, or when they were modified.
+    //
+    ConnectAllHandles = TRUE;
+    if ((DriverBindingEvent != NULL) && (DevicePathEvent != NULL)) {
+      NotifiedHandleBuffer = BmGetNotifiedHandles (DriverBindingRegistration, &NotifiedHandleCount);
+      if ((PreviousHandleBuffer != NULL) && (NotifiedHandleCount == 0)) {
+        ConnectAllHandles = FALSE;
+      }
+
+      if (NotifiedHandleBuffer != NULL) {
+        FreePool (NotifiedHandleBuffer);
+      }
+
+      NotifiedHandleBuffer = BmGetNotifiedHandles (DevicePathRegistration, &NotifiedHandleCount);
+    }
+
     //
     // Connect All EFI 1.10 drivers following EFI 1.10 algorithm
     //
@@ -37,14 +229,42 @@ BmConnectAllDriversToAllControllers (
            &HandleBuffer
            );
 
+    PERF_START_EX (gImageHandle, "BdsConnectAll", NULL, 0, Pass);
     for (Index = 0; Index < HandleCount; Index++) {
+      if (!ConnectAllHandles &&
+          BmIsHandleInSortedBuffer (HandleBuffer[Index], PreviousHandleBuffer, PreviousHandleCount) &&
+          !BmIsHandleInSortedBuffer (HandleBuffer[Index], NotifiedHandleBuffer, NotifiedHandleCount))
+      {
+        continue;
+      }
+
       gBS->ConnectController (HandleBuffer[Index], NULL, NULL, TRUE);
     }
 
-    if (HandleBuffer != NULL) {
-      FreePool (HandleBuffer);
+    PERF_END_EX (gImageHandle, "BdsConnectAll", NULL, 0, Pass);
+    Pass++;
+
+    if (PreviousHandleBuffer != NULL) {
+      FreePool (PreviousHandleBuffer);
+    }
+
+    if (NotifiedHandleBuffer != NULL) {
+      FreePool (NotifiedHandleBuffer);
+      NotifiedHandleBuffer = NULL;
+      NotifiedHandleCount  = 0;
+    }
+
+    //
+    // Only the membership of the handles of this pass is checked in the next
+    // pass, so sort them once for the binary search.
+    //
+    if ((DriverBindingEvent != NULL) && (HandleCount != 0)) {
+      PerformQuickSort (HandleBuffer, HandleCount, sizeof (EFI_HANDLE), BmCompareHandle);
     }
 
+    PreviousHandleBuffer = HandleBuffer;
+    PreviousHandleCount  = HandleCount;
+
     //
     // Check to see if it's possible to dispatch an more DXE drivers.
     // The above code may have made new DXE drivers show up.
@@ -53,6 +273,18 @@ BmConnectAllDriversToAllControllers (
     //
     Status = gDS->Dispatch ();
   } while (!EFI_ERROR (Status));
+
+  if (PreviousHandleBuffer != NULL) {
+    FreePool (PreviousHandleBuffer);
+  }
+
+  if (DriverBindingEvent != NULL) {
+    gBS->CloseEvent (DriverBindingEvent);
+  }
+
+  if (DevicePathEvent != NULL) {
+    gBS->CloseEvent (DevicePathEvent);
+  }
 }
 
 /**
@@ -87,13 +87,13 @@ PartitionInstallElToritoChildHandles (
        VolDescriptorOffset <= MultU64x32 (Media->LastBlock, Media->BlockSize);
        VolDescriptorOffset += SIZE_2KB)
   {
-    Status = DiskIo->ReadDisk (
-                       DiskIo,
-                       Media->MediaId,
-                       VolDescriptorOffset,
-                       SIZE_2KB,
-                       VolDescriptor
-                       );
+    Status = PartitionReadDisk (
+               DiskIo,
+               Media->MediaId,
+               VolDescriptorOffset,
+               SIZE_2KB,
+               VolDescriptor
+               );
     if (EFI_ERROR (Status)) {
       Found = Status;
       break;
@@ -137,13 +137,13 @@ PartitionInstallElToritoChildHandles (
       continue;
     }
 
-    Status = DiskIo->ReadDisk (
-                       DiskIo,
-                       Media->MediaId,
-                       MultU64x32 (Lba2KB, SIZE_2KB),
-                       SIZE_2KB,
-                       Catalog
-                       );
+    Status = PartitionReadDisk (
+               DiskIo,
+               Media->MediaId,
+               MultU64x32 (Lba2KB, SIZE_2KB),
+               SIZE_2KB,
+               Catalog
+               );
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "EltCheckDevice: error reading catalog %r\n", Status));
       continue;
@@ -241,13 +241,13 @@ PartitionInstallGptChildHandles (
   //
   // Read the Protective MBR from LBA #0
   //
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     0,
-                     BlockSize,
-                     ProtectiveMbr
-                     );
+  Status = PartitionReadDisk (
+             DiskIo,
+             MediaId,
+             0,
+             BlockSize,
+             ProtectiveMbr
+             );
   if (EFI_ERROR (Status)) {
     GptValidStatus = Status;
     goto Done;
@@ -325,13 +325,13 @@ PartitionInstallGptChildHandles (
     goto Done;
   }
 
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     MultU64x32 (PrimaryHeader->PartitionEntryLBA, BlockSize),
-                     PrimaryHeader->NumberOfPartitionEntries * (PrimaryHeader->SizeOfPartitionEntry),
-                     PartEntry
-                     );
+  Status = PartitionReadDisk (
+             DiskIo,
+             MediaId,
+             MultU64x32 (PrimaryHeader->PartitionEntryLBA, BlockSize),
+             PrimaryHeader->NumberOfPartitionEntries * (PrimaryHeader->SizeOfPartitionEntry),
+             PartEntry
+             );
   if (EFI_ERROR (Status)) {
     GptValidStatus = Status;
     DEBUG ((DEBUG_ERROR, " Partition Entry ReadDisk error\n"));
@@ -488,13 +488,13 @@ PartitionValidGptTable (
   //
   // Read the EFI Partition Table Header
   //
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     MultU64x32 (Lba, BlockSize),
-                     BlockSize,
-                     PartHdr
-                     );
+  Status = PartitionReadDisk (
+             DiskIo,
+             MediaId,
+             MultU64x32 (Lba, BlockSize),
+             BlockSize,
+             PartHdr
+             );
   if (EFI_ERROR (Status)) {
     FreePool (PartHdr);
     return FALSE;
@@ -563,13 +563,13 @@ PartitionCheckGptEntryArrayCRC (
     return FALSE;
   }
 
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     BlockIo->Media->MediaId,
-                     MultU64x32 (PartHeader->PartitionEntryLBA, BlockIo->Media->BlockSize),
-                     PartHeader->NumberOfPartitionEntries * PartHeader->SizeOfPartitionEntry,
-                     Ptr
-                     );
+  Status = PartitionReadDisk (
+             DiskIo,
+             BlockIo->Media->MediaId,
+             MultU64x32 (PartHeader->PartitionEntryLBA, BlockIo->Media->BlockSize),
+             PartHeader->NumberOfPartitionEntries * PartHeader->SizeOfPartitionEntry,
+             Ptr
+             );
   if (EFI_ERROR (Status)) {
     FreePool (Ptr);
     return FALSE;
@@ -657,13 +657,13 @@ PartitionRestoreGptTable (
     goto Done;
   }
 
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     MultU64x32 (PartHeader->PartitionEntryLBA, (UINT32)BlockSize),
-                     PartHeader->NumberOfPartitionEntries * PartHeader->SizeOfPartitionEntry,
-                     Ptr
-                     );
+  Status = PartitionReadDisk (
+             DiskIo,
+             MediaId,
+             MultU64x32 (PartHeader->PartitionEntryLBA, (UINT32)BlockSize),
+             PartHeader->NumberOfPartitionEntries * PartHeader->SizeOfPartitionEntry,
+             Ptr
+             );
   if (EFI_ERROR (Status)) {
     goto Done;
   }
@@ -677,6 +677,12 @@ PartitionRestoreGptTable (
                      );
 
 Done:
+  //
+  // The restored table may be inside the leading bytes read by
+  // PartitionDriverBindingStart().
+  //
+  PartitionInvalidateReadCache ();
+
   FreePool (PartHdr);
 
   if (Ptr != NULL) {
@@ -50,6 +50,121 @@ PARTITION_DETECT_ROUTINE  mPartitionDetectRoutineTable[] = {
   NULL
 };
 
+//
+// Leading bytes of the disk being probed by PartitionDriverBindingStart().
+//
+PARTITION_READ_CACHE  *mPartitionReadCache = NULL;
+
+/**
+  Read the leading bytes of the disk once, so that the partition detect
+  routines share them instead of reading the same blocks again.
+
+  @param[out] ReadCache   The cache to fill.
+  @param[in]  DiskIo      Parent DiskIo interface.
+  @param[in]  BlockIo     Parent BlockIo interface.
+
+**/
+VOID
+PartitionFillReadCache (
+  OUT PARTITION_READ_CACHE   *ReadCache,
+  IN  EFI_DISK_IO_PROTOCOL   *DiskIo,
+  IN  EFI_BLOCK_IO_PROTOCOL  *BlockIo
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      BlockSize;
+  UINTN       Length;
+
+  ZeroMem (ReadCache, sizeof (PARTITION_READ_CACHE));
+
+  BlockSize = BlockIo->Media->BlockSize;
+  if (!BlockIo->Media->MediaPresent || (BlockSize == 0)) {
+    return;
+  }
+
+  Length = PARTITION_READ_CACHE_SIZE;
+  if (DivU64x32 (PARTITION_READ_CACHE_SIZE, BlockSize) > BlockIo->Media->LastBlock) {
+    Length = (UINTN)MultU64x32 (BlockIo->Media->LastBlock + 1, BlockSize);
+  }
+
+  ReadCache->Buffer = AllocatePool (Length);
+  if (ReadCache->Buffer == NULL) {
+    return;
+  }
+
+  ReadCache->MediaId = BlockIo->Media->MediaId;
+  ReadCache->DiskReads++;
+  Status = DiskIo->ReadDisk (DiskIo, ReadCache->MediaId, 0, Length, ReadCache->Buffer);
+  if (EFI_ERROR (Status)) {
+    //
+    // Let the detect routines read the disk and report the error.
+    //
+    FreePool (ReadCache->Buffer);
+    ReadCache->Buffer = NULL;
+    return;
+  }
+
+  ReadCache->Length = Length;
+}
+
+/**
+  Read from the disk for the partition detect routines.
+
+  The read is served from the leading bytes of the disk read by
+  PartitionDriverBindingStart() when it falls inside them, otherwise it is
+  passed to DiskIo.
+
+  @param[in]  DiskIo      Parent DiskIo interface.
+  @param[in]  MediaId     Id of the media, changes every time the media is replaced.
+  @param[in]  Offset      The starting byte offset to read from.
+  @param[in]  BufferSize  Size of Buffer.
+  @param[out] Buffer      Buffer containing read data.
+
+  @return The status returned by DiskIo->ReadDisk(), or EFI_SUCCESS if the
+          read is served from the cache.
+
+**/
+EFI_STATUS
+PartitionReadDisk (
+  IN  EFI_DISK_IO_PROTOCOL  *DiskIo,
+  IN  UINT32                MediaId,
+  IN  UINT64                Offset,
+  IN  UINTN                 BufferSize,
+  OUT VOID                  *Buffer
+  )
+{
+  if (mPartitionReadCache == NULL) {
+    return DiskIo->ReadDisk (DiskIo, MediaId, Offset, BufferSize, Buffer);
+  }
+
+  if ((mPartitionReadCache->MediaId == MediaId) &&
+      (Offset <= mPartitionReadCache->Length) &&
+      (BufferSize <= mPartitionReadCache->Length - Offset))
+  {
+    CopyMem (Buffer, mPartitionReadCache->Buffer + Offset, BufferSize);
+    mPartitionReadCache->CachedReads++;
+    return EFI_SUCCESS;
+  }
+
+  mPartitionReadCache->DiskReads++;
+  return DiskIo->ReadDisk (DiskIo, MediaId, Offset, BufferSize, Buffer);
+}
+
+/**
+  Drop the cached leading bytes of the disk after the partition detect
+  routines wrote to the disk.
+
+**/
+VOID
+PartitionInvalidateReadCache (
+  VOID
+  )
+{
+  if (mPartitionReadCache != NULL) {
+    mPartitionReadCache->Length = 0;
+  }
+}
+
 /**
   Test to see if this driver supports ControllerHandle. Any ControllerHandle
   than contains a BlockIo and DiskIo protocol or a BlockIo2 protocol can be
@@ -207,6 +322,8 @@ PartitionDriverBindingStart (
   PARTITION_DETECT_ROUTINE  *Routine;
   BOOLEAN                   MediaPresent;
   EFI_TPL                   OldTpl;
+  PARTITION_READ_CACHE      ReadCache;
+  PARTITION_READ_CACHE      *OldReadCache;
 
   BlockIo2 = NULL;
   OldTpl   = gBS->RaiseTPL (TPL_CALLBACK);
@@ -315,6 +432,13 @@ PartitionDriverBindingStart (
     // If the media supports a given partition type install child handles to
     // represent the partitions described by the media.
     //
+    // The detect routines share the leading bytes of the disk, read once here.
+    // Start() may be reentered on a media change, so keep the outer cache.
+    //
+    OldReadCache = mPartitionReadCache;
+    PartitionFillReadCache (&ReadCache, DiskIo, BlockIo);
+    mPartitionReadCache = &ReadCache;
+
     Routine = &mPartitionDetectRoutineTable[0];
     while (*Routine != NULL) {
       Status = (*Routine)(
@@ -332,6 +456,20 @@ PartitionDriverBindingStart (
 
       Routine++;
     }
+
+    DEBUG ((
+      DEBUG_INFO,
+      "PartitionDxe: %p probed with %d disk reads, %d reads served from the %d leading bytes\n",
+      ControllerHandle,
+      ReadCache.DiskReads,
+      ReadCache.CachedReads,
+      ReadCache.Length
+      ));
+
+    mPartitionReadCache = OldReadCache;
+    if (ReadCache.Buffer != NULL) {
+      FreePool (ReadCache.Buffer);
+    }
   }
 
   //
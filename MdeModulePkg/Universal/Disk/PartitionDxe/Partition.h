@@ -103,6 +103,25 @@ typedef struct {
   BOOLEAN    OsSpecific;
 } EFI_PARTITION_ENTRY_STATUS;
 
+//
+// Number of leading bytes of the disk read once and shared by the partition
+// detect routines. It covers the MBR, the primary GPT header and a 128-entry
+// partition entry array for 512 and 4096 byte blocks, and the ISO 9660/UDF
+// volume descriptors starting at byte 32K.
+//
+#define PARTITION_READ_CACHE_SIZE  SIZE_64KB
+
+//
+// Leading bytes of the disk shared by the partition detect routines
+//
+typedef struct {
+  UINT32    MediaId;
+  UINTN     Length;
+  UINT8     *Buffer;
+  UINTN     DiskReads;
+  UINTN     CachedReads;
+} PARTITION_READ_CACHE;
+
 //
 // Function Prototypes
 //
@@ -304,6 +323,42 @@ PartitionComponentNameGetControllerName (
   OUT CHAR16                       **ControllerName
   );
 
+/**
+  Read from the disk for the partition detect routines.
+
+  The read is served from the leading bytes of the disk read by
+  PartitionDriverBindingStart() when it falls inside them, otherwise it is
+  passed to DiskIo.
+
+  @param[in]  DiskIo      Parent DiskIo interface.
+  @param[in]  MediaId     Id of the media, changes every time the media is replaced.
+  @param[in]  Offset      The starting byte offset to read from.
+  @param[in]  BufferSize  Size of Buffer.
+  @param[out] Buffer      Buffer containing read data.
+
+  @return The status returned by DiskIo->ReadDisk(), or EFI_SUCCESS if the
+          read is served from the cache.
+
+**/
+EFI_STATUS
+PartitionReadDisk (
+  IN  EFI_DISK_IO_PROTOCOL  *DiskIo,
+  IN  UINT32                MediaId,
+  IN  UINT64                Offset,
+  IN  UINTN                 BufferSize,
+  OUT VOID                  *Buffer
+  );
+
+/**
+  Drop the cached leading bytes of the disk after the partition detect
+  routines wrote to the disk.
+
+**/
+VOID
+PartitionInvalidateReadCache (
+  VOID
+  );
+
 /**
   Create a child handle for a logical block device that represents the
   bytes Start to End of the Parent Block IO device.
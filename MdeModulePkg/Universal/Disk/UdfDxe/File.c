@@ -74,6 +74,7 @@ UdfOpenVolume (
     // There is no more open files. Read volume information again since it was
     // cleaned up on the last UdfClose() call.
     //
+    CleanupDirectoryIndexCache (&PrivFsData->Volume);
     Status = ReadUdfVolumeInformation (
                PrivFsData->BlockIo,
                PrivFsData->DiskIo,
@@ -385,7 +386,8 @@ UdfRead (
                PrivFileData->FileSize,
                &PrivFileData->FilePosition,
                Buffer,
-               &BufferSizeUint64
+               &BufferSizeUint64,
+               &PrivFileData->ExtentMap
                );
     ASSERT (BufferSizeUint64 <= MAX_UINTN);
     *BufferSize = (UINTN)BufferSizeUint64;
@@ -564,6 +566,8 @@ UdfClose (
 
   PrivFileData = PRIVATE_UDF_FILE_DATA_FROM_THIS (This);
 
+  CleanupExtentMap (&PrivFileData->ExtentMap);
+
   if (!PrivFileData->IsRootDirectory) {
     CleanupFileInformation (&PrivFileData->File);
 
@@ -1312,7 +1312,7 @@ ReadFile (
               goto Skip_File_Seek;
             }
 
-            if (FilePosition + ExtentLength < ReadFileInfo->FilePosition) {
+            if (FilePosition + ExtentLength <= ReadFileInfo->FilePosition) {
               FilePosition += ExtentLength;
               goto Skip_Ad;
             }
@@ -1415,6 +1415,487 @@ Error_Get_Aed:
   return Status;
 }
 
+/**
+  Build the extent map of a file, so that reads seek in memory instead of
+  walking the allocation descriptors and re-reading the Allocation Extent
+  Descriptors on every call. Physically contiguous extents are merged, so a
+  sequential read becomes a few large disk reads.
+
+  @param[in]  BlockIo             BlockIo interface.
+  @param[in]  DiskIo              DiskIo interface.
+  @param[in]  Volume              Volume information pointer.
+  @param[in]  File                File information pointer.
+  @param[out] ExtentMap           Extent map of the file.
+
+  @retval EFI_SUCCESS             The extent map was built.
+  @retval EFI_UNSUPPORTED         The file's data is not recorded in extents.
+  @retval EFI_OUT_OF_RESOURCES    The extent map was not built due to lack of
+                                  resources.
+  @retval other                   The extent map was not built.
+
+**/
+EFI_STATUS
+BuildExtentMap (
+  IN   EFI_BLOCK_IO_PROTOCOL  *BlockIo,
+  IN   EFI_DISK_IO_PROTOCOL   *DiskIo,
+  IN   UDF_VOLUME_INFO        *Volume,
+  IN   UDF_FILE_INFO          *File,
+  OUT  UDF_EXTENT_MAP         *ExtentMap
+  )
+{
+  EFI_STATUS                      Status;
+  UDF_LONG_ALLOCATION_DESCRIPTOR  *ParentIcb;
+  UDF_FE_RECORDING_FLAGS          RecordingFlags;
+  VOID                            *Data;
+  VOID                            *DataBak;
+  UINT64                          Length;
+  VOID                            *Ad;
+  UINT64                          AdOffset;
+  UINT64                          Lsn;
+  UINT64                          DiskOffset;
+  UINT64                          FilePosition;
+  UINT32                          ExtentLength;
+  BOOLEAN                         DoFreeAed;
+  UDF_EXTENT                      *Extents;
+  UINTN                           Count;
+  UINTN                           MaxCount;
+
+  ZeroMem (ExtentMap, sizeof (UDF_EXTENT_MAP));
+
+  RecordingFlags = GET_FE_RECORDING_FLAGS (File->FileEntry);
+  if ((RecordingFlags != LongAdsSequence) && (RecordingFlags != ShortAdsSequence)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Status = GetAdsInformation (File->FileEntry, Volume->FileEntrySize, &Data, &Length);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ParentIcb    = &File->FileIdentifierDesc->Icb;
+  DoFreeAed    = FALSE;
+  Extents      = NULL;
+  Count        = 0;
+  MaxCount     = 0;
+  FilePosition = 0;
+  AdOffset     = 0;
+
+  for ( ; ;) {
+    Status = GetAllocationDescriptor (RecordingFlags, Data, &AdOffset, Length, &Ad);
+    if (Status == EFI_DEVICE_ERROR) {
+      Status = EFI_SUCCESS;
+      break;
+    }
+
+    if (GET_EXTENT_FLAGS (RecordingFlags, Ad) == ExtentIsNextExtent) {
+      DataBak = Data;
+      Status  = GetAedAdsData (
+                  BlockIo,
+                  DiskIo,
+                  Volume,
+                  ParentIcb,
+                  RecordingFlags,
+                  Ad,
+                  &Data,
+                  &Length
+                  );
+
+      if (!DoFreeAed) {
+        DoFreeAed = TRUE;
+      } else {
+        FreePool (DataBak);
+      }
+
+      if (EFI_ERROR (Status)) {
+        //
+        // GetAedAdsData() may have allocated Data before failing the read.
+        //
+        DoFreeAed = (BOOLEAN)(Data != DataBak);
+        break;
+      }
+
+      AdOffset = 0;
+      continue;
+    }
+
+    ExtentLength = GET_EXTENT_LENGTH (RecordingFlags, Ad);
+
+    Status = GetAllocationDescriptorLsn (RecordingFlags, Volume, ParentIcb, Ad, &Lsn);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    DiskOffset = MultU64x32 (Lsn, Volume->LogicalVolDesc.LogicalBlockSize);
+    if ((Count > 0) &&
+        (Extents[Count - 1].DiskOffset + Extents[Count - 1].Length == DiskOffset))
+    {
+      Extents[Count - 1].Length += ExtentLength;
+    } else {
+      if (Count == MaxCount) {
+        Extents = ReallocatePool (
+                    MaxCount * sizeof (UDF_EXTENT),
+                    (MaxCount + 16) * sizeof (UDF_EXTENT),
+                    Extents
+                    );
+        if (Extents == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          break;
+        }
+
+        MaxCount += 16;
+      }
+
+      Extents[Count].FilePosition = FilePosition;
+      Extents[Count].DiskOffset   = DiskOffset;
+      Extents[Count].Length       = ExtentLength;
+      Count++;
+    }
+
+    FilePosition += ExtentLength;
+    AdOffset     += AD_LENGTH (RecordingFlags);
+  }
+
+  if (DoFreeAed && (Data != NULL)) {
+    FreePool (Data);
+  }
+
+  if (EFI_ERROR (Status) || (Count == 0)) {
+    if (Extents != NULL) {
+      FreePool (Extents);
+    }
+
+    return EFI_ERROR (Status) ? Status : EFI_UNSUPPORTED;
+  }
+
+  ExtentMap->Extents = Extents;
+  ExtentMap->Count   = Count;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Seek a file and read its data through the extent map of the file.
+
+  @param[in]      BlockIo       BlockIo interface.
+  @param[in]      DiskIo        DiskIo interface.
+  @param[in]      ExtentMap     Extent map of the file.
+  @param[in]      FileSize      Size of the file.
+  @param[in, out] FilePosition  File position.
+  @param[in, out] Buffer        File data.
+  @param[in, out] BufferSize    Read size.
+
+  @retval EFI_SUCCESS          File seeked and read.
+  @retval other                Fail to read the disk.
+
+**/
+EFI_STATUS
+ReadFileDataFromExtentMap (
+  IN      EFI_BLOCK_IO_PROTOCOL  *BlockIo,
+  IN      EFI_DISK_IO_PROTOCOL   *DiskIo,
+  IN      UDF_EXTENT_MAP         *ExtentMap,
+  IN      UINT64                 FileSize,
+  IN OUT  UINT64                 *FilePosition,
+  IN OUT  VOID                   *Buffer,
+  IN OUT  UINT64                 *BufferSize
+  )
+{
+  EFI_STATUS  Status;
+  UDF_EXTENT  *Extent;
+  UINTN       Low;
+  UINTN       High;
+  UINTN       Middle;
+  UINT64      Offset;
+  UINT64      DataOffset;
+  UINT64      DataLength;
+  UINT64      BytesLeft;
+
+  if (*BufferSize > FileSize - *FilePosition) {
+    //
+    // About to read beyond the EOF -- truncate it.
+    //
+    *BufferSize = FileSize - *FilePosition;
+  }
+
+  //
+  // Binary search the extent that holds the file position.
+  //
+  Low  = 0;
+  High = ExtentMap->Count;
+  while (Low < High) {
+    Middle = (Low + High) / 2;
+    Extent = &ExtentMap->Extents[Middle];
+    if (Extent->FilePosition + Extent->Length <= *FilePosition) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  BytesLeft  = *BufferSize;
+  DataOffset = 0;
+  for ( ; (Low < ExtentMap->Count) && (BytesLeft > 0); Low++) {
+    Extent     = &ExtentMap->Extents[Low];
+    Offset     = *FilePosition - Extent->FilePosition;
+    DataLength = MIN (Extent->Length - Offset, BytesLeft);
+
+    Status = DiskIo->ReadDisk (
+                       DiskIo,
+                       BlockIo->Media->MediaId,
+                       Extent->DiskOffset + Offset,
+                       (UINTN)DataLength,
+                       (VOID *)((UINT8 *)Buffer + DataOffset)
+                       );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    DataOffset    += DataLength;
+    *FilePosition += DataLength;
+    BytesLeft     -= DataLength;
+  }
+
+  //
+  // The recorded extents may be shorter than the file size.
+  //
+  *BufferSize = DataOffset;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Calculate the hash of a file name for the hashed directory index.
+
+  @param[in]  FileName            File name string.
+
+  @return The hash of the file name.
+
+**/
+UINT32
+HashFileName (
+  IN CHAR16  *FileName
+  )
+{
+  UINT32  Hash;
+
+  //
+  // FNV-1a
+  //
+  Hash = 0x811C9DC5;
+  for ( ; *FileName != L'\0'; FileName++) {
+    Hash = (Hash ^ *FileName) * 0x01000193;
+  }
+
+  return Hash;
+}
+
+/**
+  Get the hashed index of a directory, reading the directory and building the
+  index if it is not cached on the volume yet. The least recently used index
+  is dropped only once the new index has been built, so a directory that
+  cannot be indexed leaves the cache untouched.
+
+  @param[in]  BlockIo             BlockIo interface.
+  @param[in]  DiskIo              DiskIo interface.
+  @param[in]  Volume              Volume information pointer.
+  @param[in]  Icb                 ICB of the directory.
+  @param[in]  FileEntryData       FE/EFE of the directory.
+
+  @return The hashed index of the directory, or NULL if the directory cannot
+          be indexed.
+
+**/
+UDF_DIRECTORY_INDEX *
+GetDirectoryIndex (
+  IN  EFI_BLOCK_IO_PROTOCOL           *BlockIo,
+  IN  EFI_DISK_IO_PROTOCOL            *DiskIo,
+  IN  UDF_VOLUME_INFO                 *Volume,
+  IN  UDF_LONG_ALLOCATION_DESCRIPTOR  *Icb,
+  IN  VOID                            *FileEntryData
+  )
+{
+  EFI_STATUS                      Status;
+  UDF_DIRECTORY_INDEX             *DirectoryIndex;
+  UINTN                           Index;
+  UDF_READ_FILE_INFO              ReadFileInfo;
+  UDF_FILE_IDENTIFIER_DESCRIPTOR  *FileIdentifierDesc;
+  UINT64                          FidOffset;
+  UINTN                           Count;
+  UDF_DIRECTORY_INDEX_ENTRY       *Table;
+  UINTN                           TableSize;
+  UINTN                           Slot;
+  UINT32                          Hash;
+  CHAR16                          FileName[UDF_FILENAME_LENGTH];
+
+  Volume->DirectoryIndexClock++;
+
+  DirectoryIndex = &Volume->DirectoryIndex[0];
+  for (Index = 0; Index < UDF_DIRECTORY_INDEX_CACHE_SIZE; Index++) {
+    if ((Volume->DirectoryIndex[Index].DirectoryData != NULL) &&
+        (Volume->DirectoryIndex[Index].Location.LogicalBlockNumber == Icb->ExtentLocation.LogicalBlockNumber) &&
+        (Volume->DirectoryIndex[Index].Location.PartitionReferenceNumber == Icb->ExtentLocation.PartitionReferenceNumber))
+    {
+      Volume->DirectoryIndex[Index].LastUse = Volume->DirectoryIndexClock;
+      return &Volume->DirectoryIndex[Index];
+    }
+
+    if (Volume->DirectoryIndex[Index].LastUse < DirectoryIndex->LastUse) {
+      DirectoryIndex = &Volume->DirectoryIndex[Index];
+    }
+  }
+
+  Table              = NULL;
+  ReadFileInfo.Flags = ReadFileAllocateAndRead;
+
+  Status = ReadFile (BlockIo, DiskIo, Volume, Icb, FileEntryData, &ReadFileInfo);
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  if ((ReadFileInfo.FileData == NULL) || (ReadFileInfo.ReadLength >= MAX_UINT32)) {
+    goto Error;
+  }
+
+  //
+  // Size the table to keep it at most half full.
+  //
+  Count = 0;
+  for (FidOffset = 0; FidOffset < ReadFileInfo.ReadLength; FidOffset += GetFidDescriptorLength (FileIdentifierDesc)) {
+    FileIdentifierDesc = GET_FID_FROM_ADS (ReadFileInfo.FileData, FidOffset);
+    Count++;
+  }
+
+  TableSize = 16;
+  while (TableSize < 2 * Count) {
+    TableSize *= 2;
+  }
+
+  Table = AllocateZeroPool (TableSize * sizeof (UDF_DIRECTORY_INDEX_ENTRY));
+  if (Table == NULL) {
+    goto Error;
+  }
+
+  for (FidOffset = 0; FidOffset < ReadFileInfo.ReadLength; FidOffset += GetFidDescriptorLength (FileIdentifierDesc)) {
+    FileIdentifierDesc = GET_FID_FROM_ADS (ReadFileInfo.FileData, FidOffset);
+    if ((FileIdentifierDesc->FileCharacteristics & (DELETED_FILE | PARENT_FILE)) != 0) {
+      continue;
+    }
+
+    Status = GetFileNameFromFid (FileIdentifierDesc, ARRAY_SIZE (FileName), FileName);
+    if (EFI_ERROR (Status)) {
+      //
+      // Let the directory walk report the corrupted FID.
+      //
+      goto Error;
+    }
+
+    Hash = HashFileName (FileName);
+    Slot = Hash & (TableSize - 1);
+    while (Table[Slot].FidOffset != 0) {
+      Slot = (Slot + 1) & (TableSize - 1);
+    }
+
+    Table[Slot].NameHash  = Hash;
+    Table[Slot].FidOffset = (UINT32)FidOffset + 1;
+  }
+
+  //
+  // Drop the least recently used index now that its replacement is ready.
+  //
+  if (DirectoryIndex->DirectoryData != NULL) {
+    FreePool (DirectoryIndex->DirectoryData);
+  }
+
+  if (DirectoryIndex->Table != NULL) {
+    FreePool (DirectoryIndex->Table);
+  }
+
+  CopyMem (&DirectoryIndex->Location, &Icb->ExtentLocation, sizeof (UDF_LB_ADDR));
+  DirectoryIndex->LastUse         = Volume->DirectoryIndexClock;
+  DirectoryIndex->DirectoryData   = ReadFileInfo.FileData;
+  DirectoryIndex->DirectoryLength = ReadFileInfo.ReadLength;
+  DirectoryIndex->Table           = Table;
+  DirectoryIndex->TableSize       = TableSize;
+
+  return DirectoryIndex;
+
+Error:
+  if (ReadFileInfo.FileData != NULL) {
+    FreePool (ReadFileInfo.FileData);
+  }
+
+  if (Table != NULL) {
+    FreePool (Table);
+  }
+
+  return NULL;
+}
+
+/**
+  Find a FID by its file name in the hashed index of a directory.
+
+  @param[in]  BlockIo             BlockIo interface.
+  @param[in]  DiskIo              DiskIo interface.
+  @param[in]  Volume              Volume information pointer.
+  @param[in]  Icb                 ICB of the directory.
+  @param[in]  FileEntryData       FE/EFE of the directory.
+  @param[in]  FileName            File name string.
+  @param[out] FoundFid            File Identifier Descriptor pointer.
+
+  @retval EFI_SUCCESS             The FID was found.
+  @retval EFI_NOT_FOUND           The directory has no such file.
+  @retval EFI_UNSUPPORTED         The directory cannot be indexed.
+  @retval EFI_OUT_OF_RESOURCES    The FID was not duplicated due to lack of
+                                  resources.
+
+**/
+EFI_STATUS
+FindFidFromDirectoryIndex (
+  IN   EFI_BLOCK_IO_PROTOCOL           *BlockIo,
+  IN   EFI_DISK_IO_PROTOCOL            *DiskIo,
+  IN   UDF_VOLUME_INFO                 *Volume,
+  IN   UDF_LONG_ALLOCATION_DESCRIPTOR  *Icb,
+  IN   VOID                            *FileEntryData,
+  IN   CHAR16                          *FileName,
+  OUT  UDF_FILE_IDENTIFIER_DESCRIPTOR  **FoundFid
+  )
+{
+  EFI_STATUS                      Status;
+  UDF_DIRECTORY_INDEX             *DirectoryIndex;
+  UDF_FILE_IDENTIFIER_DESCRIPTOR  *FileIdentifierDesc;
+  UINT32                          Hash;
+  UINTN                           Slot;
+  CHAR16                          FoundFileName[UDF_FILENAME_LENGTH];
+
+  DirectoryIndex = GetDirectoryIndex (BlockIo, DiskIo, Volume, Icb, FileEntryData);
+  if (DirectoryIndex == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Hash = HashFileName (FileName);
+  Slot = Hash & (DirectoryIndex->TableSize - 1);
+  while (DirectoryIndex->Table[Slot].FidOffset != 0) {
+    if (DirectoryIndex->Table[Slot].NameHash == Hash) {
+      FileIdentifierDesc = GET_FID_FROM_ADS (
+                             DirectoryIndex->DirectoryData,
+                             DirectoryIndex->Table[Slot].FidOffset - 1
+                             );
+      Status = GetFileNameFromFid (FileIdentifierDesc, ARRAY_SIZE (FoundFileName), FoundFileName);
+      if (!EFI_ERROR (Status) && (StrCmp (FileName, FoundFileName) == 0)) {
+        DuplicateFid (FileIdentifierDesc, FoundFid);
+        if (*FoundFid == NULL) {
+          return EFI_OUT_OF_RESOURCES;
+        }
+
+        return EFI_SUCCESS;
+      }
+    }
+
+    Slot = (Slot + 1) & (DirectoryIndex->TableSize - 1);
+  }
+
+  return EFI_NOT_FOUND;
+}
+
 /**
   Find a file by its filename from a given Parent file.
 
@@ -1486,13 +1967,37 @@ InternalFindFile (
     return EFI_SUCCESS;
   }
 
+  Found = FALSE;
+
+  //
+  // Look the file name up in the hashed index of the directory. ".." and "\\"
+  // are found through the parent FID by the directory walk below.
+  //
+  if ((StrCmp (FileName, L"..") != 0) && (StrCmp (FileName, L"\\") != 0)) {
+    Status = FindFidFromDirectoryIndex (
+               BlockIo,
+               DiskIo,
+               Volume,
+               (Parent->FileIdentifierDesc != NULL) ?
+               &Parent->FileIdentifierDesc->Icb :
+               Icb,
+               Parent->FileEntry,
+               FileName,
+               &FileIdentifierDesc
+               );
+    if (Status == EFI_NOT_FOUND) {
+      return Status;
+    }
+
+    Found = (BOOLEAN)(!EFI_ERROR (Status));
+  }
+
   //
   // Start directory listing.
   //
   ZeroMem ((VOID *)&ReadDirInfo, sizeof (UDF_READ_DIRECTORY_INFO));
-  Found = FALSE;
 
-  for ( ; ;) {
+  while (!Found) {
     Status = ReadDirectoryEntry (
                BlockIo,
                DiskIo,
@@ -2407,6 +2912,51 @@ CleanupFileInformation (
   ZeroMem ((VOID *)File, sizeof (UDF_FILE_INFO));
 }
 
+/**
+  Clean up the extent map of a file.
+
+  @param[in] ExtentMap Extent map pointer.
+
+**/
+VOID
+CleanupExtentMap (
+  IN UDF_EXTENT_MAP  *ExtentMap
+  )
+{
+  if (ExtentMap->Extents != NULL) {
+    FreePool (ExtentMap->Extents);
+  }
+
+  ZeroMem ((VOID *)ExtentMap, sizeof (UDF_EXTENT_MAP));
+}
+
+/**
+  Clean up the hashed directory indexes of an UDF volume.
+
+  @param[in] Volume UDF volume information structure.
+
+**/
+VOID
+CleanupDirectoryIndexCache (
+  IN UDF_VOLUME_INFO  *Volume
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < UDF_DIRECTORY_INDEX_CACHE_SIZE; Index++) {
+    if (Volume->DirectoryIndex[Index].DirectoryData != NULL) {
+      FreePool (Volume->DirectoryIndex[Index].DirectoryData);
+    }
+
+    if (Volume->DirectoryIndex[Index].Table != NULL) {
+      FreePool (Volume->DirectoryIndex[Index].Table);
+    }
+  }
+
+  ZeroMem ((VOID *)Volume->DirectoryIndex, sizeof (Volume->DirectoryIndex));
+  Volume->DirectoryIndexClock = 0;
+}
+
 /**
   Find a file from its absolute path on an UDF volume.
 
@@ -2859,6 +3409,9 @@ Out_Free:
   @param[in, out] FilePosition  File position.
   @param[in, out] Buffer        File data.
   @param[in, out] BufferSize    Read size.
+  @param[in, out] ExtentMap     Optional extent map of the file. It is built on
+                                the first read, and the next reads seek in it
+                                instead of walking the allocation descriptors.
 
   @retval EFI_SUCCESS          File seeked and read.
   @retval EFI_UNSUPPORTED      Extended Allocation Descriptors not supported.
@@ -2878,12 +3431,34 @@ ReadFileData (
   IN      UINT64                 FileSize,
   IN OUT  UINT64                 *FilePosition,
   IN OUT  VOID                   *Buffer,
-  IN OUT  UINT64                 *BufferSize
+  IN OUT  UINT64                 *BufferSize,
+  IN OUT  UDF_EXTENT_MAP         *ExtentMap OPTIONAL
   )
 {
   EFI_STATUS          Status;
   UDF_READ_FILE_INFO  ReadFileInfo;
 
+  if (ExtentMap != NULL) {
+    if (ExtentMap->Extents == NULL) {
+      //
+      // Inline data and files without recorded extents keep using ReadFile().
+      //
+      BuildExtentMap (BlockIo, DiskIo, Volume, File, ExtentMap);
+    }
+
+    if (ExtentMap->Extents != NULL) {
+      return ReadFileDataFromExtentMap (
+               BlockIo,
+               DiskIo,
+               ExtentMap,
+               FileSize,
+               FilePosition,
+               Buffer,
+               BufferSize
+               );
+    }
+  }
+
   ReadFileInfo.Flags        = ReadFileSeekAndRead;
   ReadFileInfo.FilePosition = *FilePosition;
   ReadFileInfo.FileData     = Buffer;
@@ -273,6 +273,7 @@ UdfDriverBindingStop (
                     NULL
                     );
 
+    CleanupDirectoryIndexCache (&PrivFsData->Volume);
     FreePool ((VOID *)PrivFsData);
   }
 
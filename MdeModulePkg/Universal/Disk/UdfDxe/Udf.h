@@ -309,6 +309,50 @@ typedef struct {
 
 #pragma pack()
 
+//
+// Extent of a file's recorded data, merged with the physically contiguous
+// extents following it
+//
+typedef struct {
+  UINT64    FilePosition;
+  UINT64    DiskOffset;
+  UINT64    Length;
+} UDF_EXTENT;
+
+//
+// Extents of a file's recorded data, sorted by file position
+//
+typedef struct {
+  UDF_EXTENT    *Extents;
+  UINTN         Count;
+} UDF_EXTENT_MAP;
+
+//
+// Number of directories whose hashed index is kept per volume
+//
+#define UDF_DIRECTORY_INDEX_CACHE_SIZE  8
+
+typedef struct {
+  UINT32    NameHash;
+  //
+  // Offset of the FID in the directory data plus one, or zero if the slot
+  // is free.
+  //
+  UINT32    FidOffset;
+} UDF_DIRECTORY_INDEX_ENTRY;
+
+//
+// Hashed index of the FIDs of a directory, keyed by file name
+//
+typedef struct {
+  UDF_LB_ADDR                  Location;
+  UINT64                       LastUse;
+  VOID                         *DirectoryData;
+  UINT64                       DirectoryLength;
+  UDF_DIRECTORY_INDEX_ENTRY    *Table;
+  UINTN                        TableSize;
+} UDF_DIRECTORY_INDEX;
+
 //
 // UDF filesystem driver's private data
 //
@@ -318,6 +362,8 @@ typedef struct {
   UDF_PARTITION_DESCRIPTOR         PartitionDesc;
   UDF_FILE_SET_DESCRIPTOR          FileSetDesc;
   UINTN                            FileEntrySize;
+  UDF_DIRECTORY_INDEX              DirectoryIndex[UDF_DIRECTORY_INDEX_CACHE_SIZE];
+  UINT64                           DirectoryIndexClock;
 } UDF_VOLUME_INFO;
 
 typedef struct {
@@ -353,6 +399,7 @@ typedef struct {
   CHAR16                             FileName[UDF_FILENAME_LENGTH];
   UINT64                             FileSize;
   UINT64                             FilePosition;
+  UDF_EXTENT_MAP                     ExtentMap;
 } PRIVATE_UDF_FILE_DATA;
 
 #define PRIVATE_UDF_SIMPLE_FS_DATA_SIGNATURE  SIGNATURE_32 ('U', 'd', 'f', 's')
@@ -841,6 +888,57 @@ CleanupFileInformation (
   IN UDF_FILE_INFO  *File
   );
 
+/**
+  Clean up the extent map of a file.
+
+  @param[in] ExtentMap Extent map pointer.
+
+**/
+VOID
+CleanupExtentMap (
+  IN UDF_EXTENT_MAP  *ExtentMap
+  );
+
+/**
+  Find a FID by its file name in the hashed index of a directory.
+
+  @param[in]  BlockIo             BlockIo interface.
+  @param[in]  DiskIo              DiskIo interface.
+  @param[in]  Volume              Volume information pointer.
+  @param[in]  Icb                 ICB of the directory.
+  @param[in]  FileEntryData       FE/EFE of the directory.
+  @param[in]  FileName            File name string.
+  @param[out] FoundFid            File Identifier Descriptor pointer.
+
+  @retval EFI_SUCCESS             The FID was found.
+  @retval EFI_NOT_FOUND           The directory has no such file.
+  @retval EFI_UNSUPPORTED         The directory cannot be indexed.
+  @retval EFI_OUT_OF_RESOURCES    The FID was not duplicated due to lack of
+                                  resources.
+
+**/
+EFI_STATUS
+FindFidFromDirectoryIndex (
+  IN   EFI_BLOCK_IO_PROTOCOL           *BlockIo,
+  IN   EFI_DISK_IO_PROTOCOL            *DiskIo,
+  IN   UDF_VOLUME_INFO                 *Volume,
+  IN   UDF_LONG_ALLOCATION_DESCRIPTOR  *Icb,
+  IN   VOID                            *FileEntryData,
+  IN   CHAR16                          *FileName,
+  OUT  UDF_FILE_IDENTIFIER_DESCRIPTOR  **FoundFid
+  );
+
+/**
+  Clean up the hashed directory indexes of an UDF volume.
+
+  @param[in] Volume UDF volume information structure.
+
+**/
+VOID
+CleanupDirectoryIndexCache (
+  IN UDF_VOLUME_INFO  *Volume
+  );
+
 /**
   Find a file from its absolute path on an UDF volume.
 
@@ -965,6 +1063,9 @@ GetVolumeSize (
   @param[in, out] FilePosition  File position.
   @param[in, out] Buffer        File data.
   @param[in, out] BufferSize    Read size.
+  @param[in, out] ExtentMap     Optional extent map of the file. It is built on
+                                the first read, and the next reads seek in it
+                                instead of walking the allocation descriptors.
 
   @retval EFI_SUCCESS          File seeked and read.
   @retval EFI_UNSUPPORTED      Extended Allocation Descriptors not supported.
@@ -984,7 +1085,8 @@ ReadFileData (
   IN      UINT64                 FileSize,
   IN OUT  UINT64                 *FilePosition,
   IN OUT  VOID                   *Buffer,
-  IN OUT  UINT64                 *BufferSize
+  IN OUT  UINT64                 *BufferSize,
+  IN OUT  UDF_EXTENT_MAP         *ExtentMap OPTIONAL
   );
 
 /**
@@ -0,0 +1,913 @@
+/** @file
+  Host-based unit tests of the UDF hashed directory index cache and of the
+  file extent maps.
+
+  The tests look files up in the directories of a synthetic UDF image, held in
+  memory behind a mock DiskIo protocol that counts the disk reads, and check
+  which lookups are served from the cache and which indexes get evicted. They
+  also read a file of the image recorded in several extents, some of them in
+  an Allocation Extent Descriptor (AED), through its extent map and through the
+  allocation descriptor walk, and check that both return the same data.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include "../Udf.h"
+
+#include <Library/PrintLib.h>
+#include <Library/UnitTestLib.h>
+
+#define UNIT_TEST_APP_NAME     "UdfDxe Directory Index Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+#define TEST_LOGICAL_BLOCK_SIZE  2048
+
+//
+// Directories of the synthetic image. The first UDF_DIRECTORY_INDEX_CACHE_SIZE
+// + 1 are valid, the read of the next one fails, and the last one has a FID
+// with a corrupted file name.
+//
+#define TEST_VALID_DIRECTORY_COUNT  (UDF_DIRECTORY_INDEX_CACHE_SIZE + 1)
+#define TEST_UNREADABLE_DIRECTORY   TEST_VALID_DIRECTORY_COUNT
+#define TEST_CORRUPTED_DIRECTORY    (TEST_VALID_DIRECTORY_COUNT + 1)
+#define TEST_DIRECTORY_COUNT        (TEST_VALID_DIRECTORY_COUNT + 2)
+#define TEST_FILES_PER_DIRECTORY    10
+#define TEST_DIRECTORY_ICB_BASE     0x100
+
+//
+// The FIDs of directory N are recorded in logical block N + 1.
+//
+#define TEST_DIRECTORY_BLOCK(_Dir)  ((_Dir) + 1)
+
+//
+// The extent-mapped file is recorded in the TEST_FILE_BLOCK_COUNT blocks that
+// follow the directories. Block TEST_FILE_AED_BLOCK of these holds the AED.
+//
+#define TEST_FILE_BLOCK(_Index)     (TEST_DIRECTORY_COUNT + 1 + (_Index))
+#define TEST_FILE_BLOCK_COUNT       7
+#define TEST_FILE_AED_BLOCK         4
+#define TEST_FILE_FE_EXTENT_COUNT   3
+#define TEST_FILE_LAST_EXTENT_SIZE  1000
+#define TEST_FILE_SIZE              (5 * TEST_LOGICAL_BLOCK_SIZE + TEST_FILE_LAST_EXTENT_SIZE)
+#define TEST_INLINE_FILE_SIZE       200
+
+//
+// Byte at a given position of the test files.
+//
+#define TEST_FILE_BYTE(_Position)  ((UINT8)((_Position) * 7 + ((_Position) >> 8)))
+
+typedef struct {
+  UDF_LONG_ALLOCATION_DESCRIPTOR    Icb;
+  VOID                              *FileEntry;
+} TEST_DIRECTORY;
+
+typedef struct {
+  UINT32    Block;
+  UINT32    Length;
+} TEST_EXTENT;
+
+//
+// Extents of the extent-mapped file, in file order. The first
+// TEST_FILE_FE_EXTENT_COUNT are recorded in its FE and the others in the AED.
+// Its extent map merges them into blocks 0-2, blocks 5-6 and block 3.
+//
+STATIC CONST TEST_EXTENT  mFileExtents[] = {
+  { 0, 2 * TEST_LOGICAL_BLOCK_SIZE },
+  { 2, TEST_LOGICAL_BLOCK_SIZE },
+  { 5, TEST_LOGICAL_BLOCK_SIZE },
+  { 6, TEST_LOGICAL_BLOCK_SIZE },
+  { 3, TEST_FILE_LAST_EXTENT_SIZE },
+};
+
+typedef struct {
+  UINT64    Position;
+  UINT64    Size;
+} TEST_READ;
+
+//
+// Reads of the extent-mapped file: within an extent, across and from the
+// boundaries of the merged extents, across the AED, and at the end of the file.
+//
+STATIC CONST TEST_READ  mFileReads[] = {
+  { 0, TEST_FILE_SIZE },
+  { TEST_LOGICAL_BLOCK_SIZE - 1, 2 },
+  { 3 * TEST_LOGICAL_BLOCK_SIZE - 1, 2 },
+  { 3 * TEST_LOGICAL_BLOCK_SIZE, TEST_LOGICAL_BLOCK_SIZE },
+  { 2 * TEST_LOGICAL_BLOCK_SIZE + 5, 3 * TEST_LOGICAL_BLOCK_SIZE },
+  { 4 * TEST_LOGICAL_BLOCK_SIZE + 100, TEST_LOGICAL_BLOCK_SIZE + 900 },
+  { TEST_FILE_SIZE - 10, 100 },
+  { TEST_FILE_SIZE, 10 },
+};
+
+STATIC UINT8                           mImage[(TEST_DIRECTORY_COUNT + 1 + TEST_FILE_BLOCK_COUNT) * TEST_LOGICAL_BLOCK_SIZE];
+STATIC UINTN                           mReadCount;
+STATIC EFI_BLOCK_IO_MEDIA              mMedia;
+STATIC UDF_VOLUME_INFO                 mVolume;
+STATIC TEST_DIRECTORY                  mDirectories[TEST_DIRECTORY_COUNT];
+STATIC UDF_FILE_IDENTIFIER_DESCRIPTOR  mFileFid;
+STATIC UDF_FILE_INFO                   mFile;
+STATIC UDF_FILE_INFO                   mInlineFile;
+STATIC UDF_EXTENT_MAP                  mExtentMap;
+
+/**
+  Read from the synthetic UDF image.
+
+  @param  This       Protocol instance pointer.
+  @param  MediaId    Id of the media, changes every time the media is replaced.
+  @param  Offset     The starting byte offset to read from.
+  @param  BufferSize Size of Buffer.
+  @param  Buffer     Buffer containing read data.
+
+  @retval EFI_SUCCESS           The data was read correctly from the device.
+  @retval EFI_DEVICE_ERROR      The read hit the unreadable directory.
+  @retval EFI_INVALID_PARAMETER The read request contains LBAs that are not
+                                valid for the device.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockReadDisk (
+  IN EFI_DISK_IO_PROTOCOL  *This,
+  IN UINT32                MediaId,
+  IN UINT64                Offset,
+  IN UINTN                 BufferSize,
+  OUT VOID                 *Buffer
+  )
+{
+  mReadCount++;
+
+  if ((Offset > sizeof (mImage)) || (BufferSize > sizeof (mImage) - Offset)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Offset / TEST_LOGICAL_BLOCK_SIZE == TEST_DIRECTORY_BLOCK (TEST_UNREADABLE_DIRECTORY)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  CopyMem (Buffer, &mImage[Offset], BufferSize);
+  return EFI_SUCCESS;
+}
+
+STATIC EFI_BLOCK_IO_PROTOCOL  mBlockIo = {
+  EFI_BLOCK_IO_PROTOCOL_REVISION,
+  &mMedia
+};
+
+STATIC EFI_DISK_IO_PROTOCOL  mDiskIo = {
+  EFI_DISK_IO_PROTOCOL_REVISION,
+  MockReadDisk
+};
+
+/**
+  Record a FID with an 8-bit OSTA compressed file name.
+
+  @param[out] Buffer                 Where the FID is recorded.
+  @param[in]  FileCharacteristics    Characteristics of the file.
+  @param[in]  Name                   File name, or NULL for the parent FID.
+  @param[in]  CompressionId          OSTA compression ID of the file name.
+
+  @return The length of the recorded FID.
+
+**/
+STATIC
+UINTN
+RecordFid (
+  OUT UINT8        *Buffer,
+  IN  UINT8        FileCharacteristics,
+  IN  CONST CHAR8  *Name,
+  IN  UINT8        CompressionId
+  )
+{
+  UDF_FILE_IDENTIFIER_DESCRIPTOR  *Fid;
+  UINTN                           NameLength;
+
+  Fid                              = (UDF_FILE_IDENTIFIER_DESCRIPTOR *)Buffer;
+  Fid->DescriptorTag.TagIdentifier = UdfFileIdentifierDescriptor;
+  Fid->FileVersionNumber           = 1;
+  Fid->FileCharacteristics         = FileCharacteristics;
+  Fid->LengthOfFileIdentifier      = 0;
+  Fid->LengthOfImplementationUse   = 0;
+  Fid->Icb.ExtentLength            = TEST_LOGICAL_BLOCK_SIZE;
+
+  if (Name != NULL) {
+    NameLength   = AsciiStrLen (Name);
+    Fid->Data[0] = CompressionId;
+    CopyMem (&Fid->Data[1], Name, NameLength);
+    Fid->LengthOfFileIdentifier = (UINT8)(NameLength + 1);
+  }
+
+  //
+  // FIDs are padded to a multiple of four bytes.
+  //
+  return ALIGN_VALUE (
+           OFFSET_OF (UDF_FILE_IDENTIFIER_DESCRIPTOR, Data[0]) +
+           Fid->LengthOfFileIdentifier +
+           Fid->LengthOfImplementationUse,
+           4
+           );
+}
+
+/**
+  Record the FIDs of a directory in the synthetic image and build the FE
+  pointing to them.
+
+  @param[in] Directory    Index of the directory.
+
+**/
+STATIC
+VOID
+RecordDirectory (
+  IN UINTN  Directory
+  )
+{
+  UINT8                            *Data;
+  UINTN                            Length;
+  UINTN                            Index;
+  CHAR8                            Name[UDF_FILENAME_LENGTH];
+  UDF_FILE_ENTRY                   *FileEntry;
+  UDF_SHORT_ALLOCATION_DESCRIPTOR  *ShortAd;
+
+  Data   = &mImage[TEST_DIRECTORY_BLOCK (Directory) * TEST_LOGICAL_BLOCK_SIZE];
+  Length = RecordFid (Data, DIRECTORY_FILE | PARENT_FILE, NULL, 8);
+  for (Index = 0; Index < TEST_FILES_PER_DIRECTORY; Index++) {
+    AsciiSPrint (Name, sizeof (Name), "Dir%uFile%u", (UINT32)Directory, (UINT32)Index);
+    Length += RecordFid (
+                Data + Length,
+                0,
+                Name,
+                ((Directory == TEST_CORRUPTED_DIRECTORY) && (Index == 3)) ? 0xFF : 8
+                );
+  }
+
+  FileEntry                                = AllocateZeroPool (TEST_LOGICAL_BLOCK_SIZE);
+  FileEntry->DescriptorTag.TagIdentifier   = UdfFileEntry;
+  FileEntry->IcbTag.FileType               = UdfFileEntryDirectory;
+  FileEntry->IcbTag.Flags                  = ShortAdsSequence;
+  FileEntry->InformationLength             = Length;
+  FileEntry->LengthOfExtendedAttributes    = 0;
+  FileEntry->LengthOfAllocationDescriptors = sizeof (UDF_SHORT_ALLOCATION_DESCRIPTOR);
+
+  ShortAd                 = (UDF_SHORT_ALLOCATION_DESCRIPTOR *)FileEntry->Data;
+  ShortAd->ExtentLength   = (UINT32)Length;
+  ShortAd->ExtentPosition = (UINT32)TEST_DIRECTORY_BLOCK (Directory);
+
+  mDirectories[Directory].FileEntry                                   = FileEntry;
+  mDirectories[Directory].Icb.ExtentLength                            = TEST_LOGICAL_BLOCK_SIZE;
+  mDirectories[Directory].Icb.ExtentLocation.LogicalBlockNumber       = (UINT32)(TEST_DIRECTORY_ICB_BASE + Directory);
+  mDirectories[Directory].Icb.ExtentLocation.PartitionReferenceNumber = 0;
+}
+
+/**
+  Record the extent-mapped file and the inline file in the synthetic image, and
+  build their FEs.
+
+**/
+STATIC
+VOID
+RecordFiles (
+  VOID
+  )
+{
+  UDF_FILE_ENTRY                    *FileEntry;
+  UDF_SHORT_ALLOCATION_DESCRIPTOR   *ShortAd;
+  UDF_ALLOCATION_EXTENT_DESCRIPTOR  *Aed;
+  UINT8                             *Data;
+  UINT64                            FilePosition;
+  UINTN                             Offset;
+  UINTN                             Index;
+
+  FileEntry                                = AllocateZeroPool (TEST_LOGICAL_BLOCK_SIZE);
+  FileEntry->DescriptorTag.TagIdentifier   = UdfFileEntry;
+  FileEntry->IcbTag.FileType               = UdfFileEntryStandardFile;
+  FileEntry->IcbTag.Flags                  = ShortAdsSequence;
+  FileEntry->InformationLength             = TEST_FILE_SIZE;
+  FileEntry->LengthOfExtendedAttributes    = 0;
+  FileEntry->LengthOfAllocationDescriptors = (TEST_FILE_FE_EXTENT_COUNT + 1) * sizeof (UDF_SHORT_ALLOCATION_DESCRIPTOR);
+
+  Aed                                = (UDF_ALLOCATION_EXTENT_DESCRIPTOR *)&mImage[TEST_FILE_BLOCK (TEST_FILE_AED_BLOCK) * TEST_LOGICAL_BLOCK_SIZE];
+  Aed->DescriptorTag.TagIdentifier   = UdfAllocationExtentDescriptor;
+  Aed->LengthOfAllocationDescriptors = (ARRAY_SIZE (mFileExtents) - TEST_FILE_FE_EXTENT_COUNT) * sizeof (UDF_SHORT_ALLOCATION_DESCRIPTOR);
+
+  ShortAd      = (UDF_SHORT_ALLOCATION_DESCRIPTOR *)FileEntry->Data;
+  FilePosition = 0;
+  for (Index = 0; Index < ARRAY_SIZE (mFileExtents); Index++) {
+    if (Index == TEST_FILE_FE_EXTENT_COUNT) {
+      //
+      // The next extents are recorded in the AED.
+      //
+      ShortAd->ExtentLength   = ((UINT32)ExtentIsNextExtent << 30) | TEST_LOGICAL_BLOCK_SIZE;
+      ShortAd->ExtentPosition = TEST_FILE_BLOCK (TEST_FILE_AED_BLOCK);
+      ShortAd                 = (UDF_SHORT_ALLOCATION_DESCRIPTOR *)(Aed + 1);
+    }
+
+    ShortAd->ExtentLength   = mFileExtents[Index].Length;
+    ShortAd->ExtentPosition = TEST_FILE_BLOCK (mFileExtents[Index].Block);
+
+    Data = &mImage[ShortAd->ExtentPosition * TEST_LOGICAL_BLOCK_SIZE];
+    for (Offset = 0; Offset < mFileExtents[Index].Length; Offset++) {
+      Data[Offset] = TEST_FILE_BYTE (FilePosition);
+      FilePosition++;
+    }
+
+    ShortAd++;
+  }
+
+  mFileFid.DescriptorTag.TagIdentifier = UdfFileIdentifierDescriptor;
+  mFileFid.Icb.ExtentLength            = TEST_LOGICAL_BLOCK_SIZE;
+
+  mFile.FileEntry          = FileEntry;
+  mFile.FileIdentifierDesc = &mFileFid;
+
+  //
+  // The data of the inline file is recorded in its FE.
+  //
+  FileEntry                                = AllocateZeroPool (TEST_LOGICAL_BLOCK_SIZE);
+  FileEntry->DescriptorTag.TagIdentifier   = UdfFileEntry;
+  FileEntry->IcbTag.FileType               = UdfFileEntryStandardFile;
+  FileEntry->IcbTag.Flags                  = InlineData;
+  FileEntry->InformationLength             = TEST_INLINE_FILE_SIZE;
+  FileEntry->LengthOfExtendedAttributes    = 0;
+  FileEntry->LengthOfAllocationDescriptors = TEST_INLINE_FILE_SIZE;
+  for (Offset = 0; Offset < TEST_INLINE_FILE_SIZE; Offset++) {
+    FileEntry->Data[Offset] = TEST_FILE_BYTE (Offset);
+  }
+
+  mInlineFile.FileEntry          = FileEntry;
+  mInlineFile.FileIdentifierDesc = &mFileFid;
+}
+
+/**
+  Build the synthetic UDF image and the volume information describing it.
+
+**/
+STATIC
+VOID
+BuildImage (
+  VOID
+  )
+{
+  UINTN  Directory;
+
+  ZeroMem (mImage, sizeof (mImage));
+  ZeroMem (&mVolume, sizeof (mVolume));
+
+  //
+  // A single type 1 partition starting at logical block 0.
+  //
+  mVolume.MainVdsStartLocation                                      = 0;
+  mVolume.LogicalVolDesc.LogicalBlockSize                           = TEST_LOGICAL_BLOCK_SIZE;
+  mVolume.LogicalVolDesc.DomainIdentifier.Suffix.Domain.UdfRevision = 0x0102;
+  mVolume.PartitionDesc.PartitionNumber                             = 0;
+  mVolume.PartitionDesc.PartitionStartingLocation                   = 0;
+  mVolume.FileEntrySize                                             = TEST_LOGICAL_BLOCK_SIZE;
+
+  for (Directory = 0; Directory < TEST_DIRECTORY_COUNT; Directory++) {
+    RecordDirectory (Directory);
+  }
+
+  RecordFiles ();
+}
+
+/**
+  Look a file up in a directory of the synthetic image.
+
+  @param[in] Directory    Index of the directory.
+  @param[in] File         Index of the file, or TEST_FILES_PER_DIRECTORY for a
+                          file that does not exist.
+
+  @return The status returned by FindFidFromDirectoryIndex().
+
+**/
+STATIC
+EFI_STATUS
+LookUp (
+  IN UINTN  Directory,
+  IN UINTN  File
+  )
+{
+  EFI_STATUS                      Status;
+  CHAR16                          FileName[UDF_FILENAME_LENGTH];
+  CHAR16                          FoundFileName[UDF_FILENAME_LENGTH];
+  UDF_FILE_IDENTIFIER_DESCRIPTOR  *FoundFid;
+
+  UnicodeSPrint (FileName, sizeof (FileName), L"Dir%uFile%u", (UINT32)Directory, (UINT32)File);
+
+  FoundFid = NULL;
+  Status   = FindFidFromDirectoryIndex (
+               &mBlockIo,
+               &mDiskIo,
+               &mVolume,
+               &mDirectories[Directory].Icb,
+               mDirectories[Directory].FileEntry,
+               FileName,
+               &FoundFid
+               );
+  if (!EFI_ERROR (Status)) {
+    //
+    // The FID found must be the one of the file looked up.
+    //
+    if (EFI_ERROR (GetFileNameFromFid (FoundFid, ARRAY_SIZE (FoundFileName), FoundFileName)) ||
+        (StrCmp (FileName, FoundFileName) != 0))
+    {
+      Status = EFI_VOLUME_CORRUPTED;
+    }
+
+    FreePool (FoundFid);
+  }
+
+  return Status;
+}
+
+/**
+  Read a test file and check the data read.
+
+  @param[in]      File         The extent-mapped file or the inline file.
+  @param[in]      FileSize     Size of the file.
+  @param[in]      Position     File position to read from.
+  @param[in]      Size         Number of bytes to read.
+  @param[in, out] ExtentMap    Extent map of the file, or NULL to walk its
+                               allocation descriptors.
+
+  @return The status returned by ReadFileData(), or EFI_VOLUME_CORRUPTED if the
+          data read is not the data of the file.
+
+**/
+STATIC
+EFI_STATUS
+ReadTestFile (
+  IN     UDF_FILE_INFO   *File,
+  IN     UINT64          FileSize,
+  IN     UINT64          Position,
+  IN     UINT64          Size,
+  IN OUT UDF_EXTENT_MAP  *ExtentMap OPTIONAL
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Buffer;
+  UINT64      FilePosition;
+  UINT64      BufferSize;
+  UINT64      Offset;
+
+  Buffer = AllocatePool ((UINTN)MAX (Size, 1));
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  FilePosition = Position;
+  BufferSize   = Size;
+  Status       = ReadFileData (
+                   &mBlockIo,
+                   &mDiskIo,
+                   &mVolume,
+                   File,
+                   FileSize,
+                   &FilePosition,
+                   Buffer,
+                   &BufferSize,
+                   ExtentMap
+                   );
+  if (!EFI_ERROR (Status)) {
+    //
+    // Reads are truncated at the end of the file.
+    //
+    if ((BufferSize != MIN (Size, FileSize - Position)) ||
+        (FilePosition != Position + BufferSize))
+    {
+      Status = EFI_VOLUME_CORRUPTED;
+    }
+
+    for (Offset = 0; Offset < BufferSize; Offset++) {
+      if (Buffer[Offset] != TEST_FILE_BYTE (Position + Offset)) {
+        Status = EFI_VOLUME_CORRUPTED;
+        break;
+      }
+    }
+  }
+
+  FreePool (Buffer);
+  return Status;
+}
+
+/**
+  Empty the directory index cache before a test.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED    Always.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ResetCache (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CleanupDirectoryIndexCache (&mVolume);
+  mReadCount = 0;
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Empty the directory index cache after a test.
+
+  @param[in]  Context    Unused.
+
+**/
+STATIC
+VOID
+EFIAPI
+CleanupCache (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CleanupDirectoryIndexCache (&mVolume);
+}
+
+/**
+  The first lookup in a directory reads it, and the next ones are served from
+  its cached index, whether or not the file exists.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestCacheMissThenHit (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  File;
+
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (0, 5));
+  UT_ASSERT_EQUAL (mReadCount, 1);
+
+  for (File = 0; File < TEST_FILES_PER_DIRECTORY; File++) {
+    UT_ASSERT_NOT_EFI_ERROR (LookUp (0, File));
+  }
+
+  UT_ASSERT_STATUS_EQUAL (LookUp (0, TEST_FILES_PER_DIRECTORY), EFI_NOT_FOUND);
+  UT_ASSERT_EQUAL (mReadCount, 1);
+
+  //
+  // Another directory misses and is indexed next to the first one.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (1, 0));
+  UT_ASSERT_EQUAL (mReadCount, 2);
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (0, 9));
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (1, 9));
+  UT_ASSERT_EQUAL (mReadCount, 2);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  With the cache full, indexing another directory drops the least recently
+  used index only.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestLeastRecentlyUsedEvicted (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Directory;
+
+  for (Directory = 0; Directory < UDF_DIRECTORY_INDEX_CACHE_SIZE; Directory++) {
+    UT_ASSERT_NOT_EFI_ERROR (LookUp (Directory, 0));
+  }
+
+  UT_ASSERT_EQUAL (mReadCount, UDF_DIRECTORY_INDEX_CACHE_SIZE);
+
+  //
+  // Directory 0 is used again, leaving directory 1 as the least recently used.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (0, 1));
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (UDF_DIRECTORY_INDEX_CACHE_SIZE, 0));
+  UT_ASSERT_EQUAL (mReadCount, UDF_DIRECTORY_INDEX_CACHE_SIZE + 1);
+
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (0, 2));
+  for (Directory = 2; Directory <= UDF_DIRECTORY_INDEX_CACHE_SIZE; Directory++) {
+    UT_ASSERT_NOT_EFI_ERROR (LookUp (Directory, 1));
+  }
+
+  UT_ASSERT_EQUAL (mReadCount, UDF_DIRECTORY_INDEX_CACHE_SIZE + 1);
+
+  UT_ASSERT_NOT_EFI_ERROR (LookUp (1, 1));
+  UT_ASSERT_EQUAL (mReadCount, UDF_DIRECTORY_INDEX_CACHE_SIZE + 2);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  A directory that cannot be indexed, because its data cannot be read or has
+  a corrupted FID, leaves the cached indexes in place.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestFailedIndexKeepsCache (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Directory;
+  UINTN  ReadCount;
+
+  for (Directory = 0; Directory < UDF_DIRECTORY_INDEX_CACHE_SIZE; Directory++) {
+    UT_ASSERT_NOT_EFI_ERROR (LookUp (Directory, 0));
+  }
+
+  UT_ASSERT_STATUS_EQUAL (LookUp (TEST_UNREADABLE_DIRECTORY, 0), EFI_UNSUPPORTED);
+  UT_ASSERT_STATUS_EQUAL (LookUp (TEST_CORRUPTED_DIRECTORY, 0), EFI_UNSUPPORTED);
+
+  ReadCount = mReadCount;
+  for (Directory = 0; Directory < UDF_DIRECTORY_INDEX_CACHE_SIZE; Directory++) {
+    UT_ASSERT_NOT_EFI_ERROR (LookUp (Directory, 1));
+  }
+
+  UT_ASSERT_EQUAL (mReadCount, ReadCount);
+
+  //
+  // A failed directory is not cached either; it is read again on every lookup.
+  //
+  UT_ASSERT_STATUS_EQUAL (LookUp (TEST_CORRUPTED_DIRECTORY, 0), EFI_UNSUPPORTED);
+  UT_ASSERT_EQUAL (mReadCount, ReadCount + 1);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Drop the extent map of the test files before a test.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED    Always.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ResetExtentMap (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CleanupExtentMap (&mExtentMap);
+  mReadCount = 0;
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Drop the extent map of the test files after a test.
+
+  @param[in]  Context    Unused.
+
+**/
+STATIC
+VOID
+EFIAPI
+CleanupTestExtentMap (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CleanupExtentMap (&mExtentMap);
+}
+
+/**
+  The first read of a file builds its extent map, merging the physically
+  contiguous extents of its FE and of its AED, and the next reads issue one
+  disk read per merged extent.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestExtentMapMergesExtents (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  ReadCount;
+
+  UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mFile, TEST_FILE_SIZE, 0, 1, &mExtentMap));
+  UT_ASSERT_NOT_NULL (mExtentMap.Extents);
+  UT_ASSERT_EQUAL (mExtentMap.Count, 3);
+
+  UT_ASSERT_EQUAL (mExtentMap.Extents[0].FilePosition, 0);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[0].DiskOffset, TEST_FILE_BLOCK (0) * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[0].Length, 3 * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[1].FilePosition, 3 * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[1].DiskOffset, TEST_FILE_BLOCK (5) * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[1].Length, 2 * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[2].FilePosition, 5 * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[2].DiskOffset, TEST_FILE_BLOCK (3) * TEST_LOGICAL_BLOCK_SIZE);
+  UT_ASSERT_EQUAL (mExtentMap.Extents[2].Length, TEST_FILE_LAST_EXTENT_SIZE);
+
+  //
+  // The AED is not read again.
+  //
+  ReadCount = mReadCount;
+  UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mFile, TEST_FILE_SIZE, 0, TEST_FILE_SIZE, &mExtentMap));
+  UT_ASSERT_EQUAL (mReadCount, ReadCount + 3);
+
+  //
+  // A read starting where a merged extent starts only reads that extent.
+  //
+  ReadCount = mReadCount;
+  UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mFile, TEST_FILE_SIZE, 3 * TEST_LOGICAL_BLOCK_SIZE, 10, &mExtentMap));
+  UT_ASSERT_EQUAL (mReadCount, ReadCount + 1);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Reads through the extent map return the same data as the allocation
+  descriptor walk, across extent boundaries and at the end of the file.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestExtentMapReadsMatchWalk (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < ARRAY_SIZE (mFileReads); Index++) {
+    UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mFile, TEST_FILE_SIZE, mFileReads[Index].Position, mFileReads[Index].Size, &mExtentMap));
+    UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mFile, TEST_FILE_SIZE, mFileReads[Index].Position, mFileReads[Index].Size, NULL));
+  }
+
+  UT_ASSERT_NOT_NULL (mExtentMap.Extents);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  A file whose data is inline in its FE has no extent map and is still read.
+
+  @param[in]  Context    Unused.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestInlineFileHasNoExtentMap (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mInlineFile, TEST_INLINE_FILE_SIZE, 0, TEST_INLINE_FILE_SIZE, &mExtentMap));
+  UT_ASSERT_NOT_EFI_ERROR (ReadTestFile (&mInlineFile, TEST_INLINE_FILE_SIZE, 50, 100, &mExtentMap));
+  UT_ASSERT_TRUE (mExtentMap.Extents == NULL);
+  UT_ASSERT_EQUAL (mExtentMap.Count, 0);
+  UT_ASSERT_EQUAL (mReadCount, 0);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the UDF
+  directory index cache and the file extent maps and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      DirectoryIndexTests;
+  UNIT_TEST_SUITE_HANDLE      ExtentMapTests;
+  UINTN                       Directory;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  BuildImage ();
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the directory index Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&DirectoryIndexTests, Framework, "UDF Directory Index Cache Tests", "UdfDxe.DirectoryIndex", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DirectoryIndexTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------Description--------------Name----------Function--------Pre---Post-------------------Context-----------
+  //
+  AddTestCase (DirectoryIndexTests, "Lookups after the first one hit the cache", "MissThenHit", TestCacheMissThenHit, ResetCache, CleanupCache, NULL);
+  AddTestCase (DirectoryIndexTests, "A full cache drops the least recently used index", "LruEviction", TestLeastRecentlyUsedEvicted, ResetCache, CleanupCache, NULL);
+  AddTestCase (DirectoryIndexTests, "A directory that cannot be indexed evicts nothing", "FailedIndex", TestFailedIndexKeepsCache, ResetCache, CleanupCache, NULL);
+
+  //
+  // Populate the extent map Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&ExtentMapTests, Framework, "UDF Extent Map Tests", "UdfDxe.ExtentMap", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for ExtentMapTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------Description--------------Name----------Function--------Pre---Post-------------------Context-----------
+  //
+  AddTestCase (ExtentMapTests, "The extent map merges contiguous extents", "MergedExtents", TestExtentMapMergesExtents, ResetExtentMap, CleanupTestExtentMap, NULL);
+  AddTestCase (ExtentMapTests, "Extent map reads match the descriptor walk", "ReadsMatchWalk", TestExtentMapReadsMatchWalk, ResetExtentMap, CleanupTestExtentMap, NULL);
+  AddTestCase (ExtentMapTests, "An inline file has no extent map", "InlineFile", TestInlineFileHasNoExtentMap, ResetExtentMap, CleanupTestExtentMap, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  for (Directory = 0; Directory < TEST_DIRECTORY_COUNT; Directory++) {
+    if (mDirectories[Directory].FileEntry != NULL) {
+      FreePool (mDirectories[Directory].FileEntry);
+    }
+  }
+
+  if (mFile.FileEntry != NULL) {
+    FreePool (mFile.FileEntry);
+  }
+
+  if (mInlineFile.FileEntry != NULL) {
+    FreePool (mInlineFile.FileEntry);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
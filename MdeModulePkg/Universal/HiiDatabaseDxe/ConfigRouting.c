@@ -9,6 +9,9 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include "HiiDatabase.h"
 extern HII_DATABASE_PRIVATE_DATA  mPrivate;
 
+LIST_ENTRY  mConfigRoutingCacheList        = INITIALIZE_LIST_HEAD_VARIABLE (mConfigRoutingCacheList);
+CHAR8       *mConfigRoutingPlatformLanguage = NULL;
+
 /**
   Calculate the number of Unicode characters of the incoming Configuration string,
   not including NULL terminator.
@@ -1421,9 +1424,10 @@ InternalGetString (
   }
 
   //
-  // Get the current platform language setting
+  // Get the current platform language setting, which is read once per
+  // ConfigRouting call.
   //
-  GetEfiGlobalVariable2 (L"PlatformLang", (VOID **)&PlatformLanguage, NULL);
+  PlatformLanguage = mConfigRoutingPlatformLanguage;
 
   //
   // Get the best matching language from SupportedLanguages
@@ -1499,10 +1503,6 @@ Error:
     FreePool (SupportedLanguages);
   }
 
-  if (PlatformLanguage != NULL) {
-    FreePool (PlatformLanguage);
-  }
-
   if (BestLanguage != NULL) {
     FreePool (BestLanguage);
   }
@@ -1572,50 +1572,127 @@ BlockArrayCheck (
 }
 
 /**
-  Get form package data from data base.
+  Free a cached parse result.
+
+  @param  Result                 The cached result to be freed.
+
+**/
+VOID
+FreeConfigRoutingCacheResult (
+  IN HII_CONFIG_ROUTING_CACHE_RESULT  *Result
+  )
+{
+  RemoveEntryList (&Result->Entry);
+  if (Result->DevicePath != NULL) {
+    FreePool (Result->DevicePath);
+  }
+
+  if (Result->ConfigHdr != NULL) {
+    FreePool (Result->ConfigHdr);
+  }
+
+  if (Result->ConfigRequest != NULL) {
+    FreePool (Result->ConfigRequest);
+  }
+
+  if (Result->AltCfgResp != NULL) {
+    FreePool (Result->AltCfgResp);
+  }
+
+  FreePool (Result);
+}
+
+/**
+  Drop the cached form package data and parse results of a package list.
+
+  This is a internal function.
+
+  @param  HiiHandle              The package list whose cache is dropped. If it is
+                                 NULL, the cache of all package lists is dropped.
+
+**/
+VOID
+InvalidateConfigRoutingCache (
+  IN EFI_HII_HANDLE  HiiHandle OPTIONAL
+  )
+{
+  LIST_ENTRY                *Link;
+  HII_CONFIG_ROUTING_CACHE  *Cache;
+
+  Link = mConfigRoutingCacheList.ForwardLink;
+  while (Link != &mConfigRoutingCacheList) {
+    Cache = CR (Link, HII_CONFIG_ROUTING_CACHE, Entry, HII_CONFIG_ROUTING_CACHE_SIGNATURE);
+    Link  = Link->ForwardLink;
+    if ((HiiHandle != NULL) && (Cache->HiiHandle != HiiHandle)) {
+      continue;
+    }
+
+    while (!IsListEmpty (&Cache->ResultList)) {
+      FreeConfigRoutingCacheResult (
+        CR (Cache->ResultList.ForwardLink, HII_CONFIG_ROUTING_CACHE_RESULT, Entry, HII_CONFIG_ROUTING_CACHE_RESULT_SIGNATURE)
+        );
+    }
+
+    RemoveEntryList (&Cache->Entry);
+    FreePool (Cache->FormPackage);
+    FreePool (Cache);
+  }
+}
+
+/**
+  Get the cache of a package list, exporting its form packages when the
+  package list is not cached yet.
 
   @param  DataBaseRecord         The DataBaseRecord instance contains the found Hii handle and package.
-  @param  HiiFormPackage         The buffer saves the package data.
-  @param  PackageSize            The buffer size of the package data.
+
+  @return The cache of the package list, or NULL if the form packages can't be exported.
 
 **/
-EFI_STATUS
-GetFormPackageData (
-  IN     HII_DATABASE_RECORD  *DataBaseRecord,
-  IN OUT UINT8                **HiiFormPackage,
-  OUT    UINTN                *PackageSize
+HII_CONFIG_ROUTING_CACHE *
+GetConfigRoutingCache (
+  IN HII_DATABASE_RECORD  *DataBaseRecord
   )
 {
-  EFI_STATUS  Status;
-  UINTN       Size;
-  UINTN       ResultSize;
+  EFI_STATUS                Status;
+  LIST_ENTRY                *Link;
+  HII_CONFIG_ROUTING_CACHE  *Cache;
+  UINTN                     Size;
+  UINTN                     ResultSize;
 
-  if ((DataBaseRecord == NULL) || (HiiFormPackage == NULL) || (PackageSize == NULL)) {
-    return EFI_INVALID_PARAMETER;
+  for (Link = mConfigRoutingCacheList.ForwardLink; Link != &mConfigRoutingCacheList; Link = Link->ForwardLink) {
+    Cache = CR (Link, HII_CONFIG_ROUTING_CACHE, Entry, HII_CONFIG_ROUTING_CACHE_SIGNATURE);
+    if (Cache->HiiHandle == DataBaseRecord->Handle) {
+      return Cache;
+    }
+  }
+
+  Cache = AllocateZeroPool (sizeof (HII_CONFIG_ROUTING_CACHE));
+  if (Cache == NULL) {
+    return NULL;
   }
 
-  Size       = 0;
-  ResultSize = 0;
   //
-  // 0. Get Hii Form Package by HiiHandle
+  // Get Hii Form Package size by HiiHandle
   //
-  Status = ExportFormPackages (
-             &mPrivate,
-             DataBaseRecord->Handle,
-             DataBaseRecord->PackageList,
-             0,
-             Size,
-             HiiFormPackage,
-             &ResultSize
-             );
+  ResultSize = 0;
+  Status     = ExportFormPackages (
+                 &mPrivate,
+                 DataBaseRecord->Handle,
+                 DataBaseRecord->PackageList,
+                 0,
+                 0,
+                 NULL,
+                 &ResultSize
+                 );
   if (EFI_ERROR (Status)) {
-    return Status;
+    FreePool (Cache);
+    return NULL;
   }
 
-  (*HiiFormPackage) = AllocatePool (ResultSize);
-  if (*HiiFormPackage == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    return Status;
+  Cache->FormPackage = AllocatePool (ResultSize);
+  if (Cache->FormPackage == NULL) {
+    FreePool (Cache);
+    return NULL;
   }
 
   //
@@ -1629,16 +1706,211 @@ GetFormPackageData (
                  DataBaseRecord->PackageList,
                  0,
                  Size,
-                 *HiiFormPackage,
+                 Cache->FormPackage,
                  &ResultSize
                  );
   if (EFI_ERROR (Status)) {
-    FreePool (*HiiFormPackage);
+    FreePool (Cache->FormPackage);
+    FreePool (Cache);
+    return NULL;
   }
 
-  *PackageSize = Size;
+  Cache->Signature       = HII_CONFIG_ROUTING_CACHE_SIGNATURE;
+  Cache->HiiHandle       = DataBaseRecord->Handle;
+  Cache->FormPackageSize = Size;
+  InitializeListHead (&Cache->ResultList);
+  InsertTailList (&mConfigRoutingCacheList, &Cache->Entry);
 
-  return Status;
+  return Cache;
+}
+
+/**
+  Read the platform language once for a ConfigRouting call, instead of once
+  for every string got from the string packages.
+
+  The default value of string questions is got in the platform language, so
+  all parse results are dropped when the language is changed.
+
+**/
+VOID
+UpdateConfigRoutingPlatformLanguage (
+  VOID
+  )
+{
+  CHAR8                     *PlatformLanguage;
+  LIST_ENTRY                *Link;
+  HII_CONFIG_ROUTING_CACHE  *Cache;
+
+  GetEfiGlobalVariable2 (L"PlatformLang", (VOID **)&PlatformLanguage, NULL);
+  if ((PlatformLanguage == mConfigRoutingPlatformLanguage) ||
+      ((PlatformLanguage != NULL) && (mConfigRoutingPlatformLanguage != NULL) &&
+       (AsciiStrCmp (PlatformLanguage, mConfigRoutingPlatformLanguage) == 0)))
+  {
+    if (PlatformLanguage != NULL) {
+      FreePool (PlatformLanguage);
+    }
+
+    return;
+  }
+
+  for (Link = mConfigRoutingCacheList.ForwardLink; Link != &mConfigRoutingCacheList; Link = Link->ForwardLink) {
+    Cache = CR (Link, HII_CONFIG_ROUTING_CACHE, Entry, HII_CONFIG_ROUTING_CACHE_SIGNATURE);
+    while (!IsListEmpty (&Cache->ResultList)) {
+      FreeConfigRoutingCacheResult (
+        CR (Cache->ResultList.ForwardLink, HII_CONFIG_ROUTING_CACHE_RESULT, Entry, HII_CONFIG_ROUTING_CACHE_RESULT_SIGNATURE)
+        );
+    }
+  }
+
+  if (mConfigRoutingPlatformLanguage != NULL) {
+    FreePool (mConfigRoutingPlatformLanguage);
+  }
+
+  mConfigRoutingPlatformLanguage = PlatformLanguage;
+}
+
+/**
+  Find the cached parse result for the request <ConfigHdr> of a driver.
+
+  @param  DataBaseRecord         The DataBaseRecord instance contains the found Hii handle and package.
+  @param  DevicePath             Device Path of the driver the request is routed to.
+  @param  ConfigHdr              Request string ConfigHdr. If it is NULL, the result
+                                 for the first found varstore is returned.
+
+  @return The cached result, or NULL if the request has not been parsed yet.
+
+**/
+HII_CONFIG_ROUTING_CACHE_RESULT *
+FindConfigRoutingCacheResult (
+  IN HII_DATABASE_RECORD       *DataBaseRecord,
+  IN EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN EFI_STRING                ConfigHdr
+  )
+{
+  HII_CONFIG_ROUTING_CACHE         *Cache;
+  HII_CONFIG_ROUTING_CACHE_RESULT  *Result;
+  LIST_ENTRY                       *Link;
+  UINTN                            DevicePathSize;
+
+  Cache = GetConfigRoutingCache (DataBaseRecord);
+  if (Cache == NULL) {
+    return NULL;
+  }
+
+  DevicePathSize = GetDevicePathSize (DevicePath);
+  for (Link = Cache->ResultList.ForwardLink; Link != &Cache->ResultList; Link = Link->ForwardLink) {
+    Result = CR (Link, HII_CONFIG_ROUTING_CACHE_RESULT, Entry, HII_CONFIG_ROUTING_CACHE_RESULT_SIGNATURE);
+    if ((GetDevicePathSize (Result->DevicePath) != DevicePathSize) ||
+        (CompareMem (Result->DevicePath, DevicePath, DevicePathSize) != 0))
+    {
+      continue;
+    }
+
+    if (ConfigHdr == NULL) {
+      if (Result->ConfigHdr == NULL) {
+        return Result;
+      }
+    } else if ((Result->ConfigHdr != NULL) && (StrCmp (Result->ConfigHdr, ConfigHdr) == 0)) {
+      return Result;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Record the parse result for the request <ConfigHdr>.
+
+  Failing to record the result is not an error, the request is parsed again
+  the next time.
+
+  @param  DataBaseRecord         The DataBaseRecord instance contains the found Hii handle and package.
+  @param  DevicePath             Device Path of the driver the request is routed to.
+  @param  ConfigHdr              Request string ConfigHdr, it can be NULL.
+  @param  ConfigRequest          The generated full <ConfigRequest>, it can be NULL.
+  @param  AltCfgResp             The generated default <ConfigAltResp>, it can be NULL.
+
+**/
+VOID
+AddConfigRoutingCacheResult (
+  IN HII_DATABASE_RECORD       *DataBaseRecord,
+  IN EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN EFI_STRING                ConfigHdr      OPTIONAL,
+  IN EFI_STRING                ConfigRequest  OPTIONAL,
+  IN EFI_STRING                AltCfgResp     OPTIONAL
+  )
+{
+  HII_CONFIG_ROUTING_CACHE         *Cache;
+  HII_CONFIG_ROUTING_CACHE_RESULT  *Result;
+
+  Cache = GetConfigRoutingCache (DataBaseRecord);
+  if (Cache == NULL) {
+    return;
+  }
+
+  Result = AllocateZeroPool (sizeof (HII_CONFIG_ROUTING_CACHE_RESULT));
+  if (Result == NULL) {
+    return;
+  }
+
+  Result->Signature = HII_CONFIG_ROUTING_CACHE_RESULT_SIGNATURE;
+  InsertTailList (&Cache->ResultList, &Result->Entry);
+
+  Result->DevicePath = AllocateCopyPool (GetDevicePathSize (DevicePath), DevicePath);
+  if (ConfigHdr != NULL) {
+    Result->ConfigHdr = AllocateCopyPool (StrSize (ConfigHdr), ConfigHdr);
+  }
+
+  if (ConfigRequest != NULL) {
+    Result->ConfigRequest = AllocateCopyPool (StrSize (ConfigRequest), ConfigRequest);
+  }
+
+  if (AltCfgResp != NULL) {
+    Result->AltCfgResp = AllocateCopyPool (StrSize (AltCfgResp), AltCfgResp);
+  }
+
+  if ((Result->DevicePath == NULL) ||
+      ((ConfigHdr != NULL) && (Result->ConfigHdr == NULL)) ||
+      ((ConfigRequest != NULL) && (Result->ConfigRequest == NULL)) ||
+      ((AltCfgResp != NULL) && (Result->AltCfgResp == NULL)))
+  {
+    FreeConfigRoutingCacheResult (Result);
+  }
+}
+
+/**
+  Get form package data from data base.
+
+  The returned buffer is owned by the ConfigRouting cache and must not be
+  freed by the caller.
+
+  @param  DataBaseRecord         The DataBaseRecord instance contains the found Hii handle and package.
+  @param  HiiFormPackage         The buffer saves the package data.
+  @param  PackageSize            The buffer size of the package data.
+
+**/
+EFI_STATUS
+GetFormPackageData (
+  IN     HII_DATABASE_RECORD  *DataBaseRecord,
+  IN OUT UINT8                **HiiFormPackage,
+  OUT    UINTN                *PackageSize
+  )
+{
+  HII_CONFIG_ROUTING_CACHE  *Cache;
+
+  if ((DataBaseRecord == NULL) || (HiiFormPackage == NULL) || (PackageSize == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Cache = GetConfigRoutingCache (DataBaseRecord);
+  if (Cache == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  *HiiFormPackage = Cache->FormPackage;
+  *PackageSize    = Cache->FormPackageSize;
+
+  return EFI_SUCCESS;
 }
 
 /**
@@ -1775,10 +2047,6 @@ GetVarStoreType (
   }
 
 Done:
-  if (HiiFormPackage != NULL) {
-    FreePool (HiiFormPackage);
-  }
-
   return Status;
 }
 
@@ -2007,10 +2275,6 @@ IsThisPackageList (
   }
 
 Done:
-  if (HiiFormPackage != NULL) {
-    FreePool (HiiFormPackage);
-  }
-
   if (VarStoreName != NULL) {
     FreePool (VarStoreName);
   }
@@ -4204,6 +4468,10 @@ GetFullStringFromHiiFormPackages (
   EFI_STRING           ConfigHdr;
   EFI_STRING           StringPtr;
   EFI_STRING           Progress;
+  EFI_STRING           CacheConfigHdr;
+  BOOLEAN              CacheFill;
+
+  HII_CONFIG_ROUTING_CACHE_RESULT  *CacheResult;
 
   if ((DataBaseRecord == NULL) || (DevicePath == NULL) || (Request == NULL) || (AltCfgResp == NULL)) {
     return EFI_INVALID_PARAMETER;
@@ -4220,6 +4488,8 @@ GetFullStringFromHiiFormPackages (
   HiiFormPackage    = NULL;
   PackageSize       = 0;
   Progress          = *Request;
+  CacheConfigHdr    = NULL;
+  CacheFill         = FALSE;
 
   Status = GetFormPackageData (DataBaseRecord, &HiiFormPackage, &PackageSize);
   if (EFI_ERROR (Status)) {
@@ -4289,6 +4559,45 @@ GetFullStringFromHiiFormPackages (
     }
   }
 
+  //
+  // The request without any request element is fully decided by the IFR data,
+  // so the full request and default value string can be got from the cache.
+  //
+  if (StringPtr == NULL) {
+    CacheResult = FindConfigRoutingCacheResult (DataBaseRecord, DevicePath, *Request);
+    if (CacheResult != NULL) {
+      if (CacheResult->ConfigRequest != NULL) {
+        StringPtr = AllocateCopyPool (StrSize (CacheResult->ConfigRequest), CacheResult->ConfigRequest);
+        if (StringPtr == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto Done;
+        }
+
+        if (*Request != NULL) {
+          FreePool (*Request);
+        }
+
+        *Request = StringPtr;
+      }
+
+      if (CacheResult->AltCfgResp != NULL) {
+        DefaultAltCfgResp = AllocateCopyPool (StrSize (CacheResult->AltCfgResp), CacheResult->AltCfgResp);
+        if (DefaultAltCfgResp == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto Done;
+        }
+      }
+
+      goto MergeAltCfgResp;
+    }
+
+    if (*Request != NULL) {
+      CacheConfigHdr = AllocateCopyPool (StrSize (*Request), *Request);
+    }
+
+    CacheFill = (BOOLEAN)((*Request == NULL) || (CacheConfigHdr != NULL));
+  }
+
   //
   // Initialize DefaultIdArray to store the map between DeaultId and DefaultName
   //
@@ -4336,6 +4645,10 @@ GetFullStringFromHiiFormPackages (
   // No requested varstore in IFR data and directly return
   //
   if ((VarStorageData->Type == 0) && (VarStorageData->Name == NULL)) {
+    if (CacheFill) {
+      AddConfigRoutingCacheResult (DataBaseRecord, DevicePath, CacheConfigHdr, NULL, NULL);
+    }
+
     Status = EFI_SUCCESS;
     goto Done;
   }
@@ -4350,6 +4663,10 @@ GetFullStringFromHiiFormPackages (
 
   if (RequestBlockArray == NULL) {
     if (!GenerateConfigRequest (ConfigHdr, VarStorageData, &Status, Request)) {
+      if (CacheFill && !EFI_ERROR (Status)) {
+        AddConfigRoutingCacheResult (DataBaseRecord, DevicePath, CacheConfigHdr, NULL, NULL);
+      }
+
       goto Done;
     }
   }
@@ -4364,6 +4681,11 @@ GetFullStringFromHiiFormPackages (
     goto Done;
   }
 
+  if (CacheFill) {
+    AddConfigRoutingCacheResult (DataBaseRecord, DevicePath, CacheConfigHdr, *Request, DefaultAltCfgResp);
+  }
+
+MergeAltCfgResp:
   //
   // 5. Merge string into the input AltCfgResp if the input *AltCfgResp is not NULL.
   //
@@ -4443,11 +4765,8 @@ Done:
     FreePool (ConfigHdr);
   }
 
-  //
-  // Free Package data
-  //
-  if (HiiFormPackage != NULL) {
-    FreePool (HiiFormPackage);
+  if (CacheConfigHdr != NULL) {
+    FreePool (CacheConfigHdr);
   }
 
   if (PointerProgress != NULL) {
@@ -4872,6 +5191,8 @@ HiiConfigRoutingExtractConfig (
     return EFI_INVALID_PARAMETER;
   }
 
+  UpdateConfigRoutingPlatformLanguage ();
+
   Private              = CONFIG_ROUTING_DATABASE_PRIVATE_DATA_FROM_THIS (This);
   StringPtr            = Request;
   *Progress            = StringPtr;
@@ -5252,6 +5573,8 @@ HiiConfigRoutingExportConfig (
     return EFI_INVALID_PARAMETER;
   }
 
+  UpdateConfigRoutingPlatformLanguage ();
+
   Private = CONFIG_ROUTING_DATABASE_PRIVATE_DATA_FROM_THIS (This);
 
   //
@@ -5463,6 +5786,8 @@ HiiConfigRoutingRouteConfig (
     return EFI_INVALID_PARAMETER;
   }
 
+  UpdateConfigRoutingPlatformLanguage ();
+
   Private         = CONFIG_ROUTING_DATABASE_PRIVATE_DATA_FROM_THIS (This);
   StringPtr       = Configuration;
   *Progress       = StringPtr;
@@ -3417,7 +3417,9 @@ HiiGetConfigRespInfo (
   //
   // Get ConfigResp string
   //
+  PERF_INMODULE_BEGIN ("HiiExportConfig");
   Status = HiiConfigRoutingExportConfig (&Private->ConfigRouting, &ConfigAltResp);
+  PERF_INMODULE_END ("HiiExportConfig");
 
   if (!EFI_ERROR (Status)) {
     ConfigSize = StrSize (ConfigAltResp);
@@ -3743,6 +3745,8 @@ HiiRemovePackageList (
         return Status;
       }
 
+      InvalidateConfigRoutingCache (Handle);
+
       //
       // Free resources of the package list
       //
@@ -3895,6 +3899,7 @@ HiiUpdatePackageList (
       // Add all of the packages within the new package list
       //
       Status = AddPackages (Private, EFI_HII_DATABASE_NOTIFY_ADD_PACK, PackageList, Node);
+      InvalidateConfigRoutingCache (Handle);
 
       //
       // Check whether need to get the Database info.
@@ -40,6 +40,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/PcdLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
 #include <Library/PrintLib.h>
+#include <Library/PerformanceLib.h>
 
 #define MAX_STRING_LENGTH      1024
 #define MAX_FONT_NAME_LEN      256
@@ -146,6 +147,36 @@ typedef struct {
   UINT16            Size;
 } HII_FORMSET_STORAGE;
 
+//
+// ConfigRouting cache definitions
+//
+// The exported form packages of a package list and the full request/default
+// strings generated from them by ParseIfrData () are kept here, so repeated
+// ExtractConfig ()/ExportConfig () calls on the same package list do not have
+// to export and parse the IFR again. Results are keyed on the device path and
+// <ConfigHdr> of the request. The cache is dropped whenever the package list or
+// its strings are updated, or when PlatformLang changes.
+//
+#define HII_CONFIG_ROUTING_CACHE_SIGNATURE  SIGNATURE_32 ('h','c','r','c')
+typedef struct {
+  UINTN             Signature;
+  LIST_ENTRY        Entry;
+  EFI_HII_HANDLE    HiiHandle;
+  UINT8             *FormPackage;      // Exported form packages of this package list
+  UINTN             FormPackageSize;
+  LIST_ENTRY        ResultList;        // HII_CONFIG_ROUTING_CACHE_RESULT list
+} HII_CONFIG_ROUTING_CACHE;
+
+#define HII_CONFIG_ROUTING_CACHE_RESULT_SIGNATURE  SIGNATURE_32 ('h','c','r','r')
+typedef struct {
+  UINTN                       Signature;
+  LIST_ENTRY                  Entry;
+  EFI_DEVICE_PATH_PROTOCOL    *DevicePath;   // Device Path of the driver the request is routed to
+  EFI_STRING                  ConfigHdr;     // Request <ConfigHdr>, NULL for the first varstore
+  EFI_STRING                  ConfigRequest; // Full <ConfigRequest>, NULL if no request is generated
+  EFI_STRING                  AltCfgResp;    // Default <ConfigAltResp>, NULL if no default is found
+} HII_CONFIG_ROUTING_CACHE_RESULT;
+
 //
 // String Package definitions
 //
@@ -405,6 +436,20 @@ GenerateSubStr (
   OUT EFI_STRING       *SubStr
   );
 
+/**
+  Drop the cached form package data and parse results of a package list.
+
+  This is a internal function.
+
+  @param  HiiHandle              The package list whose cache is dropped. If it is
+                                 NULL, the cache of all package lists is dropped.
+
+**/
+VOID
+InvalidateConfigRoutingCache (
+  IN EFI_HII_HANDLE  HiiHandle OPTIONAL
+  );
+
 /**
   This function checks whether a handle is a valid EFI_HII_HANDLE.
 
@@ -1802,6 +1802,11 @@ HiiSetString (
         }
 
         PackageListNode->PackageListHdr.PackageLength += StringPackage->StringPkgHdr->Header.Length - OldPackageLen;
+        //
+        // The default value of string questions may refer to the updated string.
+        //
+        InvalidateConfigRoutingCache (PackageList);
+
         //
         // Check whether need to get the contents of HiiDataBase.
         // Only after ReadyToBoot to do the export.
@@ -0,0 +1,949 @@
+/** @file
+  Host-based unit tests of the ConfigRouting parse cache of HiiDatabaseDxe.
+
+  The tests register a large form set for two drivers behind mock boot and
+  runtime services. They check that ExportConfig() returns the same
+  <MultiConfigAltResp> whether or not the form set is cached, keeps the results
+  of the drivers apart, reads PlatformLang once per call and follows a change
+  of PlatformLang. They also measure ExportConfig() with and without the cache.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include "../HiiDatabase.h"
+
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+#define UNIT_TEST_APP_NAME     "HiiDatabaseDxe ConfigRouting Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// The form set holds one byte numeric questions followed by string questions,
+// all of them with a default value and all of them in one buffer varstore.
+//
+#define TEST_NUMERIC_COUNT     500
+#define TEST_STRING_COUNT      50
+#define TEST_STRING_MAX_SIZE   8
+#define TEST_VARSTORE_SIZE     (TEST_NUMERIC_COUNT + TEST_STRING_COUNT * TEST_STRING_MAX_SIZE * sizeof (CHAR16))
+#define TEST_VARSTORE_ID       1
+#define TEST_VARSTORE_NAME     "Bench"
+#define TEST_PACKAGE_LIST_MAX  SIZE_128KB
+
+#define TEST_STRING_ID_LANGUAGE  1
+#define TEST_STRING_ID_TITLE     2
+#define TEST_STRING_ID_DEFAULT   3
+
+#define TEST_DRIVER_COUNT     2
+#define TEST_BENCHMARK_CALLS  10
+
+typedef struct {
+  VENDOR_DEVICE_PATH          Vendor;
+  EFI_DEVICE_PATH_PROTOCOL    End;
+} TEST_DEVICE_PATH;
+
+typedef struct {
+  EFI_HII_CONFIG_ACCESS_PROTOCOL    ConfigAccess;
+  TEST_DEVICE_PATH                  DevicePath;
+  EFI_HII_HANDLE                    HiiHandle;
+  UINT8                             Buffer[TEST_VARSTORE_SIZE];
+} TEST_DRIVER;
+
+extern HII_DATABASE_PRIVATE_DATA  mPrivate;
+
+VOID
+EFIAPI
+HiiToLower (
+  IN EFI_STRING  ConfigString
+  );
+
+STATIC EFI_BOOT_SERVICES     mBootServices;
+STATIC EFI_RUNTIME_SERVICES  mRuntimeServices;
+STATIC TEST_DRIVER           mDrivers[TEST_DRIVER_COUNT];
+STATIC UINT8                 *mPackageList;
+STATIC UINTN                 mPackageListSize;
+STATIC CHAR8                 *mPlatformLang;
+STATIC UINTN                 mPlatformLangReads;
+
+STATIC EFI_GUID  mPackageListGuid = {
+  0x5c1f5d73, 0x1a6e, 0x4d0e, { 0x9c, 0x3a, 0x7e, 0x1b, 0x2d, 0x44, 0x6f, 0x90 }
+};
+STATIC EFI_GUID  mVarStoreGuid = {
+  0x8a3e2f41, 0x6d2b, 0x4c7a, { 0xb5, 0x0e, 0x13, 0x9f, 0x62, 0xd4, 0x7a, 0x05 }
+};
+
+STATIC CONST CHAR16  *mEnglishStrings[] = {
+  L"English",
+  L"Benchmark",
+  L"Default"
+};
+STATIC CONST CHAR16  *mFrenchStrings[] = {
+  L"Francais",
+  L"Banc",
+  L"Defaut"
+};
+
+/**
+  The mock services run at TPL_APPLICATION.
+
+  @param  NewTpl  The TPL to raise to.
+
+  @return TPL_APPLICATION.
+
+**/
+STATIC
+EFI_TPL
+EFIAPI
+MockRaiseTpl (
+  IN EFI_TPL  NewTpl
+  )
+{
+  return TPL_APPLICATION;
+}
+
+/**
+  The mock services run at TPL_APPLICATION.
+
+  @param  OldTpl  The TPL to restore.
+
+**/
+STATIC
+VOID
+EFIAPI
+MockRestoreTpl (
+  IN EFI_TPL  OldTpl
+  )
+{
+}
+
+/**
+  The handle of a test driver is its TEST_DRIVER, which carries the
+  ConfigAccess and Device Path protocols.
+
+  @param  Handle     The handle of a test driver.
+  @param  Protocol   The protocol to get.
+  @param  Interface  Returns the protocol interface.
+
+  @retval EFI_SUCCESS      The protocol is on the handle.
+  @retval EFI_UNSUPPORTED  The protocol is not on the handle.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockHandleProtocol (
+  IN  EFI_HANDLE  Handle,
+  IN  EFI_GUID    *Protocol,
+  OUT VOID        **Interface
+  )
+{
+  TEST_DRIVER  *Driver;
+
+  Driver = (TEST_DRIVER *)Handle;
+  if (CompareGuid (Protocol, &gEfiHiiConfigAccessProtocolGuid)) {
+    *Interface = &Driver->ConfigAccess;
+    return EFI_SUCCESS;
+  }
+
+  if (CompareGuid (Protocol, &gEfiDevicePathProtocolGuid)) {
+    *Interface = &Driver->DevicePath;
+    return EFI_SUCCESS;
+  }
+
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Return the handles of the test drivers, which all carry the ConfigAccess
+  protocol.
+
+  @param  SearchType  Must be ByProtocol.
+  @param  Protocol    Must be gEfiHiiConfigAccessProtocolGuid.
+  @param  SearchKey   Not used.
+  @param  NoHandles   Returns the number of handles.
+  @param  Buffer      Returns the handles.
+
+  @retval EFI_SUCCESS           The handles are returned.
+  @retval EFI_NOT_FOUND         No handle carries the protocol.
+  @retval EFI_OUT_OF_RESOURCES  The handle buffer can't be allocated.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockLocateHandleBuffer (
+  IN     EFI_LOCATE_SEARCH_TYPE  SearchType,
+  IN     EFI_GUID                *Protocol       OPTIONAL,
+  IN     VOID                    *SearchKey      OPTIONAL,
+  OUT    UINTN                   *NoHandles,
+  OUT    EFI_HANDLE              **Buffer
+  )
+{
+  UINTN  Index;
+
+  if ((SearchType != ByProtocol) || !CompareGuid (Protocol, &gEfiHiiConfigAccessProtocolGuid)) {
+    return EFI_NOT_FOUND;
+  }
+
+  *Buffer = AllocatePool (TEST_DRIVER_COUNT * sizeof (EFI_HANDLE));
+  if (*Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < TEST_DRIVER_COUNT; Index++) {
+    (*Buffer)[Index] = (EFI_HANDLE)&mDrivers[Index];
+  }
+
+  *NoHandles = TEST_DRIVER_COUNT;
+  return EFI_SUCCESS;
+}
+
+/**
+  Return PlatformLang and count the reads of it.
+
+  @param  VariableName  The name of the variable.
+  @param  VendorGuid    The vendor of the variable.
+  @param  Attributes    Not used.
+  @param  DataSize      On input the size of Data, on output the size of the variable.
+  @param  Data          Returns the variable.
+
+  @retval EFI_SUCCESS           PlatformLang is returned.
+  @retval EFI_BUFFER_TOO_SMALL  Data is too small for PlatformLang.
+  @retval EFI_NOT_FOUND         The variable is not PlatformLang.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockGetVariable (
+  IN     CHAR16    *VariableName,
+  IN     EFI_GUID  *VendorGuid,
+  OUT    UINT32    *Attributes     OPTIONAL,
+  IN OUT UINTN     *DataSize,
+  OUT    VOID      *Data           OPTIONAL
+  )
+{
+  UINTN  Size;
+
+  if ((StrCmp (VariableName, L"PlatformLang") != 0) || !CompareGuid (VendorGuid, &gEfiGlobalVariableGuid)) {
+    return EFI_NOT_FOUND;
+  }
+
+  Size = AsciiStrSize (mPlatformLang);
+  if (*DataSize < Size) {
+    *DataSize = Size;
+    return EFI_BUFFER_TOO_SMALL;
+  }
+
+  mPlatformLangReads++;
+  *DataSize = Size;
+  CopyMem (Data, mPlatformLang, Size);
+  return EFI_SUCCESS;
+}
+
+/**
+  The test drivers don't build the request for the whole varstore, so
+  ConfigRouting builds it from the form set. The full request is answered from
+  the varstore buffer of the driver.
+
+  @param  This      The ConfigAccess protocol of a test driver.
+  @param  Request   The <ConfigRequest> to answer, or NULL for the whole varstore.
+  @param  Progress  Returns the progress in Request.
+  @param  Results   Returns the <ConfigResp>.
+
+  @retval EFI_SUCCESS    Results is returned.
+  @retval EFI_NOT_FOUND  Request is NULL.
+  @return Others         The status of BlockToConfig().
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockExtractConfig (
+  IN CONST  EFI_HII_CONFIG_ACCESS_PROTOCOL  *This,
+  IN CONST  EFI_STRING                      Request,
+  OUT EFI_STRING                            *Progress,
+  OUT EFI_STRING                            *Results
+  )
+{
+  TEST_DRIVER  *Driver;
+
+  if (Request == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  Driver = BASE_CR (This, TEST_DRIVER, ConfigAccess);
+  return HiiBlockToConfig (
+           &mPrivate.ConfigRouting,
+           Request,
+           Driver->Buffer,
+           TEST_VARSTORE_SIZE,
+           Results,
+           Progress
+           );
+}
+
+/**
+  The test drivers don't take configuration.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockRouteConfig (
+  IN CONST  EFI_HII_CONFIG_ACCESS_PROTOCOL  *This,
+  IN CONST  EFI_STRING                      Configuration,
+  OUT EFI_STRING                            *Progress
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  The test drivers don't take callbacks.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockCallback (
+  IN     CONST EFI_HII_CONFIG_ACCESS_PROTOCOL  *This,
+  IN     EFI_BROWSER_ACTION                    Action,
+  IN     EFI_QUESTION_ID                       QuestionId,
+  IN     UINT8                                 Type,
+  IN OUT EFI_IFR_TYPE_VALUE                    *Value,
+  OUT    EFI_BROWSER_ACTION_REQUEST            *ActionRequest
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Append data to the package list.
+
+  @param  Data  The data to append.
+  @param  Size  The size of Data.
+
+  @return The appended data in the package list.
+
+**/
+STATIC
+VOID *
+AppendToPackageList (
+  IN CONST VOID  *Data,
+  IN UINTN       Size
+  )
+{
+  VOID  *Appended;
+
+  ASSERT (mPackageListSize + Size <= TEST_PACKAGE_LIST_MAX);
+  Appended = mPackageList + mPackageListSize;
+  CopyMem (Appended, Data, Size);
+  mPackageListSize += Size;
+  return Appended;
+}
+
+/**
+  Append an opcode, with the given scope, to the package list.
+
+  @param  OpCode  The opcode to append.
+  @param  Length  The length of the opcode.
+  @param  Scope   The scope of the opcode.
+
+**/
+STATIC
+VOID
+AppendOpCode (
+  IN VOID   *OpCode,
+  IN UINTN  Length,
+  IN UINT8  Scope
+  )
+{
+  ((EFI_IFR_OP_HEADER *)OpCode)->Length = (UINT8)Length;
+  ((EFI_IFR_OP_HEADER *)OpCode)->Scope  = Scope;
+  AppendToPackageList (OpCode, Length);
+}
+
+/**
+  Append an EFI_IFR_END_OP to the package list.
+
+**/
+STATIC
+VOID
+AppendEndOpCode (
+  VOID
+  )
+{
+  EFI_IFR_END  End;
+
+  ZeroMem (&End, sizeof (End));
+  End.Header.OpCode = EFI_IFR_END_OP;
+  AppendOpCode (&End, sizeof (End), 0);
+}
+
+/**
+  Append a string package to the package list.
+
+  @param  Language     The language of the string package.
+  @param  Strings      The strings, starting with string ID 1.
+  @param  StringCount  The number of strings.
+
+**/
+STATIC
+VOID
+AppendStringPackage (
+  IN CONST CHAR8   *Language,
+  IN CONST CHAR16  **Strings,
+  IN UINTN         StringCount
+  )
+{
+  EFI_HII_STRING_PACKAGE_HDR  Header;
+  UINTN                       HeaderOffset;
+  UINT8                       BlockType;
+  UINTN                       Index;
+
+  ZeroMem (&Header, sizeof (Header));
+  Header.Header.Type      = EFI_HII_PACKAGE_STRINGS;
+  Header.HdrSize          = (UINT32)(sizeof (Header) - sizeof (Header.Language) + AsciiStrSize (Language));
+  Header.StringInfoOffset = Header.HdrSize;
+  Header.LanguageName     = TEST_STRING_ID_LANGUAGE;
+
+  HeaderOffset = mPackageListSize;
+  AppendToPackageList (&Header, sizeof (Header) - sizeof (Header.Language));
+  AppendToPackageList (Language, AsciiStrSize (Language));
+
+  BlockType = EFI_HII_SIBT_STRING_UCS2;
+  for (Index = 0; Index < StringCount; Index++) {
+    AppendToPackageList (&BlockType, sizeof (BlockType));
+    AppendToPackageList (Strings[Index], StrSize (Strings[Index]));
+  }
+
+  BlockType = EFI_HII_SIBT_END;
+  AppendToPackageList (&BlockType, sizeof (BlockType));
+
+  ((EFI_HII_PACKAGE_HEADER *)(mPackageList + HeaderOffset))->Length = (UINT32)(mPackageListSize - HeaderOffset);
+}
+
+/**
+  Append the form package of the large form set to the package list.
+
+**/
+STATIC
+VOID
+AppendFormPackage (
+  VOID
+  )
+{
+  EFI_HII_PACKAGE_HEADER  Header;
+  UINTN                   HeaderOffset;
+  UINT8                   OpCode[sizeof (EFI_IFR_FORM_SET) + sizeof (EFI_GUID)];
+  EFI_IFR_FORM_SET        *FormSet;
+  EFI_IFR_DEFAULTSTORE    DefaultStore;
+  UINT8                   VarStoreOpCode[sizeof (EFI_IFR_VARSTORE) + sizeof (TEST_VARSTORE_NAME)];
+  EFI_IFR_VARSTORE        *VarStore;
+  EFI_IFR_FORM            Form;
+  EFI_IFR_NUMERIC         Numeric;
+  EFI_IFR_STRING          String;
+  EFI_IFR_DEFAULT         Default;
+  UINTN                   Index;
+
+  ZeroMem (&Header, sizeof (Header));
+  Header.Type  = EFI_HII_PACKAGE_FORMS;
+  HeaderOffset = mPackageListSize;
+  AppendToPackageList (&Header, sizeof (Header));
+
+  ZeroMem (OpCode, sizeof (OpCode));
+  FormSet                = (EFI_IFR_FORM_SET *)OpCode;
+  FormSet->Header.OpCode = EFI_IFR_FORM_SET_OP;
+  FormSet->FormSetTitle  = TEST_STRING_ID_TITLE;
+  FormSet->Help          = TEST_STRING_ID_TITLE;
+  FormSet->Flags         = 1;
+  CopyGuid (&FormSet->Guid, &mPackageListGuid);
+  CopyGuid ((EFI_GUID *)(FormSet + 1), &gEfiHiiPlatformSetupFormsetGuid);
+  AppendOpCode (OpCode, sizeof (OpCode), 1);
+
+  ZeroMem (&DefaultStore, sizeof (DefaultStore));
+  DefaultStore.Header.OpCode = EFI_IFR_DEFAULTSTORE_OP;
+  DefaultStore.DefaultName   = TEST_STRING_ID_TITLE;
+  DefaultStore.DefaultId     = EFI_HII_DEFAULT_CLASS_STANDARD;
+  AppendOpCode (&DefaultStore, sizeof (DefaultStore), 0);
+
+  ZeroMem (VarStoreOpCode, sizeof (VarStoreOpCode));
+  VarStore                = (EFI_IFR_VARSTORE *)VarStoreOpCode;
+  VarStore->Header.OpCode = EFI_IFR_VARSTORE_OP;
+  VarStore->VarStoreId    = TEST_VARSTORE_ID;
+  VarStore->Size          = (UINT16)TEST_VARSTORE_SIZE;
+  CopyGuid (&VarStore->Guid, &mVarStoreGuid);
+  CopyMem (VarStore->Name, TEST_VARSTORE_NAME, sizeof (TEST_VARSTORE_NAME));
+  AppendOpCode (VarStoreOpCode, OFFSET_OF (EFI_IFR_VARSTORE, Name) + sizeof (TEST_VARSTORE_NAME), 0);
+
+  ZeroMem (&Form, sizeof (Form));
+  Form.Header.OpCode = EFI_IFR_FORM_OP;
+  Form.FormId        = 1;
+  Form.FormTitle     = TEST_STRING_ID_TITLE;
+  AppendOpCode (&Form, sizeof (Form), 1);
+
+  ZeroMem (&Default, sizeof (Default));
+  Default.Header.OpCode = EFI_IFR_DEFAULT_OP;
+  Default.DefaultId     = EFI_HII_DEFAULT_CLASS_STANDARD;
+
+  for (Index = 0; Index < TEST_NUMERIC_COUNT; Index++) {
+    ZeroMem (&Numeric, sizeof (Numeric));
+    Numeric.Header.OpCode                   = EFI_IFR_NUMERIC_OP;
+    Numeric.Question.Header.Prompt          = TEST_STRING_ID_TITLE;
+    Numeric.Question.Header.Help            = TEST_STRING_ID_TITLE;
+    Numeric.Question.QuestionId             = (EFI_QUESTION_ID)(Index + 1);
+    Numeric.Question.VarStoreId             = TEST_VARSTORE_ID;
+    Numeric.Question.VarStoreInfo.VarOffset = (UINT16)Index;
+    Numeric.Flags                           = EFI_IFR_NUMERIC_SIZE_1;
+    Numeric.data.u8.MaxValue                = 0xFF;
+    Numeric.data.u8.Step                    = 1;
+    AppendOpCode (&Numeric, OFFSET_OF (EFI_IFR_NUMERIC, data) + sizeof (Numeric.data.u8), 1);
+
+    Default.Type     = EFI_IFR_TYPE_NUM_SIZE_8;
+    Default.Value.u8 = (UINT8)Index;
+    AppendOpCode (&Default, OFFSET_OF (EFI_IFR_DEFAULT, Value) + sizeof (Default.Value.u8), 0);
+    AppendEndOpCode ();
+  }
+
+  for (Index = 0; Index < TEST_STRING_COUNT; Index++) {
+    ZeroMem (&String, sizeof (String));
+    String.Header.OpCode                   = EFI_IFR_STRING_OP;
+    String.Question.Header.Prompt          = TEST_STRING_ID_TITLE;
+    String.Question.Header.Help            = TEST_STRING_ID_TITLE;
+    String.Question.QuestionId             = (EFI_QUESTION_ID)(TEST_NUMERIC_COUNT + Index + 1);
+    String.Question.VarStoreId             = TEST_VARSTORE_ID;
+    String.Question.VarStoreInfo.VarOffset = (UINT16)(TEST_NUMERIC_COUNT + Index * TEST_STRING_MAX_SIZE * sizeof (CHAR16));
+    String.MaxSize                         = TEST_STRING_MAX_SIZE;
+    AppendOpCode (&String, sizeof (String), 1);
+
+    Default.Type         = EFI_IFR_TYPE_STRING;
+    Default.Value.string = TEST_STRING_ID_DEFAULT;
+    AppendOpCode (&Default, OFFSET_OF (EFI_IFR_DEFAULT, Value) + sizeof (Default.Value.string), 0);
+    AppendEndOpCode ();
+  }
+
+  //
+  // End of the form and of the form set.
+  //
+  AppendEndOpCode ();
+  AppendEndOpCode ();
+
+  ((EFI_HII_PACKAGE_HEADER *)(mPackageList + HeaderOffset))->Length = (UINT32)(mPackageListSize - HeaderOffset);
+}
+
+/**
+  Build the package list of the large form set, with an English and a French
+  string package.
+
+  @retval EFI_SUCCESS           The package list is built.
+  @retval EFI_OUT_OF_RESOURCES  The package list can't be allocated.
+
+**/
+STATIC
+EFI_STATUS
+BuildPackageList (
+  VOID
+  )
+{
+  EFI_HII_PACKAGE_LIST_HEADER  ListHeader;
+  EFI_HII_PACKAGE_HEADER       End;
+
+  mPackageList = AllocateZeroPool (TEST_PACKAGE_LIST_MAX);
+  if (mPackageList == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  mPackageListSize = 0;
+  CopyGuid (&ListHeader.PackageListGuid, &mPackageListGuid);
+  ListHeader.PackageLength = 0;
+  AppendToPackageList (&ListHeader, sizeof (ListHeader));
+
+  AppendFormPackage ();
+  AppendStringPackage ("en-US", mEnglishStrings, ARRAY_SIZE (mEnglishStrings));
+  AppendStringPackage ("fr-FR", mFrenchStrings, ARRAY_SIZE (mFrenchStrings));
+
+  ZeroMem (&End, sizeof (End));
+  End.Type   = EFI_HII_PACKAGE_END;
+  End.Length = sizeof (End);
+  AppendToPackageList (&End, sizeof (End));
+
+  ((EFI_HII_PACKAGE_LIST_HEADER *)mPackageList)->PackageLength = (UINT32)mPackageListSize;
+  return EFI_SUCCESS;
+}
+
+/**
+  Check that a <MultiConfigAltResp> holds the <ConfigHdr> path of a driver.
+
+  @param  Results  The <MultiConfigAltResp> to check.
+  @param  Driver   The test driver.
+
+  @retval TRUE   Results holds the path of the driver.
+  @retval FALSE  Results doesn't hold the path of the driver.
+
+**/
+STATIC
+BOOLEAN
+ResultsHoldDriverPath (
+  IN EFI_STRING   Results,
+  IN TEST_DRIVER  *Driver
+  )
+{
+  CHAR16  Path[sizeof (L"&PATH=") / sizeof (CHAR16) + sizeof (TEST_DEVICE_PATH) * 2];
+  UINT8   *Byte;
+  UINTN   Index;
+
+  StrCpyS (Path, ARRAY_SIZE (Path), L"&PATH=");
+  Byte = (UINT8 *)&Driver->DevicePath;
+  for (Index = 0; Index < sizeof (TEST_DEVICE_PATH); Index++) {
+    UnicodeSPrint (Path + StrLen (Path), (ARRAY_SIZE (Path) - StrLen (Path)) * sizeof (CHAR16), L"%02x", Byte[Index]);
+  }
+
+  HiiToLower (Path);
+  return (BOOLEAN)(StrStr (Results, Path) != NULL);
+}
+
+/**
+  Unregister the form set of the test drivers.
+
+  @param  Context  Not used.
+
+**/
+STATIC
+VOID
+EFIAPI
+UnregisterDrivers (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < TEST_DRIVER_COUNT; Index++) {
+    if (mDrivers[Index].HiiHandle != NULL) {
+      HiiRemovePackageList (&mPrivate.HiiDatabase, mDrivers[Index].HiiHandle);
+      mDrivers[Index].HiiHandle = NULL;
+    }
+  }
+
+  mPlatformLang = "en-US";
+}
+
+/**
+  Register the same form set for each of the test drivers. The drivers have
+  different device paths and different varstore contents.
+
+  @param  Context  Not used.
+
+  @retval UNIT_TEST_PASSED                      The drivers are registered.
+  @retval UNIT_TEST_ERROR_PREREQUISITE_NOT_MET  The form set can't be registered.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+RegisterDrivers (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STATUS   Status;
+  TEST_DRIVER  *Driver;
+  UINTN        Index;
+  UINTN        Offset;
+
+  for (Index = 0; Index < TEST_DRIVER_COUNT; Index++) {
+    Driver = &mDrivers[Index];
+    ZeroMem (Driver, sizeof (*Driver));
+    Driver->ConfigAccess.ExtractConfig = MockExtractConfig;
+    Driver->ConfigAccess.RouteConfig   = MockRouteConfig;
+    Driver->ConfigAccess.Callback      = MockCallback;
+
+    Driver->DevicePath.Vendor.Header.Type    = HARDWARE_DEVICE_PATH;
+    Driver->DevicePath.Vendor.Header.SubType = HW_VENDOR_DP;
+    SetDevicePathNodeLength (&Driver->DevicePath.Vendor.Header, sizeof (VENDOR_DEVICE_PATH));
+    CopyGuid (&Driver->DevicePath.Vendor.Guid, &mVarStoreGuid);
+    Driver->DevicePath.Vendor.Guid.Data1 += (UINT32)Index;
+    SetDevicePathEndNode (&Driver->DevicePath.End);
+
+    for (Offset = 0; Offset < TEST_VARSTORE_SIZE; Offset++) {
+      Driver->Buffer[Offset] = (UINT8)(Offset + Index);
+    }
+
+    Status = HiiNewPackageList (
+               &mPrivate.HiiDatabase,
+               (EFI_HII_PACKAGE_LIST_HEADER *)mPackageList,
+               (EFI_HANDLE)Driver,
+               &Driver->HiiHandle
+               );
+    if (EFI_ERROR (Status)) {
+      UnregisterDrivers (Context);
+      return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+    }
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  ExportConfig() returns the same <MultiConfigAltResp> whether or not the form
+  set is cached, and the result of each driver holds its own path.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestExportConfigCached (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STRING  Parsed;
+  EFI_STRING  Cached;
+  UINTN       Index;
+
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Parsed));
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Cached));
+
+  UT_ASSERT_EQUAL (StrCmp (Parsed, Cached), 0);
+  for (Index = 0; Index < TEST_DRIVER_COUNT; Index++) {
+    UT_ASSERT_TRUE (ResultsHoldDriverPath (Cached, &mDrivers[Index]));
+  }
+
+  FreePool (Parsed);
+  FreePool (Cached);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  ExportConfig() reads PlatformLang once, not once for every default string.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestPlatformLangReadOnce (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STRING  Results;
+
+  mPlatformLangReads = 0;
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Results));
+  UT_ASSERT_EQUAL (mPlatformLangReads, 1);
+  FreePool (Results);
+
+  mPlatformLangReads = 0;
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Results));
+  UT_ASSERT_EQUAL (mPlatformLangReads, 1);
+  FreePool (Results);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  The cached default strings follow a change of PlatformLang.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestPlatformLangChange (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STRING  English;
+  EFI_STRING  French;
+  EFI_STRING  Parsed;
+
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &English));
+
+  mPlatformLang = "fr-FR";
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &French));
+  UT_ASSERT_NOT_EQUAL (StrCmp (English, French), 0);
+
+  InvalidateConfigRoutingCache (NULL);
+  UT_ASSERT_NOT_EFI_ERROR (HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Parsed));
+  UT_ASSERT_EQUAL (StrCmp (French, Parsed), 0);
+
+  FreePool (English);
+  FreePool (French);
+  FreePool (Parsed);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Measure ExportConfig() of the large form set with and without the cache.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestExportConfigCost (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_BENCHMARK  Benchmark;
+  EFI_STRING           Results;
+  EFI_STATUS           Status;
+  UINTN                Index;
+
+  Status = EFI_SUCCESS;
+  UnitTestBenchmarkStart (&Benchmark);
+  for (Index = 0; Index < TEST_BENCHMARK_CALLS && !EFI_ERROR (Status); Index++) {
+    InvalidateConfigRoutingCache (NULL);
+    Status = HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Results);
+    if (!EFI_ERROR (Status)) {
+      FreePool (Results);
+    }
+  }
+
+  UnitTestBenchmarkStop (&Benchmark);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UnitTestBenchmarkLogRate ("ExportConfig, form set parsed", &Benchmark, TEST_BENCHMARK_CALLS);
+
+  UnitTestBenchmarkStart (&Benchmark);
+  for (Index = 0; Index < TEST_BENCHMARK_CALLS && !EFI_ERROR (Status); Index++) {
+    Status = HiiConfigRoutingExportConfig (&mPrivate.ConfigRouting, &Results);
+    if (!EFI_ERROR (Status)) {
+      FreePool (Results);
+    }
+  }
+
+  UnitTestBenchmarkStop (&Benchmark);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UnitTestBenchmarkLogRate ("ExportConfig, form set cached", &Benchmark, TEST_BENCHMARK_CALLS);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  ConfigRouting parse cache and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      ExportConfigTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  mBootServices.RaiseTPL           = MockRaiseTpl;
+  mBootServices.RestoreTPL         = MockRestoreTpl;
+  mBootServices.HandleProtocol     = MockHandleProtocol;
+  mBootServices.LocateHandleBuffer = MockLocateHandleBuffer;
+  mRuntimeServices.GetVariable     = MockGetVariable;
+  gBS                              = &mBootServices;
+  gRT                              = &mRuntimeServices;
+  mPlatformLang                    = "en-US";
+
+  //
+  // InitializeHiiDatabase () is not run, as it installs the HII protocols.
+  //
+  InitializeListHead (&mPrivate.DatabaseList);
+  InitializeListHead (&mPrivate.DatabaseNotifyList);
+  InitializeListHead (&mPrivate.HiiHandleList);
+  InitializeListHead (&mPrivate.FontInfoList);
+
+  Status = BuildPackageList ();
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in BuildPackageList. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the ExportConfig Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&ExportConfigTests, Framework, "ExportConfig Tests", "HiiDatabaseDxe.ExportConfig", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for ExportConfigTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------Description--------------Name----------Function--------Pre---Post-------------------Context-----------
+  //
+  AddTestCase (ExportConfigTests, "Cached results match the parsed results of each driver", "Cached", TestExportConfigCached, RegisterDrivers, UnregisterDrivers, NULL);
+  AddTestCase (ExportConfigTests, "PlatformLang is read once per call", "PlatformLangReadOnce", TestPlatformLangReadOnce, RegisterDrivers, UnregisterDrivers, NULL);
+  AddTestCase (ExportConfigTests, "Cached default strings follow PlatformLang", "PlatformLangChange", TestPlatformLangChange, RegisterDrivers, UnregisterDrivers, NULL);
+  AddTestCase (ExportConfigTests, "Cost of ExportConfig of a large form set", "ExportConfigCost", TestExportConfigCost, RegisterDrivers, UnregisterDrivers, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  if (mPackageList != NULL) {
+    FreePool (mPackageList);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
@@ -1568,6 +1568,53 @@ SetHiiVariable (
   return Status;
 }
 
+/**
+  Search the dynamic-ex PCD mapping table of a PCD database.
+
+  The build tool sorts the mapping table by token space guid index and then by
+  dynamic-ex token number, so a binary search can be used instead of a linear
+  walk over all dynamic-ex PCD entries.
+
+  @param ExMap           Pointer to the dynamic-ex PCD mapping table.
+  @param ExTokenCount    Number of entries in the dynamic-ex PCD mapping table.
+  @param GuidTableIdx    Index of the token space guid in the guid table.
+  @param ExTokenNumber   Dynamic-ex PCD token number.
+
+  @return Token Number for dynamic-ex PCD, or PCD_INVALID_TOKEN_NUMBER if not found.
+
+**/
+UINTN
+SearchExMapTable (
+  IN CONST DYNAMICEX_MAPPING  *ExMap,
+  IN UINTN                    ExTokenCount,
+  IN UINTN                    GuidTableIdx,
+  IN UINTN                    ExTokenNumber
+  )
+{
+  UINTN  Low;
+  UINTN  High;
+  UINTN  Mid;
+
+  Low  = 0;
+  High = ExTokenCount;
+  while (Low < High) {
+    Mid = Low + (High - Low) / 2;
+    if ((ExMap[Mid].ExGuidIndex == GuidTableIdx) && (ExMap[Mid].ExTokenNumber == ExTokenNumber)) {
+      return ExMap[Mid].TokenNumber;
+    }
+
+    if ((ExMap[Mid].ExGuidIndex < GuidTableIdx) ||
+        ((ExMap[Mid].ExGuidIndex == GuidTableIdx) && (ExMap[Mid].ExTokenNumber < ExTokenNumber)))
+    {
+      Low = Mid + 1;
+    } else {
+      High = Mid;
+    }
+  }
+
+  return PCD_INVALID_TOKEN_NUMBER;
+}
+
 /**
   Get Token Number according to dynamic-ex PCD's {token space guid:token number}
 
@@ -1587,11 +1634,11 @@ GetExPcdTokenNumber (
   IN UINT32          ExTokenNumber
   )
 {
-  UINT32             Index;
   DYNAMICEX_MAPPING  *ExMap;
   EFI_GUID           *GuidTable;
   EFI_GUID           *MatchGuid;
   UINTN              MatchGuidIdx;
+  UINTN              TokenNumber;
 
   if (!mPeiDatabaseEmpty) {
     ExMap     = (DYNAMICEX_MAPPING *)((UINT8 *)mPcdDatabase.PeiDb + mPcdDatabase.PeiDb->ExMapTableOffset);
@@ -1601,13 +1648,9 @@ GetExPcdTokenNumber (
 
     if (MatchGuid != NULL) {
       MatchGuidIdx = MatchGuid - GuidTable;
-
-      for (Index = 0; Index < mPcdDatabase.PeiDb->ExTokenCount; Index++) {
-        if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-            (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-        {
-          return ExMap[Index].TokenNumber;
-        }
+      TokenNumber  = SearchExMapTable (ExMap, mPcdDatabase.PeiDb->ExTokenCount, MatchGuidIdx, ExTokenNumber);
+      if (TokenNumber != PCD_INVALID_TOKEN_NUMBER) {
+        return TokenNumber;
       }
     }
   }
@@ -1623,13 +1666,9 @@ GetExPcdTokenNumber (
   ASSERT (MatchGuid != NULL);
 
   MatchGuidIdx = MatchGuid - GuidTable;
-
-  for (Index = 0; Index < mPcdDatabase.DxeDb->ExTokenCount; Index++) {
-    if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-        (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-    {
-      return ExMap[Index].TokenNumber;
-    }
+  TokenNumber  = SearchExMapTable (ExMap, mPcdDatabase.DxeDb->ExTokenCount, MatchGuidIdx, ExTokenNumber);
+  if (TokenNumber != PCD_INVALID_TOKEN_NUMBER) {
+    return TokenNumber;
   }
 
   DEBUG ((DEBUG_ERROR, "%a: Failed to find PCD with GUID: %g and token number: %d\n", __FUNCTION__, Guid, ExTokenNumber));
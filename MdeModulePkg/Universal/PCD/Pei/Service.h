@@ -31,7 +31,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // Please make sure the PCD Serivce PEIM Version is consistent with
 // the version of the generated PEIM PCD Database by build tool.
 //
-#define PCD_SERVICE_PEIM_VERSION  7
+#define PCD_SERVICE_PEIM_VERSION  8
 
 //
 // PCD_PEI_SERVICE_DRIVER_VERSION is defined in Autogen.h.
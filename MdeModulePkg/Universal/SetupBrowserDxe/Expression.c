@@ -881,6 +881,279 @@ IdToQuestion (
   return NULL;
 }
 
+/**
+  Get the Question an expression refers to for the dependency analysis.
+
+  The Question is searched in the same way as IdToQuestion (), but a Question
+  whose value IdToQuestion () reloads from the EFI variable storage on each
+  lookup is not returned, since its value may change without the browser
+  knowing it.
+
+  @param  FormSet                The formset which contains this form.
+  @param  Form                   The form which contains the expression.
+  @param  QuestionId             Id of the referred Question.
+
+  @retval Pointer                The Question.
+  @retval NULL                   The Question is not found or can't be tracked.
+
+**/
+FORM_BROWSER_STATEMENT *
+GetDependencyQuestion (
+  IN FORM_BROWSER_FORMSET  *FormSet,
+  IN FORM_BROWSER_FORM     *Form,
+  IN UINT16                QuestionId
+  )
+{
+  LIST_ENTRY              *Link;
+  FORM_BROWSER_FORM       *FormSetForm;
+  FORM_BROWSER_STATEMENT  *Question;
+
+  Question = IdToQuestion2 (Form, QuestionId);
+  if (Question == NULL) {
+    Link = GetFirstNode (&FormSet->FormListHead);
+    while (!IsNull (&FormSet->FormListHead, Link)) {
+      FormSetForm = FORM_BROWSER_FORM_FROM_LINK (Link);
+      Question    = IdToQuestion2 (FormSetForm, QuestionId);
+      if (Question != NULL) {
+        if ((Question->Storage != NULL) && (Question->Storage->Type == EFI_HII_VARSTORE_EFI_VARIABLE)) {
+          return NULL;
+        }
+
+        break;
+      }
+
+      Link = GetNextNode (&FormSet->FormListHead, Link);
+    }
+  }
+
+  //
+  // Only the value kept in the HiiValue of the Question can be tracked,
+  // string, buffer and orderedlist values are kept elsewhere.
+  //
+  if ((Question == NULL) || (Question->HiiValue.Type > EFI_IFR_TYPE_DATE)) {
+    return NULL;
+  }
+
+  return Question;
+}
+
+/**
+  Build the list of Questions an expression depends on.
+
+  The expression is marked as EXPRESSION_DEPENDENCY_STATIC if it only consists
+  of constants, operators and references to trackable Questions, otherwise
+  it is marked as EXPRESSION_DEPENDENCY_VOLATILE.
+
+  @param  FormSet                FormSet associated with this expression.
+  @param  Form                   Form associated with this expression.
+  @param  Expression             Expression to be analyzed.
+
+**/
+VOID
+AnalyzeExpressionDependency (
+  IN FORM_BROWSER_FORMSET  *FormSet,
+  IN FORM_BROWSER_FORM     *Form,
+  IN OUT FORM_EXPRESSION   *Expression
+  )
+{
+  LIST_ENTRY         *Link;
+  EXPRESSION_OPCODE  *OpCode;
+  UINTN              Count;
+  UINTN              Index;
+
+  Expression->DependencyState = EXPRESSION_DEPENDENCY_VOLATILE;
+  Expression->DependencyCount = 0;
+
+  //
+  // Check whether all opcodes are pure functions of their operands and
+  // count the Question references.
+  //
+  Count = 0;
+  Link  = GetFirstNode (&Expression->OpCodeListHead);
+  while (!IsNull (&Expression->OpCodeListHead, Link)) {
+    OpCode = EXPRESSION_OPCODE_FROM_LINK (Link);
+    Link   = GetNextNode (&Expression->OpCodeListHead, Link);
+
+    switch (OpCode->Operand) {
+      case EFI_IFR_EQ_ID_VAL_OP:
+      case EFI_IFR_EQ_ID_VAL_LIST_OP:
+      case EFI_IFR_QUESTION_REF1_OP:
+      case EFI_IFR_THIS_OP:
+        Count += 1;
+        break;
+
+      case EFI_IFR_EQ_ID_ID_OP:
+        Count += 2;
+        break;
+
+      case EFI_IFR_DUP_OP:
+      case EFI_IFR_TRUE_OP:
+      case EFI_IFR_FALSE_OP:
+      case EFI_IFR_ONE_OP:
+      case EFI_IFR_ONES_OP:
+      case EFI_IFR_UINT8_OP:
+      case EFI_IFR_UINT16_OP:
+      case EFI_IFR_UINT32_OP:
+      case EFI_IFR_UINT64_OP:
+      case EFI_IFR_UNDEFINED_OP:
+      case EFI_IFR_VERSION_OP:
+      case EFI_IFR_ZERO_OP:
+      case EFI_IFR_NOT_OP:
+      case EFI_IFR_TO_BOOLEAN_OP:
+      case EFI_IFR_TO_UINT_OP:
+      case EFI_IFR_BITWISE_NOT_OP:
+      case EFI_IFR_ADD_OP:
+      case EFI_IFR_SUBTRACT_OP:
+      case EFI_IFR_MULTIPLY_OP:
+      case EFI_IFR_DIVIDE_OP:
+      case EFI_IFR_MODULO_OP:
+      case EFI_IFR_BITWISE_AND_OP:
+      case EFI_IFR_BITWISE_OR_OP:
+      case EFI_IFR_SHIFT_LEFT_OP:
+      case EFI_IFR_SHIFT_RIGHT_OP:
+      case EFI_IFR_AND_OP:
+      case EFI_IFR_OR_OP:
+      case EFI_IFR_EQUAL_OP:
+      case EFI_IFR_NOT_EQUAL_OP:
+      case EFI_IFR_GREATER_EQUAL_OP:
+      case EFI_IFR_GREATER_THAN_OP:
+      case EFI_IFR_LESS_EQUAL_OP:
+      case EFI_IFR_LESS_THAN_OP:
+      case EFI_IFR_CONDITIONAL_OP:
+        break;
+
+      default:
+        //
+        // Strings, storage access, rules, user privilege and map expressions
+        // may change without any Question value being changed.
+        //
+        return;
+    }
+  }
+
+  if (Count != 0) {
+    Expression->Dependency = AllocateZeroPool (Count * sizeof (EXPRESSION_DEPENDENCY));
+    if (Expression->Dependency == NULL) {
+      return;
+    }
+  }
+
+  Index = 0;
+  Link  = GetFirstNode (&Expression->OpCodeListHead);
+  while (!IsNull (&Expression->OpCodeListHead, Link)) {
+    OpCode = EXPRESSION_OPCODE_FROM_LINK (Link);
+    Link   = GetNextNode (&Expression->OpCodeListHead, Link);
+
+    switch (OpCode->Operand) {
+      case EFI_IFR_EQ_ID_ID_OP:
+        Expression->Dependency[Index].Question = GetDependencyQuestion (FormSet, Form, OpCode->QuestionId);
+        if (Expression->Dependency[Index++].Question == NULL) {
+          return;
+        }
+
+        Expression->Dependency[Index].Question = GetDependencyQuestion (FormSet, Form, OpCode->QuestionId2);
+        if (Expression->Dependency[Index++].Question == NULL) {
+          return;
+        }
+
+        break;
+
+      case EFI_IFR_EQ_ID_VAL_OP:
+      case EFI_IFR_EQ_ID_VAL_LIST_OP:
+      case EFI_IFR_QUESTION_REF1_OP:
+      case EFI_IFR_THIS_OP:
+        Expression->Dependency[Index].Question = GetDependencyQuestion (FormSet, Form, OpCode->QuestionId);
+        if (Expression->Dependency[Index++].Question == NULL) {
+          return;
+        }
+
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  ASSERT (Index == Count);
+  Expression->DependencyCount = Count;
+  Expression->DependencyState = EXPRESSION_DEPENDENCY_STATIC;
+}
+
+/**
+  Check whether an expression must be evaluated again.
+
+  An expression that only depends on Question values keeps its last result
+  until one of the Questions it refers to is changed, so only the expressions
+  affected by a value change are evaluated again.
+
+  @param  FormSet                FormSet associated with this expression.
+  @param  Form                   Form associated with this expression.
+  @param  Expression             Expression to be checked.
+
+  @retval TRUE                   The expression must be evaluated.
+  @retval FALSE                  The last result of the expression is still valid.
+
+**/
+BOOLEAN
+IsExpressionEvaluationRequired (
+  IN FORM_BROWSER_FORMSET  *FormSet,
+  IN FORM_BROWSER_FORM     *Form,
+  IN OUT FORM_EXPRESSION   *Expression
+  )
+{
+  UINTN                  Index;
+  EXPRESSION_DEPENDENCY  *Dependency;
+
+  if (Expression->DependencyState == EXPRESSION_DEPENDENCY_UNKNOWN) {
+    AnalyzeExpressionDependency (FormSet, Form, Expression);
+  }
+
+  if ((Expression->DependencyState != EXPRESSION_DEPENDENCY_STATIC) || !Expression->ResultValid) {
+    return TRUE;
+  }
+
+  for (Index = 0; Index < Expression->DependencyCount; Index++) {
+    Dependency = &Expression->Dependency[Index];
+    if ((Dependency->Question->HiiValue.Type != Dependency->Value.Type) ||
+        (CompareMem (&Dependency->Question->HiiValue.Value, &Dependency->Value.Value, sizeof (EFI_IFR_TYPE_VALUE)) != 0))
+    {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Save the values of the Questions an expression depends on after it is evaluated.
+
+  @param  Expression             The evaluated expression.
+  @param  ResultValid            Whether the expression is evaluated successfully.
+
+**/
+VOID
+SaveExpressionDependency (
+  IN OUT FORM_EXPRESSION  *Expression,
+  IN     BOOLEAN          ResultValid
+  )
+{
+  UINTN  Index;
+
+  if (Expression->DependencyState != EXPRESSION_DEPENDENCY_STATIC) {
+    return;
+  }
+
+  for (Index = 0; Index < Expression->DependencyCount; Index++) {
+    CopyMem (
+      &Expression->Dependency[Index].Value,
+      &Expression->Dependency[Index].Question->HiiValue,
+      sizeof (EFI_HII_VALUE)
+      );
+  }
+
+  Expression->ResultValid = ResultValid;
+}
+
 /**
   Get Expression given its RuleId.
 
@@ -3673,6 +3946,8 @@ Done:
     CopyMem (&Expression->Result, Value, sizeof (EFI_HII_VALUE));
   }
 
+  SaveExpressionDependency (Expression, (BOOLEAN) !EFI_ERROR (Status));
+
   return Status;
 }
 
@@ -3753,6 +4028,11 @@ EvaluateExpressionList (
   //
   if (Evaluate) {
     while (ExpList->Count > Index) {
+      if (!IsExpressionEvaluationRequired (FormSet, Form, ExpList->Expression[Index])) {
+        Index++;
+        continue;
+      }
+
       Status = EvaluateExpression (FormSet, Form, ExpList->Expression[Index++]);
       if (EFI_ERROR (Status)) {
         return ExpressFalse;
@@ -219,6 +219,28 @@ EvaluateExpression (
   IN OUT FORM_EXPRESSION   *Expression
   );
 
+/**
+  Check whether an expression must be evaluated again.
+
+  An expression that only depends on Question values keeps its last result
+  until one of the Questions it refers to is changed, so only the expressions
+  affected by a value change are evaluated again.
+
+  @param  FormSet                FormSet associated with this expression.
+  @param  Form                   Form associated with this expression.
+  @param  Expression             Expression to be checked.
+
+  @retval TRUE                   The expression must be evaluated.
+  @retval FALSE                  The last result of the expression is still valid.
+
+**/
+BOOLEAN
+IsExpressionEvaluationRequired (
+  IN FORM_BROWSER_FORMSET  *FormSet,
+  IN FORM_BROWSER_FORM     *Form,
+  IN OUT FORM_EXPRESSION   *Expression
+  );
+
 /**
   Return the result of the expression list. Check the expression list and
   return the highest priority express result.
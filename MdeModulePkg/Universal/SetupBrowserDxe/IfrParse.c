@@ -739,6 +739,10 @@ DestroyExpression (
     }
   }
 
+  if (Expression->Dependency != NULL) {
+    FreePool (Expression->Dependency);
+  }
+
   //
   // Free this Expression
   //
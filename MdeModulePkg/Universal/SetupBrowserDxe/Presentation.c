@@ -90,6 +90,13 @@ EvaluateFormExpressions (
       continue;
     }
 
+    //
+    // Only evaluate the expressions whose referred Question values are changed.
+    //
+    if (!IsExpressionEvaluationRequired (FormSet, Form, Expression)) {
+      continue;
+    }
+
     Status = EvaluateExpression (FormSet, Form, Expression);
     if (EFI_ERROR (Status)) {
       return Status;
@@ -213,23 +213,42 @@ typedef struct {
 
 #define EXPRESSION_OPCODE_FROM_LINK(a)  CR (a, EXPRESSION_OPCODE, Link, EXPRESSION_OPCODE_SIGNATURE)
 
+//
+// Whether the result of an expression only depends on the value of the
+// questions it refers to, so it need not be evaluated again until one of
+// those values is changed.
+//
+#define EXPRESSION_DEPENDENCY_UNKNOWN   0  // Not analyzed yet
+#define EXPRESSION_DEPENDENCY_STATIC    1  // Only depends on the questions in Dependency
+#define EXPRESSION_DEPENDENCY_VOLATILE  2  // Must be evaluated every time
+
+typedef struct {
+  struct _FORM_BROWSER_STATEMENT    *Question;   // Question referred by the expression
+  EFI_HII_VALUE                     Value;       // Question value when the expression was last evaluated
+} EXPRESSION_DEPENDENCY;
+
 #define FORM_EXPRESSION_SIGNATURE  SIGNATURE_32 ('F', 'E', 'X', 'P')
 
 typedef struct {
-  UINTN                Signature;
-  LIST_ENTRY           Link;
+  UINTN                    Signature;
+  LIST_ENTRY               Link;
+
+  UINT8                    Type;         // Type for this expression
 
-  UINT8                Type;         // Type for this expression
+  UINT8                    RuleId;       // For EFI_IFR_RULE only
+  EFI_STRING_ID            Error;        // For EFI_IFR_NO_SUBMIT_IF, EFI_IFR_INCONSISTENT_IF only
 
-  UINT8                RuleId;       // For EFI_IFR_RULE only
-  EFI_STRING_ID        Error;        // For EFI_IFR_NO_SUBMIT_IF, EFI_IFR_INCONSISTENT_IF only
+  EFI_HII_VALUE            Result;       // Expression evaluation result
 
-  EFI_HII_VALUE        Result;       // Expression evaluation result
+  UINT8                    TimeOut;      // For EFI_IFR_WARNING_IF
+  EFI_IFR_OP_HEADER        *OpCode;      // Save the opcode buffer.
 
-  UINT8                TimeOut;      // For EFI_IFR_WARNING_IF
-  EFI_IFR_OP_HEADER    *OpCode;      // Save the opcode buffer.
+  LIST_ENTRY               OpCodeListHead; // OpCodes consist of this expression (EXPRESSION_OPCODE)
 
-  LIST_ENTRY           OpCodeListHead; // OpCodes consist of this expression (EXPRESSION_OPCODE)
+  UINT8                    DependencyState; // EXPRESSION_DEPENDENCY_UNKNOWN, _STATIC or _VOLATILE
+  BOOLEAN                  ResultValid;     // Whether Result is evaluated from the values saved in Dependency
+  UINTN                    DependencyCount;
+  EXPRESSION_DEPENDENCY    *Dependency;     // Array[DependencyCount] of questions this expression refers to
 } FORM_EXPRESSION;
 
 #define FORM_EXPRESSION_FROM_LINK(a)  CR (a, FORM_EXPRESSION, Link, FORM_EXPRESSION_SIGNATURE)
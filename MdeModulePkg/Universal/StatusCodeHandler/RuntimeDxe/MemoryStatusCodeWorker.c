@@ -72,12 +72,40 @@ RtMemoryStatusCodeReportWorker (
   )
 {
   MEMORY_STATUSCODE_RECORD  *Record;
+  UINT32                    RecordIndex;
+  UINT32                    NextRecordIndex;
+
+  //
+  // Reserve a record without taking a lock, so concurrent reporters each get
+  // their own record.
+  //
+  // If record index equals to max record number, then wrap around record index to zero.
+  //
+  // The reader of status code should compare the number of records with max records number,
+  // If it is equal to or larger than the max number, then the wrap-around had happened,
+  // so the first record is pointed by record index.
+  // If it is less then max number, index of the first record is zero.
+  //
+  do {
+    RecordIndex     = mRtMemoryStatusCodeTable->RecordIndex;
+    NextRecordIndex = RecordIndex + 1;
+    if (NextRecordIndex == mRtMemoryStatusCodeTable->MaxRecordsNumber) {
+      //
+      // Wrap around record index.
+      //
+      NextRecordIndex = 0;
+    }
+  } while (InterlockedCompareExchange32 (
+             (volatile UINT32 *)&mRtMemoryStatusCodeTable->RecordIndex,
+             RecordIndex,
+             NextRecordIndex
+             ) != RecordIndex);
 
   //
   // Locate current record buffer.
   //
   Record = (MEMORY_STATUSCODE_RECORD *)(mRtMemoryStatusCodeTable + 1);
-  Record = &Record[mRtMemoryStatusCodeTable->RecordIndex++];
+  Record = &Record[RecordIndex];
 
   //
   // Save status code.
@@ -86,21 +114,7 @@ RtMemoryStatusCodeReportWorker (
   Record->Value    = Value;
   Record->Instance = Instance;
 
-  //
-  // If record index equals to max record number, then wrap around record index to zero.
-  //
-  // The reader of status code should compare the number of records with max records number,
-  // If it is equal to or larger than the max number, then the wrap-around had happened,
-  // so the first record is pointed by record index.
-  // If it is less then max number, index of the first record is zero.
-  //
-  mRtMemoryStatusCodeTable->NumberOfRecords++;
-  if (mRtMemoryStatusCodeTable->RecordIndex == mRtMemoryStatusCodeTable->MaxRecordsNumber) {
-    //
-    // Wrap around record index.
-    //
-    mRtMemoryStatusCodeTable->RecordIndex = 0;
-  }
+  InterlockedIncrement ((volatile UINT32 *)&mRtMemoryStatusCodeTable->NumberOfRecords);
 
   return EFI_SUCCESS;
 }
@@ -8,6 +8,214 @@
 
 #include "StatusCodeHandlerRuntimeDxe.h"
 
+SERIAL_STATUS_CODE_RING  mSerialStatusCodeRing;
+
+/**
+  Write all messages queued in the serial status code ring buffer to the
+  serial port.
+
+  @retval TRUE   The ring buffer was drained, or it is disabled.
+  @retval FALSE  Another caller is draining the ring buffer.
+
+**/
+BOOLEAN
+SerialStatusCodeRingFlush (
+  VOID
+  )
+{
+  SERIAL_STATUS_CODE_RING_ENTRY  *Entry;
+  UINT32                         DroppedCount;
+  CHAR8                          Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+  UINTN                          CharCount;
+
+  if (mSerialStatusCodeRing.Entries == NULL) {
+    return TRUE;
+  }
+
+  //
+  // Only one consumer may walk the ring buffer at a time.
+  //
+  if (InterlockedCompareExchange32 (&mSerialStatusCodeRing.Draining, 0, 1) != 0) {
+    return FALSE;
+  }
+
+  while (mSerialStatusCodeRing.Tail != mSerialStatusCodeRing.Head) {
+    Entry = &mSerialStatusCodeRing.Entries[mSerialStatusCodeRing.Tail % mSerialStatusCodeRing.EntryCount];
+    if (Entry->Ready == 0) {
+      //
+      // The producer which reserved this slot has not finished copying the
+      // message yet. Pick it up in the next drain.
+      //
+      break;
+    }
+
+    SerialPortWrite ((UINT8 *)Entry->Buffer, Entry->Length);
+
+    Entry->Ready = 0;
+    MemoryFence ();
+    mSerialStatusCodeRing.Tail++;
+  }
+
+  DroppedCount = mSerialStatusCodeRing.DroppedCount;
+  if (DroppedCount != mSerialStatusCodeRing.ReportedDroppedCount) {
+    CharCount = AsciiSPrint (
+                  Buffer,
+                  sizeof (Buffer),
+                  "STATUS CODE: %d serial message(s) dropped\n\r",
+                  DroppedCount - mSerialStatusCodeRing.ReportedDroppedCount
+                  );
+    SerialPortWrite ((UINT8 *)Buffer, CharCount);
+    mSerialStatusCodeRing.ReportedDroppedCount = DroppedCount;
+  }
+
+  MemoryFence ();
+  mSerialStatusCodeRing.Draining = 0;
+
+  return TRUE;
+}
+
+/**
+  Queue a formatted message in the serial status code ring buffer.
+
+  A slot is reserved with a compare-exchange on the head counter, so this
+  function does not take any lock and may be called by several producers at
+  the same time. If the ring buffer is full the message is dropped and counted.
+
+  @param  Buffer     The formatted message.
+  @param  CharCount  The number of characters in Buffer.
+
+**/
+VOID
+SerialStatusCodeRingPush (
+  IN CONST CHAR8  *Buffer,
+  IN UINTN        CharCount
+  )
+{
+  SERIAL_STATUS_CODE_RING_ENTRY  *Entry;
+  UINT32                         Head;
+
+  do {
+    Head = mSerialStatusCodeRing.Head;
+    if ((UINT32)(Head - mSerialStatusCodeRing.Tail) >= mSerialStatusCodeRing.EntryCount) {
+      InterlockedIncrement (&mSerialStatusCodeRing.DroppedCount);
+      return;
+    }
+  } while (InterlockedCompareExchange32 (&mSerialStatusCodeRing.Head, Head, Head + 1) != Head);
+
+  Entry = &mSerialStatusCodeRing.Entries[Head % mSerialStatusCodeRing.EntryCount];
+  ASSERT (Entry->Ready == 0);
+
+  CharCount = MIN (CharCount, sizeof (Entry->Buffer));
+  CopyMem (Entry->Buffer, Buffer, CharCount);
+  Entry->Length = (UINT32)CharCount;
+
+  //
+  // Publish the message only after its content is visible to the consumer.
+  //
+  MemoryFence ();
+  Entry->Ready = 1;
+}
+
+/**
+  Timer notification function which drains the serial status code ring buffer.
+
+  @param  Event         Event whose notification function is being invoked.
+  @param  Context       Pointer to the notification function's context.
+
+**/
+VOID
+EFIAPI
+SerialStatusCodeRingDrainNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  SerialStatusCodeRingFlush ();
+}
+
+/**
+  Allocate the serial status code ring buffer and create the timer event which
+  drains it at TPL_CALLBACK.
+
+  The ring buffer is only used when PcdStatusCodeSerialRingBufferEntries is not
+  zero. Otherwise serial status codes are written out synchronously.
+
+  @retval EFI_SUCCESS           The ring buffer is ready, or it is disabled.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory for the ring buffer.
+  @retval others                Errors from gBS->CreateEvent() or gBS->SetTimer().
+
+**/
+EFI_STATUS
+SerialStatusCodeRingInitializeWorker (
+  VOID
+  )
+{
+  EFI_STATUS                     Status;
+  UINT32                         EntryCount;
+  SERIAL_STATUS_CODE_RING_ENTRY  *Entries;
+
+  EntryCount = PcdGet32 (PcdStatusCodeSerialRingBufferEntries);
+  if (EntryCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Serial status codes are only handled before ExitBootServices(), so the
+  // ring buffer lives in boot services memory.
+  //
+  Entries = AllocateZeroPool (EntryCount * sizeof (SERIAL_STATUS_CODE_RING_ENTRY));
+  if (Entries == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  SerialStatusCodeRingDrainNotify,
+                  NULL,
+                  &mSerialStatusCodeRing.DrainEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    FreePool (Entries);
+    return Status;
+  }
+
+  Status = gBS->SetTimer (
+                  mSerialStatusCodeRing.DrainEvent,
+                  TimerPeriodic,
+                  SERIAL_STATUS_CODE_DRAIN_PERIOD
+                  );
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (mSerialStatusCodeRing.DrainEvent);
+    mSerialStatusCodeRing.DrainEvent = NULL;
+    FreePool (Entries);
+    return Status;
+  }
+
+  mSerialStatusCodeRing.EntryCount = EntryCount;
+  MemoryFence ();
+  mSerialStatusCodeRing.Entries = Entries;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Drain the serial status code ring buffer and stop the drain timer.
+
+**/
+VOID
+SerialStatusCodeRingShutdown (
+  VOID
+  )
+{
+  if (mSerialStatusCodeRing.Entries == NULL) {
+    return;
+  }
+
+  SerialStatusCodeRingFlush ();
+  gBS->SetTimer (mSerialStatusCodeRing.DrainEvent, TimerCancel, 0);
+}
+
 /**
   Convert status code value and extended data to readable ASCII string, send string to serial I/O device.
 
@@ -149,10 +357,26 @@ SerialStatusCodeReportWorker (
                   );
   }
 
-  //
-  // Call SerialPort Lib function to do print.
-  //
-  SerialPortWrite ((UINT8 *)Buffer, CharCount);
+  if ((mSerialStatusCodeRing.Entries != NULL) &&
+      ((CodeType & EFI_STATUS_CODE_TYPE_MASK) != EFI_ERROR_CODE))
+  {
+    //
+    // Queue the message and let the drain timer write it to the serial port,
+    // so the caller does not wait for a slow UART.
+    //
+    SerialStatusCodeRingPush (Buffer, CharCount);
+  } else {
+    //
+    // Error codes, including ASSERT(), are written out immediately. Drain the
+    // ring buffer first to keep the output in order.
+    //
+    SerialStatusCodeRingFlush ();
+
+    //
+    // Call SerialPort Lib function to do print.
+    //
+    SerialPortWrite ((UINT8 *)Buffer, CharCount);
+  }
 
   //
   // If register an unregister function of gEfiEventExitBootServicesGuid,
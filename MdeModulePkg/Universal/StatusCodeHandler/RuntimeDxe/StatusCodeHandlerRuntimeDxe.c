@@ -25,6 +25,7 @@ UnregisterSerialBootTimeHandlers (
 {
   if (PcdGetBool (PcdStatusCodeUseSerial)) {
     mRscHandlerProtocol->Unregister (SerialStatusCodeReportWorker);
+    SerialStatusCodeRingShutdown ();
   }
 }
 
@@ -80,6 +81,12 @@ InitializationDispatcherWorker (
     //
     Status = SerialPortInitialize ();
     ASSERT_EFI_ERROR (Status);
+
+    //
+    // Queue serial status codes in a ring buffer if it is configured.
+    //
+    Status = SerialStatusCodeRingInitializeWorker ();
+    ASSERT_EFI_ERROR (Status);
   }
 
   if (PcdGetBool (PcdStatusCodeUseMemory)) {
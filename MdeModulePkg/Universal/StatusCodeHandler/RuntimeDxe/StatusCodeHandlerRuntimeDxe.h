@@ -17,6 +17,7 @@
 #include <Guid/StatusCodeDataTypeDebug.h>
 #include <Guid/EventGroup.h>
 
+#include <Library/BaseLib.h>
 #include <Library/SynchronizationLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
@@ -35,6 +36,40 @@
 //
 #define MAX_DEBUG_MESSAGE_LENGTH  0x100
 
+//
+// Period of the timer event which drains the serial status code ring buffer,
+// in 100ns units (10ms).
+//
+#define SERIAL_STATUS_CODE_DRAIN_PERIOD  100000
+
+///
+/// One formatted message queued in the serial status code ring buffer.
+///
+typedef struct {
+  ///
+  /// Set by the producer once Buffer and Length are valid.
+  ///
+  volatile UINT32    Ready;
+  UINT32             Length;
+  CHAR8              Buffer[MAX_DEBUG_MESSAGE_LENGTH];
+} SERIAL_STATUS_CODE_RING_ENTRY;
+
+///
+/// Multi-producer, single-consumer ring buffer of formatted serial messages.
+/// Head and Tail are free running counters, the slot is the counter modulo
+/// EntryCount.
+///
+typedef struct {
+  SERIAL_STATUS_CODE_RING_ENTRY    *Entries;
+  UINT32                           EntryCount;
+  volatile UINT32                  Head;
+  volatile UINT32                  Tail;
+  volatile UINT32                  Draining;
+  volatile UINT32                  DroppedCount;
+  UINT32                           ReportedDroppedCount;
+  EFI_EVENT                        DrainEvent;
+} SERIAL_STATUS_CODE_RING;
+
 extern RUNTIME_MEMORY_STATUSCODE_HEADER  *mRtMemoryStatusCodeTable;
 
 /**
@@ -48,6 +83,45 @@ EfiSerialStatusCodeInitializeWorker (
   VOID
   );
 
+/**
+  Allocate the serial status code ring buffer and create the timer event which
+  drains it at TPL_CALLBACK.
+
+  The ring buffer is only used when PcdStatusCodeSerialRingBufferEntries is not
+  zero. Otherwise serial status codes are written out synchronously.
+
+  @retval EFI_SUCCESS           The ring buffer is ready, or it is disabled.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory for the ring buffer.
+  @retval others                Errors from gBS->CreateEvent() or gBS->SetTimer().
+
+**/
+EFI_STATUS
+SerialStatusCodeRingInitializeWorker (
+  VOID
+  );
+
+/**
+  Write all messages queued in the serial status code ring buffer to the
+  serial port.
+
+  @retval TRUE   The ring buffer was drained, or it is disabled.
+  @retval FALSE  Another caller is draining the ring buffer.
+
+**/
+BOOLEAN
+SerialStatusCodeRingFlush (
+  VOID
+  );
+
+/**
+  Drain the serial status code ring buffer and stop the drain timer.
+
+**/
+VOID
+SerialStatusCodeRingShutdown (
+  VOID
+  );
+
 /**
   Convert status code value and extended data to readable ASCII string, send string to serial I/O device.
 
@@ -0,0 +1,80 @@
+/** @file
+  Provides services to share a set of independent tasks between the processors.
+
+  The work is described as TaskCount tasks executed by the same function. Each
+  processor taking part, the calling processor included, claims the next task
+  by atomically incrementing a shared index, so no lock is taken per task.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MP_WORK_QUEUE_LIB_H_
+#define MP_WORK_QUEUE_LIB_H_
+
+/**
+  Execute one task of a work queue.
+
+  @param[in] Context    The context passed to MpWorkQueueRun().
+  @param[in] TaskIndex  The index of the task, from 0 to TaskCount - 1.
+**/
+typedef
+VOID
+(EFIAPI *MP_WORK_QUEUE_TASK)(
+  IN VOID   *Context,
+  IN UINTN  TaskIndex
+  );
+
+/**
+  Execute a set of tasks, sharing them between the calling processor and the
+  other processors that are available.
+
+  Task is called once for each task index, in no particular order and possibly
+  on several processors at the same time. So a task must only write the data of
+  its own index, and must only use services that are safe to call on an AP.
+
+  If the APs are stopped because TimeoutInMicroseconds expired, the tasks they
+  did not complete are executed on the calling processor. Such a task may have
+  been partly executed on an AP, so it must give the same result when it is
+  executed again.
+
+  If no AP is available, or the APs cannot be started, all the tasks are
+  executed on the calling processor.
+
+  @param[in] Task                   The function executing one task.
+  @param[in] Context                The context passed to Task.
+  @param[in] TaskCount              The number of tasks.
+  @param[in] TimeoutInMicroseconds  The time the APs are given to complete the
+                                    tasks, or 0 for no limit. It is only
+                                    honored where the APs can be stopped.
+
+  @retval RETURN_SUCCESS            All the tasks are completed.
+  @retval RETURN_INVALID_PARAMETER  Task is NULL.
+  @retval RETURN_INVALID_PARAMETER  TaskCount is bigger than MAX_INT32.
+**/
+RETURN_STATUS
+EFIAPI
+MpWorkQueueRun (
+  IN MP_WORK_QUEUE_TASK  Task,
+  IN VOID                *Context,
+  IN UINTN               TaskCount,
+  IN UINTN               TimeoutInMicroseconds
+  );
+
+/**
+  Return the number of processors that may execute tasks at the same time in
+  MpWorkQueueRun(), the calling processor included.
+
+  A caller may use it to size the resources that a task only needs while it
+  runs, such as a scratch buffer, by the processors rather than by the tasks.
+
+  @return The number of processors, which is at least 1.
+**/
+UINTN
+EFIAPI
+MpWorkQueueGetProcessorCount (
+  VOID
+  );
+
+#endif
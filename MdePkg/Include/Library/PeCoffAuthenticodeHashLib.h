@@ -0,0 +1,163 @@
+/** @file
+  Provides services to compute the Authenticode hash of a PE/COFF image, as
+  described in the PE/COFF Specification 8.0 Appendix A.
+
+  The library selects the parts of the image that are covered by the hash, in
+  the order required by Authenticode, and passes them to a hash function of the
+  caller. The hash function may feed several hash algorithms at the same time,
+  so all the digests of an image are computed in a single pass.
+
+  The image can be passed as a single buffer, or streamed as consecutive chunks
+  of the file, as they are read from a device. In the latter case no copy of the
+  image is made, unless its sections overlap or are not in file order.
+
+  Caution: The PE/COFF image is external input, this library validates the data
+  structures it uses.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef PE_COFF_AUTHENTICODE_HASH_LIB_H_
+#define PE_COFF_AUTHENTICODE_HASH_LIB_H_
+
+/**
+  Add a part of the image to the Authenticode hash.
+
+  @param[in] HashContext  The context passed to PeCoffAuthenticodeHashStart()
+                          or PeCoffAuthenticodeHashImage().
+  @param[in] Data         The data to hash.
+  @param[in] DataSize     The size, in bytes, of Data. It is never 0.
+
+  @retval RETURN_SUCCESS  The data is hashed.
+  @retval Others          The data cannot be hashed. The error is returned
+                          to the caller of the library.
+**/
+typedef
+RETURN_STATUS
+(EFIAPI *PE_COFF_AUTHENTICODE_HASH_UPDATE)(
+  IN VOID        *HashContext,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  );
+
+/**
+  Compute the Authenticode hash of a PE/COFF image in a buffer.
+
+  HashUpdate is called with the parts of the image covered by the hash, in the
+  order required by Authenticode. The caller initializes its hash algorithms
+  before, and finalizes them after, the call.
+
+  The image is expected to have been checked by PeCoffLoaderGetImageInfo().
+
+  @param[in] Image        The PE/COFF image.
+  @param[in] ImageSize    The size, in bytes, of the image file.
+  @param[in] HashUpdate   The function that hashes the data.
+  @param[in] HashContext  The context passed to HashUpdate.
+
+  @retval RETURN_SUCCESS            The image is hashed.
+  @retval RETURN_INVALID_PARAMETER  Image or HashUpdate is NULL.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image.
+  @retval RETURN_OUT_OF_RESOURCES   Not enough memory is available.
+  @retval Others                    The error returned by HashUpdate.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashImage (
+  IN CONST VOID                        *Image,
+  IN UINTN                             ImageSize,
+  IN PE_COFF_AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN VOID                              *HashContext
+  );
+
+/**
+  Start the Authenticode hash of a PE/COFF image that is streamed.
+
+  The image file is then passed in order, in chunks of any size, to
+  PeCoffAuthenticodeHashUpdate(). HashUpdate is called with the parts of the
+  image covered by the hash as soon as they are received.
+
+  @param[in]  ImageSize    The size, in bytes, of the image file.
+  @param[in]  HashUpdate   The function that hashes the data.
+  @param[in]  HashContext  The context passed to HashUpdate.
+  @param[out] Context      The context of the stream, to pass to
+                           PeCoffAuthenticodeHashUpdate() and
+                           PeCoffAuthenticodeHashFinal() or
+                           PeCoffAuthenticodeHashAbort().
+
+  @retval RETURN_SUCCESS            The stream is started.
+  @retval RETURN_INVALID_PARAMETER  HashUpdate or Context is NULL.
+  @retval RETURN_OUT_OF_RESOURCES   Not enough memory is available.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashStart (
+  IN  UINTN                             ImageSize,
+  IN  PE_COFF_AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN  VOID                              *HashContext,
+  OUT VOID                              **Context
+  );
+
+/**
+  Pass the next chunk of the image file to an Authenticode hash stream.
+
+  The headers of the image are kept until SizeOfHeaders bytes are received, so
+  they need not be passed in a single chunk.
+
+  @param[in] Context   The context returned by PeCoffAuthenticodeHashStart().
+  @param[in] Data      The chunk of the image file, that follows the previous
+                       one.
+  @param[in] DataSize  The size, in bytes, of Data.
+
+  @retval RETURN_SUCCESS            The chunk is processed.
+  @retval RETURN_INVALID_PARAMETER  Context is NULL, or Data is NULL and
+                                    DataSize is not 0.
+  @retval RETURN_BAD_BUFFER_SIZE    More than ImageSize bytes are passed.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image.
+  @retval RETURN_OUT_OF_RESOURCES   Not enough memory is available.
+  @retval Others                    The error returned by HashUpdate.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashUpdate (
+  IN VOID        *Context,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  );
+
+/**
+  Complete an Authenticode hash stream, and free its context.
+
+  On success all the data covered by the hash has been passed to HashUpdate,
+  and the caller can finalize its hash algorithms.
+
+  @param[in] Context  The context returned by PeCoffAuthenticodeHashStart().
+
+  @retval RETURN_SUCCESS            The image is hashed.
+  @retval RETURN_INVALID_PARAMETER  Context is NULL.
+  @retval RETURN_NOT_READY          Less than ImageSize bytes were passed.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image.
+  @retval Others                    An error returned by a previous call to
+                                    PeCoffAuthenticodeHashUpdate(), or by
+                                    HashUpdate.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashFinal (
+  IN VOID  *Context
+  );
+
+/**
+  Free the context of an Authenticode hash stream that is not completed.
+
+  @param[in] Context  The context returned by PeCoffAuthenticodeHashStart(),
+                      or NULL.
+**/
+VOID
+EFIAPI
+PeCoffAuthenticodeHashAbort (
+  IN VOID  *Context
+  );
+
+#endif
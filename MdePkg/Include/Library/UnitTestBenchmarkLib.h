@@ -0,0 +1,95 @@
+/** @file
+  Provides timing and reporting services for benchmarks run by unit tests.
+
+  A benchmark is timed with UnitTestBenchmarkStart() and UnitTestBenchmarkStop()
+  and reported with UnitTestBenchmarkLogThroughput() or UnitTestBenchmarkLogRate()
+  through the UT_LOG_INFO() macro of UnitTestLib.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef UNIT_TEST_BENCHMARK_LIB_H_
+#define UNIT_TEST_BENCHMARK_LIB_H_
+
+///
+/// The time taken by a benchmark.
+///
+typedef struct {
+  ///
+  /// The cycle counter when the benchmark was started.
+  ///
+  UINT64    StartCycles;
+  ///
+  /// The time when the benchmark was started, in units private to the
+  /// library instance.
+  ///
+  UINT64    StartTime;
+  ///
+  /// The number of cycles the benchmark took, or 0 if the processor has no
+  /// cycle counter that can be read.
+  ///
+  UINT64    Cycles;
+  ///
+  /// The time the benchmark took in nanoseconds, or 0 if it is not known.
+  ///
+  UINT64    Nanoseconds;
+} UNIT_TEST_BENCHMARK;
+
+/**
+  Start timing a benchmark.
+
+  @param[out]  Benchmark  The benchmark to start.
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkStart (
+  OUT UNIT_TEST_BENCHMARK  *Benchmark
+  );
+
+/**
+  Stop timing a benchmark and record the cycles and time it took.
+
+  @param[in, out]  Benchmark  The benchmark started by UnitTestBenchmarkStart().
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkStop (
+  IN OUT UNIT_TEST_BENCHMARK  *Benchmark
+  );
+
+/**
+  Log the throughput of a benchmark in cycles per byte and in MB/s.
+
+  @param[in]  Operation  The name of the operation that was timed.
+  @param[in]  Benchmark  The benchmark stopped by UnitTestBenchmarkStop().
+  @param[in]  DataSize   The number of bytes the operation processed.
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkLogThroughput (
+  IN CONST CHAR8                *Operation,
+  IN CONST UNIT_TEST_BENCHMARK  *Benchmark,
+  IN UINT64                     DataSize
+  );
+
+/**
+  Log the rate of a benchmark in cycles per call and in calls per second.
+
+  @param[in]  Operation  The name of the operation that was timed.
+  @param[in]  Benchmark  The benchmark stopped by UnitTestBenchmarkStop().
+  @param[in]  Count      The number of times the operation was called.
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkLogRate (
+  IN CONST CHAR8                *Operation,
+  IN CONST UNIT_TEST_BENCHMARK  *Benchmark,
+  IN UINT64                     Count
+  );
+
+#endif
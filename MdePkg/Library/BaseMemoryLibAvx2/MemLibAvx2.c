@@ -0,0 +1,283 @@
+/** @file
+  Selection between the SSE2 and the AVX2 implementations of CopyMem(),
+  SetMem() and ZeroMem().
+
+  The AVX2 kernels are used when the processor supports AVX2, the YMM state is
+  enabled in XCR0 on the executing processor, and the buffer is large enough
+  to amortize saving and restoring the YMM registers. Buffers larger than
+  MEM_LIB_AVX2_NON_TEMPORAL_THRESHOLD are written with non-temporal stores,
+  so that a large copy does not evict the working set from the cache.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "MemLibInternals.h"
+#include <Register/Intel/Cpuid.h>
+
+#define MEM_LIB_AVX2_THRESHOLD               SIZE_1KB
+#define MEM_LIB_AVX2_NON_TEMPORAL_THRESHOLD  SIZE_1MB
+
+#define MEM_LIB_AVX2_UNKNOWN      0
+#define MEM_LIB_AVX2_SUPPORTED    1
+#define MEM_LIB_AVX2_UNSUPPORTED  2
+
+//
+// Whether the processor supports AVX2, as reported by CPUID.
+//
+UINT8  mMemLibAvx2Support = MEM_LIB_AVX2_UNKNOWN;
+
+/**
+  Copy Length bytes from Source to Destination with SSE2 registers.
+
+  @param  DestinationBuffer The target of the copy request.
+  @param  SourceBuffer      The place to copy from.
+  @param  Length            The number of bytes to copy.
+
+  @return Destination
+
+**/
+VOID *
+EFIAPI
+InternalMemCopyMemSse2 (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  );
+
+/**
+  Copy Length bytes from Source to Destination with AVX2 registers.
+
+  The copy is done forward, so DestinationBuffer must be below SourceBuffer
+  or the buffers must not overlap.
+
+  @param  DestinationBuffer The target of the copy request.
+  @param  SourceBuffer      The place to copy from.
+  @param  Length            The number of bytes to copy.
+  @param  NonTemporal       TRUE to write DestinationBuffer with non-temporal
+                            stores.
+
+  @return Destination
+
+**/
+VOID *
+EFIAPI
+InternalMemCopyMemAvx2 (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length,
+  IN      BOOLEAN     NonTemporal
+  );
+
+/**
+  Set Buffer to Value for Size bytes with SSE2 registers.
+
+  @param  Buffer   The memory to set.
+  @param  Length   The number of bytes to set.
+  @param  Value    The value of the set operation.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMemSse2 (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length,
+  IN      UINT8  Value
+  );
+
+/**
+  Set Buffer to Value for Size bytes with AVX2 registers.
+
+  @param  Buffer       The memory to set.
+  @param  Length       The number of bytes to set.
+  @param  Value        The value of the set operation.
+  @param  NonTemporal  TRUE to write Buffer with non-temporal stores.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMemAvx2 (
+  OUT     VOID     *Buffer,
+  IN      UINTN    Length,
+  IN      UINT8    Value,
+  IN      BOOLEAN  NonTemporal
+  );
+
+/**
+  Fills a target buffer with zeros with SSE2 registers.
+
+  @param  Buffer      The pointer to the target buffer to fill with zeros.
+  @param  Length      The number of bytes in Buffer to fill with zeros.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemZeroMemSse2 (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length
+  );
+
+/**
+  Check if the AVX2 kernels can be used for a buffer of Length bytes.
+
+  The processor support is queried once. The enabling of the YMM state is
+  checked on every call, because it is programmed per processor and an AP
+  may not have the same CR4 and XCR0 setup as the BSP.
+
+  @param  Length      The number of bytes to process.
+
+  @retval TRUE        The AVX2 kernels can be used.
+  @retval FALSE       The SSE2 kernels must be used.
+
+**/
+STATIC
+BOOLEAN
+InternalMemUseAvx2 (
+  IN      UINTN  Length
+  )
+{
+  UINT32                                       MaxLeaf;
+  CPUID_VERSION_INFO_ECX                       VersionEcx;
+  CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS_EBX  ExtendedEbx;
+  IA32_CR4                                     Cr4;
+
+  if (Length < MEM_LIB_AVX2_THRESHOLD) {
+    return FALSE;
+  }
+
+  if (mMemLibAvx2Support == MEM_LIB_AVX2_UNKNOWN) {
+    mMemLibAvx2Support = MEM_LIB_AVX2_UNSUPPORTED;
+    AsmCpuid (CPUID_SIGNATURE, &MaxLeaf, NULL, NULL, NULL);
+    if (MaxLeaf >= CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS) {
+      AsmCpuid (CPUID_VERSION_INFO, NULL, NULL, &VersionEcx.Uint32, NULL);
+      AsmCpuidEx (
+        CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS,
+        CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS_SUB_LEAF_INFO,
+        NULL,
+        &ExtendedEbx.Uint32,
+        NULL,
+        NULL
+        );
+      if ((VersionEcx.Bits.AVX == 1) && (ExtendedEbx.Bits.AVX2 == 1)) {
+        mMemLibAvx2Support = MEM_LIB_AVX2_SUPPORTED;
+      }
+    }
+  }
+
+  if (mMemLibAvx2Support != MEM_LIB_AVX2_SUPPORTED) {
+    return FALSE;
+  }
+
+  //
+  // XGETBV faults unless CR4.OSXSAVE is set. Both the SSE and the AVX state
+  // must be enabled in XCR0 to use the YMM registers.
+  //
+  Cr4.UintN = AsmReadCr4 ();
+  if (Cr4.Bits.OSXSAVE == 0) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)((AsmXGetBv (0) & (BIT1 | BIT2)) == (BIT1 | BIT2));
+}
+
+/**
+  Copy Length bytes from Source to Destination.
+
+  @param  DestinationBuffer The target of the copy request.
+  @param  SourceBuffer      The place to copy from.
+  @param  Length            The number of bytes to copy.
+
+  @return Destination
+
+**/
+VOID *
+EFIAPI
+InternalMemCopyMem (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  )
+{
+  //
+  // The AVX2 kernel only copies forward. An overlapped copy to a higher
+  // address is left to the SSE2 kernel, which copies backward.
+  //
+  if ((((UINTN)DestinationBuffer < (UINTN)SourceBuffer) ||
+       ((UINTN)DestinationBuffer - (UINTN)SourceBuffer >= Length)) &&
+      InternalMemUseAvx2 (Length))
+  {
+    return InternalMemCopyMemAvx2 (
+             DestinationBuffer,
+             SourceBuffer,
+             Length,
+             (BOOLEAN)(Length > MEM_LIB_AVX2_NON_TEMPORAL_THRESHOLD)
+             );
+  }
+
+  return InternalMemCopyMemSse2 (DestinationBuffer, SourceBuffer, Length);
+}
+
+/**
+  Set Buffer to Value for Size bytes.
+
+  @param  Buffer   The memory to set.
+  @param  Length   The number of bytes to set.
+  @param  Value    The value of the set operation.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMem (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length,
+  IN      UINT8  Value
+  )
+{
+  if (InternalMemUseAvx2 (Length)) {
+    return InternalMemSetMemAvx2 (
+             Buffer,
+             Length,
+             Value,
+             (BOOLEAN)(Length > MEM_LIB_AVX2_NON_TEMPORAL_THRESHOLD)
+             );
+  }
+
+  return InternalMemSetMemSse2 (Buffer, Length, Value);
+}
+
+/**
+  Fills a target buffer with zeros, and returns the target buffer.
+
+  @param  Buffer      The pointer to the target buffer to fill with zeros.
+  @param  Length      The number of bytes in Buffer to fill with zeros.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemZeroMem (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length
+  )
+{
+  if (InternalMemUseAvx2 (Length)) {
+    return InternalMemSetMemAvx2 (
+             Buffer,
+             Length,
+             0,
+             (BOOLEAN)(Length > MEM_LIB_AVX2_NON_TEMPORAL_THRESHOLD)
+             );
+  }
+
+  return InternalMemZeroMemSse2 (Buffer, Length);
+}
@@ -0,0 +1,769 @@
+/** @file
+  Compute the Authenticode hash of a PE/COFF image, as described in the PE/COFF
+  Specification 8.0 Appendix A.
+
+  Caution: This file requires additional review when modified.
+  This library will have external input - PE/COFF image.
+  This external input must be validated carefully to avoid security issue like
+  buffer overflow, integer overflow.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <IndustryStandard/PeImage.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PeCoffAuthenticodeHashLib.h>
+
+//
+// A part of the image file covered by the hash.
+//
+typedef struct {
+  UINTN    Offset;
+  UINTN    Size;
+} HASH_RANGE;
+
+typedef struct {
+  PE_COFF_AUTHENTICODE_HASH_UPDATE    HashUpdate;
+  VOID                                *HashContext;
+  UINTN                               ImageSize;
+  //
+  // The number of bytes of the image file received so far.
+  //
+  UINTN                               Position;
+  //
+  // The beginning of the image file, kept until the headers are complete.
+  //
+  UINT8                               *Headers;
+  UINTN                               HeadersBufferSize;
+  //
+  // The parts of the image covered by the hash, in hash order, and the next
+  // one to hash.
+  //
+  HASH_RANGE                          *Ranges;
+  UINTN                               RangeCount;
+  UINTN                               RangeIndex;
+  //
+  // A copy of the image file, only used when the ranges are not in file
+  // order. The image is then hashed by PeCoffAuthenticodeHashFinal().
+  //
+  UINT8                               *Image;
+  //
+  // The first error met by PeCoffAuthenticodeHashUpdate().
+  //
+  RETURN_STATUS                       Status;
+} AUTHENTICODE_HASH_STREAM;
+
+/**
+  Get the size of the image headers, from the beginning of the image file.
+
+  The size is found in several steps, each of them needing more data: the DOS
+  header, the PE header up to SizeOfHeaders, and then SizeOfHeaders bytes.
+
+  @param[in]  Data         The beginning of the image file.
+  @param[in]  DataSize     The size, in bytes, of Data.
+  @param[in]  ImageSize    The size, in bytes, of the image file.
+  @param[out] HeadersSize  The size of the image headers, or the size of data
+                           needed for the next step.
+
+  @retval RETURN_SUCCESS      *HeadersSize is the size of the image headers,
+                              and DataSize is not smaller.
+  @retval RETURN_NOT_READY    More data is needed. *HeadersSize is the size
+                              needed for the next step.
+  @retval RETURN_UNSUPPORTED  The image is not a valid PE/COFF image.
+**/
+STATIC
+RETURN_STATUS
+GetHeadersSize (
+  IN  CONST UINT8  *Data,
+  IN  UINTN        DataSize,
+  IN  UINTN        ImageSize,
+  OUT UINTN        *HeadersSize
+  )
+{
+  CONST EFI_IMAGE_DOS_HEADER           *DosHdr;
+  EFI_IMAGE_OPTIONAL_HEADER_PTR_UNION  Hdr;
+  UINT32                               PeCoffHeaderOffset;
+  UINTN                                Size;
+
+  *HeadersSize = sizeof (EFI_IMAGE_DOS_HEADER);
+  if (ImageSize < *HeadersSize) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if (DataSize < *HeadersSize) {
+    return RETURN_NOT_READY;
+  }
+
+  DosHdr             = (CONST EFI_IMAGE_DOS_HEADER *)Data;
+  PeCoffHeaderOffset = 0;
+  if (DosHdr->e_magic == EFI_IMAGE_DOS_SIGNATURE) {
+    PeCoffHeaderOffset = DosHdr->e_lfanew;
+  }
+
+  //
+  // SizeOfHeaders has the same offset in the PE32 and PE32+ optional headers.
+  //
+  Size = OFFSET_OF (EFI_IMAGE_NT_HEADERS32, OptionalHeader) +
+         OFFSET_OF (EFI_IMAGE_OPTIONAL_HEADER32, SizeOfHeaders) + sizeof (UINT32);
+  if ((PeCoffHeaderOffset > ImageSize) || (ImageSize - PeCoffHeaderOffset < Size)) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  *HeadersSize = PeCoffHeaderOffset + Size;
+  if (DataSize < *HeadersSize) {
+    return RETURN_NOT_READY;
+  }
+
+  Hdr.Pe32 = (EFI_IMAGE_NT_HEADERS32 *)(Data + PeCoffHeaderOffset);
+  if (Hdr.Pe32->Signature != EFI_IMAGE_NT_SIGNATURE) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if (Hdr.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+    Size = Hdr.Pe32->OptionalHeader.SizeOfHeaders;
+  } else if (Hdr.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+    Size = Hdr.Pe32Plus->OptionalHeader.SizeOfHeaders;
+  } else {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if ((Size < *HeadersSize) || (Size > ImageSize)) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  *HeadersSize = Size;
+  if (DataSize < *HeadersSize) {
+    return RETURN_NOT_READY;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Append a range to the hash ranges, unless it is empty.
+
+  @param[in, out] Ranges      The hash ranges.
+  @param[in, out] RangeCount  The number of hash ranges.
+  @param[in]      Offset      The offset of the range in the image file.
+  @param[in]      Size        The size of the range.
+**/
+STATIC
+VOID
+AddHashRange (
+  IN OUT HASH_RANGE  *Ranges,
+  IN OUT UINTN       *RangeCount,
+  IN     UINTN       Offset,
+  IN     UINTN       Size
+  )
+{
+  if (Size != 0) {
+    Ranges[*RangeCount].Offset = Offset;
+    Ranges[*RangeCount].Size   = Size;
+    (*RangeCount)++;
+  }
+}
+
+/**
+  Build the list of the parts of the image file covered by the Authenticode
+  hash, in hash order.
+
+  @param[in]  Headers      The image headers, as validated by GetHeadersSize().
+  @param[in]  HeadersSize  The size, in bytes, of the image headers.
+  @param[in]  ImageSize    The size, in bytes, of the image file.
+  @param[out] Ranges       The hash ranges, to free with FreePool().
+  @param[out] RangeCount   The number of hash ranges.
+
+  @retval RETURN_SUCCESS           The hash ranges are built.
+  @retval RETURN_UNSUPPORTED       The image is not a valid PE/COFF image.
+  @retval RETURN_OUT_OF_RESOURCES  Not enough memory is available.
+**/
+STATIC
+RETURN_STATUS
+BuildHashRanges (
+  IN  CONST UINT8  *Headers,
+  IN  UINTN        HeadersSize,
+  IN  UINTN        ImageSize,
+  OUT HASH_RANGE   **Ranges,
+  OUT UINTN        *RangeCount
+  )
+{
+  CONST EFI_IMAGE_DOS_HEADER           *DosHdr;
+  EFI_IMAGE_OPTIONAL_HEADER_PTR_UNION  Hdr;
+  UINT32                               PeCoffHeaderOffset;
+  UINTN                                OptionalHeaderEnd;
+  UINTN                                CheckSumOffset;
+  UINTN                                SecDataDirOffset;
+  UINT32                               NumberOfRvaAndSizes;
+  UINT32                               CertSize;
+  CONST EFI_IMAGE_SECTION_HEADER       *Section;
+  UINTN                                NumberOfSections;
+  HASH_RANGE                           *HashRanges;
+  UINTN                                Count;
+  UINTN                                FirstSection;
+  UINTN                                Index;
+  UINTN                                Pos;
+  UINT64                               SumOfBytesHashed;
+
+  DosHdr             = (CONST EFI_IMAGE_DOS_HEADER *)Headers;
+  PeCoffHeaderOffset = 0;
+  if (DosHdr->e_magic == EFI_IMAGE_DOS_SIGNATURE) {
+    PeCoffHeaderOffset = DosHdr->e_lfanew;
+  }
+
+  Hdr.Pe32          = (EFI_IMAGE_NT_HEADERS32 *)(Headers + PeCoffHeaderOffset);
+  OptionalHeaderEnd = PeCoffHeaderOffset + OFFSET_OF (EFI_IMAGE_NT_HEADERS32, OptionalHeader) +
+                      Hdr.Pe32->FileHeader.SizeOfOptionalHeader;
+  NumberOfSections = Hdr.Pe32->FileHeader.NumberOfSections;
+
+  if (Hdr.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+    //
+    // Use PE32 offset.
+    //
+    CheckSumOffset      = (UINTN)&Hdr.Pe32->OptionalHeader.CheckSum - (UINTN)Headers;
+    SecDataDirOffset    = (UINTN)&Hdr.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY] - (UINTN)Headers;
+    NumberOfRvaAndSizes = Hdr.Pe32->OptionalHeader.NumberOfRvaAndSizes;
+  } else {
+    //
+    // Use PE32+ offset.
+    //
+    CheckSumOffset      = (UINTN)&Hdr.Pe32Plus->OptionalHeader.CheckSum - (UINTN)Headers;
+    SecDataDirOffset    = (UINTN)&Hdr.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY] - (UINTN)Headers;
+    NumberOfRvaAndSizes = Hdr.Pe32Plus->OptionalHeader.NumberOfRvaAndSizes;
+  }
+
+  //
+  // The optional header, up to the Cert Directory when there is one, and the
+  // section headers must be in the image headers.
+  //
+  if ((OptionalHeaderEnd > HeadersSize) ||
+      ((HeadersSize - OptionalHeaderEnd) / sizeof (EFI_IMAGE_SECTION_HEADER) < NumberOfSections) ||
+      (CheckSumOffset + sizeof (UINT32) > OptionalHeaderEnd))
+  {
+    return RETURN_UNSUPPORTED;
+  }
+
+  CertSize = 0;
+  if (NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
+    if (SecDataDirOffset + sizeof (EFI_IMAGE_DATA_DIRECTORY) > OptionalHeaderEnd) {
+      return RETURN_UNSUPPORTED;
+    }
+
+    CertSize = ((CONST EFI_IMAGE_DATA_DIRECTORY *)(Headers + SecDataDirOffset))->Size;
+  }
+
+  //
+  // Three ranges for the headers, one for each section and one for the data
+  // after the sections.
+  //
+  HashRanges = AllocatePool ((3 + NumberOfSections + 1) * sizeof (HASH_RANGE));
+  if (HashRanges == NULL) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Hash the image header from its base to beginning of the image checksum,
+  // skip over the image checksum, and hash everything up to the end of the
+  // image header but the Cert Directory.
+  //
+  Count = 0;
+  AddHashRange (HashRanges, &Count, 0, CheckSumOffset);
+  if (NumberOfRvaAndSizes <= EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
+    AddHashRange (HashRanges, &Count, CheckSumOffset + sizeof (UINT32), HeadersSize - CheckSumOffset - sizeof (UINT32));
+  } else {
+    AddHashRange (HashRanges, &Count, CheckSumOffset + sizeof (UINT32), SecDataDirOffset - CheckSumOffset - sizeof (UINT32));
+    AddHashRange (
+      HashRanges,
+      &Count,
+      SecDataDirOffset + sizeof (EFI_IMAGE_DATA_DIRECTORY),
+      HeadersSize - SecDataDirOffset - sizeof (EFI_IMAGE_DATA_DIRECTORY)
+      );
+  }
+
+  //
+  // Hash the sections with raw data, sorted by their offset in the image file.
+  //
+  SumOfBytesHashed = HeadersSize;
+  FirstSection     = Count;
+  Section          = (CONST EFI_IMAGE_SECTION_HEADER *)(Headers + OptionalHeaderEnd);
+  for (Index = 0; Index < NumberOfSections; Index++, Section++) {
+    if (Section->SizeOfRawData == 0) {
+      continue;
+    }
+
+    if ((Section->PointerToRawData > ImageSize) ||
+        (Section->SizeOfRawData > ImageSize - Section->PointerToRawData))
+    {
+      FreePool (HashRanges);
+      return RETURN_UNSUPPORTED;
+    }
+
+    Pos = Count;
+    while ((Pos > FirstSection) && (Section->PointerToRawData < HashRanges[Pos - 1].Offset)) {
+      HashRanges[Pos] = HashRanges[Pos - 1];
+      Pos--;
+    }
+
+    HashRanges[Pos].Offset = Section->PointerToRawData;
+    HashRanges[Pos].Size   = Section->SizeOfRawData;
+    Count++;
+
+    SumOfBytesHashed += Section->SizeOfRawData;
+  }
+
+  //
+  // If the file size is greater than SUM_OF_BYTES_HASHED, there is extra data
+  // in the file that needs to be added to the hash. This data begins at file
+  // offset SUM_OF_BYTES_HASHED and its length is:
+  //        FileSize  -  (CertDirectory->Size)
+  //
+  if (ImageSize > SumOfBytesHashed) {
+    if (ImageSize - SumOfBytesHashed < CertSize) {
+      FreePool (HashRanges);
+      return RETURN_UNSUPPORTED;
+    }
+
+    AddHashRange (HashRanges, &Count, (UINTN)SumOfBytesHashed, ImageSize - (UINTN)SumOfBytesHashed - CertSize);
+  }
+
+  *Ranges     = HashRanges;
+  *RangeCount = Count;
+  return RETURN_SUCCESS;
+}
+
+/**
+  Check whether the hash ranges are in file order, and do not overlap.
+
+  @param[in] Ranges      The hash ranges.
+  @param[in] RangeCount  The number of hash ranges.
+
+  @retval TRUE   The ranges can be hashed as the image file is received.
+  @retval FALSE  The image file must be received entirely before it is hashed.
+**/
+STATIC
+BOOLEAN
+AreHashRangesInFileOrder (
+  IN CONST HASH_RANGE  *Ranges,
+  IN UINTN             RangeCount
+  )
+{
+  UINTN  Index;
+
+  for (Index = 1; Index < RangeCount; Index++) {
+    if (Ranges[Index].Offset < Ranges[Index - 1].Offset + Ranges[Index - 1].Size) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+  Hash the ranges of an image file in a buffer.
+
+  @param[in] Image        The image file.
+  @param[in] Ranges       The hash ranges.
+  @param[in] RangeCount   The number of hash ranges.
+  @param[in] HashUpdate   The function that hashes the data.
+  @param[in] HashContext  The context passed to HashUpdate.
+
+  @retval RETURN_SUCCESS  The ranges are hashed.
+  @retval Others          The error returned by HashUpdate.
+**/
+STATIC
+RETURN_STATUS
+HashRangesInBuffer (
+  IN CONST UINT8                       *Image,
+  IN CONST HASH_RANGE                  *Ranges,
+  IN UINTN                             RangeCount,
+  IN PE_COFF_AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN VOID                              *HashContext
+  )
+{
+  RETURN_STATUS  Status;
+  UINTN          Index;
+
+  for (Index = 0; Index < RangeCount; Index++) {
+    Status = HashUpdate (HashContext, Image + Ranges[Index].Offset, Ranges[Index].Size);
+    if (RETURN_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Hash the parts of a chunk of the image file that are covered by the hash.
+
+  The hash ranges must be in file order.
+
+  @param[in, out] Stream    The Authenticode hash stream.
+  @param[in]      Offset    The offset of the chunk in the image file.
+  @param[in]      Data      The chunk of the image file.
+  @param[in]      DataSize  The size, in bytes, of Data.
+
+  @retval RETURN_SUCCESS  The chunk is hashed.
+  @retval Others          The error returned by HashUpdate.
+**/
+STATIC
+RETURN_STATUS
+HashRangesInChunk (
+  IN OUT AUTHENTICODE_HASH_STREAM  *Stream,
+  IN     UINTN                     Offset,
+  IN     CONST UINT8               *Data,
+  IN     UINTN                     DataSize
+  )
+{
+  RETURN_STATUS  Status;
+  HASH_RANGE     *Range;
+  UINTN          Size;
+
+  while ((DataSize != 0) && (Stream->RangeIndex < Stream->RangeCount)) {
+    Range = &Stream->Ranges[Stream->RangeIndex];
+    if (Offset < Range->Offset) {
+      //
+      // Skip the data before the range.
+      //
+      Size = MIN (Range->Offset - Offset, DataSize);
+    } else {
+      Size   = MIN (Range->Offset + Range->Size - Offset, DataSize);
+      Status = Stream->HashUpdate (Stream->HashContext, Data, Size);
+      if (RETURN_ERROR (Status)) {
+        return Status;
+      }
+
+      if (Offset + Size == Range->Offset + Range->Size) {
+        Stream->RangeIndex++;
+      }
+    }
+
+    Offset   += Size;
+    Data     += Size;
+    DataSize -= Size;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Compute the Authenticode hash of a PE/COFF image in a buffer.
+
+  HashUpdate is called with the parts of the image covered by the hash, in the
+  order required by Authenticode. The caller initializes its hash algorithms
+  before, and finalizes them after, the call.
+
+  The image is expected to have been checked by PeCoffLoaderGetImageInfo().
+
+  @param[in] Image        The PE/COFF image.
+  @param[in] ImageSize    The size, in bytes, of the image file.
+  @param[in] HashUpdate   The function that hashes the data.
+  @param[in] HashContext  The context passed to HashUpdate.
+
+  @retval RETURN_SUCCESS            The image is hashed.
+  @retval RETURN_INVALID_PARAMETER  Image or HashUpdate is NULL.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image.
+  @retval RETURN_OUT_OF_RESOURCES   Not enough memory is available.
+  @retval Others                    The error returned by HashUpdate.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashImage (
+  IN CONST VOID                        *Image,
+  IN UINTN                             ImageSize,
+  IN PE_COFF_AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN VOID                              *HashContext
+  )
+{
+  RETURN_STATUS  Status;
+  UINTN          HeadersSize;
+  HASH_RANGE     *Ranges;
+  UINTN          RangeCount;
+
+  if ((Image == NULL) || (HashUpdate == NULL)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  Status = GetHeadersSize (Image, ImageSize, ImageSize, &HeadersSize);
+  if (RETURN_ERROR (Status)) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  Status = BuildHashRanges (Image, HeadersSize, ImageSize, &Ranges, &RangeCount);
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = HashRangesInBuffer (Image, Ranges, RangeCount, HashUpdate, HashContext);
+
+  FreePool (Ranges);
+  return Status;
+}
+
+/**
+  Start the Authenticode hash of a PE/COFF image that is streamed.
+
+  The image file is then passed in order, in chunks of any size, to
+  PeCoffAuthenticodeHashUpdate(). HashUpdate is called with the parts of the
+  image covered by the hash as soon as they are received.
+
+  @param[in]  ImageSize    The size, in bytes, of the image file.
+  @param[in]  HashUpdate   The function that hashes the data.
+  @param[in]  HashContext  The context passed to HashUpdate.
+  @param[out] Context      The context of the stream, to pass to
+                           PeCoffAuthenticodeHashUpdate() and
+                           PeCoffAuthenticodeHashFinal() or
+                           PeCoffAuthenticodeHashAbort().
+
+  @retval RETURN_SUCCESS            The stream is started.
+  @retval RETURN_INVALID_PARAMETER  HashUpdate or Context is NULL.
+  @retval RETURN_OUT_OF_RESOURCES   Not enough memory is available.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashStart (
+  IN  UINTN                             ImageSize,
+  IN  PE_COFF_AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN  VOID                              *HashContext,
+  OUT VOID                              **Context
+  )
+{
+  AUTHENTICODE_HASH_STREAM  *Stream;
+
+  if ((HashUpdate == NULL) || (Context == NULL)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  Stream = AllocateZeroPool (sizeof (AUTHENTICODE_HASH_STREAM));
+  if (Stream == NULL) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  Stream->HashUpdate  = HashUpdate;
+  Stream->HashContext = HashContext;
+  Stream->ImageSize   = ImageSize;
+  Stream->Status      = RETURN_SUCCESS;
+
+  *Context = Stream;
+  return RETURN_SUCCESS;
+}
+
+/**
+  Pass the next chunk of the image file to an Authenticode hash stream.
+
+  The headers of the image are kept until SizeOfHeaders bytes are received, so
+  they need not be passed in a single chunk.
+
+  @param[in] Context   The context returned by PeCoffAuthenticodeHashStart().
+  @param[in] Data      The chunk of the image file, that follows the previous
+                       one.
+  @param[in] DataSize  The size, in bytes, of Data.
+
+  @retval RETURN_SUCCESS            The chunk is processed.
+  @retval RETURN_INVALID_PARAMETER  Context is NULL, or Data is NULL and
+                                    DataSize is not 0.
+  @retval RETURN_BAD_BUFFER_SIZE    More than ImageSize bytes are passed.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image.
+  @retval RETURN_OUT_OF_RESOURCES   Not enough memory is available.
+  @retval Others                    The error returned by HashUpdate.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashUpdate (
+  IN VOID        *Context,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  )
+{
+  AUTHENTICODE_HASH_STREAM  *Stream;
+  CONST UINT8               *Chunk;
+  RETURN_STATUS             Status;
+  UINTN                     HeadersSize;
+  UINTN                     Size;
+  VOID                      *Buffer;
+
+  Stream = Context;
+  Chunk  = Data;
+  if ((Stream == NULL) || ((Chunk == NULL) && (DataSize != 0))) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (RETURN_ERROR (Stream->Status)) {
+    return Stream->Status;
+  }
+
+  if (DataSize > Stream->ImageSize - Stream->Position) {
+    Status = RETURN_BAD_BUFFER_SIZE;
+    goto Done;
+  }
+
+  //
+  // Keep the beginning of the image file until the hash ranges can be built.
+  //
+  while (Stream->Ranges == NULL) {
+    Status = GetHeadersSize (Stream->Headers, Stream->Position, Stream->ImageSize, &HeadersSize);
+    if (Status == RETURN_SUCCESS) {
+      Status = BuildHashRanges (Stream->Headers, HeadersSize, Stream->ImageSize, &Stream->Ranges, &Stream->RangeCount);
+      if (RETURN_ERROR (Status)) {
+        goto Done;
+      }
+
+      if (AreHashRangesInFileOrder (Stream->Ranges, Stream->RangeCount)) {
+        Status = HashRangesInChunk (Stream, 0, Stream->Headers, Stream->Position);
+        if (RETURN_ERROR (Status)) {
+          goto Done;
+        }
+      } else {
+        //
+        // Some sections overlap, or the data after the sections starts before
+        // their end. The image file is kept whole to hash it in Final.
+        //
+        DEBUG ((DEBUG_INFO, "PeCoffAuthenticodeHash: Sections are not in file order, keeping the whole image.\n"));
+        Stream->Image = AllocatePool (Stream->ImageSize);
+        if (Stream->Image == NULL) {
+          Status = RETURN_OUT_OF_RESOURCES;
+          goto Done;
+        }
+
+        CopyMem (Stream->Image, Stream->Headers, Stream->Position);
+      }
+
+      FreePool (Stream->Headers);
+      Stream->Headers = NULL;
+      break;
+    }
+
+    if ((Status != RETURN_NOT_READY) || (DataSize == 0)) {
+      goto Done;
+    }
+
+    if (Stream->HeadersBufferSize < HeadersSize) {
+      Buffer = ReallocatePool (Stream->HeadersBufferSize, HeadersSize, Stream->Headers);
+      if (Buffer == NULL) {
+        Status = RETURN_OUT_OF_RESOURCES;
+        goto Done;
+      }
+
+      Stream->Headers           = Buffer;
+      Stream->HeadersBufferSize = HeadersSize;
+    }
+
+    Size = MIN (HeadersSize - Stream->Position, DataSize);
+    CopyMem (Stream->Headers + Stream->Position, Chunk, Size);
+    Stream->Position += Size;
+    Chunk            += Size;
+    DataSize         -= Size;
+  }
+
+  if (Stream->Image != NULL) {
+    CopyMem (Stream->Image + Stream->Position, Chunk, DataSize);
+    Status = RETURN_SUCCESS;
+  } else {
+    Status = HashRangesInChunk (Stream, Stream->Position, Chunk, DataSize);
+  }
+
+  Stream->Position += DataSize;
+
+Done:
+  if (RETURN_ERROR (Status) && (Status != RETURN_NOT_READY)) {
+    Stream->Status = Status;
+    return Status;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Complete an Authenticode hash stream, and free its context.
+
+  On success all the data covered by the hash has been passed to HashUpdate,
+  and the caller can finalize its hash algorithms.
+
+  @param[in] Context  The context returned by PeCoffAuthenticodeHashStart().
+
+  @retval RETURN_SUCCESS            The image is hashed.
+  @retval RETURN_INVALID_PARAMETER  Context is NULL.
+  @retval RETURN_NOT_READY          Less than ImageSize bytes were passed.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image.
+  @retval Others                    An error returned by a previous call to
+                                    PeCoffAuthenticodeHashUpdate(), or by
+                                    HashUpdate.
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffAuthenticodeHashFinal (
+  IN VOID  *Context
+  )
+{
+  AUTHENTICODE_HASH_STREAM  *Stream;
+  RETURN_STATUS             Status;
+
+  Stream = Context;
+  if (Stream == NULL) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  Status = Stream->Status;
+  if (RETURN_ERROR (Status)) {
+    goto Done;
+  }
+
+  if (Stream->Position != Stream->ImageSize) {
+    Status = RETURN_NOT_READY;
+    goto Done;
+  }
+
+  if (Stream->Ranges == NULL) {
+    Status = RETURN_UNSUPPORTED;
+    goto Done;
+  }
+
+  if (Stream->Image != NULL) {
+    Status = HashRangesInBuffer (Stream->Image, Stream->Ranges, Stream->RangeCount, Stream->HashUpdate, Stream->HashContext);
+  } else {
+    ASSERT (Stream->RangeIndex == Stream->RangeCount);
+  }
+
+Done:
+  PeCoffAuthenticodeHashAbort (Stream);
+  return Status;
+}
+
+/**
+  Free the context of an Authenticode hash stream that is not completed.
+
+  @param[in] Context  The context returned by PeCoffAuthenticodeHashStart(),
+                      or NULL.
+**/
+VOID
+EFIAPI
+PeCoffAuthenticodeHashAbort (
+  IN VOID  *Context
+  )
+{
+  AUTHENTICODE_HASH_STREAM  *Stream;
+
+  Stream = Context;
+  if (Stream == NULL) {
+    return;
+  }
+
+  if (Stream->Headers != NULL) {
+    FreePool (Stream->Headers);
+  }
+
+  if (Stream->Ranges != NULL) {
+    FreePool (Stream->Ranges);
+  }
+
+  if (Stream->Image != NULL) {
+    FreePool (Stream->Image);
+  }
+
+  FreePool (Stream);
+}
@@ -14,6 +14,9 @@
 
   Shift mBitBuf NumOfBits left. Read in NumOfBits of bits from source.
 
+  The source bits are read ahead into mBitReservoir, a natural width word,
+  so the source is only read once every few calls.
+
   @param  Sd        The global scratch data.
   @param  NumOfBits The number of bits to shift and read.
 
@@ -24,43 +27,54 @@ FillBuf (
   IN  UINT16        NumOfBits
   )
 {
-  //
-  // Left shift NumOfBits of bits in advance
-  //
-  Sd->mBitBuf = (UINT32)LShiftU64 (((UINT64)Sd->mBitBuf), NumOfBits);
+  UINT32  InBuf;
 
   //
-  // Copy data needed in bytes into mSbuBitBuf
+  // Move at most 16 bits at a time, so that a 32-bit mBitReservoir can
+  // always supply them.
   //
-  while (NumOfBits > Sd->mBitCount) {
-    NumOfBits    = (UINT16)(NumOfBits - Sd->mBitCount);
-    Sd->mBitBuf |= (UINT32)LShiftU64 (((UINT64)Sd->mSubBitBuf), NumOfBits);
+  while (NumOfBits > 16) {
+    FillBuf (Sd, 16);
+    NumOfBits = (UINT16)(NumOfBits - 16);
+  }
 
-    if (Sd->mCompSize > 0) {
-      //
-      // Get 1 byte into SubBitBuf
-      //
-      Sd->mCompSize--;
-      Sd->mSubBitBuf = Sd->mSrcBase[Sd->mInBuf++];
-      Sd->mBitCount  = 8;
+  if (NumOfBits == 0) {
+    return;
+  }
+
+  if (Sd->mBitCount < NumOfBits) {
+    //
+    // Fill up mBitReservoir with whole bytes from source.
+    //
+    if (Sd->mCompSize >= sizeof (UINTN)) {
+      InBuf = Sd->mInBuf;
+      do {
+        Sd->mBitReservoir |= (UINTN)Sd->mSrcBase[Sd->mInBuf++] << (BIT_RESERVOIR_SIZE - 8 - Sd->mBitCount);
+        Sd->mBitCount      = (UINT16)(Sd->mBitCount + 8);
+      } while (Sd->mBitCount <= BIT_RESERVOIR_SIZE - 8);
+
+      Sd->mCompSize -= Sd->mInBuf - InBuf;
     } else {
-      //
-      // No more bits from the source, just pad zero bit.
-      //
-      Sd->mSubBitBuf = 0;
-      Sd->mBitCount  = 8;
+      do {
+        if (Sd->mCompSize > 0) {
+          Sd->mCompSize--;
+          Sd->mBitReservoir |= (UINTN)Sd->mSrcBase[Sd->mInBuf++] << (BIT_RESERVOIR_SIZE - 8 - Sd->mBitCount);
+        }
+
+        //
+        // No more bits from the source, just pad zero bits.
+        //
+        Sd->mBitCount = (UINT16)(Sd->mBitCount + 8);
+      } while (Sd->mBitCount <= BIT_RESERVOIR_SIZE - 8);
     }
   }
 
   //
-  // Calculate additional bit count read to update mBitCount
+  // Move NumOfBits of bits from mBitReservoir into mBitBuf
   //
-  Sd->mBitCount = (UINT16)(Sd->mBitCount - NumOfBits);
-
-  //
-  // Copy NumOfBits of bits from mSubBitBuf into mBitBuf
-  //
-  Sd->mBitBuf |= Sd->mSubBitBuf >> Sd->mBitCount;
+  Sd->mBitBuf       = (Sd->mBitBuf << NumOfBits) | (UINT32)(Sd->mBitReservoir >> (BIT_RESERVOIR_SIZE - NumOfBits));
+  Sd->mBitReservoir = Sd->mBitReservoir << NumOfBits;
+  Sd->mBitCount     = (UINT16)(Sd->mBitCount - NumOfBits);
 }
 
 /**
@@ -559,11 +573,25 @@ Decode (
   UINT16  BytesRemain;
   UINT32  DataIdx;
   UINT16  CharC;
+  UINT8   *DstBase;
+  UINT32  OutBuf;
+  UINT32  OrigSize;
+  UINT8   *String;
+  UINT8   *Dst;
+  UINT8   *DstEnd;
 
   BytesRemain = (UINT16)(-1);
 
   DataIdx = 0;
 
+  //
+  // Keep the output state in local variables, as the writes to mDstBase
+  // could otherwise alias the scratch data.
+  //
+  DstBase  = Sd->mDstBase;
+  OutBuf   = Sd->mOutBuf;
+  OrigSize = Sd->mOrigSize;
+
   for ( ; ;) {
     //
     // Get one code from mBitBuf
@@ -577,13 +605,13 @@ Decode (
       //
       // Process an Original character
       //
-      if (Sd->mOutBuf >= Sd->mOrigSize) {
+      if (OutBuf >= OrigSize) {
         goto Done;
       } else {
         //
         // Write orignal character into mDstBase
         //
-        Sd->mDstBase[Sd->mOutBuf++] = (UINT8)CharC;
+        DstBase[OutBuf++] = (UINT8)CharC;
       }
     } else {
       //
@@ -599,7 +627,23 @@ Decode (
       //
       // Locate string position
       //
-      DataIdx = Sd->mOutBuf - DecodeP (Sd) - 1;
+      DataIdx = OutBuf - DecodeP (Sd) - 1;
+
+      if ((DataIdx < OutBuf) && (BytesRemain <= OrigSize - OutBuf)) {
+        //
+        // The string is in the data already decoded, and fits in mDstBase.
+        // Copy it byte by byte, as it may overlap the bytes being written.
+        //
+        String = DstBase + DataIdx;
+        Dst    = DstBase + OutBuf;
+        DstEnd = Dst + BytesRemain;
+        while (Dst < DstEnd) {
+          *(Dst++) = *(String++);
+        }
+
+        OutBuf      = OutBuf + BytesRemain;
+        BytesRemain = 0;
+      }
 
       //
       // Write BytesRemain of bytes into mDstBase
@@ -607,16 +651,16 @@ Decode (
       BytesRemain--;
 
       while ((INT16)(BytesRemain) >= 0) {
-        if (Sd->mOutBuf >= Sd->mOrigSize) {
+        if (OutBuf >= OrigSize) {
           goto Done;
         }
 
-        if (DataIdx >= Sd->mOrigSize) {
+        if (DataIdx >= OrigSize) {
           Sd->mBadTableFlag = (UINT16)BAD_TABLE;
           goto Done;
         }
 
-        Sd->mDstBase[Sd->mOutBuf++] = Sd->mDstBase[DataIdx++];
+        DstBase[OutBuf++] = DstBase[DataIdx++];
 
         BytesRemain--;
       }
@@ -624,13 +668,14 @@ Decode (
       //
       // Once mOutBuf is fully filled, directly return
       //
-      if (Sd->mOutBuf >= Sd->mOrigSize) {
+      if (OutBuf >= OrigSize) {
         goto Done;
       }
     }
   }
 
 Done:
+  Sd->mOutBuf = OutBuf;
   return;
 }
 
@@ -23,6 +23,11 @@
 #define CODE_BIT   16
 #define BAD_TABLE  - 1
 
+//
+// Size in bits of the buffer of source bits that follow mBitBuf.
+//
+#define BIT_RESERVOIR_SIZE  (sizeof (UINTN) * 8)
+
 //
 // C: Char&Len Set; P: Position Set; T: exTra Set
 //
@@ -44,9 +49,9 @@ typedef struct {
   UINT32    mOutBuf;
   UINT32    mInBuf;
 
-  UINT16    mBitCount;
+  UINT16    mBitCount;     // The number of bits in mBitReservoir
   UINT32    mBitBuf;
-  UINT32    mSubBitBuf;
+  UINTN     mBitReservoir; // The source bits that follow mBitBuf, from the most significant bit
   UINT16    mBlockSize;
   UINT32    mCompSize;
   UINT32    mOrigSize;
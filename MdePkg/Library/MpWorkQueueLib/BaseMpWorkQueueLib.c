@@ -0,0 +1,64 @@
+/** @file
+  MpWorkQueueLib instance that executes all the tasks on the calling processor.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <Library/MpWorkQueueLib.h>
+
+/**
+  Execute a set of tasks, sharing them between the calling processor and the
+  other processors that are available.
+
+  This instance executes all the tasks on the calling processor.
+
+  @param[in] Task                   The function executing one task.
+  @param[in] Context                The context passed to Task.
+  @param[in] TaskCount              The number of tasks.
+  @param[in] TimeoutInMicroseconds  Not used.
+
+  @retval RETURN_SUCCESS            All the tasks are completed.
+  @retval RETURN_INVALID_PARAMETER  Task is NULL.
+  @retval RETURN_INVALID_PARAMETER  TaskCount is bigger than MAX_INT32.
+**/
+RETURN_STATUS
+EFIAPI
+MpWorkQueueRun (
+  IN MP_WORK_QUEUE_TASK  Task,
+  IN VOID                *Context,
+  IN UINTN               TaskCount,
+  IN UINTN               TimeoutInMicroseconds
+  )
+{
+  UINTN  TaskIndex;
+
+  if ((Task == NULL) || (TaskCount > MAX_INT32)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  for (TaskIndex = 0; TaskIndex < TaskCount; TaskIndex++) {
+    Task (Context, TaskIndex);
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Return the number of processors that may execute tasks at the same time in
+  MpWorkQueueRun(), the calling processor included.
+
+  This instance executes all the tasks on the calling processor.
+
+  @return 1.
+**/
+UINTN
+EFIAPI
+MpWorkQueueGetProcessorCount (
+  VOID
+  )
+{
+  return 1;
+}
@@ -0,0 +1,133 @@
+/** @file
+  MpWorkQueueLib instance that shares the tasks with the APs in MM.
+
+  The APs that are in MM are started with MmStartupThisAp(), which does not
+  wait for them, so the BSP claims tasks too while they run. An AP in MM cannot
+  be stopped, so the BSP always waits until every AP leaves the work queue.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiMm.h>
+#include <Library/MmServicesTableLib.h>
+
+#include "MpWorkQueueCommon.h"
+
+/**
+  Claim and execute the tasks of a work queue on an AP.
+
+  @param[in] Buffer  The work queue.
+**/
+VOID
+EFIAPI
+MmMpWorkQueueApProcedure (
+  IN VOID  *Buffer
+  )
+{
+  MP_WORK_QUEUE  *Queue;
+
+  Queue = (MP_WORK_QUEUE *)Buffer;
+  MpWorkQueueProcess (Queue);
+
+  //
+  // This is the last access of the AP to the work queue.
+  //
+  InterlockedDecrement (&Queue->ActiveAps);
+}
+
+/**
+  Execute a set of tasks, sharing them between the calling processor and the
+  other processors that are available.
+
+  Task is called once for each task index, in no particular order and possibly
+  on several processors at the same time. So a task must only write the data of
+  its own index, and must only use services that are safe to call on an AP.
+
+  If no AP is in MM, or the APs cannot be started, all the tasks are executed
+  on the calling processor.
+
+  @param[in] Task                   The function executing one task.
+  @param[in] Context                The context passed to Task.
+  @param[in] TaskCount              The number of tasks.
+  @param[in] TimeoutInMicroseconds  Not used, as the APs in MM cannot be
+                                    stopped.
+
+  @retval RETURN_SUCCESS            All the tasks are completed.
+  @retval RETURN_INVALID_PARAMETER  Task is NULL.
+  @retval RETURN_INVALID_PARAMETER  TaskCount is bigger than MAX_INT32.
+**/
+RETURN_STATUS
+EFIAPI
+MpWorkQueueRun (
+  IN MP_WORK_QUEUE_TASK  Task,
+  IN VOID                *Context,
+  IN UINTN               TaskCount,
+  IN UINTN               TimeoutInMicroseconds
+  )
+{
+  EFI_STATUS     Status;
+  MP_WORK_QUEUE  Queue;
+  UINTN          Index;
+
+  if ((Task == NULL) || (TaskCount > MAX_INT32)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if ((TaskCount < 2) || (gMmst == NULL) || (gMmst->NumberOfCpus < 2)) {
+    MpWorkQueueRunOnCaller (Task, Context, TaskCount);
+    return RETURN_SUCCESS;
+  }
+
+  Status = MpWorkQueueInitialize (&Queue, Task, Context, TaskCount);
+  if (EFI_ERROR (Status)) {
+    MpWorkQueueRunOnCaller (Task, Context, TaskCount);
+    return RETURN_SUCCESS;
+  }
+
+  for (Index = 0; Index < gMmst->NumberOfCpus; Index++) {
+    if (Index == gMmst->CurrentlyExecutingCpu) {
+      continue;
+    }
+
+    //
+    // Count the AP before it starts, as it may complete before
+    // MmStartupThisAp() returns.
+    //
+    InterlockedIncrement (&Queue.ActiveAps);
+    Status = gMmst->MmStartupThisAp (MmMpWorkQueueApProcedure, Index, &Queue);
+    if (EFI_ERROR (Status)) {
+      InterlockedDecrement (&Queue.ActiveAps);
+    }
+  }
+
+  MpWorkQueueProcess (&Queue);
+
+  while (Queue.ActiveAps != 0) {
+    CpuPause ();
+  }
+
+  MpWorkQueueFinish (&Queue);
+  return RETURN_SUCCESS;
+}
+
+/**
+  Return the number of processors that may execute tasks at the same time in
+  MpWorkQueueRun(), the calling processor included.
+
+  @return The number of processors in MM, or 1 if the MM Services Table is not
+          available.
+**/
+UINTN
+EFIAPI
+MpWorkQueueGetProcessorCount (
+  VOID
+  )
+{
+  if ((gMmst == NULL) || (gMmst->NumberOfCpus == 0)) {
+    return 1;
+  }
+
+  return gMmst->NumberOfCpus;
+}
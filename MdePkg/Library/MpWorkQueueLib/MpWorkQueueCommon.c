@@ -0,0 +1,123 @@
+/** @file
+  Work queue shared by the MP instances of MpWorkQueueLib.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include "MpWorkQueueCommon.h"
+
+/**
+  Initialize a work queue.
+
+  @param[out] Queue      The work queue.
+  @param[in]  Task       The function executing one task.
+  @param[in]  Context    The context passed to Task.
+  @param[in]  TaskCount  The number of tasks.
+
+  @retval RETURN_SUCCESS           The work queue is initialized.
+  @retval RETURN_OUT_OF_RESOURCES  The completion flags cannot be allocated.
+**/
+RETURN_STATUS
+MpWorkQueueInitialize (
+  OUT MP_WORK_QUEUE       *Queue,
+  IN  MP_WORK_QUEUE_TASK  Task,
+  IN  VOID                *Context,
+  IN  UINTN               TaskCount
+  )
+{
+  ASSERT (TaskCount <= MAX_INT32);
+
+  Queue->Task      = Task;
+  Queue->Context   = Context;
+  Queue->TaskCount = (UINT32)TaskCount;
+  Queue->NextTask  = 0;
+  Queue->ActiveAps = 0;
+  Queue->Completed = AllocateZeroPool (TaskCount * sizeof (BOOLEAN));
+  if (Queue->Completed == NULL) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Claim and execute the tasks of a work queue until none is left.
+
+  It is executed by every processor taking part, the BSP included.
+
+  @param[in] Buffer  The work queue.
+**/
+VOID
+EFIAPI
+MpWorkQueueProcess (
+  IN VOID  *Buffer
+  )
+{
+  MP_WORK_QUEUE  *Queue;
+  UINT32         TaskIndex;
+
+  Queue = (MP_WORK_QUEUE *)Buffer;
+
+  //
+  // Every processor increments NextTask once more after the last task is
+  // claimed, which cannot wrap around as TaskCount is at most MAX_INT32.
+  //
+  while (TRUE) {
+    TaskIndex = InterlockedIncrement (&Queue->NextTask) - 1;
+    if (TaskIndex >= Queue->TaskCount) {
+      break;
+    }
+
+    Queue->Task (Queue->Context, TaskIndex);
+    Queue->Completed[TaskIndex] = TRUE;
+  }
+}
+
+/**
+  Execute the tasks that are not completed on the calling processor, and free
+  the resources of a work queue.
+
+  It must only be called once no AP works on the queue any more.
+
+  @param[in] Queue  The work queue.
+**/
+VOID
+MpWorkQueueFinish (
+  IN MP_WORK_QUEUE  *Queue
+  )
+{
+  UINT32  TaskIndex;
+
+  for (TaskIndex = 0; TaskIndex < Queue->TaskCount; TaskIndex++) {
+    if (!Queue->Completed[TaskIndex]) {
+      DEBUG ((DEBUG_WARN, "%a: Task %d is not completed by an AP\n", __FUNCTION__, TaskIndex));
+      Queue->Task (Queue->Context, TaskIndex);
+    }
+  }
+
+  FreePool ((VOID *)Queue->Completed);
+}
+
+/**
+  Execute all the tasks on the calling processor.
+
+  @param[in] Task       The function executing one task.
+  @param[in] Context    The context passed to Task.
+  @param[in] TaskCount  The number of tasks.
+**/
+VOID
+MpWorkQueueRunOnCaller (
+  IN MP_WORK_QUEUE_TASK  Task,
+  IN VOID                *Context,
+  IN UINTN               TaskCount
+  )
+{
+  UINTN  TaskIndex;
+
+  for (TaskIndex = 0; TaskIndex < TaskCount; TaskIndex++) {
+    Task (Context, TaskIndex);
+  }
+}
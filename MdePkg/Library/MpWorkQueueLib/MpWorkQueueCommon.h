@@ -0,0 +1,92 @@
+/** @file
+  Internal definitions shared by the MP instances of MpWorkQueueLib.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MP_WORK_QUEUE_COMMON_H_
+#define MP_WORK_QUEUE_COMMON_H_
+
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/MpWorkQueueLib.h>
+
+typedef struct {
+  MP_WORK_QUEUE_TASK    Task;
+  VOID                  *Context;
+  UINT32                TaskCount;
+  //
+  // Index of the next task to claim, incremented by every processor.
+  //
+  volatile UINT32       NextTask;
+  //
+  // Number of APs that still work on the queue.
+  //
+  volatile UINT32       ActiveAps;
+  volatile BOOLEAN      *Completed;
+} MP_WORK_QUEUE;
+
+/**
+  Initialize a work queue.
+
+  @param[out] Queue      The work queue.
+  @param[in]  Task       The function executing one task.
+  @param[in]  Context    The context passed to Task.
+  @param[in]  TaskCount  The number of tasks.
+
+  @retval RETURN_SUCCESS           The work queue is initialized.
+  @retval RETURN_OUT_OF_RESOURCES  The completion flags cannot be allocated.
+**/
+RETURN_STATUS
+MpWorkQueueInitialize (
+  OUT MP_WORK_QUEUE       *Queue,
+  IN  MP_WORK_QUEUE_TASK  Task,
+  IN  VOID                *Context,
+  IN  UINTN               TaskCount
+  );
+
+/**
+  Claim and execute the tasks of a work queue until none is left.
+
+  It is executed by every processor taking part, the BSP included.
+
+  @param[in] Buffer  The work queue.
+**/
+VOID
+EFIAPI
+MpWorkQueueProcess (
+  IN VOID  *Buffer
+  );
+
+/**
+  Execute the tasks that are not completed on the calling processor, and free
+  the resources of a work queue.
+
+  It must only be called once no AP works on the queue any more.
+
+  @param[in] Queue  The work queue.
+**/
+VOID
+MpWorkQueueFinish (
+  IN MP_WORK_QUEUE  *Queue
+  );
+
+/**
+  Execute all the tasks on the calling processor.
+
+  @param[in] Task       The function executing one task.
+  @param[in] Context    The context passed to Task.
+  @param[in] TaskCount  The number of tasks.
+**/
+VOID
+MpWorkQueueRunOnCaller (
+  IN MP_WORK_QUEUE_TASK  Task,
+  IN VOID                *Context,
+  IN UINTN               TaskCount
+  );
+
+#endif
@@ -0,0 +1,135 @@
+/** @file
+  MpWorkQueueLib instance that shares the tasks with the APs through the PEI MP
+  Services PPI.
+
+  StartupAllAPs() of the PPI is blocking, so the BSP waits while the APs work
+  on the queue, then executes the tasks that they left.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiPei.h>
+#include <Library/PeiServicesLib.h>
+#include <Library/PeiServicesTablePointerLib.h>
+#include <Ppi/MpServices.h>
+
+#include "MpWorkQueueCommon.h"
+
+/**
+  Execute a set of tasks, sharing them between the calling processor and the
+  other processors that are available.
+
+  Task is called once for each task index, in no particular order and possibly
+  on several processors at the same time. So a task must only write the data of
+  its own index, and must only use services that are safe to call on an AP.
+
+  If the APs are stopped because TimeoutInMicroseconds expired, the tasks they
+  did not complete are executed on the calling processor. Such a task may have
+  been partly executed on an AP, so it must give the same result when it is
+  executed again.
+
+  If no AP is available, or the APs cannot be started, all the tasks are
+  executed on the calling processor.
+
+  @param[in] Task                   The function executing one task.
+  @param[in] Context                The context passed to Task.
+  @param[in] TaskCount              The number of tasks.
+  @param[in] TimeoutInMicroseconds  The time the APs are given to complete the
+                                    tasks, or 0 for no limit.
+
+  @retval RETURN_SUCCESS            All the tasks are completed.
+  @retval RETURN_INVALID_PARAMETER  Task is NULL.
+  @retval RETURN_INVALID_PARAMETER  TaskCount is bigger than MAX_INT32.
+**/
+RETURN_STATUS
+EFIAPI
+MpWorkQueueRun (
+  IN MP_WORK_QUEUE_TASK  Task,
+  IN VOID                *Context,
+  IN UINTN               TaskCount,
+  IN UINTN               TimeoutInMicroseconds
+  )
+{
+  EFI_STATUS               Status;
+  EFI_PEI_MP_SERVICES_PPI  *MpServices;
+  MP_WORK_QUEUE            Queue;
+
+  if ((Task == NULL) || (TaskCount > MAX_INT32)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (TaskCount < 2) {
+    MpWorkQueueRunOnCaller (Task, Context, TaskCount);
+    return RETURN_SUCCESS;
+  }
+
+  Status = PeiServicesLocatePpi (&gEfiPeiMpServicesPpiGuid, 0, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    MpWorkQueueRunOnCaller (Task, Context, TaskCount);
+    return RETURN_SUCCESS;
+  }
+
+  Status = MpWorkQueueInitialize (&Queue, Task, Context, TaskCount);
+  if (EFI_ERROR (Status)) {
+    MpWorkQueueRunOnCaller (Task, Context, TaskCount);
+    return RETURN_SUCCESS;
+  }
+
+  //
+  // EFI_NOT_STARTED is returned when there is no enabled AP, and the BSP
+  // executes all the tasks below.
+  //
+  Status = MpServices->StartupAllAPs (
+                         GetPeiServicesTablePointer (),
+                         MpServices,
+                         MpWorkQueueProcess,
+                         FALSE,
+                         TimeoutInMicroseconds,
+                         &Queue
+                         );
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_STARTED)) {
+    DEBUG ((DEBUG_WARN, "%a: StartupAllAPs(): %r\n", __FUNCTION__, Status));
+  }
+
+  MpWorkQueueProcess (&Queue);
+  MpWorkQueueFinish (&Queue);
+  return RETURN_SUCCESS;
+}
+
+/**
+  Return the number of processors that may execute tasks at the same time in
+  MpWorkQueueRun(), the calling processor included.
+
+  @return The number of enabled processors, or 1 if the PEI MP Services PPI
+          is not available.
+**/
+UINTN
+EFIAPI
+MpWorkQueueGetProcessorCount (
+  VOID
+  )
+{
+  EFI_STATUS               Status;
+  EFI_PEI_MP_SERVICES_PPI  *MpServices;
+  UINTN                    NumberOfProcessors;
+  UINTN                    NumberOfEnabledProcessors;
+
+  Status = PeiServicesLocatePpi (&gEfiPeiMpServicesPpiGuid, 0, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    return 1;
+  }
+
+  Status = MpServices->GetNumberOfProcessors (
+                         GetPeiServicesTablePointer (),
+                         MpServices,
+                         &NumberOfProcessors,
+                         &NumberOfEnabledProcessors
+                         );
+  if (EFI_ERROR (Status) || (NumberOfEnabledProcessors == 0)) {
+    return 1;
+  }
+
+  return NumberOfEnabledProcessors;
+}
@@ -0,0 +1,407 @@
+/** @file
+  Unit tests of the CRC32 and CRC32C APIs in BaseLib.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+#define UNIT_TEST_APP_NAME     "BaseLib CRC32 Unit Test Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+///
+/// Reflected polynomials of CRC32 (ITU-T V.42) and CRC32C (Castagnoli).
+///
+#define CRC32_POLYNOMIAL   0xEDB88320
+#define CRC32C_POLYNOMIAL  0x82F63B78
+
+///
+/// Large enough to cover several eight byte blocks at every alignment.
+///
+#define CRC_TEST_BUFFER_SIZE  300
+
+///
+/// The throughput benchmark runs each variant over CRC_BENCHMARK_COUNT passes
+/// of a CRC_BENCHMARK_BUFFER_SIZE buffer.
+///
+#define CRC_BENCHMARK_BUFFER_SIZE  SIZE_1MB
+#define CRC_BENCHMARK_COUNT        64
+
+typedef struct {
+  CHAR8     *TestInput;
+  UINT32    ExpectedCrc32;
+  UINT32    ExpectedCrc32c;
+} CRC_VECTOR_TEST_CONTEXT;
+
+/**
+  Computes a 32-bit CRC of a buffer.
+
+  @param[in]  Buffer      A pointer to the buffer.
+  @param[in]  Length      The number of bytes in the buffer.
+
+  @return The CRC of the buffer.
+**/
+typedef
+UINT32
+(EFIAPI *CRC_FUNCTION)(
+  IN VOID   *Buffer,
+  IN UINTN  Length
+  );
+
+typedef struct {
+  CHAR8           *ByteWiseName;
+  CHAR8           *BaseLibName;
+  UINT32          Polynomial;
+  CRC_FUNCTION    Calculate;
+} CRC_BENCHMARK_CONTEXT;
+
+//
+// Check values from the catalogue of parametrised CRC algorithms.
+//
+CRC_VECTOR_TEST_CONTEXT  mCrcVectorTest1 = { "", 0x00000000, 0x00000000 };
+CRC_VECTOR_TEST_CONTEXT  mCrcVectorTest2 = { "a", 0xE8B7BE43, 0xC1D04330 };
+CRC_VECTOR_TEST_CONTEXT  mCrcVectorTest3 = { "123456789", 0xCBF43926, 0xE3069283 };
+CRC_VECTOR_TEST_CONTEXT  mCrcVectorTest4 = { "The quick brown fox jumps over the lazy dog", 0x414FA339, 0x22620404 };
+
+/**
+  Computes a reflected 32-bit CRC one bit at a time.
+
+  @param[in]  Polynomial  The reflected polynomial.
+  @param[in]  Buffer      A pointer to the buffer.
+  @param[in]  Length      The number of bytes in the buffer.
+
+  @return The CRC of the buffer.
+**/
+STATIC
+UINT32
+ReferenceCrc32 (
+  IN UINT32       Polynomial,
+  IN CONST UINT8  *Buffer,
+  IN UINTN        Length
+  )
+{
+  UINT32  Crc;
+  UINTN   Bit;
+
+  Crc = 0xFFFFFFFF;
+  while (Length-- != 0) {
+    Crc ^= *(Buffer++);
+    for (Bit = 0; Bit < 8; Bit++) {
+      Crc = (Crc >> 1) ^ ((Crc & 1) != 0 ? Polynomial : 0);
+    }
+  }
+
+  return ~Crc;
+}
+
+/**
+  Computes a reflected 32-bit CRC one byte at a time through a 256-entry table,
+  the way BaseLib did before the slice-by-8 path.
+
+  @param[in]  Table       The byte-wise table of the polynomial.
+  @param[in]  Buffer      A pointer to the buffer.
+  @param[in]  Length      The number of bytes in the buffer.
+
+  @return The CRC of the buffer.
+**/
+STATIC
+UINT32
+ByteWiseCrc32 (
+  IN CONST UINT32  *Table,
+  IN CONST UINT8   *Buffer,
+  IN UINTN         Length
+  )
+{
+  UINT32  Crc;
+
+  Crc = 0xFFFFFFFF;
+  while (Length-- != 0) {
+    Crc = Table[(Crc ^ *(Buffer++)) & 0xFF] ^ (Crc >> 8);
+  }
+
+  return ~Crc;
+}
+
+/**
+  Computes the CRC32C of a buffer with an initial value of zero.
+
+  @param[in]  Buffer      A pointer to the buffer.
+  @param[in]  Length      The number of bytes in the buffer.
+
+  @return The CRC32C of the buffer.
+**/
+STATIC
+UINT32
+EFIAPI
+CalculateCrc32cFromZero (
+  IN VOID   *Buffer,
+  IN UINTN  Length
+  )
+{
+  return CalculateCrc32c (Buffer, Length, 0);
+}
+
+CRC_BENCHMARK_CONTEXT  mCrc32Benchmark  = { "CRC32 byte-wise", "CRC32 BaseLib", CRC32_POLYNOMIAL, CalculateCrc32 };
+CRC_BENCHMARK_CONTEXT  mCrc32cBenchmark = { "CRC32C byte-wise", "CRC32C BaseLib", CRC32C_POLYNOMIAL, CalculateCrc32cFromZero };
+
+/**
+  Check CalculateCrc32() and CalculateCrc32c() against known check values.
+
+  @param[in]  Context  The CRC_VECTOR_TEST_CONTEXT of the test.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+CrcVectorTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CRC_VECTOR_TEST_CONTEXT  *Vector;
+  UINTN                    Length;
+
+  Vector = (CRC_VECTOR_TEST_CONTEXT *)Context;
+  Length = AsciiStrLen (Vector->TestInput);
+
+  UT_ASSERT_EQUAL (CalculateCrc32 (Vector->TestInput, Length), Vector->ExpectedCrc32);
+  UT_ASSERT_EQUAL (CalculateCrc32c (Vector->TestInput, Length, 0), Vector->ExpectedCrc32c);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check CalculateCrc32() and CalculateCrc32c() against a bitwise reference for
+  every length of the test buffer at every alignment within a UINT64, so that
+  both the eight byte blocks and the trailing bytes are covered.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+CrcReferenceTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8   Buffer[CRC_TEST_BUFFER_SIZE + sizeof (UINT64)];
+  UINTN   Index;
+  UINTN   Offset;
+  UINTN   Length;
+  UINT32  Seed;
+
+  Seed = 0x12345678;
+  for (Index = 0; Index < sizeof (Buffer); Index++) {
+    Seed          = Seed * 1103515245 + 12345;
+    Buffer[Index] = (UINT8)(Seed >> 16);
+  }
+
+  for (Offset = 0; Offset < sizeof (UINT64); Offset++) {
+    for (Length = 0; Length <= CRC_TEST_BUFFER_SIZE; Length++) {
+      UT_ASSERT_EQUAL (
+        CalculateCrc32 (Buffer + Offset, Length),
+        ReferenceCrc32 (CRC32_POLYNOMIAL, Buffer + Offset, Length)
+        );
+      UT_ASSERT_EQUAL (
+        CalculateCrc32c (Buffer + Offset, Length, 0),
+        ReferenceCrc32 (CRC32C_POLYNOMIAL, Buffer + Offset, Length)
+        );
+    }
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that CalculateCrc32c() can continue a CRC over a split buffer.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+Crc32cInitialValueTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CONST CHAR8  *Input;
+  UINTN        Length;
+  UINTN        Split;
+  UINT32       Crc;
+
+  Input  = mCrcVectorTest4.TestInput;
+  Length = AsciiStrLen (Input);
+
+  for (Split = 0; Split <= Length; Split++) {
+    Crc = CalculateCrc32c (Input, Split, 0);
+    Crc = CalculateCrc32c (Input + Split, Length - Split, Crc);
+    UT_ASSERT_EQUAL (Crc, mCrcVectorTest4.ExpectedCrc32c);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Benchmark a CRC of BaseLib against the byte-wise table loop it replaced and
+  log the throughput of both.
+
+  @param[in]  Context  The CRC_BENCHMARK_CONTEXT of the test.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+CrcBenchmarkTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CRC_BENCHMARK_CONTEXT  *Benchmark;
+  UINT32                 Table[256];
+  UINT8                  *Buffer;
+  UINTN                  Index;
+  UINTN                  Bit;
+  UINT32                 Seed;
+  UINT32                 ByteWiseCrc;
+  UINT32                 Crc;
+  UNIT_TEST_BENCHMARK    Timer;
+
+  Benchmark = (CRC_BENCHMARK_CONTEXT *)Context;
+
+  for (Index = 0; Index < ARRAY_SIZE (Table); Index++) {
+    Table[Index] = (UINT32)Index;
+    for (Bit = 0; Bit < 8; Bit++) {
+      Table[Index] = (Table[Index] >> 1) ^ ((Table[Index] & 1) != 0 ? Benchmark->Polynomial : 0);
+    }
+  }
+
+  Buffer = AllocatePool (CRC_BENCHMARK_BUFFER_SIZE);
+  UT_ASSERT_NOT_NULL (Buffer);
+
+  Seed = 0x12345678;
+  for (Index = 0; Index < CRC_BENCHMARK_BUFFER_SIZE; Index++) {
+    Seed          = Seed * 1103515245 + 12345;
+    Buffer[Index] = (UINT8)(Seed >> 16);
+  }
+
+  ByteWiseCrc = 0;
+  UnitTestBenchmarkStart (&Timer);
+  for (Index = 0; Index < CRC_BENCHMARK_COUNT; Index++) {
+    ByteWiseCrc = ByteWiseCrc32 (Table, Buffer, CRC_BENCHMARK_BUFFER_SIZE);
+  }
+
+  UnitTestBenchmarkStop (&Timer);
+  UnitTestBenchmarkLogThroughput (Benchmark->ByteWiseName, &Timer, CRC_BENCHMARK_COUNT * CRC_BENCHMARK_BUFFER_SIZE);
+
+  Crc = 0;
+  UnitTestBenchmarkStart (&Timer);
+  for (Index = 0; Index < CRC_BENCHMARK_COUNT; Index++) {
+    Crc = Benchmark->Calculate (Buffer, CRC_BENCHMARK_BUFFER_SIZE);
+  }
+
+  UnitTestBenchmarkStop (&Timer);
+  UnitTestBenchmarkLogThroughput (Benchmark->BaseLibName, &Timer, CRC_BENCHMARK_COUNT * CRC_BENCHMARK_BUFFER_SIZE);
+
+  FreePool (Buffer);
+
+  UT_ASSERT_EQUAL (Crc, ByteWiseCrc);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  CRC32 APIs of BaseLib and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Fw;
+  UNIT_TEST_SUITE_HANDLE      CrcTests;
+
+  Fw = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Fw, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the CRC32 Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&CrcTests, Fw, "CRC32 and CRC32C", "BaseLib.Crc32", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for CrcTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // --------------Suite-----------Description--------------Class Name----------Function--------Pre---Post-------------------Context-----------
+  AddTestCase (CrcTests, "Check Value - Empty", "Test1", CrcVectorTest, NULL, NULL, &mCrcVectorTest1);
+  AddTestCase (CrcTests, "Check Value - a", "Test2", CrcVectorTest, NULL, NULL, &mCrcVectorTest2);
+  AddTestCase (CrcTests, "Check Value - 123456789", "Test3", CrcVectorTest, NULL, NULL, &mCrcVectorTest3);
+  AddTestCase (CrcTests, "Check Value - quick brown fox", "Test4", CrcVectorTest, NULL, NULL, &mCrcVectorTest4);
+  AddTestCase (CrcTests, "Bitwise reference at all lengths and alignments", "Reference", CrcReferenceTest, NULL, NULL, NULL);
+  AddTestCase (CrcTests, "CRC32C continued over a split buffer", "InitialValue", Crc32cInitialValueTest, NULL, NULL, NULL);
+  AddTestCase (CrcTests, "CRC32 throughput against the byte-wise loop", "Crc32Benchmark", CrcBenchmarkTest, NULL, NULL, &mCrc32Benchmark);
+  AddTestCase (CrcTests, "CRC32C throughput against the byte-wise loop", "Crc32cBenchmark", CrcBenchmarkTest, NULL, NULL, &mCrc32cBenchmark);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Fw);
+
+EXIT:
+  if (Fw) {
+    FreeUnitTestFramework (Fw);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
@@ -0,0 +1,451 @@
+/** @file
+  Firmware volume sections that hold compressed data, used by the unit tests of
+  the UEFI decompression library.
+
+  Both sections wrap the same EFI_SECTION_RAW section, whose content is the
+  UefiCpuPkg/ResetVector/Vtf0/Bin/X64/PageTable2M/ResetVector.x64.raw file that
+  platforms place in their SEC firmware volume. mFvCompressionSection is an
+  EFI_SECTION_COMPRESSION section compressed with the EFI algorithm by
+  BaseTools/Source/C/Common/EfiCompress.c, and mFvTianoGuidedSection is an
+  EFI_SECTION_GUID_DEFINED section of gTianoCustomDecompressGuid compressed with
+  the Tiano algorithm by BaseTools/Source/C/Common/TianoCompress.c.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef UEFI_DECOMPRESS_FV_SECTIONS_H_
+#define UEFI_DECOMPRESS_FV_SECTIONS_H_
+
+///
+/// The size of the EFI_SECTION_RAW section compressed in both sections.
+///
+#define FV_RAW_SECTION_SIZE  0x7008
+
+///
+/// The CRC32 of the EFI_SECTION_RAW section compressed in both sections.
+///
+#define FV_RAW_SECTION_CRC32  0x4B6E80B0
+
+STATIC CONST UINT8  mFvCompressionSection[] = {
+  0xdc, 0x0c, 0x00, 0x01, 0x08, 0x70, 0x00, 0x00, 0x01, 0xcb, 0x0c, 0x00, 0x00, 0x08, 0x70, 0x00,
+  0x00, 0x12, 0x0a, 0x87, 0xbd, 0x8f, 0x01, 0x70, 0xf6, 0xad, 0x25, 0xfe, 0xe6, 0xd9, 0x33, 0x81,
+  0x93, 0xba, 0x2d, 0x5b, 0x30, 0x01, 0x83, 0x6a, 0x46, 0xac, 0xc0, 0x40, 0x00, 0xe3, 0x37, 0x14,
+  0x96, 0xd5, 0x44, 0xea, 0x88, 0xb2, 0x33, 0x3e, 0xb5, 0x5d, 0xaa, 0xa5, 0x03, 0x1d, 0xf9, 0x7a,
+  0xa8, 0xb7, 0x3b, 0x6b, 0x55, 0xd0, 0x2c, 0xea, 0x59, 0xa5, 0x66, 0xbd, 0xa9, 0xaa, 0x99, 0xa5,
+  0xa6, 0xa3, 0x28, 0xb6, 0xe3, 0x63, 0x10, 0x0d, 0x49, 0x45, 0x4e, 0x9c, 0x83, 0xc1, 0x11, 0x0e,
+  0xef, 0x9a, 0x5c, 0x2a, 0x2a, 0xcb, 0xbe, 0xf8, 0x37, 0xf2, 0xd7, 0xe5, 0xe2, 0x5a, 0xf0, 0x33,
+  0x78, 0x00, 0xbf, 0x47, 0xff, 0x98, 0xe3, 0xb9, 0x5f, 0x78, 0x76, 0xbd, 0x57, 0xab, 0x8f, 0x90,
+  0xef, 0x39, 0x77, 0x61, 0xbe, 0x4e, 0x48, 0xe1, 0xb8, 0x6e, 0x1b, 0x86, 0xe1, 0xb8, 0x6e, 0x1b,
+  0x86, 0xe1, 0xb8, 0x6e, 0x1b, 0x86, 0xe1, 0xb8, 0x6e, 0x1b, 0xff, 0xfb, 0xb0, 0xfb, 0x5f, 0x1b,
+  0xdf, 0xff, 0xd8, 0x59, 0xfb, 0x93, 0xce, 0x1d, 0x01, 0x7e, 0x1b, 0x86, 0xe1, 0xb8, 0x6e, 0x1b,
+  0x86, 0xe1, 0xb8, 0x6e, 0x1b, 0x86, 0xe1, 0xb8, 0x6e, 0x1b, 0x86, 0xff, 0xf6, 0xf7, 0xdf, 0xa4,
+  0xfa, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf3, 0xf4, 0x6f, 0xf4, 0xcb, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0x4e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x75, 0x0b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1e, 0x39, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xea, 0x57, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0x8d, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3a, 0xa5, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xc7, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1e, 0x41, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf8, 0xe5, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe3, 0xf4, 0xcb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc7, 0xaf,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x45, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c,
+  0x38, 0xe6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0x5a, 0xf9, 0xc9, 0xe8, 0xe8,
+  0xf6, 0x76, 0x78, 0x71, 0xfa, 0x75, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xc9, 0x2f,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xa8, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf,
+  0x0e, 0x3a, 0xc5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf5, 0x2b, 0xe7, 0x27, 0xa3,
+  0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xea, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8e, 0xb5,
+  0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xeb, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3,
+  0xc3, 0x8f, 0x90, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x56, 0xbe, 0x72, 0x7a,
+  0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x79, 0x35, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xca,
+  0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x55, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b,
+  0x3c, 0x38, 0xf2, 0xcb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x97, 0x5f, 0x39, 0x3d,
+  0x1d, 0x1e, 0xce, 0xcf, 0x0f, 0xc6, 0xfd, 0xfc, 0x72, 0xdf, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf,
+  0x0e, 0x3c, 0xc2, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe6, 0x57, 0xce, 0x4f, 0x47,
+  0x47, 0xb3, 0xb3, 0xc3, 0x8e, 0xc1, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xec, 0x57,
+  0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xd6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0x1f, 0xad, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0x45, 0x7c, 0xe4, 0xf4,
+  0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf3, 0x4b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc9,
+  0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xae, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce,
+  0xcf, 0x0e, 0x3f, 0x5e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0xc1, 0x7c, 0xe4,
+  0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xec, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f,
+  0x93, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x62, 0xbe, 0x72, 0x7a, 0x3a, 0x3d,
+  0x9d, 0x9e, 0x1c, 0x79, 0xb5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xce, 0x2f, 0x9c,
+  0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x75, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38,
+  0xfd, 0x92, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe7, 0x97, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0x3e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7a, 0x05, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xd0, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1e, 0x89, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf4, 0x6b, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0xca, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0x9a, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe9, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3,
+  0x8e, 0xd1, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf9, 0x55, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe3, 0xf6, 0x6b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xf8, 0xde, 0xff,
+  0x0e, 0x5b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xcb, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f,
+  0x67, 0x67, 0x87, 0x1f, 0x2e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7a, 0x55, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf6, 0x8b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1,
+  0xc7, 0xcc, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x32, 0xbe, 0x72, 0x7a, 0x3a,
+  0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0xd5, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xed, 0x57,
+  0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xdb, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0x1f, 0xb7, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x70, 0xbe, 0x72, 0x7a,
+  0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0xe5, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf4,
+  0xcb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xee, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3,
+  0xb3, 0xc3, 0x8f, 0x9a, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0x65, 0xf3, 0x93,
+  0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf7, 0x6b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7,
+  0xef, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xde, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f,
+  0x67, 0x67, 0x87, 0x1e, 0x9d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfd, 0xf2, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xea, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3,
+  0x8f, 0xdf, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0xba, 0xf9, 0xc9, 0xe8, 0xe8,
+  0xf6, 0x76, 0x78, 0x71, 0xf3, 0x6b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xa9, 0x5f,
+  0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0x71, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c,
+  0x38, 0xfe, 0x02, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf3, 0xab, 0xe7, 0x27, 0xa3,
+  0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xf0, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0x9e,
+  0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0f, 0xc6, 0xeb, 0xf4, 0x72, 0xdf, 0x39, 0x3d, 0x1d,
+  0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0x7d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfe, 0x12,
+  0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfc, 0x35, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec,
+  0xf0, 0xe3, 0xf8, 0x8b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xf1, 0x57, 0xce, 0x4f,
+  0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8e, 0x6a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfc,
+  0x65, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf8, 0xeb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9,
+  0xd9, 0xe1, 0xc7, 0xf2, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xe4, 0xaf, 0x9c,
+  0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xca, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3f, 0x96, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0x02, 0xf9, 0xc9, 0xe8, 0xe8,
+  0xf6, 0x76, 0x78, 0x71, 0xf4, 0x2b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xaa, 0x5f,
+  0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3d, 0x5a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78,
+  0x71, 0xeb, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8e, 0xe1, 0x7c, 0xe4, 0xf4, 0x74,
+  0x7b, 0x3b, 0x3c, 0x38, 0xf5, 0xab, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x39, 0x7c,
+  0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xe2, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3e, 0x89, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfa, 0x35, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe3, 0x9e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0x22, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf4, 0xab, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1,
+  0xc7, 0xd3, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0xb9, 0x7c, 0xe4, 0xf4, 0x74,
+  0x7b, 0x3b, 0x3c, 0x38, 0xfa, 0x75, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xea, 0x17,
+  0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xe6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0xe3, 0x77, 0xf8, 0x39, 0x6f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0x05, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf9, 0xab, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1,
+  0xc7, 0x72, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x39, 0x7c, 0xe4, 0xf4, 0x74,
+  0x7b, 0x3b, 0x3c, 0x38, 0xee, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xe7, 0xaf,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xd0, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf,
+  0x0e, 0x3f, 0xa2, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x74, 0x57, 0xce, 0x4f, 0x47,
+  0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0x5e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7b, 0x05,
+  0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xd8, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0x1f, 0xd2, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0xb5, 0xf3, 0x93, 0xd1,
+  0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xea, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8e, 0xf1,
+  0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfe, 0x9a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76,
+  0x78, 0x71, 0xfd, 0x45, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xea, 0x97, 0xce, 0x4f,
+  0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xab, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f,
+  0xaa, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0x62, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6,
+  0x76, 0x78, 0x71, 0xfd, 0x65, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xfa, 0xeb, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xd6, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1f, 0x5c, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0x7a, 0xf9, 0xc9, 0xe8, 0xe8,
+  0xf6, 0x76, 0x78, 0x71, 0xfd, 0x85, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xec, 0x17,
+  0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xec, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0x1f, 0xda, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x36, 0xbe, 0x72, 0x7a, 0x3a,
+  0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x6d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfe, 0xe2,
+  0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfd, 0xd5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec,
+  0xf0, 0xe3, 0xec, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xef, 0x2f, 0x9c, 0x9e,
+  0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xdf, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f,
+  0xc0, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x85, 0x7c, 0xe4, 0xf4, 0x74, 0x7b,
+  0x3b, 0x3c, 0x38, 0xff, 0x12, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf6, 0x4b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xf8, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3,
+  0x8f, 0xb3, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0xc8, 0xbe, 0x72, 0x7a, 0x3a,
+  0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x95, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfb, 0x45,
+  0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xed, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3,
+  0xc3, 0x8f, 0xf3, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xe7, 0x5f, 0x39, 0x3d,
+  0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0xd9, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xff,
+  0x42, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfe, 0x95, 0xf3, 0x93, 0xd1, 0xd1, 0xec,
+  0xec, 0xf0, 0xe3, 0xfd, 0x4b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xb2, 0x5f, 0x39,
+  0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0xd5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3,
+  0xed, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xb8, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3d, 0x9a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf7, 0x2b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xdd, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1f, 0xeb, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0xe5, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe2, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xbb, 0x5f, 0x39,
+  0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0xd8, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c,
+  0x77, 0xeb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xb4, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3c, 0x05, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xda, 0xaf, 0x9c,
+  0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xed, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3d, 0xb2, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xed, 0xd7, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0x70, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0xe2, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfe, 0xe5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0,
+  0xe3, 0xfd, 0xeb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xfc, 0x17, 0xce, 0x4f, 0x47,
+  0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xbd, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3d, 0xca,
+  0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xff, 0x15, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec,
+  0xf0, 0xe3, 0xfe, 0x4b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xba, 0x5f, 0x39, 0x3d,
+  0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0xe6, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f,
+  0xd1, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xff, 0xaa, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6,
+  0x76, 0x78, 0x71, 0xf7, 0xcb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x82, 0xbe, 0x72,
+  0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0xd9, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38,
+  0xfb, 0xf5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xc2, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3f, 0x01, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf7, 0x6b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xbc, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3f, 0x05, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xc5, 0xf3, 0x93, 0xd1, 0xd1, 0xec,
+  0xec, 0xf0, 0xe3, 0xde, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x84, 0xbe, 0x72,
+  0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1f, 0xc4, 0xf8, 0xf8, 0xb7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3,
+  0xc3, 0x8f, 0xc3, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3d, 0xfa, 0xf9, 0xc9, 0xe8,
+  0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf8, 0x8b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc0,
+  0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0x0a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76,
+  0x78, 0x71, 0xd2, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3c, 0x35, 0xf3, 0x93, 0xd1,
+  0xd1, 0xec, 0xec, 0xf0, 0xe3, 0x8d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfc, 0x55,
+  0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xfe, 0xeb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9,
+  0xe1, 0xc7, 0xfe, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xc6, 0x5f, 0x39, 0x3d,
+  0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x1d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf1,
+  0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0x84, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d,
+  0x9e, 0x1c, 0x7e, 0x42, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf9, 0x2b, 0xe7, 0x27,
+  0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xe5, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f,
+  0x0d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfc, 0xb5, 0xf3, 0x93, 0xd1, 0xd1, 0xec,
+  0xec, 0xf0, 0xe3, 0xf3, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xcd, 0x5f, 0x39,
+  0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x39, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38,
+  0xff, 0xca, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf9, 0xeb, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0xe8, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x2a, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xc8, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x7c,
+  0x57, 0xe7, 0x2f, 0xb2, 0x8e, 0xae, 0x23, 0xb4, 0xe5, 0xf1, 0x72, 0x77, 0x1f, 0x37, 0xd0, 0xe7,
+  0xf5, 0x7f, 0x4b, 0x7e, 0xb7, 0xd3, 0xf1, 0x79, 0x5e, 0x87, 0x3f, 0xac, 0xfb, 0xce, 0xd3, 0xdc,
+  0x7a, 0x6e, 0x2e, 0xb3, 0xa1, 0xcf, 0xeb, 0xbe, 0xeb, 0xd5, 0x79, 0x6f, 0xac, 0xe2, 0xf8, 0xee,
+  0x87, 0x3f, 0xca, 0x74, 0x7e, 0x07, 0x9e, 0xfa, 0xee, 0x2e, 0x9f, 0x8f, 0xb1, 0xe5, 0x8b, 0xcf,
+  0xf7, 0xfe, 0xc7, 0xd8, 0xf1, 0x78, 0x1c, 0xb1, 0x7b, 0x4f, 0x5f, 0xe5, 0x3e, 0x6b, 0x8b, 0xee,
+  0x79, 0x62, 0xfd, 0x6f, 0x9f, 0xe8, 0xfc, 0xff, 0x17, 0xdb, 0x72, 0xc5, 0xee, 0xbb, 0xfe, 0xcb,
+  0xdd, 0x71, 0x7d, 0x97, 0x73, 0xcf, 0xec, 0x63, 0x8b, 0xec, 0x7a, 0x3d, 0xff, 0x51, 0xdb, 0xf5,
+  0xfc, 0x5f, 0x61, 0xc7, 0xe3, 0xfb, 0xde, 0xfb, 0x97, 0x74, 0x7c, 0x0e, 0x3f, 0x17, 0xa3, 0xe0,
+  0x74, 0xbd, 0x7f, 0x4d, 0xcb, 0xcd, 0xbc, 0x2e, 0x8f, 0xbc, 0xe8, 0xfc, 0x1e, 0x6f, 0xb0, 0xf9,
+  0xdf, 0x37, 0xd3, 0x78, 0x3d, 0xc7, 0x67, 0xc7, 0xd4, 0x4f, 0x71, 0xe8, 0x3b, 0xab, 0xe7, 0x79,
+  0xde, 0xe6, 0xfe, 0x37, 0xb8, 0xec, 0xbb, 0x1f, 0xcc, 0xf5, 0xfd, 0xbf, 0x5b, 0xf0, 0xfb, 0xfe,
+  0xbf, 0x9d, 0xe1, 0xfb, 0x0e, 0xd7, 0xac, 0xe8, 0x7b, 0xde, 0x4e, 0x4e, 0x48, 0xf1, 0xfe, 0xdf,
+  0x9d, 0xee, 0xfa, 0x6f, 0xbb, 0xe7, 0x74, 0xfd, 0xc7, 0xdf, 0x57, 0x3f, 0xc9, 0x75, 0x1c, 0x5d,
+  0x4f, 0x1f, 0x5b, 0xdd, 0x5f, 0x17, 0x53, 0xd1, 0xf6, 0xdc, 0x7e, 0xe3, 0xce, 0x5f, 0x47, 0xda,
+  0xf7, 0x5f, 0x0f, 0x8b, 0xa7, 0xe7, 0x78, 0xbd, 0x2f, 0x43, 0xcb, 0xc5, 0xf9, 0x78, 0x27, 0xcf,
+  0x77, 0x37, 0xd7, 0x7a, 0x3f, 0x6d, 0xeb, 0x7b, 0x7a, 0xe7, 0xf5, 0x1d, 0x5f, 0x3b, 0xc9, 0xf2,
+  0x9f, 0x25, 0xce, 0xf3, 0xbe, 0xc3, 0xae, 0xe8, 0x7b, 0xef, 0x89, 0xc1, 0xf9, 0x79, 0x64, 0xf7,
+  0x37, 0xd4, 0x77, 0x1d, 0x9f, 0x63, 0xf9, 0xfc, 0x7e, 0x17, 0x73, 0x7f, 0x19, 0xcd, 0xe8, 0x7a,
+  0x2f, 0x4d, 0xea, 0x78, 0xbb, 0x2e, 0x67, 0xb2, 0xed, 0xfd, 0x27, 0x4d, 0xdf, 0xf4, 0x3b, 0x3e,
+  0xdb, 0xe6, 0x22, 0x38, 0xbc, 0xbf, 0x51, 0xe9, 0x7c, 0xd7, 0x1f, 0x97, 0xe5, 0xfb, 0x9d, 0x1e,
+  0xff, 0x9b, 0xd0, 0xec, 0xfd, 0x47, 0xa9, 0xe2, 0xf2, 0x3d, 0x47, 0xa5, 0xea, 0xbb, 0x9b, 0xf3,
+  0x5c, 0xcf, 0x65, 0xf3, 0x9d, 0x4f, 0xc9, 0x78, 0x3c, 0x7e, 0x3b, 0xe2, 0xf4, 0xbd, 0xba, 0x5e,
+  0xbb, 0x97, 0x87, 0x71, 0xf6, 0x5c, 0xce, 0xbf, 0x39, 0x9f, 0x71, 0xf0, 0x7c, 0x77, 0x33, 0xcc,
+  0xe7, 0xdb, 0xd7, 0x2f, 0x45, 0x23, 0x99, 0xe7, 0x79, 0x7c, 0xbd, 0x57, 0x33, 0xcd, 0xf3, 0x3a,
+  0xfb, 0xe5, 0xf0, 0x79, 0x7e, 0x67, 0x99, 0xbf, 0x0f, 0x9b, 0xe2, 0x72, 0x72, 0x75, 0xd1, 0xd2,
+  0xf8, 0x9d, 0x92, 0xbe, 0xf6, 0x3b, 0xce, 0x4e, 0x4e, 0x67, 0x99, 0xf0, 0x78, 0xfd, 0xbf, 0xe7,
+  0x7b, 0x38, 0xfc, 0x7e, 0xef, 0xc2, 0xf6, 0x7f, 0x67, 0xe2, 0x7c, 0x9f, 0x37, 0x99, 0xd3, 0x75,
+  0xbc, 0xde, 0xf7, 0xb0, 0x88, 0x9e, 0x59, 0x9c, 0xdf, 0x0f, 0xea, 0xf9, 0x66, 0xf5, 0x71, 0xde,
+  0xcf, 0x53, 0x11, 0xcb, 0xc4, 0xf9, 0xbd, 0xef, 0x55, 0x1d, 0xdf, 0x83, 0xdd, 0xdf, 0x77, 0x9d,
+  0xdf, 0xc1, 0xee, 0xfd, 0xcf, 0x1f, 0x6d, 0xf2, 0x3c, 0xbf, 0x93, 0xbe, 0x4e, 0x4e, 0xf3, 0xff,
+  0x9a, 0x1b, 0x93, 0xe2, 0x7f, 0xe6, 0xfd, 0x57, 0xde, 0xf8, 0xcf, 0xeb, 0xff, 0x45, 0xfd, 0xa1,
+  0xfd, 0x4c, 0x77, 0xdf, 0x2f, 0xdb, 0x71, 0xf9, 0x0e, 0xfb, 0xe5, 0xbb, 0x6e, 0x3f, 0x1d, 0xcd,
+  0xe8, 0xfb, 0x4e, 0x3e, 0x9f, 0x8f, 0xf3, 0x7a, 0x5f, 0x49, 0xc9, 0xd2, 0xe4, 0xfd, 0x0e, 0x4e,
+  0x4e, 0x97, 0xac, 0xf1, 0x79, 0x47, 0x9c, 0xe5, 0xfe, 0x9d, 0xde, 0xf2, 0xfc, 0xf2, 0x76, 0xbe,
+  0x63, 0xda, 0xf6, 0xbe, 0x63, 0xc0, 0xed, 0x7c, 0xc7, 0xb4, 0xed, 0x7a, 0x39, 0xc9, 0xf8, 0x9f,
+  0xfa, 0xe3, 0xfc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3,
+  0x70, 0xdc, 0x37, 0xff, 0x77, 0x4b, 0xc8, 0x7c, 0x2f, 0xd2, 0xf7, 0x13, 0xfa, 0x8f, 0x4f, 0xf3,
+  0x31, 0xde, 0x77, 0x9d, 0x2f, 0xc8, 0xf1, 0x3f, 0xf7, 0xee, 0x3f, 0x00,
+};
+
+STATIC CONST UINT8  mFvTianoGuidedSection[] = {
+  0xfc, 0x0c, 0x00, 0x02, 0xad, 0x80, 0x12, 0xa3, 0x1e, 0x48, 0xb6, 0x41, 0x95, 0xe8, 0x12, 0x7f,
+  0x4c, 0x98, 0x47, 0x79, 0x18, 0x00, 0x01, 0x00, 0xdc, 0x0c, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00,
+  0x12, 0x00, 0x87, 0xbd, 0x8f, 0x01, 0x70, 0xf6, 0xad, 0x25, 0xfe, 0xe6, 0xd9, 0xc3, 0x81, 0x93,
+  0xa4, 0x45, 0x19, 0x40, 0x0c, 0x1b, 0x52, 0x35, 0x66, 0x36, 0x80, 0x01, 0xc0, 0xdc, 0x52, 0x5b,
+  0x55, 0x13, 0xaa, 0x22, 0xc8, 0xcc, 0xfa, 0xd5, 0x76, 0xa9, 0x54, 0x0c, 0x77, 0xe5, 0xea, 0xa2,
+  0xdc, 0xed, 0xad, 0x57, 0x40, 0xb3, 0xa9, 0x66, 0x95, 0x9a, 0xf6, 0xa6, 0xaa, 0x66, 0x96, 0x9a,
+  0x8c, 0xa2, 0xc7, 0x1b, 0x18, 0x80, 0x6a, 0x0a, 0x2a, 0x72, 0xe4, 0x1e, 0x08, 0x88, 0x74, 0xf9,
+  0xa5, 0x05, 0x45, 0x59, 0x77, 0xdf, 0x63, 0xbf, 0xc3, 0x5f, 0x97, 0x89, 0x6b, 0xc0, 0xcd, 0xe0,
+  0x02, 0xfd, 0x1f, 0xf8, 0x31, 0xf1, 0xef, 0x2b, 0xf0, 0x1d, 0xb5, 0xee, 0xb3, 0xd3, 0xc7, 0xc8,
+  0x77, 0x9c, 0xbb, 0xaf, 0xdf, 0x27, 0x24, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d,
+  0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xff, 0xfd, 0xd7, 0xfd, 0xc7, 0x4f,
+  0xcf, 0xff, 0xd7, 0xd9, 0xfb, 0x73, 0xce, 0x1e, 0x80, 0xbf, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d,
+  0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x7f, 0xfb, 0x7b, 0xcf, 0xd4,
+  0x7d, 0x71, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x79, 0xf1, 0x6f, 0xf5, 0x0b, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0x52, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x75, 0x4b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1d, 0x5a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe2, 0x17, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0x8d, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3a, 0xc5, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xc4, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1e, 0x29, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf8, 0xe5, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe3, 0xf5, 0x4b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc7, 0xaf,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x2d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c,
+  0x38, 0xe6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x31, 0x7c, 0xe4, 0xf4, 0x74,
+  0x7b, 0x3b, 0x3c, 0x38, 0xfd, 0x5a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe3, 0x57,
+  0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xd6, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0x1e, 0x39, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfd, 0x6a, 0xf9, 0xc9, 0xe8,
+  0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfa, 0xe5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xc7,
+  0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0x6a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76,
+  0x78, 0x71, 0xf2, 0x0b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xc8, 0xaf, 0x9c, 0x9e,
+  0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x41, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf2,
+  0x2b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x92, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce,
+  0xcf, 0x0e, 0x3c, 0x9a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe5, 0x17, 0xce, 0x4f,
+  0x47, 0x47, 0xb3, 0xb3, 0xc3, 0xe9, 0xfd, 0xfe, 0x39, 0x6f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67,
+  0x87, 0x1e, 0x55, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf2, 0xcb, 0xe7, 0x27, 0xa3,
+  0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x5e, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x76, 0x0b,
+  0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xeb, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3,
+  0xc3, 0x8f, 0xd8, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x24, 0xbe, 0x72, 0x7a,
+  0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x79, 0x75, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xe4,
+  0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xd8, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67,
+  0x67, 0x87, 0x1f, 0xb2, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x66, 0xbe, 0x72,
+  0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x76, 0x2b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7,
+  0xca, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xb4, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3c, 0xc2, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xd9, 0x2f, 0x9c,
+  0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0x9a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71,
+  0xfb, 0x55, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xcc, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f,
+  0x67, 0x67, 0x87, 0x1e, 0x69, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf3, 0x6b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x9c, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3c, 0xea, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe7, 0x97, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0x95, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0x45, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xcf, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1e, 0x81, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf9, 0x65, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe3, 0xf6, 0xcb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xf4, 0xfc, 0xfe,
+  0x1c, 0xb7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0x97, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3e, 0x61, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf4, 0x2b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xed, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3,
+  0x8f, 0x99, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0x69, 0x7c, 0xe4, 0xf4, 0x74,
+  0x7b, 0x3b, 0x3c, 0x38, 0xfd, 0xc2, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xda, 0xaf,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xb9, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf,
+  0x0e, 0x3f, 0x74, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0xed, 0x7c, 0xe4, 0xf4,
+  0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfd, 0xe2, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe8,
+  0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xde, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67,
+  0x67, 0x87, 0x1f, 0x36, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x76, 0xcb, 0xe7, 0x27,
+  0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xef, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f,
+  0xdf, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xc0, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3d, 0x1a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfc, 0x15, 0xf3,
+  0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xd2, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87,
+  0x1f, 0xc2, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0x75, 0xf3, 0x93, 0xd1, 0xd1,
+  0xec, 0xec, 0xf0, 0xe3, 0xe7, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0x4a, 0xbe,
+  0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7c, 0xea, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78,
+  0x71, 0xfc, 0x35, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xe7, 0x97, 0xce, 0x4f, 0x47,
+  0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xe2, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x3e,
+  0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1f, 0x4f, 0xd7, 0xe8, 0xe5, 0xbe, 0x72, 0x7a, 0x3a,
+  0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0x02, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfc, 0x55,
+  0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf8, 0xcb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9,
+  0xe1, 0xc7, 0xf1, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xe4, 0x2f, 0x9c, 0x9e,
+  0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1c, 0xd5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf9,
+  0x2b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xf2, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3,
+  0xb3, 0xc3, 0x8f, 0xe5, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xcc, 0x5f, 0x39,
+  0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0x85, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38,
+  0xfa, 0x25, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xe8, 0xd7, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0xa4, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3d, 0x32, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xe9, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3,
+  0x8f, 0x50, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x77, 0x0b, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0xa9, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x39, 0xcb, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x12, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71,
+  0xf4, 0xab, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xd3, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f,
+  0x67, 0x67, 0x87, 0x1c, 0xf5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xe9, 0xd7, 0xce,
+  0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xa8, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3e, 0xa5, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf5, 0x4b, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0xd5, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x56, 0xbe,
+  0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x35, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c,
+  0x3e, 0x9f, 0xbf, 0xc1, 0xcb, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xe8, 0x2f, 0x9c,
+  0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xce, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3b, 0x95, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf9, 0xeb, 0xe7, 0x27, 0xa3, 0xa3,
+  0xd9, 0xd9, 0xe1, 0xc7, 0x74, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x41, 0x7c,
+  0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfe, 0x8a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78,
+  0x71, 0xfd, 0x25, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xa2, 0xbe, 0x72, 0x7a, 0x3a,
+  0x3d, 0x9d, 0x9e, 0x1c, 0x7a, 0xb5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xd6, 0x2f,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0xb5, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c,
+  0x38, 0xfe, 0x9a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xdd, 0xaf, 0x9c, 0x9e, 0x8e,
+  0x8f, 0x67, 0x67, 0x87, 0x1f, 0x58, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x77, 0x8b,
+  0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xf5, 0x17, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3,
+  0xc3, 0x8f, 0xea, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x5a, 0xbe, 0x72, 0x7a,
+  0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7d, 0x72, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfd,
+  0x65, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xeb, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3,
+  0xb3, 0xc3, 0x8f, 0xeb, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xd8, 0x5f, 0x39,
+  0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0xc1, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38,
+  0xfb, 0x15, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xec, 0x97, 0xce, 0x4f, 0x47, 0x47,
+  0xb3, 0xb3, 0xc3, 0x8f, 0xec, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x66, 0xbe,
+  0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x69, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c,
+  0x38, 0xfe, 0xda, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x7d, 0x3e, 0x9f, 0x63, 0x96, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfd, 0xc5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0,
+  0xe3, 0xfb, 0xab, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xf7, 0x97, 0xce, 0x4f, 0x47,
+  0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xb4, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0xbe,
+  0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0x81, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b,
+  0x3c, 0x38, 0xff, 0x0a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfe, 0x25, 0xf3, 0x93,
+  0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xfc, 0x6b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7,
+  0xda, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xe4, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3e, 0xd9, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xff, 0x2a, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xfe, 0x65, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0,
+  0xe3, 0xed, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xb8, 0x5f, 0x39, 0x3d, 0x1d,
+  0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0xce, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0xa1,
+  0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xfb, 0x95, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec,
+  0xf0, 0xe3, 0xfd, 0x2b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xfa, 0x97, 0xce, 0x4f,
+  0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xf5, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e,
+  0xb9, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xef, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3,
+  0xb3, 0xc3, 0x8f, 0xba, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3e, 0xed, 0x7c, 0xe4,
+  0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf5, 0xeb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7,
+  0xde, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x7a, 0xbe, 0x72, 0x7a, 0x3a, 0x3d,
+  0x9d, 0x9e, 0x1c, 0x7f, 0xb1, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf6, 0x0b, 0xe7,
+  0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xf4, 0xfa, 0xfd, 0x0e, 0x5b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9,
+  0xd9, 0xe1, 0xc7, 0xdf, 0x2f, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0xed, 0x5f, 0x39,
+  0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3b, 0xe5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3,
+  0xd8, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1d, 0xfa, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6,
+  0x76, 0x78, 0x71, 0xec, 0x97, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xf7, 0x2f, 0x9c,
+  0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0xcd, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38,
+  0xf6, 0x8b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xb5, 0x5f, 0x39, 0x3d, 0x1d, 0x1e,
+  0xce, 0xcf, 0x0e, 0x3e, 0xfd, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xff, 0x7a, 0xf9,
+  0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xff, 0x05, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0,
+  0xe3, 0xfe, 0x2b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xb6, 0x5f, 0x39, 0x3d, 0x1d,
+  0x1e, 0xce, 0xcf, 0x0e, 0x3d, 0xba, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xff, 0x25,
+  0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xfe, 0x6b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9,
+  0xe1, 0xc7, 0xb8, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0xe8, 0xbe, 0x72, 0x7a,
+  0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7f, 0xd5, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xff,
+  0xb2, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf8, 0x0b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9,
+  0xd9, 0xe1, 0xc7, 0x80, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0x0a, 0xf9, 0xc9,
+  0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf8, 0x4b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7,
+  0x82, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0x1a, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6,
+  0x76, 0x78, 0x71, 0xee, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0x74, 0xbe, 0x72,
+  0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0x22, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x7d,
+  0x3e, 0xdf, 0x23, 0x96, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xee, 0xd7, 0xce, 0x4f,
+  0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xc5, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0f, 0xa7,
+  0xdc, 0x61, 0x72, 0xdf, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e, 0x3f, 0x19, 0x7c, 0xe4, 0xf4,
+  0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf7, 0xab, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xe3,
+  0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0xf9, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b,
+  0x3c, 0x38, 0xf7, 0xeb, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x49, 0x7c, 0xe4, 0xf4,
+  0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xf8, 0x0b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0x1a,
+  0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf9, 0x0b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9,
+  0xe1, 0xc7, 0xfd, 0xd7, 0xce, 0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xfc, 0x2f, 0x9c, 0x9e,
+  0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x92, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e,
+  0x52, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf0, 0x57, 0xce, 0x4f, 0x47, 0x47, 0xb3,
+  0xb3, 0xc3, 0x8f, 0x84, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x1c, 0x7e, 0x5a, 0xf9, 0xc9,
+  0xe8, 0xe8, 0xf6, 0x76, 0x78, 0x71, 0xf9, 0x8b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7,
+  0xe6, 0xaf, 0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1f, 0x0d, 0x7c, 0xe4, 0xf4, 0x74, 0x7b,
+  0x3b, 0x3c, 0x38, 0xfc, 0xe5, 0xf3, 0x93, 0xd1, 0xd1, 0xec, 0xec, 0xf0, 0xe3, 0xf3, 0xd7, 0xce,
+  0x4f, 0x47, 0x47, 0xb3, 0xb3, 0xc3, 0x8f, 0xd0, 0x5f, 0x39, 0x3d, 0x1d, 0x1e, 0xce, 0xcf, 0x0e,
+  0x3f, 0x45, 0x7c, 0xe4, 0xf4, 0x74, 0x7b, 0x3b, 0x3c, 0x38, 0xff, 0xca, 0xf9, 0xc9, 0xe8, 0xe8,
+  0xf6, 0x76, 0x78, 0x71, 0xfa, 0x4b, 0xe7, 0x27, 0xa3, 0xa3, 0xd9, 0xd9, 0xe1, 0xc7, 0xe9, 0xaf,
+  0x9c, 0x9e, 0x8e, 0x8f, 0x67, 0x67, 0x87, 0x1e, 0x12, 0xf9, 0xc9, 0xe8, 0xe8, 0xf6, 0x76, 0x78,
+  0x71, 0xc8, 0xbe, 0x72, 0x7a, 0x3a, 0x3d, 0x9d, 0x9e, 0x7c, 0x47, 0xd9, 0x5f, 0x63, 0xe1, 0xf7,
+  0x80, 0x1e, 0x1f, 0x61, 0x17, 0xc9, 0xdc, 0x7c, 0xe7, 0x43, 0x9f, 0xe3, 0x3e, 0xa2, 0xfd, 0x4f,
+  0xa3, 0xe2, 0xf2, 0x5d, 0x0e, 0x7f, 0x8e, 0xfb, 0xff, 0x41, 0xed, 0x7d, 0x17, 0x17, 0x8e, 0xe8,
+  0x73, 0xfa, 0xdf, 0xbd, 0xf4, 0xde, 0x4f, 0xeb, 0xf8, 0xbe, 0x3b, 0xa1, 0xcf, 0xf2, 0x3d, 0x1f,
+  0x7d, 0xe6, 0x7e, 0xc7, 0x8b, 0xa9, 0xe3, 0xec, 0x39, 0x62, 0xf3, 0xfd, 0xef, 0xad, 0xf5, 0xbc,
+  0x5d, 0xff, 0x2c, 0x5f, 0x41, 0xea, 0xfc, 0x8f, 0xcd, 0xf1, 0x7d, 0xe7, 0x2c, 0x5f, 0xb0, 0xf3,
+  0x5d, 0x1f, 0xa0, 0xe2, 0xfb, 0x9e, 0x58, 0xbd, 0xd7, 0x7d, 0xd8, 0xfb, 0x8e, 0x2f, 0xb5, 0xee,
+  0x79, 0xfd, 0x84, 0x71, 0x7d, 0xa7, 0x47, 0xbe, 0xea, 0xbb, 0x7e, 0xbb, 0x8b, 0xec, 0xf8, 0xfc,
+  0x4f, 0x7b, 0xec, 0x39, 0x77, 0x47, 0xbf, 0xe3, 0xf0, 0xba, 0x3d, 0xff, 0x4b, 0xd5, 0xf5, 0x1c,
+  0xbc, 0xdb, 0xc1, 0xe8, 0xfb, 0xae, 0x8f, 0xbf, 0xe6, 0xfa, 0xcf, 0x9e, 0xf3, 0x1d, 0x47, 0x81,
+  0xdc, 0x76, 0x9c, 0x7d, 0x54, 0xf7, 0x1e, 0x6f, 0xba, 0xbe, 0x77, 0x67, 0xdc, 0xdf, 0xc6, 0xf7,
+  0x1d, 0x8f, 0x61, 0xf9, 0xfe, 0xaf, 0xb7, 0xf1, 0xff, 0x0f, 0xbe, 0xeb, 0xb9, 0xdf, 0x03, 0xd6,
+  0x76, 0xbe, 0x3b, 0xa1, 0xee, 0xf9, 0x39, 0x39, 0x23, 0xc4, 0xfb, 0x4e, 0x77, 0xb9, 0xea, 0x3e,
+  0xfb, 0x9d, 0xd4, 0xf7, 0x1f, 0x81, 0x5c, 0xff, 0x1b, 0xd5, 0x71, 0x78, 0x8e, 0x3f, 0x1f, 0xdd,
+  0x5f, 0x17, 0x88, 0xe8, 0xfb, 0x3e, 0x3f, 0x6b, 0xd9, 0x5f, 0x47, 0xd9, 0x77, 0x5f, 0x0f, 0x8b,
+  0xa9, 0xe7, 0x78, 0x5d, 0x2f, 0x39, 0xcb, 0xc5, 0xf9, 0x78, 0x27, 0xcf, 0xf7, 0x37, 0xd6, 0xf9,
+  0xef, 0x67, 0xea, 0x7b, 0x7a, 0xe7, 0xf5, 0x5e, 0x33, 0x9d, 0xe4, 0x39, 0x4f, 0x8d, 0xe7, 0x76,
+  0x7e, 0xb3, 0xad, 0xe8, 0x7b, 0xcf, 0x0f, 0x83, 0xf2, 0xf2, 0xc9, 0xee, 0x6f, 0xaa, 0xee, 0x3b,
+  0x4e, 0xc3, 0xf4, 0xb8, 0xfc, 0x1e, 0xe6, 0xfe, 0x33, 0x9b, 0xd0, 0xf3, 0xbe, 0x8b, 0xd2, 0xf1,
+  0x76, 0x3c, 0xcf, 0x5d, 0xdb, 0xf9, 0xfe, 0xa3, 0xbe, 0xe8, 0x76, 0x9d, 0xb7, 0xcc, 0xc4, 0x71,
+  0x79, 0x4e, 0xab, 0xd0, 0xf9, 0x7e, 0x3f, 0x29, 0xcb, 0xfd, 0x9d, 0x1e, 0xfb, 0x9b, 0xd0, 0xed,
+  0x3d, 0x27, 0xa5, 0xe2, 0xf1, 0x7d, 0x57, 0xa1, 0xeb, 0x3b, 0x9b, 0xf2, 0xfc, 0xcf, 0x5d, 0xf3,
+  0xbe, 0x23, 0xe4, 0xfc, 0x0e, 0x3e, 0xaf, 0xe2, 0x7a, 0x5e, 0xdd, 0x2f, 0x55, 0xcb, 0xc3, 0xb8,
+  0xfb, 0x1e, 0x67, 0x5d, 0x9c, 0xcf, 0xbb, 0xf7, 0xfd, 0x5f, 0x33, 0xcb, 0x67, 0xdd, 0x54, 0x45,
+  0xf3, 0x3b, 0x3e, 0x5f, 0x97, 0xac, 0xe6, 0x79, 0x8e, 0x67, 0x5d, 0x7c, 0xbf, 0x07, 0x94, 0xe6,
+  0x79, 0x6b, 0xf8, 0x1c, 0xdf, 0x83, 0xc9, 0xc9, 0xd6, 0xc7, 0x4b, 0xc3, 0xf6, 0x4a, 0xfb, 0xd8,
+  0xef, 0x39, 0x39, 0x39, 0x9e, 0x5b, 0xc0, 0xe3, 0xf6, 0x9f, 0xa3, 0xeb, 0xe3, 0xf2, 0xbb, 0xbf,
+  0x07, 0xd7, 0xfd, 0xb7, 0xc1, 0xf9, 0x4e, 0x6f, 0x33, 0xa8, 0xf1, 0xfc, 0xde, 0xf7, 0xaf, 0x88,
+  0x9e, 0x59, 0x9c, 0xdf, 0x81, 0xf5, 0xdc, 0xb3, 0x7c, 0x64, 0x77, 0xbe, 0x1f, 0xe0, 0x00, 0xb9,
+  0x78, 0x9f, 0x37, 0xbd, 0xeb, 0x23, 0xbb, 0xf0, 0x3b, 0xbb, 0xee, 0xf3, 0xbb, 0xf7, 0xfd, 0xdf,
+  0xb7, 0xe3, 0xed, 0xbe, 0x4b, 0x97, 0xea, 0x77, 0xc9, 0xc9, 0xde, 0x7f, 0xf3, 0x7c, 0x5f, 0xc0,
+  0xe3, 0xfc, 0x4f, 0xc8, 0xd6, 0xfd, 0x6f, 0xb6, 0xe9, 0xbf, 0xb2, 0xf8, 0xaf, 0xed, 0xcf, 0xeb,
+  0x23, 0xd8, 0x7c, 0xc7, 0x6d, 0xc7, 0xe2, 0xbd, 0x87, 0xcb, 0xf6, 0xdc, 0x7d, 0x5f, 0x37, 0xa3,
+  0xec, 0x78, 0xfa, 0x9e, 0x3f, 0xd0, 0xe9, 0x7d, 0x3f, 0x27, 0x4b, 0x93, 0xf4, 0xf9, 0x39, 0x3a,
+  0x5e, 0xa3, 0xc2, 0xe5, 0x1d, 0x97, 0x2f, 0xfe, 0x77, 0x7b, 0xcb, 0xfe, 0xf2, 0x76, 0xbe, 0x57,
+  0xd9, 0x76, 0xbe, 0x57, 0xbf, 0xed, 0x7c, 0xaf, 0xb1, 0xed, 0x7a, 0x39, 0xc9, 0xf8, 0xff, 0xfa,
+  0xe3, 0xfc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x70, 0xdc, 0x37, 0x0d, 0xc3, 0x70,
+  0xdc, 0x37, 0xff, 0x77, 0x4b, 0xc5, 0x7c, 0x2f, 0xd4, 0xf3, 0x13, 0xfa, 0x4f, 0x47, 0xf3, 0x51,
+  0xde, 0x77, 0x9d, 0x2f, 0xcb, 0xf8, 0x3f, 0xfb, 0xf3, 0x1f, 0x80, 0x00,
+};
+
+#endif
@@ -0,0 +1,769 @@
+/** @file
+  Unit tests of the UEFI decompression library.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Pi/PiFirmwareFile.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiDecompressLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+#include "UefiDecompressFvSections.h"
+
+#define UNIT_TEST_APP_NAME     "UEFI Decompress Unit Test Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+///
+/// The number of times the data is decompressed by the benchmark.
+///
+#define DECOMPRESS_BENCHMARK_COUNT  1000
+
+///
+/// The size of the data compressed in mUefiCompressedData.
+///
+#define DECOMPRESS_TEST_DATA_SIZE  0x4000
+
+//
+// The decoder of BaseUefiDecompressLib for both algorithms. UefiDecompress()
+// uses version 1, and BaseUefiTianoCustomDecompressLib uses version 2 to
+// decode the sections of gTianoCustomDecompressGuid.
+//
+RETURN_STATUS
+UefiTianoDecompress (
+  IN CONST VOID  *Source,
+  IN OUT VOID    *Destination,
+  IN OUT VOID    *Scratch,
+  IN UINT32      Version
+  );
+
+//
+// Strings that look like the content of a firmware volume.
+//
+STATIC CONST CHAR8  *mTestDataStrings[] = {
+  "MZ",
+  "PE\0\0",
+  ".text",
+  ".data",
+  ".reloc",
+  "_FVH",
+  "EFI_STATUS",
+  "gEfiFirmwareVolume2ProtocolGuid",
+  "ASSERT_EFI_ERROR (Status = %r)\n",
+  "DxeCore",
+};
+
+/**
+  Generate the data that is compressed in mUefiCompressedData.
+
+  The data mixes strings, repeated strings, padding and random bytes, like the
+  sections of a firmware volume.
+
+  @param[out]  Buffer  The buffer to fill.
+  @param[in]   Size    The size, in bytes, of Buffer.
+**/
+STATIC
+VOID
+GenerateTestData (
+  OUT UINT8  *Buffer,
+  IN  UINTN  Size
+  )
+{
+  UINT32       Seed;
+  UINTN        Index;
+  UINTN        Offset;
+  UINTN        Length;
+  UINTN        Distance;
+  CONST CHAR8  *String;
+
+  Seed  = 0x5EED;
+  Index = 0;
+  while (Index < Size) {
+    Seed = Seed * 1103515245 + 12345;
+    switch ((Seed >> 16) % 4) {
+      case 0:
+        String = mTestDataStrings[(Seed >> 20) % ARRAY_SIZE (mTestDataStrings)];
+        Length = MIN (AsciiStrLen (String) + 1, Size - Index);
+        CopyMem (Buffer + Index, String, Length);
+        break;
+
+      case 1:
+        //
+        // Repeat the data found at most 4KB before.
+        //
+        if (Index == 0) {
+          Length = 0;
+          break;
+        }
+
+        Length   = MIN (3 + (Seed >> 24) % 32, Size - Index);
+        Distance = 1 + (Seed >> 8) % MIN (Index, 4096);
+        for (Offset = 0; Offset < Length; Offset++) {
+          Buffer[Index + Offset] = Buffer[Index + Offset - Distance];
+        }
+
+        break;
+
+      case 2:
+        Length = MIN (1 + (Seed >> 24) % 64, Size - Index);
+        SetMem (Buffer + Index, Length, ((Seed & BIT8) != 0) ? 0xFF : 0x00);
+        break;
+
+      default:
+        Buffer[Index] = (UINT8)(Seed >> 24);
+        Length        = 1;
+        break;
+    }
+
+    Index += Length;
+  }
+}
+
+//
+// The data of GenerateTestData(), compressed with the EFI algorithm by
+// BaseTools/Source/C/Common/EfiCompress.c.
+//
+STATIC CONST UINT8  mUefiCompressedData[] = {
+  0x30, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xb1, 0x72, 0xc3, 0xf7, 0xac, 0x69, 0x75,
+  0xcb, 0xc6, 0x51, 0x9f, 0xc9, 0x34, 0x13, 0x24, 0x54, 0xea, 0xd8, 0x4b, 0x52, 0xfc, 0x1a, 0x6c,
+  0x83, 0x11, 0x86, 0x04, 0xb7, 0x76, 0x98, 0x53, 0x27, 0x76, 0x92, 0xb5, 0x93, 0x5c, 0x6d, 0xd2,
+  0x61, 0xc9, 0xd1, 0xcf, 0x61, 0xc5, 0x51, 0x11, 0x82, 0xa5, 0x4a, 0x84, 0xa1, 0x29, 0x11, 0xaa,
+  0xd4, 0x41, 0xa0, 0xaa, 0x52, 0x8a, 0xb7, 0xc1, 0x4b, 0x49, 0x43, 0x96, 0x62, 0x7e, 0x1c, 0x96,
+  0x5a, 0x12, 0x96, 0x9a, 0xa4, 0x28, 0xd4, 0x08, 0xc7, 0x7b, 0xbd, 0xfd, 0xef, 0xfe, 0xef, 0x7b,
+  0xbb, 0x77, 0xbd, 0xed, 0xde, 0xee, 0xef, 0x6e, 0xee, 0xef, 0xff, 0x77, 0x6b, 0xbb, 0xb7, 0x69,
+  0xdb, 0x67, 0x77, 0x67, 0x67, 0x72, 0xed, 0x67, 0x1d, 0x1a, 0xaa, 0x26, 0x8a, 0x82, 0xaf, 0x92,
+  0xfb, 0x3f, 0x74, 0x1e, 0xf7, 0x6b, 0x23, 0x69, 0xb6, 0x31, 0xf3, 0xd1, 0x2f, 0xff, 0xa2, 0x53,
+  0x9f, 0xea, 0x48, 0x99, 0x5e, 0xb6, 0x99, 0x75, 0x19, 0xdf, 0xf5, 0x4f, 0x9c, 0xdb, 0xfe, 0x2b,
+  0xcb, 0x87, 0x9b, 0xb9, 0xfe, 0xbb, 0x50, 0x76, 0xe9, 0x9e, 0x50, 0x41, 0xfc, 0x24, 0xcf, 0x53,
+  0x3b, 0x40, 0xff, 0x55, 0x63, 0x7f, 0x9b, 0xb9, 0x96, 0x0b, 0x6a, 0x18, 0x5c, 0xe8, 0x4e, 0x3a,
+  0x31, 0xdc, 0x3f, 0x28, 0xc7, 0x0f, 0x33, 0x1b, 0x3f, 0x1a, 0x3f, 0xaf, 0xf1, 0x91, 0x7d, 0x99,
+  0xa5, 0x6a, 0xd4, 0x2a, 0x9f, 0xa2, 0x50, 0xa7, 0x37, 0x44, 0xa1, 0x52, 0xa9, 0xe5, 0x52, 0xdd,
+  0x12, 0xb6, 0x0b, 0x18, 0x53, 0xe9, 0x25, 0xb3, 0x32, 0xdd, 0x02, 0xfc, 0xa6, 0x3a, 0xfd, 0x38,
+  0x02, 0x6d, 0xd0, 0xa8, 0xec, 0x29, 0x54, 0xd2, 0xaf, 0xd1, 0xe9, 0x56, 0x2f, 0x5b, 0x9f, 0x5d,
+  0x4d, 0x4f, 0xa3, 0x5b, 0x35, 0x9e, 0x5e, 0xb9, 0x82, 0xea, 0x35, 0xd4, 0xd3, 0xb4, 0xf4, 0xb4,
+  0x84, 0x52, 0x11, 0x0d, 0x78, 0x86, 0x9d, 0x5e, 0xef, 0x6e, 0x29, 0xa6, 0xd9, 0x74, 0x65, 0x73,
+  0xf9, 0xa9, 0xfe, 0xad, 0x59, 0x19, 0x66, 0x32, 0x72, 0x16, 0xac, 0xfb, 0xa1, 0xb3, 0x74, 0x04,
+  0xf6, 0xd9, 0x46, 0x4c, 0x02, 0xe3, 0x43, 0x33, 0x81, 0x9a, 0xf2, 0x73, 0x95, 0x0b, 0x7a, 0x85,
+  0xcb, 0xd6, 0x91, 0x23, 0x35, 0x2f, 0x92, 0xcb, 0x9c, 0x74, 0x06, 0x52, 0x5b, 0x04, 0x6d, 0x2f,
+  0x8c, 0xb3, 0x02, 0xd7, 0x9b, 0x44, 0x46, 0x6e, 0x6a, 0x22, 0xfa, 0xe2, 0x76, 0x91, 0xb6, 0x44,
+  0x87, 0xe5, 0x8c, 0xf4, 0x42, 0x5f, 0x13, 0x34, 0x8b, 0x18, 0x2c, 0x23, 0x53, 0x7e, 0x24, 0xfa,
+  0xbe, 0x5a, 0xf9, 0xf7, 0x7c, 0x0c, 0x37, 0x61, 0x3d, 0x8c, 0x7e, 0x82, 0xdb, 0x83, 0x2f, 0x62,
+  0xca, 0x86, 0x38, 0x1d, 0xa6, 0xb1, 0x0d, 0xbf, 0x90, 0x1e, 0x91, 0xae, 0xc0, 0xef, 0xb1, 0x18,
+  0x4f, 0x25, 0x76, 0x85, 0x26, 0xa3, 0xbe, 0x49, 0x4d, 0x68, 0xed, 0x05, 0x58, 0x58, 0xae, 0x8d,
+  0x3b, 0x66, 0x92, 0x11, 0x8d, 0x16, 0xc1, 0xe3, 0x78, 0x10, 0x67, 0x82, 0x4f, 0x44, 0x4d, 0x13,
+  0xc7, 0x60, 0x5b, 0xb3, 0xee, 0x83, 0xe3, 0x7e, 0xf0, 0x23, 0x43, 0xd9, 0x84, 0x85, 0x5c, 0x0d,
+  0x05, 0x5f, 0xe3, 0xbd, 0xd2, 0xbb, 0x51, 0xd0, 0xda, 0x78, 0xf5, 0xf9, 0x1e, 0x12, 0x83, 0x72,
+  0x09, 0x4a, 0xa4, 0x4e, 0x9d, 0xf1, 0x22, 0xda, 0x1c, 0x04, 0x5a, 0x31, 0x3d, 0x54, 0x3e, 0x0b,
+  0xa3, 0xd7, 0xfb, 0xba, 0x4c, 0x50, 0x0d, 0xd1, 0x7c, 0x43, 0x73, 0x18, 0x0a, 0x3d, 0x13, 0xfe,
+  0x32, 0x33, 0x59, 0x81, 0x21, 0x21, 0xed, 0x7e, 0xdd, 0xfb, 0xba, 0xe1, 0xb9, 0x16, 0x80, 0x95,
+  0x89, 0x56, 0xc7, 0x93, 0x84, 0xea, 0xac, 0x98, 0x30, 0x0e, 0x5a, 0x2b, 0xed, 0xd6, 0x93, 0xea,
+  0x13, 0xfc, 0x46, 0x0b, 0x22, 0x94, 0x32, 0x40, 0x8e, 0x72, 0xd7, 0x72, 0x2b, 0x7f, 0x3a, 0x63,
+  0x3b, 0xa2, 0x6b, 0xfa, 0x83, 0x1a, 0xf3, 0xef, 0x09, 0x3e, 0xec, 0x80, 0x52, 0x3a, 0x38, 0x42,
+  0xb8, 0x2e, 0x14, 0x26, 0x67, 0x6c, 0x46, 0x54, 0x38, 0x2a, 0xfc, 0xbd, 0x76, 0x1e, 0x38, 0x98,
+  0xba, 0xe7, 0x09, 0xd1, 0x2b, 0x4c, 0x80, 0xe0, 0x9f, 0xdb, 0x6d, 0x76, 0x95, 0xc0, 0x57, 0x9d,
+  0x9a, 0xfa, 0x00, 0x65, 0x92, 0x89, 0x2e, 0xdb, 0x99, 0x2e, 0x62, 0xc4, 0xe0, 0x46, 0x06, 0x0c,
+  0x12, 0xf8, 0x18, 0x87, 0x9e, 0xd3, 0x1d, 0x37, 0xa1, 0x88, 0x1c, 0x4d, 0x05, 0xa0, 0xc0, 0x60,
+  0x09, 0xb4, 0x35, 0x34, 0x8a, 0x6d, 0xf8, 0xdb, 0x9c, 0x8d, 0xc5, 0xa8, 0xf0, 0x1e, 0x8d, 0x21,
+  0xf0, 0xc0, 0xe1, 0x0b, 0x23, 0x75, 0x7a, 0xde, 0x1e, 0x9e, 0xd0, 0xce, 0xef, 0x7d, 0x98, 0xd3,
+  0x9f, 0x04, 0xe1, 0x7b, 0xac, 0x81, 0x10, 0x05, 0x9c, 0xab, 0xd7, 0x5d, 0xd9, 0xcc, 0x29, 0x53,
+  0x96, 0x80, 0x9b, 0x2f, 0x62, 0x6e, 0x05, 0xf4, 0xc1, 0xb8, 0x03, 0x5f, 0x9c, 0x5d, 0xb5, 0x03,
+  0xca, 0x3a, 0x4a, 0x58, 0x18, 0x49, 0x68, 0x7e, 0x10, 0xff, 0x7b, 0x0f, 0x28, 0x1a, 0xcd, 0xe1,
+  0xd0, 0x2a, 0x7d, 0x86, 0x6d, 0xba, 0xf2, 0xc5, 0xeb, 0x89, 0x02, 0xb1, 0x69, 0xab, 0xcf, 0x29,
+  0x89, 0x86, 0xa7, 0xb5, 0x1f, 0x9f, 0x44, 0x72, 0x37, 0xe9, 0xa7, 0x40, 0x22, 0x1e, 0x73, 0x21,
+  0x83, 0xbd, 0x0a, 0x59, 0x87, 0x45, 0xf8, 0x79, 0x4a, 0xa5, 0x8d, 0xe4, 0x84, 0x90, 0x37, 0xa4,
+  0xa7, 0x8b, 0x86, 0x9a, 0xf6, 0x5c, 0x25, 0x26, 0xc8, 0xc4, 0x71, 0x89, 0xed, 0xc3, 0xb1, 0x6b,
+  0x8e, 0x88, 0x18, 0xe1, 0x42, 0x14, 0x39, 0xe5, 0x79, 0xe2, 0xef, 0x1d, 0xcb, 0xf1, 0xbc, 0x3b,
+  0xb2, 0xf3, 0x61, 0xef, 0xec, 0x05, 0xfb, 0xcd, 0xf7, 0x89, 0xc1, 0xa4, 0xd4, 0x44, 0x1b, 0xc1,
+  0xd9, 0xaf, 0x79, 0x29, 0x25, 0x56, 0x70, 0x36, 0xd9, 0x5f, 0xf2, 0xb7, 0xab, 0xe8, 0x46, 0x60,
+  0x2a, 0x23, 0x1f, 0x4c, 0x6f, 0x0e, 0x86, 0x8c, 0x74, 0xb9, 0x26, 0xa8, 0x12, 0xd1, 0xca, 0x1c,
+  0x67, 0x65, 0x69, 0xcf, 0xb7, 0x9f, 0xc8, 0x62, 0x07, 0x30, 0x01, 0xe2, 0x1b, 0x4e, 0x8f, 0xef,
+  0x25, 0x30, 0xa5, 0x28, 0x3e, 0xda, 0x1a, 0xa6, 0xf9, 0x4b, 0x44, 0xf5, 0x49, 0x22, 0xf3, 0xec,
+  0xcc, 0x4c, 0x78, 0x48, 0x78, 0x3f, 0x95, 0x19, 0xa4, 0xcb, 0x59, 0xfe, 0x2b, 0x6e, 0x46, 0x20,
+  0x9d, 0xf5, 0x8b, 0x71, 0x26, 0x8e, 0xd3, 0xb6, 0xb3, 0x55, 0xf6, 0xe6, 0x2a, 0xdf, 0xce, 0xde,
+  0xc9, 0x85, 0xba, 0x2d, 0x07, 0x1d, 0x87, 0xeb, 0x4d, 0xa0, 0x64, 0x80, 0x78, 0x0b, 0xb4, 0x65,
+  0x04, 0x21, 0x90, 0xbe, 0x77, 0xcd, 0xc9, 0xa3, 0x3c, 0x80, 0xa5, 0xde, 0xce, 0x14, 0xfb, 0x0d,
+  0x68, 0x50, 0x76, 0x3a, 0xf4, 0x25, 0x86, 0x18, 0x7f, 0x1a, 0xac, 0xaf, 0x41, 0xec, 0xa2, 0x0e,
+  0xe0, 0xfd, 0x47, 0x2f, 0x4f, 0xae, 0xde, 0x73, 0x86, 0xf9, 0x2b, 0xe2, 0xe1, 0x51, 0xd8, 0x4e,
+  0x81, 0xe3, 0x5f, 0x03, 0x69, 0x19, 0xa8, 0x60, 0x93, 0x01, 0xa7, 0x78, 0x31, 0x8e, 0xca, 0xe0,
+  0x99, 0x07, 0x76, 0xda, 0x91, 0x55, 0xa8, 0x4b, 0x85, 0x26, 0xdf, 0x69, 0xec, 0x33, 0xb8, 0xd6,
+  0x92, 0xe2, 0xa5, 0x08, 0xf5, 0x42, 0x3b, 0x06, 0x4c, 0x18, 0x34, 0x25, 0x43, 0x35, 0x86, 0x37,
+  0x06, 0x2e, 0xcf, 0x5b, 0x16, 0x8d, 0xfa, 0xed, 0xf6, 0xe2, 0xd9, 0x38, 0x8a, 0x0d, 0xc6, 0x70,
+  0xaa, 0x86, 0xdd, 0xbf, 0x10, 0x0b, 0xfd, 0x90, 0xcd, 0x64, 0x06, 0x19, 0xda, 0x5e, 0x86, 0xc9,
+  0x10, 0xad, 0x2b, 0x9f, 0x8f, 0xdb, 0xdd, 0x0e, 0x13, 0xcd, 0xd0, 0x73, 0xb1, 0xe8, 0xf7, 0x99,
+  0xea, 0xdb, 0x04, 0x09, 0xd2, 0x1a, 0x57, 0xd7, 0x0e, 0x11, 0xf4, 0x25, 0x40, 0xe1, 0x4b, 0x0b,
+  0x24, 0xf3, 0x0d, 0xce, 0xdd, 0xce, 0xba, 0xfa, 0x68, 0x68, 0x81, 0xf5, 0x79, 0x2a, 0x59, 0x28,
+  0x94, 0x69, 0x6c, 0x98, 0x23, 0xfa, 0x76, 0xb0, 0x9f, 0x13, 0xf0, 0x0d, 0xbe, 0xca, 0xd2, 0xea,
+  0xf8, 0x71, 0xa9, 0xc7, 0x06, 0xad, 0x6f, 0x88, 0x9d, 0xbd, 0x7f, 0x20, 0x8f, 0xfb, 0x2d, 0x47,
+  0xea, 0x83, 0xd7, 0xd3, 0x3b, 0x16, 0xd8, 0x5c, 0xa7, 0x66, 0x92, 0xfe, 0xaa, 0x83, 0x52, 0x5a,
+  0x87, 0x95, 0x8d, 0x7e, 0x4f, 0xb1, 0x34, 0x51, 0xee, 0x2f, 0x28, 0x3a, 0x41, 0x64, 0xb2, 0x64,
+  0xf4, 0x48, 0xc5, 0x19, 0xca, 0x42, 0x9c, 0x3f, 0x6d, 0x63, 0x43, 0x70, 0x71, 0x51, 0x8f, 0x11,
+  0x9a, 0x5b, 0x93, 0x0d, 0x82, 0x2a, 0x9f, 0x6a, 0xf6, 0x72, 0xa8, 0xb6, 0x0b, 0x41, 0xec, 0x73,
+  0x90, 0x21, 0x5f, 0x1a, 0x3b, 0xf0, 0xef, 0x6a, 0x2f, 0x5e, 0x39, 0xbd, 0x83, 0x33, 0x95, 0x1e,
+  0xdd, 0x8f, 0x74, 0x37, 0x5f, 0x7d, 0x00, 0x34, 0x60, 0x03, 0x7a, 0xfe, 0x0d, 0x09, 0xd0, 0xe8,
+  0x30, 0x1b, 0x4b, 0xac, 0x6c, 0x0f, 0x50, 0x25, 0xf0, 0x71, 0x95, 0xb2, 0x4e, 0x58, 0x7a, 0x2f,
+  0x55, 0x59, 0x64, 0x4e, 0x20, 0xcb, 0xae, 0xa9, 0x8d, 0xf7, 0xe5, 0xfd, 0xfb, 0xdf, 0x34, 0x61,
+  0x10, 0x78, 0xcd, 0x69, 0x8c, 0x67, 0xb3, 0x16, 0x9f, 0xc8, 0xfe, 0x16, 0xc1, 0xed, 0x1e, 0x3b,
+  0x1f, 0xf7, 0x01, 0xac, 0xc7, 0xc0, 0xff, 0x6a, 0xc8, 0xb0, 0xa3, 0xf5, 0x48, 0x4f, 0x25, 0xc6,
+  0x85, 0x7f, 0xf6, 0x44, 0x1b, 0x23, 0xa6, 0xe3, 0x21, 0xd7, 0xd5, 0x5a, 0x94, 0xd9, 0x97, 0xe5,
+  0xfe, 0xdf, 0x6b, 0x28, 0x8b, 0xc8, 0x47, 0x33, 0x74, 0xf2, 0xbd, 0x26, 0x84, 0xb6, 0xcd, 0x67,
+  0x3d, 0xb1, 0x7f, 0xbe, 0x31, 0x9c, 0x4f, 0x37, 0x90, 0x5c, 0x3c, 0x87, 0x44, 0x36, 0x13, 0x1b,
+  0xff, 0x2e, 0x56, 0xfb, 0x7d, 0x77, 0x54, 0x6c, 0x50, 0xfa, 0xa0, 0x85, 0x00, 0xbb, 0x4e, 0xde,
+  0xca, 0xed, 0x6f, 0x20, 0x21, 0x23, 0xce, 0xa1, 0x43, 0x1e, 0x3e, 0x2e, 0x15, 0x4c, 0xab, 0xa9,
+  0x00, 0x42, 0xa5, 0xab, 0xb9, 0xcf, 0xeb, 0x92, 0x97, 0x40, 0x6a, 0x86, 0xba, 0x2a, 0x1d, 0xf8,
+  0x39, 0x1d, 0xf9, 0xc8, 0xf0, 0x41, 0x8f, 0xee, 0x34, 0x4b, 0x3c, 0x9a, 0x71, 0x47, 0x55, 0x1c,
+  0x27, 0x9c, 0x18, 0xe9, 0xbd, 0x6a, 0x10, 0xdd, 0x73, 0xad, 0x52, 0x19, 0x5f, 0x74, 0xba, 0x68,
+  0x48, 0x8f, 0xff, 0x90, 0x18, 0x06, 0x78, 0x3b, 0xa6, 0xb6, 0x53, 0xb8, 0xa3, 0x28, 0x0d, 0xfc,
+  0x9d, 0xa6, 0xf1, 0xec, 0xba, 0xef, 0xdd, 0x24, 0xd9, 0x5a, 0xdb, 0x42, 0x2a, 0x62, 0x53, 0x9d,
+  0x7f, 0xc4, 0xf5, 0x7c, 0x55, 0xdb, 0x04, 0x72, 0x9d, 0xc2, 0xa1, 0xcb, 0xe2, 0x50, 0xbd, 0xf5,
+  0x1d, 0xfd, 0x3d, 0xb5, 0xcc, 0x73, 0xb7, 0x56, 0x04, 0x59, 0x14, 0x54, 0x15, 0xfd, 0xc1, 0x90,
+  0xd1, 0xf8, 0xaf, 0x7f, 0x22, 0x5f, 0x47, 0x77, 0x14, 0x8a, 0x8b, 0x3a, 0x79, 0xc8, 0xe1, 0xb0,
+  0xef, 0x2a, 0x87, 0x65, 0x26, 0x37, 0x3c, 0xb7, 0x20, 0xb2, 0xb8, 0x43, 0x50, 0xc4, 0xfe, 0x02,
+  0xd4, 0x1c, 0xb1, 0xef, 0x75, 0x69, 0x0b, 0x02, 0xa4, 0xe4, 0x6f, 0x0f, 0x24, 0xaf, 0x1a, 0x76,
+  0xb2, 0x40, 0xeb, 0x32, 0x5c, 0x10, 0xa1, 0x24, 0xf9, 0xb9, 0x4d, 0xf0, 0xd0, 0xc9, 0x5c, 0x3c,
+  0x42, 0x2b, 0xd1, 0xec, 0x88, 0xd8, 0x8e, 0x7f, 0x84, 0x3b, 0x38, 0xf6, 0x3f, 0x7b, 0x6b, 0xc4,
+  0x94, 0x91, 0xea, 0x49, 0xec, 0x8c, 0x0b, 0xd3, 0x3f, 0x27, 0x11, 0xd3, 0x50, 0x4e, 0x58, 0x6e,
+  0x41, 0x8b, 0x9b, 0xa8, 0xe0, 0x9c, 0xd8, 0x7d, 0x05, 0x38, 0x59, 0x19, 0x29, 0x28, 0x2e, 0xb8,
+  0xca, 0x5f, 0x54, 0x65, 0xa4, 0x46, 0x58, 0xa6, 0xea, 0x04, 0x5d, 0x72, 0xe9, 0xf2, 0x3f, 0x4b,
+  0xe9, 0xad, 0xf9, 0x3e, 0xb2, 0x1d, 0x24, 0xe2, 0xdb, 0x00, 0xc1, 0xf7, 0xce, 0x94, 0xc9, 0xc7,
+  0x42, 0x47, 0xcd, 0x20, 0xcf, 0x86, 0x6c, 0x7a, 0x4c, 0xaa, 0x28, 0x8e, 0xc5, 0x73, 0x23, 0x0c,
+  0x08, 0xd7, 0x5f, 0x1e, 0xd3, 0x84, 0x57, 0x15, 0xf4, 0x30, 0x28, 0xb6, 0xb3, 0xf7, 0xad, 0xa9,
+  0xe1, 0xa3, 0x93, 0x07, 0x83, 0x1a, 0x52, 0xe8, 0x4a, 0x3e, 0xd2, 0xdc, 0xc2, 0xf3, 0xc6, 0xe3,
+  0xfe, 0xec, 0xe7, 0x4a, 0xf8, 0x87, 0xe6, 0x6e, 0x4f, 0x06, 0xcb, 0x2a, 0x4f, 0xd5, 0xfd, 0x21,
+  0x09, 0x22, 0x32, 0x27, 0xda, 0xe7, 0x66, 0xea, 0xe4, 0xe9, 0x7f, 0xfe, 0xa9, 0xd2, 0x91, 0xcb,
+  0x0d, 0x91, 0x0d, 0xfd, 0x06, 0x41, 0xbf, 0x4d, 0x6b, 0xd4, 0x6d, 0xfd, 0xc5, 0xe3, 0x99, 0xf2,
+  0xb6, 0x36, 0x91, 0x7c, 0x82, 0x64, 0x75, 0x2a, 0xd8, 0x7d, 0xbe, 0x59, 0x22, 0xd1, 0x8e, 0x78,
+  0x3a, 0xf5, 0x3c, 0xc3, 0x4e, 0xa8, 0xf2, 0xbe, 0x91, 0x92, 0xf3, 0xfa, 0x6f, 0xef, 0x91, 0xc3,
+  0x16, 0xcd, 0x54, 0xbd, 0x7f, 0x7b, 0xda, 0xe3, 0xf7, 0xf0, 0x81, 0x93, 0x0a, 0x86, 0xf0, 0x5c,
+  0x6e, 0x68, 0x8d, 0x4f, 0x45, 0xec, 0xfa, 0x0f, 0x98, 0x89, 0x94, 0xbc, 0x85, 0x53, 0xaf, 0xcc,
+  0x34, 0xa3, 0xec, 0x90, 0xbc, 0x60, 0x1e, 0xb7, 0x82, 0xcc, 0x76, 0x79, 0xe9, 0x0f, 0x70, 0x78,
+  0xd9, 0x9e, 0x24, 0x9c, 0x3a, 0x0d, 0x9c, 0x5a, 0x13, 0xcd, 0x10, 0xf2, 0xcc, 0x9e, 0x24, 0xa8,
+  0x80, 0x6e, 0xea, 0x14, 0x85, 0xef, 0xa2, 0x94, 0xdd, 0xc7, 0xb9, 0xcc, 0xff, 0x53, 0xd6, 0x1d,
+  0x93, 0x56, 0x70, 0x9c, 0x7b, 0x94, 0xf6, 0x5e, 0x8e, 0x2c, 0x1b, 0x13, 0xe1, 0xeb, 0x1d, 0x24,
+  0xeb, 0x18, 0x3d, 0xfb, 0xa0, 0xbe, 0x4e, 0x00,
+};
+
+/**
+  Decompress mUefiCompressedData into a new buffer.
+
+  @param[out]  Destination  The decompressed data. Freed by the caller.
+  @param[out]  Scratch      The scratch buffer. Freed by the caller.
+
+  @retval  UNIT_TEST_PASSED             The data is decompressed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+DecompressTestData (
+  OUT VOID  **Destination,
+  OUT VOID  **Scratch
+  )
+{
+  UINT32  DestinationSize;
+  UINT32  ScratchSize;
+
+  UT_ASSERT_NOT_EFI_ERROR (
+    UefiDecompressGetInfo (mUefiCompressedData, sizeof (mUefiCompressedData), &DestinationSize, &ScratchSize)
+    );
+  UT_ASSERT_EQUAL (DestinationSize, DECOMPRESS_TEST_DATA_SIZE);
+
+  *Destination = AllocatePool (DestinationSize);
+  *Scratch     = AllocatePool (ScratchSize);
+  UT_ASSERT_NOT_NULL (*Destination);
+  UT_ASSERT_NOT_NULL (*Scratch);
+
+  UT_ASSERT_NOT_EFI_ERROR (UefiDecompress (mUefiCompressedData, *Destination, *Scratch));
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that UefiDecompress() restores the data compressed in
+  mUefiCompressedData.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressVectorTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS  Status;
+  UINT8             *Expected;
+  VOID              *Destination;
+  VOID              *Scratch;
+
+  Destination = NULL;
+  Scratch     = NULL;
+  Expected    = AllocatePool (DECOMPRESS_TEST_DATA_SIZE);
+  UT_ASSERT_NOT_NULL (Expected);
+  GenerateTestData (Expected, DECOMPRESS_TEST_DATA_SIZE);
+
+  Status = DecompressTestData (&Destination, &Scratch);
+  if (Status == UNIT_TEST_PASSED) {
+    UT_ASSERT_MEM_EQUAL (Destination, Expected, DECOMPRESS_TEST_DATA_SIZE);
+  }
+
+  FreePool (Expected);
+  if (Destination != NULL) {
+    FreePool (Destination);
+  }
+
+  if (Scratch != NULL) {
+    FreePool (Scratch);
+  }
+
+  return Status;
+}
+
+/**
+  Locate the compressed data of mFvCompressionSection or mFvTianoGuidedSection
+  the way the section extraction of the PEI and DXE cores does.
+
+  @param[in]   Section  The compression section or the GUIDed section.
+  @param[out]  Data     The compressed data of Section.
+  @param[out]  Size     The size, in bytes, of Data.
+  @param[out]  Version  1 for the EFI algorithm, 2 for the Tiano algorithm.
+
+  @retval  UNIT_TEST_PASSED             The compressed data is located.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+GetFvSectionData (
+  IN  CONST VOID  *Section,
+  OUT CONST VOID  **Data,
+  OUT UINT32      *Size,
+  OUT UINT32      *Version
+  )
+{
+  CONST EFI_COMPRESSION_SECTION   *Compression;
+  CONST EFI_GUID_DEFINED_SECTION  *Guided;
+
+  if (((CONST EFI_COMMON_SECTION_HEADER *)Section)->Type == EFI_SECTION_COMPRESSION) {
+    Compression = Section;
+    UT_ASSERT_EQUAL (Compression->CompressionType, EFI_STANDARD_COMPRESSION);
+    UT_ASSERT_EQUAL (Compression->UncompressedLength, FV_RAW_SECTION_SIZE);
+
+    *Data    = Compression + 1;
+    *Size    = SECTION_SIZE (Section) - sizeof (EFI_COMPRESSION_SECTION);
+    *Version = 1;
+  } else {
+    Guided = Section;
+    UT_ASSERT_EQUAL (Guided->CommonHeader.Type, EFI_SECTION_GUID_DEFINED);
+    UT_ASSERT_TRUE (CompareGuid (&Guided->SectionDefinitionGuid, &gTianoCustomDecompressGuid));
+    UT_ASSERT_EQUAL (Guided->Attributes, EFI_GUIDED_SECTION_PROCESSING_REQUIRED);
+
+    *Data    = (CONST UINT8 *)Section + Guided->DataOffset;
+    *Size    = SECTION_SIZE (Section) - Guided->DataOffset;
+    *Version = 2;
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Decompress mFvCompressionSection or mFvTianoGuidedSection into a new buffer.
+
+  @param[in]   Section      The compression section or the GUIDed section.
+  @param[out]  Destination  The decompressed data. Freed by the caller.
+  @param[out]  Scratch      The scratch buffer. Freed by the caller.
+
+  @retval  UNIT_TEST_PASSED             The data is decompressed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+DecompressFvSection (
+  IN  CONST VOID  *Section,
+  OUT VOID        **Destination,
+  OUT VOID        **Scratch
+  )
+{
+  UNIT_TEST_STATUS  Status;
+  CONST VOID        *Data;
+  UINT32            Size;
+  UINT32            Version;
+  UINT32            DestinationSize;
+  UINT32            ScratchSize;
+
+  Status = GetFvSectionData (Section, &Data, &Size, &Version);
+  if (Status != UNIT_TEST_PASSED) {
+    return Status;
+  }
+
+  //
+  // Both algorithms use the same header.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (UefiDecompressGetInfo (Data, Size, &DestinationSize, &ScratchSize));
+  UT_ASSERT_EQUAL (DestinationSize, FV_RAW_SECTION_SIZE);
+
+  *Destination = AllocatePool (DestinationSize);
+  *Scratch     = AllocatePool (ScratchSize);
+  UT_ASSERT_NOT_NULL (*Destination);
+  UT_ASSERT_NOT_NULL (*Scratch);
+
+  UT_ASSERT_NOT_EFI_ERROR (UefiTianoDecompress (Data, *Destination, *Scratch, Version));
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that the section passed as context decompresses into the raw section
+  of ResetVector.x64.raw.
+
+  @param[in]  Context  mFvCompressionSection or mFvTianoGuidedSection.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressFvSectionTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS  Status;
+  VOID              *Destination;
+  VOID              *Scratch;
+
+  Destination = NULL;
+  Scratch     = NULL;
+  Status      = DecompressFvSection (Context, &Destination, &Scratch);
+  if (Status == UNIT_TEST_PASSED) {
+    UT_ASSERT_EQUAL (((EFI_COMMON_SECTION_HEADER *)Destination)->Type, EFI_SECTION_RAW);
+    UT_ASSERT_EQUAL (SECTION_SIZE (Destination), FV_RAW_SECTION_SIZE);
+    UT_ASSERT_EQUAL (CalculateCrc32 (Destination, FV_RAW_SECTION_SIZE), FV_RAW_SECTION_CRC32);
+  }
+
+  if (Destination != NULL) {
+    FreePool (Destination);
+  }
+
+  if (Scratch != NULL) {
+    FreePool (Scratch);
+  }
+
+  return Status;
+}
+
+/**
+  Check that the EFI and the Tiano sections decompress into the same bytes.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressFvSectionsMatchTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS  Status;
+  VOID              *EfiDestination;
+  VOID              *EfiScratch;
+  VOID              *TianoDestination;
+  VOID              *TianoScratch;
+
+  EfiDestination   = NULL;
+  EfiScratch       = NULL;
+  TianoDestination = NULL;
+  TianoScratch     = NULL;
+  Status           = DecompressFvSection (mFvCompressionSection, &EfiDestination, &EfiScratch);
+  if (Status == UNIT_TEST_PASSED) {
+    Status = DecompressFvSection (mFvTianoGuidedSection, &TianoDestination, &TianoScratch);
+  }
+
+  if (Status == UNIT_TEST_PASSED) {
+    UT_ASSERT_MEM_EQUAL (EfiDestination, TianoDestination, FV_RAW_SECTION_SIZE);
+  }
+
+  if (EfiDestination != NULL) {
+    FreePool (EfiDestination);
+  }
+
+  if (EfiScratch != NULL) {
+    FreePool (EfiScratch);
+  }
+
+  if (TianoDestination != NULL) {
+    FreePool (TianoDestination);
+  }
+
+  if (TianoScratch != NULL) {
+    FreePool (TianoScratch);
+  }
+
+  return Status;
+}
+
+/**
+  Check that UefiDecompressGetInfo() rejects a source that is shorter than the
+  header, or than the compressed size of its header.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+GetInfoInvalidSizeTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT32  DestinationSize;
+  UINT32  ScratchSize;
+
+  UT_ASSERT_STATUS_EQUAL (
+    UefiDecompressGetInfo (mUefiCompressedData, 7, &DestinationSize, &ScratchSize),
+    RETURN_INVALID_PARAMETER
+    );
+  UT_ASSERT_STATUS_EQUAL (
+    UefiDecompressGetInfo (mUefiCompressedData, sizeof (mUefiCompressedData) - 1, &DestinationSize, &ScratchSize),
+    RETURN_INVALID_PARAMETER
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that data of size 0 is decompressed without reading the source.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressEmptyTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RETURN_STATUS  Status;
+  UINT8          Source[8];
+  UINT8          Destination[1];
+  UINT32         DestinationSize;
+  UINT32         ScratchSize;
+  VOID           *Scratch;
+
+  ZeroMem (Source, sizeof (Source));
+  Destination[0] = 0xA5;
+
+  UT_ASSERT_NOT_EFI_ERROR (UefiDecompressGetInfo (Source, sizeof (Source), &DestinationSize, &ScratchSize));
+  UT_ASSERT_EQUAL (DestinationSize, 0);
+
+  Scratch = AllocatePool (ScratchSize);
+  UT_ASSERT_NOT_NULL (Scratch);
+  Status = UefiDecompress (Source, Destination, Scratch);
+  FreePool (Scratch);
+
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (Destination[0], 0xA5);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Measure the throughput of UefiDecompress() on mUefiCompressedData.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressBenchmarkTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS     Status;
+  VOID                 *Destination;
+  VOID                 *Scratch;
+  UINTN                Index;
+  UNIT_TEST_BENCHMARK  Timer;
+
+  Destination = NULL;
+  Scratch     = NULL;
+  Status      = DecompressTestData (&Destination, &Scratch);
+  if (Status == UNIT_TEST_PASSED) {
+    UnitTestBenchmarkStart (&Timer);
+    for (Index = 0; Index < DECOMPRESS_BENCHMARK_COUNT; Index++) {
+      UefiDecompress (mUefiCompressedData, Destination, Scratch);
+    }
+
+    UnitTestBenchmarkStop (&Timer);
+    UnitTestBenchmarkLogThroughput ("UefiDecompress", &Timer, DECOMPRESS_BENCHMARK_COUNT * DECOMPRESS_TEST_DATA_SIZE);
+  }
+
+  if (Destination != NULL) {
+    FreePool (Destination);
+  }
+
+  if (Scratch != NULL) {
+    FreePool (Scratch);
+  }
+
+  return Status;
+}
+
+/**
+  Measure the throughput of the decoder on the section passed as context.
+
+  @param[in]  Context  mFvCompressionSection or mFvTianoGuidedSection.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+DecompressFvSectionBenchmarkTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS     Status;
+  CONST VOID           *Data;
+  UINT32               Size;
+  UINT32               Version;
+  VOID                 *Destination;
+  VOID                 *Scratch;
+  UINTN                Index;
+  UNIT_TEST_BENCHMARK  Timer;
+
+  Destination = NULL;
+  Scratch     = NULL;
+  Status      = GetFvSectionData (Context, &Data, &Size, &Version);
+  if (Status == UNIT_TEST_PASSED) {
+    Status = DecompressFvSection (Context, &Destination, &Scratch);
+  }
+
+  if (Status == UNIT_TEST_PASSED) {
+    UnitTestBenchmarkStart (&Timer);
+    for (Index = 0; Index < DECOMPRESS_BENCHMARK_COUNT; Index++) {
+      UefiTianoDecompress (Data, Destination, Scratch, Version);
+    }
+
+    UnitTestBenchmarkStop (&Timer);
+    UnitTestBenchmarkLogThroughput (
+      (Version == 1) ? "UefiDecompress (FV section)" : "TianoDecompress (FV section)",
+      &Timer,
+      DECOMPRESS_BENCHMARK_COUNT * FV_RAW_SECTION_SIZE
+      );
+  }
+
+  if (Destination != NULL) {
+    FreePool (Destination);
+  }
+
+  if (Scratch != NULL) {
+    FreePool (Scratch);
+  }
+
+  return Status;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  UEFI decompression library and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Fw;
+  UNIT_TEST_SUITE_HANDLE      DecompressTests;
+
+  Fw = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Fw, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the UEFI Decompress Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&DecompressTests, Fw, "UEFI Decompress", "UefiDecompressLib", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DecompressTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // --------------Suite----------Description--------------------------Class Name------Function-----------------Pre---Post--Context
+  AddTestCase (DecompressTests, "Decompress a known vector", "Vector", DecompressVectorTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Decompress an EFI compression section", "FvEfi", DecompressFvSectionTest, NULL, NULL, (UNIT_TEST_CONTEXT)mFvCompressionSection);
+  AddTestCase (DecompressTests, "Decompress a Tiano GUIDed section", "FvTiano", DecompressFvSectionTest, NULL, NULL, (UNIT_TEST_CONTEXT)mFvTianoGuidedSection);
+  AddTestCase (DecompressTests, "EFI and Tiano sections decode to the same data", "FvMatch", DecompressFvSectionsMatchTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "GetInfo rejects truncated sources", "InvalidSize", GetInfoInvalidSizeTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Decompress empty data", "Empty", DecompressEmptyTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "Decompress throughput", "Benchmark", DecompressBenchmarkTest, NULL, NULL, NULL);
+  AddTestCase (DecompressTests, "EFI section throughput", "FvEfiBenchmark", DecompressFvSectionBenchmarkTest, NULL, NULL, (UNIT_TEST_CONTEXT)mFvCompressionSection);
+  AddTestCase (DecompressTests, "Tiano section throughput", "FvTianoBenchmark", DecompressFvSectionBenchmarkTest, NULL, NULL, (UNIT_TEST_CONTEXT)mFvTianoGuidedSection);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Fw);
+
+EXIT:
+  if (Fw) {
+    FreeUnitTestFramework (Fw);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
@@ -36,6 +36,12 @@ UINT8  *mImageBase = NULL;
 UINT8  mImageDigest[MAX_DIGEST_SIZE];
 UINTN  mImageDigestSize;
 
+//
+// Digests of the current PE/COFF image computed so far, for each hash algorithm.
+//
+UINT8    mImageDigests[HASHALG_MAX][MAX_DIGEST_SIZE];
+BOOLEAN  mImageDigestValid[HASHALG_MAX];
+
 //
 // Notify string for authorization UI.
 //
@@ -71,6 +77,18 @@ HASH_TABLE  mHash[] = {
 
 EFI_STRING  mHashTypeStr;
 
+//
+// Signature types of the certificate hashes in dbx, and their hash algorithm.
+//
+struct {
+  EFI_GUID    *SignatureType;
+  UINT32      HashAlg;
+} mCertHashType[] = {
+  { &gEfiCertX509Sha256Guid, HASHALG_SHA256 },
+  { &gEfiCertX509Sha384Guid, HASHALG_SHA384 },
+  { &gEfiCertX509Sha512Guid, HASHALG_SHA512 }
+};
+
 /**
   SecureBoot Hook for processing image verification.
 
@@ -271,6 +289,121 @@ GetImageType (
   return IMAGE_UNKNOWN;
 }
 
+/**
+  Add a part of the PE/COFF image to all the digests being computed.
+
+  @param[in] HashContext  Pointer to the IMAGE_HASH_CONTEXT.
+  @param[in] Data         The data to hash.
+  @param[in] DataSize     The size, in bytes, of Data.
+
+  @retval RETURN_SUCCESS  The data is hashed.
+  @retval RETURN_ABORTED  A hash algorithm failed.
+**/
+RETURN_STATUS
+EFIAPI
+ImageHashUpdate (
+  IN VOID        *HashContext,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  )
+{
+  IMAGE_HASH_CONTEXT  *Context;
+  UINT32              Index;
+
+  Context = HashContext;
+  for (Index = 0; Index < HASHALG_MAX; Index++) {
+    if ((Context->HashCtx[Index] != NULL) &&
+        !mHash[Index].HashUpdate (Context->HashCtx[Index], Data, DataSize))
+    {
+      return RETURN_ABORTED;
+    }
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Calculate the digests of Pe/Coff image for several hash algorithms, based on
+  the authenticode image hashing in PE/COFF Specification 8.0 Appendix A.
+
+  All the digests are computed in a single pass over the image, and are kept
+  in mImageDigests until the next image is verified. The digests already
+  computed for the image are not computed again.
+
+  Caution: This function may receive untrusted input.
+  PE/COFF image is external input, so this function will validate its data structure
+  within this image buffer before use.
+
+  @param[in]    HashAlgMask   Bit mask of the hash algorithm types.
+
+  @retval TRUE            Successfully hash image.
+  @retval FALSE           Fail in hash image.
+
+**/
+BOOLEAN
+HashPeImageWithAlgorithms (
+  IN  UINT32  HashAlgMask
+  )
+{
+  IMAGE_HASH_CONTEXT  Context;
+  UINT32              Index;
+  UINTN               HashCount;
+  BOOLEAN             Status;
+
+  ZeroMem (&Context, sizeof (Context));
+  HashCount = 0;
+  Status    = FALSE;
+
+  for (Index = 0; Index < HASHALG_MAX; Index++) {
+    if (((HashAlgMask & HASHALG_BIT (Index)) == 0) ||
+        mImageDigestValid[Index] ||
+        (mHash[Index].HashInit == NULL))
+    {
+      continue;
+    }
+
+    Context.HashCtx[Index] = AllocatePool (mHash[Index].GetContextSize ());
+    if (Context.HashCtx[Index] == NULL) {
+      goto Done;
+    }
+
+    if (!mHash[Index].HashInit (Context.HashCtx[Index])) {
+      goto Done;
+    }
+
+    HashCount++;
+  }
+
+  if (HashCount == 0) {
+    return TRUE;
+  }
+
+  if (RETURN_ERROR (PeCoffAuthenticodeHashImage (mImageBase, mImageSize, ImageHashUpdate, &Context))) {
+    goto Done;
+  }
+
+  for (Index = 0; Index < HASHALG_MAX; Index++) {
+    if (Context.HashCtx[Index] != NULL) {
+      if (!mHash[Index].HashFinal (Context.HashCtx[Index], mImageDigests[Index])) {
+        goto Done;
+      }
+
+      mImageDigestValid[Index] = TRUE;
+    }
+  }
+
+  Status = TRUE;
+
+Done:
+  for (Index = 0; Index < HASHALG_MAX; Index++) {
+    if (Context.HashCtx[Index] != NULL) {
+      FreePool (Context.HashCtx[Index]);
+    }
+  }
+
+  return Status;
+}
+
 /**
   Calculate hash of Pe/Coff image based on the authenticode image hashing in
   PE/COFF Specification 8.0 Appendix A
@@ -293,30 +426,10 @@ HashPeImage (
   IN  UINT32  HashAlg
   )
 {
-  BOOLEAN                   Status;
-  EFI_IMAGE_SECTION_HEADER  *Section;
-  VOID                      *HashCtx;
-  UINTN                     CtxSize;
-  UINT8                     *HashBase;
-  UINTN                     HashSize;
-  UINTN                     SumOfBytesHashed;
-  EFI_IMAGE_SECTION_HEADER  *SectionHeader;
-  UINTN                     Index;
-  UINTN                     Pos;
-  UINT32                    CertSize;
-  UINT32                    NumberOfRvaAndSizes;
-
-  HashCtx       = NULL;
-  SectionHeader = NULL;
-  Status        = FALSE;
-
   if ((HashAlg >= HASHALG_MAX)) {
     return FALSE;
   }
 
-  //
-  // Initialize context of hash.
-  //
   ZeroMem (mImageDigest, MAX_DIGEST_SIZE);
 
   switch (HashAlg) {
@@ -347,268 +460,17 @@ HashPeImage (
   }
 
   mHashTypeStr = mHash[HashAlg].Name;
-  CtxSize      = mHash[HashAlg].GetContextSize ();
 
-  HashCtx = AllocatePool (CtxSize);
-  if (HashCtx == NULL) {
+  if (!HashPeImageWithAlgorithms (HASHALG_BIT (HashAlg))) {
     return FALSE;
   }
 
-  // 1.  Load the image header into memory.
-
-  // 2.  Initialize a SHA hash context.
-  Status = mHash[HashAlg].HashInit (HashCtx);
-
-  if (!Status) {
-    goto Done;
-  }
-
-  //
-  // Measuring PE/COFF Image Header;
-  // But CheckSum field and SECURITY data directory (certificate) are excluded
-  //
-
-  //
-  // 3.  Calculate the distance from the base of the image header to the image checksum address.
-  // 4.  Hash the image header from its base to beginning of the image checksum.
-  //
-  HashBase = mImageBase;
-  if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-    //
-    // Use PE32 offset.
-    //
-    HashSize            = (UINTN)(&mNtHeader.Pe32->OptionalHeader.CheckSum) - (UINTN)HashBase;
-    NumberOfRvaAndSizes = mNtHeader.Pe32->OptionalHeader.NumberOfRvaAndSizes;
-  } else if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
-    //
-    // Use PE32+ offset.
-    //
-    HashSize            = (UINTN)(&mNtHeader.Pe32Plus->OptionalHeader.CheckSum) - (UINTN)HashBase;
-    NumberOfRvaAndSizes = mNtHeader.Pe32Plus->OptionalHeader.NumberOfRvaAndSizes;
-  } else {
-    //
-    // Invalid header magic number.
-    //
-    Status = FALSE;
-    goto Done;
-  }
-
-  Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-  if (!Status) {
-    goto Done;
-  }
-
-  //
-  // 5.  Skip over the image checksum (it occupies a single ULONG).
-  //
-  if (NumberOfRvaAndSizes <= EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
-    //
-    // 6.  Since there is no Cert Directory in optional header, hash everything
-    //     from the end of the checksum to the end of image header.
-    //
-    if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      //
-      // Use PE32 offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = mNtHeader.Pe32->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    } else {
-      //
-      // Use PE32+ offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32Plus->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = mNtHeader.Pe32Plus->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    }
-
-    if (HashSize != 0) {
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    }
-  } else {
-    //
-    // 7.  Hash everything from the end of the checksum to the start of the Cert Directory.
-    //
-    if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      //
-      // Use PE32 offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = (UINTN)(&mNtHeader.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY]) - (UINTN)HashBase;
-    } else {
-      //
-      // Use PE32+ offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32Plus->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = (UINTN)(&mNtHeader.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY]) - (UINTN)HashBase;
-    }
-
-    if (HashSize != 0) {
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    }
-
-    //
-    // 8.  Skip over the Cert Directory. (It is sizeof(IMAGE_DATA_DIRECTORY) bytes.)
-    // 9.  Hash everything from the end of the Cert Directory to the end of image header.
-    //
-    if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      //
-      // Use PE32 offset
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY + 1];
-      HashSize = mNtHeader.Pe32->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    } else {
-      //
-      // Use PE32+ offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY + 1];
-      HashSize = mNtHeader.Pe32Plus->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    }
-
-    if (HashSize != 0) {
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    }
-  }
-
-  //
-  // 10. Set the SUM_OF_BYTES_HASHED to the size of the header.
-  //
-  if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-    //
-    // Use PE32 offset.
-    //
-    SumOfBytesHashed = mNtHeader.Pe32->OptionalHeader.SizeOfHeaders;
-  } else {
-    //
-    // Use PE32+ offset
-    //
-    SumOfBytesHashed = mNtHeader.Pe32Plus->OptionalHeader.SizeOfHeaders;
-  }
-
-  Section = (EFI_IMAGE_SECTION_HEADER *)(
-                                         mImageBase +
-                                         mPeCoffHeaderOffset +
-                                         sizeof (UINT32) +
-                                         sizeof (EFI_IMAGE_FILE_HEADER) +
-                                         mNtHeader.Pe32->FileHeader.SizeOfOptionalHeader
-                                         );
-
-  //
-  // 11. Build a temporary table of pointers to all the IMAGE_SECTION_HEADER
-  //     structures in the image. The 'NumberOfSections' field of the image
-  //     header indicates how big the table should be. Do not include any
-  //     IMAGE_SECTION_HEADERs in the table whose 'SizeOfRawData' field is zero.
-  //
-  SectionHeader = (EFI_IMAGE_SECTION_HEADER *)AllocateZeroPool (sizeof (EFI_IMAGE_SECTION_HEADER) * mNtHeader.Pe32->FileHeader.NumberOfSections);
-  if (SectionHeader == NULL) {
-    Status = FALSE;
-    goto Done;
-  }
-
-  //
-  // 12.  Using the 'PointerToRawData' in the referenced section headers as
-  //      a key, arrange the elements in the table in ascending order. In other
-  //      words, sort the section headers according to the disk-file offset of
-  //      the section.
-  //
-  for (Index = 0; Index < mNtHeader.Pe32->FileHeader.NumberOfSections; Index++) {
-    Pos = Index;
-    while ((Pos > 0) && (Section->PointerToRawData < SectionHeader[Pos - 1].PointerToRawData)) {
-      CopyMem (&SectionHeader[Pos], &SectionHeader[Pos - 1], sizeof (EFI_IMAGE_SECTION_HEADER));
-      Pos--;
-    }
-
-    CopyMem (&SectionHeader[Pos], Section, sizeof (EFI_IMAGE_SECTION_HEADER));
-    Section += 1;
-  }
-
-  //
-  // 13.  Walk through the sorted table, bring the corresponding section
-  //      into memory, and hash the entire section (using the 'SizeOfRawData'
-  //      field in the section header to determine the amount of data to hash).
-  // 14.  Add the section's 'SizeOfRawData' to SUM_OF_BYTES_HASHED .
-  // 15.  Repeat steps 13 and 14 for all the sections in the sorted table.
-  //
-  for (Index = 0; Index < mNtHeader.Pe32->FileHeader.NumberOfSections; Index++) {
-    Section = &SectionHeader[Index];
-    if (Section->SizeOfRawData == 0) {
-      continue;
-    }
-
-    HashBase = mImageBase + Section->PointerToRawData;
-    HashSize = (UINTN)Section->SizeOfRawData;
-
-    Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-    if (!Status) {
-      goto Done;
-    }
-
-    SumOfBytesHashed += HashSize;
-  }
-
-  //
-  // 16.  If the file size is greater than SUM_OF_BYTES_HASHED, there is extra
-  //      data in the file that needs to be added to the hash. This data begins
-  //      at file offset SUM_OF_BYTES_HASHED and its length is:
-  //             FileSize  -  (CertDirectory->Size)
-  //
-  if (mImageSize > SumOfBytesHashed) {
-    HashBase = mImageBase + SumOfBytesHashed;
-
-    if (NumberOfRvaAndSizes <= EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
-      CertSize = 0;
-    } else {
-      if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-        //
-        // Use PE32 offset.
-        //
-        CertSize = mNtHeader.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].Size;
-      } else {
-        //
-        // Use PE32+ offset.
-        //
-        CertSize = mNtHeader.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].Size;
-      }
-    }
-
-    if (mImageSize > CertSize + SumOfBytesHashed) {
-      HashSize = (UINTN)(mImageSize - CertSize - SumOfBytesHashed);
-
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    } else if (mImageSize < CertSize + SumOfBytesHashed) {
-      Status = FALSE;
-      goto Done;
-    }
-  }
-
-  Status = mHash[HashAlg].HashFinal (HashCtx, mImageDigest);
-
-Done:
-  if (HashCtx != NULL) {
-    FreePool (HashCtx);
-  }
-
-  if (SectionHeader != NULL) {
-    FreePool (SectionHeader);
-  }
-
-  return Status;
+  CopyMem (mImageDigest, mImageDigests[HashAlg], mImageDigestSize);
+  return TRUE;
 }
 
 /**
-  Recognize the Hash algorithm in PE/COFF Authenticode and calculate hash of
-  Pe/Coff image based on the authenticode image hashing in PE/COFF Specification
-  8.0 Appendix A
+  Recognize the Hash algorithm in PE/COFF Authenticode.
 
   Caution: This function may receive untrusted input.
   PE/COFF image is external input, so this function will validate its data structure
@@ -617,17 +479,16 @@ Done:
   @param[in]  AuthData            Pointer to the Authenticode Signature retrieved from signed image.
   @param[in]  AuthDataSize        Size of the Authenticode Signature in bytes.
 
-  @retval EFI_UNSUPPORTED             Hash algorithm is not supported.
-  @retval EFI_SUCCESS                 Hash successfully.
+  @return The hash algorithm type, or HASHALG_MAX if it is not recognized.
 
 **/
-EFI_STATUS
-HashPeImageByType (
+UINT32
+GetAuthenticodeHashAlg (
   IN UINT8  *AuthData,
   IN UINTN  AuthDataSize
   )
 {
-  UINT8  Index;
+  UINT32  Index;
 
   for (Index = 0; Index < HASHALG_MAX; Index++) {
     //
@@ -650,7 +511,7 @@ HashPeImageByType (
     }
 
     if (AuthDataSize < 32 + mHash[Index].OidLength) {
-      return EFI_UNSUPPORTED;
+      return HASHALG_MAX;
     }
 
     if (CompareMem (AuthData + 32, mHash[Index].OidValue, mHash[Index].OidLength) == 0) {
@@ -658,6 +519,34 @@ HashPeImageByType (
     }
   }
 
+  return Index;
+}
+
+/**
+  Recognize the Hash algorithm in PE/COFF Authenticode and calculate hash of
+  Pe/Coff image based on the authenticode image hashing in PE/COFF Specification
+  8.0 Appendix A
+
+  Caution: This function may receive untrusted input.
+  PE/COFF image is external input, so this function will validate its data structure
+  within this image buffer before use.
+
+  @param[in]  AuthData            Pointer to the Authenticode Signature retrieved from signed image.
+  @param[in]  AuthDataSize        Size of the Authenticode Signature in bytes.
+
+  @retval EFI_UNSUPPORTED             Hash algorithm is not supported.
+  @retval EFI_SUCCESS                 Hash successfully.
+
+**/
+EFI_STATUS
+HashPeImageByType (
+  IN UINT8  *AuthData,
+  IN UINTN  AuthDataSize
+  )
+{
+  UINT32  Index;
+
+  Index = GetAuthenticodeHashAlg (AuthData, AuthDataSize);
   if (Index == HASHALG_MAX) {
     return EFI_UNSUPPORTED;
   }
@@ -672,6 +561,95 @@ HashPeImageByType (
   return EFI_SUCCESS;
 }
 
+/**
+  Get the hash algorithms of all the Authenticode signatures of the image, so
+  that the digests they need are computed in a single pass over the image.
+
+  The attribute certificate table is only walked as far as it is valid. It is
+  checked again when the signatures are verified.
+
+  Caution: This function may receive untrusted input.
+  PE/COFF image is external input, so this function will validate its data structure
+  within this image buffer before use.
+
+  @param[in]  SecDataDir          The security data directory of the image.
+
+  @return Bit mask of the hash algorithm types.
+
+**/
+UINT32
+GetAuthenticodeHashAlgMask (
+  IN EFI_IMAGE_DATA_DIRECTORY  *SecDataDir
+  )
+{
+  UINT32                     HashAlgMask;
+  UINT32                     HashAlg;
+  UINT32                     OffSet;
+  UINT32                     SecDataDirEnd;
+  UINT32                     SecDataDirLeft;
+  WIN_CERTIFICATE            *WinCertificate;
+  WIN_CERTIFICATE_EFI_PKCS   *PkcsCertData;
+  WIN_CERTIFICATE_UEFI_GUID  *WinCertUefiGuid;
+  UINT8                      *AuthData;
+  UINTN                      AuthDataSize;
+
+  HashAlgMask    = 0;
+  WinCertificate = NULL;
+  SecDataDirEnd  = SecDataDir->VirtualAddress + SecDataDir->Size;
+  for (OffSet = SecDataDir->VirtualAddress;
+       OffSet < SecDataDirEnd;
+       OffSet += (WinCertificate->dwLength + ALIGN_SIZE (WinCertificate->dwLength)))
+  {
+    SecDataDirLeft = SecDataDirEnd - OffSet;
+    if (SecDataDirLeft <= sizeof (WIN_CERTIFICATE)) {
+      break;
+    }
+
+    WinCertificate = (WIN_CERTIFICATE *)(mImageBase + OffSet);
+    if ((SecDataDirLeft < WinCertificate->dwLength) ||
+        (SecDataDirLeft - WinCertificate->dwLength <
+         ALIGN_SIZE (WinCertificate->dwLength)))
+    {
+      break;
+    }
+
+    if (WinCertificate->wCertificateType == WIN_CERT_TYPE_PKCS_SIGNED_DATA) {
+      PkcsCertData = (WIN_CERTIFICATE_EFI_PKCS *)WinCertificate;
+      if (PkcsCertData->Hdr.dwLength <= sizeof (PkcsCertData->Hdr)) {
+        break;
+      }
+
+      AuthData     = PkcsCertData->CertData;
+      AuthDataSize = PkcsCertData->Hdr.dwLength - sizeof (PkcsCertData->Hdr);
+    } else if (WinCertificate->wCertificateType == WIN_CERT_TYPE_EFI_GUID) {
+      WinCertUefiGuid = (WIN_CERTIFICATE_UEFI_GUID *)WinCertificate;
+      if (WinCertUefiGuid->Hdr.dwLength <= OFFSET_OF (WIN_CERTIFICATE_UEFI_GUID, CertData)) {
+        break;
+      }
+
+      if (!CompareGuid (&WinCertUefiGuid->CertType, &gEfiCertPkcs7Guid)) {
+        continue;
+      }
+
+      AuthData     = WinCertUefiGuid->CertData;
+      AuthDataSize = WinCertUefiGuid->Hdr.dwLength - OFFSET_OF (WIN_CERTIFICATE_UEFI_GUID, CertData);
+    } else {
+      if (WinCertificate->dwLength < sizeof (WIN_CERTIFICATE)) {
+        break;
+      }
+
+      continue;
+    }
+
+    HashAlg = GetAuthenticodeHashAlg (AuthData, AuthDataSize);
+    if (HashAlg < HASHALG_MAX) {
+      HashAlgMask |= HASHALG_BIT (HashAlg);
+    }
+  }
+
+  return HashAlgMask;
+}
+
 /**
   Returns the size of a given image execution info table in bytes.
 
@@ -829,10 +807,10 @@ AddImageExeInfo (
 /**
   Check whether the hash of an given X.509 certificate is in forbidden database (DBX).
 
+  The forbidden database must have been got by GetSignatureDatabase().
+
   @param[in]  Certificate       Pointer to X.509 Certificate that is searched for.
   @param[in]  CertSize          Size of X.509 Certificate.
-  @param[in]  SignatureList     Pointer to the Signature List in forbidden database.
-  @param[in]  SignatureListSize Size of Signature List.
   @param[out] RevocationTime    Return the time that the certificate was revoked.
   @param[out] IsFound           Search result. Only valid if EFI_SUCCESS returned.
 
@@ -842,36 +820,30 @@ AddImageExeInfo (
 **/
 EFI_STATUS
 IsCertHashFoundInDbx (
-  IN  UINT8               *Certificate,
-  IN  UINTN               CertSize,
-  IN  EFI_SIGNATURE_LIST  *SignatureList,
-  IN  UINTN               SignatureListSize,
-  OUT EFI_TIME            *RevocationTime,
-  OUT BOOLEAN             *IsFound
+  IN  UINT8     *Certificate,
+  IN  UINTN     CertSize,
+  OUT EFI_TIME  *RevocationTime,
+  OUT BOOLEAN   *IsFound
   )
 {
-  EFI_STATUS          Status;
-  EFI_SIGNATURE_LIST  *DbxList;
-  UINTN               DbxSize;
-  EFI_SIGNATURE_DATA  *CertHash;
-  UINTN               CertHashCount;
-  UINTN               Index;
-  UINT32              HashAlg;
-  VOID                *HashCtx;
-  UINT8               CertDigest[MAX_DIGEST_SIZE];
-  UINT8               *DbxCertHash;
-  UINTN               SiglistHeaderSize;
-  UINT8               *TBSCert;
-  UINTN               TBSCertSize;
-
-  Status   = EFI_ABORTED;
-  *IsFound = FALSE;
-  DbxList  = SignatureList;
-  DbxSize  = SignatureListSize;
-  HashCtx  = NULL;
-  HashAlg  = HASHALG_MAX;
-
-  if ((RevocationTime == NULL) || (DbxList == NULL)) {
+  EFI_STATUS       Status;
+  UINTN            Index;
+  UINT32           HashAlg;
+  VOID             *HashCtx;
+  UINT8            CertDigest[MAX_DIGEST_SIZE];
+  UINT8            *TBSCert;
+  UINTN            TBSCertSize;
+  SIGNATURE_ENTRY  *Entry;
+  SIGNATURE_ENTRY  *Found;
+  UINTN            FoundDigestLength;
+
+  Status            = EFI_ABORTED;
+  *IsFound          = FALSE;
+  HashCtx           = NULL;
+  Found             = NULL;
+  FoundDigestLength = 0;
+
+  if (RevocationTime == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -882,22 +854,16 @@ IsCertHashFoundInDbx (
     return Status;
   }
 
-  while ((DbxSize > 0) && (SignatureListSize >= DbxList->SignatureListSize)) {
+  for (Index = 0; Index < ARRAY_SIZE (mCertHashType); Index++) {
     //
-    // Determine Hash Algorithm of Certificate in the forbidden database.
+    // Skip the hash algorithms without certificate hash in the forbidden database.
     //
-    if (CompareGuid (&DbxList->SignatureType, &gEfiCertX509Sha256Guid)) {
-      HashAlg = HASHALG_SHA256;
-    } else if (CompareGuid (&DbxList->SignatureType, &gEfiCertX509Sha384Guid)) {
-      HashAlg = HASHALG_SHA384;
-    } else if (CompareGuid (&DbxList->SignatureType, &gEfiCertX509Sha512Guid)) {
-      HashAlg = HASHALG_SHA512;
-    } else {
-      DbxSize -= DbxList->SignatureListSize;
-      DbxList  = (EFI_SIGNATURE_LIST *)((UINT8 *)DbxList + DbxList->SignatureListSize);
+    if (FindSignature (&mDbx, mCertHashType[Index].SignatureType, NULL, 0, FALSE) == NULL) {
       continue;
     }
 
+    HashAlg = mCertHashType[Index].HashAlg;
+
     //
     // Calculate the hash value of current TBSCertificate for comparision.
     //
@@ -926,33 +892,22 @@ IsCertHashFoundInDbx (
     FreePool (HashCtx);
     HashCtx = NULL;
 
-    SiglistHeaderSize = sizeof (EFI_SIGNATURE_LIST) + DbxList->SignatureHeaderSize;
-    CertHash          = (EFI_SIGNATURE_DATA *)((UINT8 *)DbxList + SiglistHeaderSize);
-    CertHashCount     = (DbxList->SignatureListSize - SiglistHeaderSize) / DbxList->SignatureSize;
-    for (Index = 0; Index < CertHashCount; Index++) {
-      //
-      // Iterate each Signature Data Node within this CertList for verify.
-      //
-      DbxCertHash = CertHash->SignatureData;
-      if (CompareMem (DbxCertHash, CertDigest, mHash[HashAlg].DigestLength) == 0) {
-        //
-        // Hash of Certificate is found in forbidden database.
-        //
-        Status   = EFI_SUCCESS;
-        *IsFound = TRUE;
-
-        //
-        // Return the revocation time.
-        //
-        CopyMem (RevocationTime, (EFI_TIME *)(DbxCertHash + mHash[HashAlg].DigestLength), sizeof (EFI_TIME));
-        goto Done;
-      }
-
-      CertHash = (EFI_SIGNATURE_DATA *)((UINT8 *)CertHash + DbxList->SignatureSize);
+    //
+    // Keep the match that comes first in the forbidden database.
+    //
+    Entry = FindSignature (&mDbx, mCertHashType[Index].SignatureType, CertDigest, mHash[HashAlg].DigestLength, FALSE);
+    if ((Entry != NULL) && ((Found == NULL) || (Entry->Signature < Found->Signature))) {
+      Found             = Entry;
+      FoundDigestLength = mHash[HashAlg].DigestLength;
     }
+  }
 
-    DbxSize -= DbxList->SignatureListSize;
-    DbxList  = (EFI_SIGNATURE_LIST *)((UINT8 *)DbxList + DbxList->SignatureListSize);
+  if (Found != NULL) {
+    //
+    // Hash of Certificate is found in forbidden database. Return the revocation time.
+    //
+    *IsFound = TRUE;
+    CopyMem (RevocationTime, (EFI_TIME *)(Found->Signature->SignatureData + FoundDigestLength), sizeof (EFI_TIME));
   }
 
   Status = EFI_SUCCESS;
@@ -968,7 +923,7 @@ Done:
 /**
   Check whether signature is in specified database.
 
-  @param[in]  VariableName        Name of database variable that is searched in.
+  @param[in]  Database            Signature database that is searched in.
   @param[in]  Signature           Pointer to signature that is searched for.
   @param[in]  CertType            Pointer to hash algorithm.
   @param[in]  SignatureSize       Size of Signature.
@@ -980,91 +935,44 @@ Done:
 **/
 EFI_STATUS
 IsSignatureFoundInDatabase (
-  IN  CHAR16    *VariableName,
-  IN  UINT8     *Signature,
-  IN  EFI_GUID  *CertType,
-  IN  UINTN     SignatureSize,
-  OUT BOOLEAN   *IsFound
+  IN  SIGNATURE_DATABASE  *Database,
+  IN  UINT8               *Signature,
+  IN  EFI_GUID            *CertType,
+  IN  UINTN               SignatureSize,
+  OUT BOOLEAN             *IsFound
   )
 {
-  EFI_STATUS          Status;
-  EFI_SIGNATURE_LIST  *CertList;
-  EFI_SIGNATURE_DATA  *Cert;
-  UINTN               DataSize;
-  UINT8               *Data;
-  UINTN               Index;
-  UINTN               CertCount;
+  EFI_STATUS       Status;
+  SIGNATURE_ENTRY  *Entry;
 
-  //
-  // Read signature database variable.
-  //
   *IsFound = FALSE;
-  Data     = NULL;
-  DataSize = 0;
-  Status   = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status == EFI_NOT_FOUND) {
-      //
-      // No database, no need to search.
-      //
-      Status = EFI_SUCCESS;
-    }
-
-    return Status;
-  }
-
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return EFI_OUT_OF_RESOURCES;
+  Status   = GetSignatureDatabase (Database);
+  if (Status == EFI_NOT_FOUND) {
+    //
+    // No database, no need to search.
+    //
+    return EFI_SUCCESS;
   }
 
-  Status = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Data);
   if (EFI_ERROR (Status)) {
-    goto Done;
+    return Status;
   }
 
-  //
-  // Enumerate all signature data in SigDB to check if signature exists for executable.
-  //
-  CertList = (EFI_SIGNATURE_LIST *)Data;
-  while ((DataSize > 0) && (DataSize >= CertList->SignatureListSize)) {
-    CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
-    Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
-    if ((CertList->SignatureSize == sizeof (EFI_SIGNATURE_DATA) - 1 + SignatureSize) && (CompareGuid (&CertList->SignatureType, CertType))) {
-      for (Index = 0; Index < CertCount; Index++) {
-        if (CompareMem (Cert->SignatureData, Signature, SignatureSize) == 0) {
-          //
-          // Find the signature in database.
-          //
-          *IsFound = TRUE;
-          //
-          // Entries in UEFI_IMAGE_SECURITY_DATABASE that are used to validate image should be measured
-          //
-          if (StrCmp (VariableName, EFI_IMAGE_SECURITY_DATABASE) == 0) {
-            SecureBootHook (VariableName, &gEfiImageSecurityDatabaseGuid, CertList->SignatureSize, Cert);
-          }
-
-          break;
-        }
-
-        Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
-      }
-
-      if (*IsFound) {
-        break;
-      }
+  Entry = FindSignature (Database, CertType, Signature, SignatureSize, TRUE);
+  if (Entry != NULL) {
+    //
+    // Find the signature in database.
+    //
+    *IsFound = TRUE;
+    //
+    // Entries in UEFI_IMAGE_SECURITY_DATABASE that are used to validate image should be measured
+    //
+    if (Database == &mDb) {
+      SecureBootHook (Database->VariableName, &gEfiImageSecurityDatabaseGuid, Entry->SignatureList->SignatureSize, Entry->Signature);
     }
-
-    DataSize -= CertList->SignatureListSize;
-    CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
   }
 
-Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
-  return Status;
+  return EFI_SUCCESS;
 }
 
 /**
@@ -1248,37 +1156,24 @@ IsForbiddenByDbx (
   IN UINTN  AuthDataSize
   )
 {
-  EFI_STATUS          Status;
-  BOOLEAN             IsForbidden;
-  BOOLEAN             IsFound;
-  UINT8               *Data;
-  UINTN               DataSize;
-  EFI_SIGNATURE_LIST  *CertList;
-  UINTN               CertListSize;
-  EFI_SIGNATURE_DATA  *CertData;
-  UINT8               *RootCert;
-  UINTN               RootCertSize;
-  UINTN               CertCount;
-  UINTN               Index;
-  UINT8               *CertBuffer;
-  UINTN               BufferLength;
-  UINT8               *TrustedCert;
-  UINTN               TrustedCertLength;
-  UINT8               CertNumber;
-  UINT8               *CertPtr;
-  UINT8               *Cert;
-  UINTN               CertSize;
-  EFI_TIME            RevocationTime;
+  EFI_STATUS       Status;
+  BOOLEAN          IsForbidden;
+  BOOLEAN          IsFound;
+  UINTN            Index;
+  UINT8            *CertBuffer;
+  UINTN            BufferLength;
+  UINT8            *TrustedCert;
+  UINTN            TrustedCertLength;
+  UINT8            CertNumber;
+  UINT8            *CertPtr;
+  UINT8            *Cert;
+  UINTN            CertSize;
+  EFI_TIME         RevocationTime;
 
   //
   // Variable Initialization
   //
   IsForbidden       = TRUE;
-  Data              = NULL;
-  CertList          = NULL;
-  CertData          = NULL;
-  RootCert          = NULL;
-  RootCertSize      = 0;
   Cert              = NULL;
   CertBuffer        = NULL;
   BufferLength      = 0;
@@ -1288,10 +1183,8 @@ IsForbiddenByDbx (
   //
   // The image will not be forbidden if dbx can't be got.
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
+  Status = GetSignatureDatabase (&mDbx);
+  if (EFI_ERROR (Status)) {
     if (Status == EFI_NOT_FOUND) {
       //
       // Evidently not in dbx if the database doesn't exist.
@@ -1302,56 +1195,25 @@ IsForbiddenByDbx (
     return IsForbidden;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return IsForbidden;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
-
   //
   // Verify image signature with RAW X509 certificates in DBX database.
   // If passed, the image will be forbidden.
   //
-  CertList     = (EFI_SIGNATURE_LIST *)Data;
-  CertListSize = DataSize;
-  while ((CertListSize > 0) && (CertListSize >= CertList->SignatureListSize)) {
-    if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
-      CertData  = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
-      CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
-
-      for (Index = 0; Index < CertCount; Index++) {
-        //
-        // Iterate each Signature Data Node within this CertList for verify.
-        //
-        RootCert     = CertData->SignatureData;
-        RootCertSize = CertList->SignatureSize - sizeof (EFI_GUID);
-
-        //
-        // Call AuthenticodeVerify library to Verify Authenticode struct.
-        //
-        IsForbidden = AuthenticodeVerify (
-                        AuthData,
-                        AuthDataSize,
-                        RootCert,
-                        RootCertSize,
-                        mImageDigest,
-                        mImageDigestSize
-                        );
-        if (IsForbidden) {
-          DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: Image is signed but signature is forbidden by DBX.\n"));
-          goto Done;
-        }
-
-        CertData = (EFI_SIGNATURE_DATA *)((UINT8 *)CertData + CertList->SignatureSize);
-      }
+  for (Index = 0; Index < mDbx.CertCount; Index++) {
+    //
+    // Verify Authenticode struct with the certificate.
+    //
+    IsForbidden = VerifyWithCertEntry (
+                    &mDbx.CertEntries[Index],
+                    AuthData,
+                    AuthDataSize,
+                    mImageDigest,
+                    mImageDigestSize
+                    );
+    if (IsForbidden) {
+      DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: Image is signed but signature is forbidden by DBX.\n"));
+      goto Done;
     }
-
-    CertListSize -= CertList->SignatureListSize;
-    CertList      = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
   }
 
   //
@@ -1389,7 +1251,7 @@ IsForbiddenByDbx (
     //
     CertPtr = CertPtr + sizeof (UINT32) + CertSize;
 
-    Status = IsCertHashFoundInDbx (Cert, CertSize, (EFI_SIGNATURE_LIST *)Data, DataSize, &RevocationTime, &IsFound);
+    Status = IsCertHashFoundInDbx (Cert, CertSize, &RevocationTime, &IsFound);
     if (EFI_ERROR (Status)) {
       //
       // Error in searching dbx. Consider it as 'found'. RevocationTime might
@@ -1418,10 +1280,6 @@ IsForbiddenByDbx (
   IsForbidden = FALSE;
 
 Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
   Pkcs7FreeSigners (CertBuffer);
   Pkcs7FreeSigners (TrustedCert);
 
@@ -1444,26 +1302,18 @@ IsAllowedByDb (
   IN UINTN  AuthDataSize
   )
 {
-  EFI_STATUS          Status;
-  BOOLEAN             VerifyStatus;
-  BOOLEAN             IsFound;
-  EFI_SIGNATURE_LIST  *CertList;
-  EFI_SIGNATURE_DATA  *CertData;
-  UINTN               DataSize;
-  UINT8               *Data;
-  UINT8               *RootCert;
-  UINTN               RootCertSize;
-  UINTN               Index;
-  UINTN               CertCount;
-  UINTN               DbxDataSize;
-  UINT8               *DbxData;
-  EFI_TIME            RevocationTime;
-
-  Data         = NULL;
-  CertList     = NULL;
-  CertData     = NULL;
+  EFI_STATUS       Status;
+  EFI_STATUS       DbxStatus;
+  BOOLEAN          VerifyStatus;
+  BOOLEAN          IsFound;
+  SIGNATURE_ENTRY  *Entry;
+  UINT8            *RootCert;
+  UINTN            RootCertSize;
+  UINTN            Index;
+  EFI_TIME         RevocationTime;
+
+  Entry        = NULL;
   RootCert     = NULL;
-  DbxData      = NULL;
   RootCertSize = 0;
   VerifyStatus = FALSE;
 
@@ -1471,21 +1321,9 @@ IsAllowedByDb (
   // Fetch 'db' content. If 'db' doesn't exist or encounters problem to get the
   // data, return not-allowed-by-db (FALSE).
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    return VerifyStatus;
-  }
-
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return VerifyStatus;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
+  Status = GetSignatureDatabase (&mDb);
   if (EFI_ERROR (Status)) {
-    goto Done;
+    return VerifyStatus;
   }
 
   //
@@ -1493,114 +1331,67 @@ IsAllowedByDb (
   // If any other errors occurred, no need to check 'db' but just return
   // not-allowed-by-db (FALSE) to avoid bypass.
   //
-  DbxDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status != EFI_NOT_FOUND) {
-      goto Done;
-    }
-
-    //
-    // 'dbx' does not exist. Continue to check 'db'.
-    //
-  } else {
-    //
-    // 'dbx' exists. Get its content.
-    //
-    DbxData = (UINT8 *)AllocateZeroPool (DbxDataSize);
-    if (DbxData == NULL) {
-      goto Done;
-    }
-
-    Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, (VOID *)DbxData);
-    if (EFI_ERROR (Status)) {
-      goto Done;
-    }
+  DbxStatus = GetSignatureDatabase (&mDbx);
+  if (EFI_ERROR (DbxStatus) && (DbxStatus != EFI_NOT_FOUND)) {
+    return VerifyStatus;
   }
 
   //
-  // Find X509 certificate in Signature List to verify the signature in pkcs7 signed data.
+  // Find X509 certificate in 'db' to verify the signature in pkcs7 signed data.
   //
-  CertList = (EFI_SIGNATURE_LIST *)Data;
-  while ((DataSize > 0) && (DataSize >= CertList->SignatureListSize)) {
-    if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
-      CertData  = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
-      CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
-
-      for (Index = 0; Index < CertCount; Index++) {
-        //
-        // Iterate each Signature Data Node within this CertList for verify.
-        //
-        RootCert     = CertData->SignatureData;
-        RootCertSize = CertList->SignatureSize - sizeof (EFI_GUID);
+  for (Index = 0; Index < mDb.CertCount; Index++) {
+    Entry        = &mDb.CertEntries[Index];
+    RootCert     = Entry->Signature->SignatureData;
+    RootCertSize = Entry->SignatureList->SignatureSize - sizeof (EFI_GUID);
 
+    //
+    // Verify Authenticode struct with the certificate.
+    //
+    VerifyStatus = VerifyWithCertEntry (
+                     Entry,
+                     AuthData,
+                     AuthDataSize,
+                     mImageDigest,
+                     mImageDigestSize
+                     );
+    if (VerifyStatus) {
+      //
+      // The image is signed and its signature is found in 'db'.
+      //
+      if (!EFI_ERROR (DbxStatus)) {
         //
-        // Call AuthenticodeVerify library to Verify Authenticode struct.
+        // Here We still need to check if this RootCert's Hash is revoked
         //
-        VerifyStatus = AuthenticodeVerify (
-                         AuthData,
-                         AuthDataSize,
-                         RootCert,
-                         RootCertSize,
-                         mImageDigest,
-                         mImageDigestSize
-                         );
-        if (VerifyStatus) {
+        Status = IsCertHashFoundInDbx (RootCert, RootCertSize, &RevocationTime, &IsFound);
+        if (EFI_ERROR (Status)) {
           //
-          // The image is signed and its signature is found in 'db'.
+          // Error in searching dbx. Consider it as 'found'. RevocationTime might
+          // not be valid in such situation.
           //
-          if (DbxData != NULL) {
-            //
-            // Here We still need to check if this RootCert's Hash is revoked
-            //
-            Status = IsCertHashFoundInDbx (RootCert, RootCertSize, (EFI_SIGNATURE_LIST *)DbxData, DbxDataSize, &RevocationTime, &IsFound);
-            if (EFI_ERROR (Status)) {
-              //
-              // Error in searching dbx. Consider it as 'found'. RevocationTime might
-              // not be valid in such situation.
-              //
-              VerifyStatus = FALSE;
-            } else if (IsFound) {
-              //
-              // Check the timestamp signature and signing time to determine if the RootCert can be trusted.
-              //
-              VerifyStatus = PassTimestampCheck (AuthData, AuthDataSize, &RevocationTime);
-              if (!VerifyStatus) {
-                DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: Image is signed and signature is accepted by DB, but its root cert failed the timestamp check.\n"));
-              }
-            }
-          }
-
+          VerifyStatus = FALSE;
+        } else if (IsFound) {
           //
-          // There's no 'dbx' to check revocation time against (must-be pass),
-          // or, there's revocation time found in 'dbx' and checked againt 'dbt'
-          // (maybe pass or fail, depending on timestamp compare result). Either
-          // way the verification job has been completed at this point.
+          // Check the timestamp signature and signing time to determine if the RootCert can be trusted.
           //
-          goto Done;
+          VerifyStatus = PassTimestampCheck (AuthData, AuthDataSize, &RevocationTime);
+          if (!VerifyStatus) {
+            DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: Image is signed and signature is accepted by DB, but its root cert failed the timestamp check.\n"));
+          }
         }
-
-        CertData = (EFI_SIGNATURE_DATA *)((UINT8 *)CertData + CertList->SignatureSize);
       }
-    }
 
-    DataSize -= CertList->SignatureListSize;
-    CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+      //
+      // There's no 'dbx' to check revocation time against (must-be pass),
+      // or, there's revocation time found in 'dbx' and checked againt 'dbt'
+      // (maybe pass or fail, depending on timestamp compare result). Either
+      // way the verification job has been completed at this point.
+      //
+      break;
+    }
   }
 
-Done:
-
   if (VerifyStatus) {
-    SecureBootHook (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, CertList->SignatureSize, CertData);
-  }
-
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
-  if (DbxData != NULL) {
-    FreePool (DbxData);
+    SecureBootHook (mDb.VariableName, &gEfiImageSecurityDatabaseGuid, Entry->SignatureList->SignatureSize, Entry->Signature);
   }
 
   return VerifyStatus;
@@ -1760,6 +1551,11 @@ DxeImageVerificationHandler (
 
   FreePool (SecureBoot);
 
+  //
+  // db and dbx may have been updated since the last image was verified.
+  //
+  MarkSignatureDatabasesStale ();
+
   //
   // Read the Dos header.
   //
@@ -1769,6 +1565,7 @@ DxeImageVerificationHandler (
 
   mImageBase = (UINT8 *)FileBuffer;
   mImageSize = FileSize;
+  ZeroMem (mImageDigestValid, sizeof (mImageDigestValid));
 
   ZeroMem (&ImageContext, sizeof (ImageContext));
   ImageContext.Handle    = (VOID *)FileBuffer;
@@ -1841,7 +1638,7 @@ DxeImageVerificationHandler (
     }
 
     DbStatus = IsSignatureFoundInDatabase (
-                 EFI_IMAGE_SECURITY_DATABASE1,
+                 &mDbx,
                  mImageDigest,
                  &mCertType,
                  mImageDigestSize,
@@ -1856,7 +1653,7 @@ DxeImageVerificationHandler (
     }
 
     DbStatus = IsSignatureFoundInDatabase (
-                 EFI_IMAGE_SECURITY_DATABASE,
+                 &mDb,
                  mImageDigest,
                  &mCertType,
                  mImageDigestSize,
@@ -1876,6 +1673,13 @@ DxeImageVerificationHandler (
     goto Failed;
   }
 
+  //
+  // Compute the digests needed by all the signatures together, rather than
+  // hashing the image again for each hash algorithm. A digest that cannot be
+  // computed here is computed again when its signature is verified.
+  //
+  HashPeImageWithAlgorithms (GetAuthenticodeHashAlgMask (SecDataDir));
+
   //
   // Verify the signature of the image, multiple signatures are allowed as per PE/COFF Section 4.7
   // "Attribute Certificate Table".
@@ -1964,7 +1768,7 @@ DxeImageVerificationHandler (
     // Check the image's hash value.
     //
     DbStatus = IsSignatureFoundInDatabase (
-                 EFI_IMAGE_SECURITY_DATABASE1,
+                 &mDbx,
                  mImageDigest,
                  &mCertType,
                  mImageDigestSize,
@@ -1979,7 +1783,7 @@ DxeImageVerificationHandler (
 
     if (!IsVerified) {
       DbStatus = IsSignatureFoundInDatabase (
-                   EFI_IMAGE_SECURITY_DATABASE,
+                   &mDb,
                    mImageDigest,
                    &mCertType,
                    mImageDigestSize,
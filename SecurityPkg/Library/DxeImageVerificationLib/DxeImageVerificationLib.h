@@ -23,6 +23,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DevicePathLib.h>
 #include <Library/SecurityManagementLib.h>
 #include <Library/PeCoffLib.h>
+#include <Library/PeCoffAuthenticodeHashLib.h>
 #include <Protocol/FirmwareVolume2.h>
 #include <Protocol/DevicePath.h>
 #include <Protocol/BlockIo.h>
@@ -69,6 +70,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define HASHALG_SHA512  0x00000004
 #define HASHALG_MAX     0x00000005
 
+//
+// Bit of a hash type in a mask of hash types
+//
+#define HASHALG_BIT(HashAlg)  (1U << (HashAlg))
+
 //
 // Set max digest size as SHA512 Output (64 bytes) by far
 //
@@ -195,4 +201,134 @@ typedef struct {
   HASH_FINAL               HashFinal;
 } HASH_TABLE;
 
+//
+// Hash contexts of the digests computed in a pass over the image, indexed by
+// hash type. NULL for the hash types that are not computed.
+//
+typedef struct {
+  VOID    *HashCtx[HASHALG_MAX];
+} IMAGE_HASH_CONTEXT;
+
+//
+// A signature of a cached signature database.
+//
+typedef struct {
+  EFI_SIGNATURE_LIST    *SignatureList;
+  EFI_SIGNATURE_DATA    *Signature;
+  //
+  // PKCS#7 verification context of an X.509 certificate, created when the
+  // certificate is first used. It holds this certificate only, so that a
+  // successful verification identifies the certificate.
+  //
+  VOID                  *VerifyContext;
+} SIGNATURE_ENTRY;
+
+//
+// Cached copy of a signature database variable (db or dbx).
+//
+typedef struct {
+  CHAR16             *VariableName;
+  //
+  // TRUE once the variable is read for the current image verification.
+  //
+  BOOLEAN            Refreshed;
+  //
+  // EFI_SUCCESS, EFI_NOT_FOUND if the variable does not exist, or the error
+  // that prevented to read the variable.
+  //
+  EFI_STATUS         Status;
+  UINT8              *Data;
+  UINTN              DataSize;
+  //
+  // All the signatures except the X.509 certificates, sorted by signature
+  // type and data for binary search.
+  //
+  SIGNATURE_ENTRY    *HashEntries;
+  UINTN              HashCount;
+  //
+  // The X.509 certificates, in the order of the variable.
+  //
+  SIGNATURE_ENTRY    *CertEntries;
+  UINTN              CertCount;
+} SIGNATURE_DATABASE;
+
+extern SIGNATURE_DATABASE  mDb;
+extern SIGNATURE_DATABASE  mDbx;
+
+/**
+  Require the cached signature databases to be checked against their variables
+  before they are used again.
+
+  It is called when a new image verification starts, so that a change of db or
+  dbx is seen by the next image.
+
+**/
+VOID
+MarkSignatureDatabasesStale (
+  VOID
+  );
+
+/**
+  Get the content of a signature database for the current image verification.
+
+  The variable is read once per image verification, and only parsed again
+  when its content changed.
+
+  @param[in, out]  Database     The signature database.
+
+  @retval EFI_SUCCESS           The signature database is available.
+  @retval EFI_NOT_FOUND         The signature database variable does not exist.
+  @retval Others                The signature database variable cannot be read.
+
+**/
+EFI_STATUS
+GetSignatureDatabase (
+  IN OUT SIGNATURE_DATABASE  *Database
+  );
+
+/**
+  Find a signature in a signature database, except the X.509 certificates.
+
+  @param[in]  Database      The signature database, got by GetSignatureDatabase().
+  @param[in]  SignatureType The signature type.
+  @param[in]  Key           The signature data to search for.
+  @param[in]  KeySize       The size of Key, 0 to find any signature of SignatureType.
+  @param[in]  ExactSize     TRUE if the signature data must be Key, FALSE if it
+                            only needs to start with Key.
+
+  @return The first matching signature of the variable, or NULL if none.
+
+**/
+SIGNATURE_ENTRY *
+FindSignature (
+  IN SIGNATURE_DATABASE  *Database,
+  IN EFI_GUID            *SignatureType,
+  IN UINT8               *Key      OPTIONAL,
+  IN UINTN               KeySize,
+  IN BOOLEAN             ExactSize
+  );
+
+/**
+  Verify an Authenticode signature against an X.509 certificate of a signature
+  database.
+
+  @param[in, out]  Entry            The X.509 certificate.
+  @param[in]       AuthData         Pointer to the Authenticode signature.
+  @param[in]       AuthDataSize     Size of the Authenticode signature in bytes.
+  @param[in]       ImageDigest      The digest of the image.
+  @param[in]       ImageDigestSize  Size of ImageDigest in bytes.
+
+  @retval TRUE   The signature is verified by the certificate.
+  @retval FALSE  The signature is not verified by the certificate.
+
+**/
+BOOLEAN
+VerifyWithCertEntry (
+  IN OUT SIGNATURE_ENTRY  *Entry,
+  IN     UINT8            *AuthData,
+  IN     UINTN            AuthDataSize,
+  IN     UINT8            *ImageDigest,
+  IN     UINTN            ImageDigestSize
+  );
+
 #endif
@@ -0,0 +1,480 @@
+/** @file
+  Cache of the signature databases db and dbx.
+
+  The databases are read once per image verification, and only parsed again
+  when their content changed. The signatures are indexed at parse time: the
+  hash signatures are sorted for binary search, and the X.509 certificates are
+  listed so that they are not searched for in the signature lists. Each
+  certificate is decoded once, when it first verifies a signature.
+
+  Caution: This module requires additional review when modified.
+  The signature databases are only modified through authenticated variable
+  writes, but their signature lists are still checked before they are indexed.
+
+Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "DxeImageVerificationLib.h"
+
+SIGNATURE_DATABASE  mDb = {
+  EFI_IMAGE_SECURITY_DATABASE
+};
+
+SIGNATURE_DATABASE  mDbx = {
+  EFI_IMAGE_SECURITY_DATABASE1
+};
+
+///
+/// FALSE once Pkcs7VerifyContextNew() has failed. Verification contexts are
+/// then not created again, and the certificates are given to
+/// AuthenticodeVerify() instead.
+///
+STATIC BOOLEAN  mVerifyContextSupported = TRUE;
+
+/**
+  Get the size of the data of a signature.
+
+  @param[in]  Entry     The signature.
+
+  @return The size of the signature data.
+
+**/
+UINTN
+GetSignatureDataSize (
+  IN CONST SIGNATURE_ENTRY  *Entry
+  )
+{
+  return Entry->SignatureList->SignatureSize - sizeof (EFI_GUID);
+}
+
+/**
+  Compare two signatures by signature type, then by signature data. Identical
+  signatures keep the order of the variable.
+
+  @param[in]  Buffer1   The first SIGNATURE_ENTRY.
+  @param[in]  Buffer2   The second SIGNATURE_ENTRY.
+
+  @retval  0            The signatures are the same entry.
+  @retval  <0           Buffer1 is sorted before Buffer2.
+  @retval  >0           Buffer1 is sorted after Buffer2.
+
+**/
+INTN
+EFIAPI
+CompareSignatureEntry (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  CONST SIGNATURE_ENTRY  *Entry1;
+  CONST SIGNATURE_ENTRY  *Entry2;
+  UINTN                  Size1;
+  UINTN                  Size2;
+  INTN                   Result;
+
+  Entry1 = (CONST SIGNATURE_ENTRY *)Buffer1;
+  Entry2 = (CONST SIGNATURE_ENTRY *)Buffer2;
+
+  Result = CompareMem (&Entry1->SignatureList->SignatureType, &Entry2->SignatureList->SignatureType, sizeof (EFI_GUID));
+  if (Result != 0) {
+    return Result;
+  }
+
+  Size1  = GetSignatureDataSize (Entry1);
+  Size2  = GetSignatureDataSize (Entry2);
+  Result = CompareMem (Entry1->Signature->SignatureData, Entry2->Signature->SignatureData, MIN (Size1, Size2));
+  if (Result != 0) {
+    return Result;
+  }
+
+  if (Size1 != Size2) {
+    return (Size1 < Size2) ? -1 : 1;
+  }
+
+  if (Entry1->Signature != Entry2->Signature) {
+    return (Entry1->Signature < Entry2->Signature) ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/**
+  Compare a signature with a search key, in the order of CompareSignatureEntry().
+
+  @param[in]  Entry          The signature.
+  @param[in]  SignatureType  The signature type of the key.
+  @param[in]  Key            The signature data of the key.
+  @param[in]  KeySize        The size of Key.
+
+  @retval  0            The signature has the type of the key, and its data starts with Key.
+  @retval  <0           The signature is sorted before the key.
+  @retval  >0           The signature is sorted after the key.
+
+**/
+INTN
+CompareSignatureKey (
+  IN CONST SIGNATURE_ENTRY  *Entry,
+  IN EFI_GUID               *SignatureType,
+  IN UINT8                  *Key,
+  IN UINTN                  KeySize
+  )
+{
+  UINTN  Size;
+  INTN   Result;
+
+  Result = CompareMem (&Entry->SignatureList->SignatureType, SignatureType, sizeof (EFI_GUID));
+  if (Result != 0) {
+    return Result;
+  }
+
+  Size   = GetSignatureDataSize (Entry);
+  Result = CompareMem (Entry->Signature->SignatureData, Key, MIN (Size, KeySize));
+  if (Result != 0) {
+    return Result;
+  }
+
+  return (Size < KeySize) ? -1 : 0;
+}
+
+/**
+  Free the content of a signature database.
+
+  @param[in, out]  Database     The signature database.
+
+**/
+VOID
+FreeSignatureDatabase (
+  IN OUT SIGNATURE_DATABASE  *Database
+  )
+{
+  UINTN  Index;
+
+  if (Database->Data != NULL) {
+    FreePool (Database->Data);
+  }
+
+  if (Database->HashEntries != NULL) {
+    FreePool (Database->HashEntries);
+  }
+
+  if (Database->CertEntries != NULL) {
+    for (Index = 0; Index < Database->CertCount; Index++) {
+      if (Database->CertEntries[Index].VerifyContext != NULL) {
+        Pkcs7VerifyContextFree (Database->CertEntries[Index].VerifyContext);
+      }
+    }
+
+    FreePool (Database->CertEntries);
+  }
+
+  Database->Data        = NULL;
+  Database->DataSize    = 0;
+  Database->HashEntries = NULL;
+  Database->HashCount   = 0;
+  Database->CertEntries = NULL;
+  Database->CertCount   = 0;
+}
+
+/**
+  Index the signatures of a signature database.
+
+  The signature lists are walked twice: to count the signatures, then to
+  record them. The walk stops at the first malformed signature list.
+
+  @param[in, out]  Database     The signature database, with its Data.
+
+  @retval EFI_SUCCESS           The signatures are indexed.
+  @retval EFI_OUT_OF_RESOURCES  The index cannot be allocated.
+
+**/
+EFI_STATUS
+BuildSignatureIndex (
+  IN OUT SIGNATURE_DATABASE  *Database
+  )
+{
+  EFI_SIGNATURE_LIST  *CertList;
+  EFI_SIGNATURE_DATA  *Cert;
+  UINTN               DataSize;
+  UINTN               CertCount;
+  UINTN               Index;
+  UINTN               Pass;
+  UINTN               HashCount;
+  UINTN               X509Count;
+  SIGNATURE_ENTRY     *Entry;
+  SIGNATURE_ENTRY     SwapEntry;
+
+  HashCount = 0;
+  X509Count = 0;
+  for (Pass = 0; Pass < 2; Pass++) {
+    HashCount = 0;
+    X509Count = 0;
+    CertList  = (EFI_SIGNATURE_LIST *)Database->Data;
+    DataSize  = Database->DataSize;
+    while ((DataSize >= sizeof (EFI_SIGNATURE_LIST)) && (DataSize >= CertList->SignatureListSize)) {
+      if ((CertList->SignatureListSize < sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize) ||
+          (CertList->SignatureSize <= sizeof (EFI_GUID)))
+      {
+        DEBUG ((DEBUG_ERROR, "DxeImageVerificationLib: Malformed signature list in %s.\n", Database->VariableName));
+        break;
+      }
+
+      CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
+      Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
+      for (Index = 0; Index < CertCount; Index++) {
+        if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
+          Entry = (Pass == 0) ? NULL : &Database->CertEntries[X509Count];
+          X509Count++;
+        } else {
+          Entry = (Pass == 0) ? NULL : &Database->HashEntries[HashCount];
+          HashCount++;
+        }
+
+        if (Entry != NULL) {
+          Entry->SignatureList = CertList;
+          Entry->Signature     = Cert;
+          Entry->VerifyContext = NULL;
+        }
+
+        Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
+      }
+
+      DataSize -= CertList->SignatureListSize;
+      CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+    }
+
+    if (Pass == 0) {
+      Database->HashEntries = AllocatePool (MAX (HashCount, 1) * sizeof (SIGNATURE_ENTRY));
+      Database->CertEntries = AllocatePool (MAX (X509Count, 1) * sizeof (SIGNATURE_ENTRY));
+      if ((Database->HashEntries == NULL) || (Database->CertEntries == NULL)) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+    }
+  }
+
+  Database->HashCount = HashCount;
+  Database->CertCount = X509Count;
+  if (HashCount > 1) {
+    QuickSort (Database->HashEntries, HashCount, sizeof (SIGNATURE_ENTRY), CompareSignatureEntry, &SwapEntry);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Require the cached signature databases to be checked against their variables
+  before they are used again.
+
+  It is called when a new image verification starts, so that a change of db or
+  dbx is seen by the next image.
+
+**/
+VOID
+MarkSignatureDatabasesStale (
+  VOID
+  )
+{
+  mDb.Refreshed  = FALSE;
+  mDbx.Refreshed = FALSE;
+}
+
+/**
+  Get the content of a signature database for the current image verification.
+
+  The variable is read once per image verification, and only parsed again
+  when its content changed.
+
+  @param[in, out]  Database     The signature database.
+
+  @retval EFI_SUCCESS           The signature database is available.
+  @retval EFI_NOT_FOUND         The signature database variable does not exist.
+  @retval Others                The signature database variable cannot be read.
+
+**/
+EFI_STATUS
+GetSignatureDatabase (
+  IN OUT SIGNATURE_DATABASE  *Database
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Data;
+  UINTN       DataSize;
+
+  if (Database->Refreshed) {
+    return Database->Status;
+  }
+
+  Data     = NULL;
+  DataSize = 0;
+  Status   = gRT->GetVariable (Database->VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
+  ASSERT (EFI_ERROR (Status));
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    Data = (UINT8 *)AllocateZeroPool (DataSize);
+    if (Data == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+    } else {
+      Status = gRT->GetVariable (Database->VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Data);
+    }
+  }
+
+  if (!EFI_ERROR (Status) && !EFI_ERROR (Database->Status) &&
+      (DataSize == Database->DataSize) && (CompareMem (Data, Database->Data, DataSize) == 0))
+  {
+    //
+    // The content did not change, keep the index.
+    //
+    FreePool (Data);
+    Database->Refreshed = TRUE;
+    return EFI_SUCCESS;
+  }
+
+  FreeSignatureDatabase (Database);
+  if (!EFI_ERROR (Status)) {
+    Database->Data     = Data;
+    Database->DataSize = DataSize;
+    Status             = BuildSignatureIndex (Database);
+    if (EFI_ERROR (Status)) {
+      FreeSignatureDatabase (Database);
+    }
+  } else if (Data != NULL) {
+    FreePool (Data);
+  }
+
+  Database->Status    = Status;
+  Database->Refreshed = TRUE;
+  return Status;
+}
+
+/**
+  Find a signature in a signature database, except the X.509 certificates.
+
+  @param[in]  Database      The signature database, got by GetSignatureDatabase().
+  @param[in]  SignatureType The signature type.
+  @param[in]  Key           The signature data to search for.
+  @param[in]  KeySize       The size of Key, 0 to find any signature of SignatureType.
+  @param[in]  ExactSize     TRUE if the signature data must be Key, FALSE if it
+                            only needs to start with Key.
+
+  @return The first matching signature of the variable, or NULL if none.
+
+**/
+SIGNATURE_ENTRY *
+FindSignature (
+  IN SIGNATURE_DATABASE  *Database,
+  IN EFI_GUID            *SignatureType,
+  IN UINT8               *Key      OPTIONAL,
+  IN UINTN               KeySize,
+  IN BOOLEAN             ExactSize
+  )
+{
+  UINTN            Low;
+  UINTN            High;
+  UINTN            Middle;
+  SIGNATURE_ENTRY  *Entry;
+  SIGNATURE_ENTRY  *Found;
+
+  //
+  // Find the first signature that is not sorted before the key.
+  //
+  Low  = 0;
+  High = Database->HashCount;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if (CompareSignatureKey (&Database->HashEntries[Middle], SignatureType, Key, KeySize) < 0) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  //
+  // The signatures starting with the key follow it. Return the first one of
+  // the variable, as a linear search of the signature lists would.
+  //
+  Found = NULL;
+  for ( ; Low < Database->HashCount; Low++) {
+    Entry = &Database->HashEntries[Low];
+    if (CompareSignatureKey (Entry, SignatureType, Key, KeySize) != 0) {
+      break;
+    }
+
+    if (ExactSize && (GetSignatureDataSize (Entry) != KeySize)) {
+      continue;
+    }
+
+    if ((Found == NULL) || (Entry->Signature < Found->Signature)) {
+      Found = Entry;
+    }
+  }
+
+  return Found;
+}
+
+/**
+  Verify an Authenticode signature against an X.509 certificate of a signature
+  database.
+
+  The certificate is decoded into a PKCS#7 verification context the first time
+  it is used, and the context is kept until the signature database changes.
+
+  The first failure of Pkcs7VerifyContextNew() is taken to mean that the
+  verification contexts are not supported, and AuthenticodeVerify() is used
+  from then on. With the EDK II Crypto Protocol, the Pkcs7VerifyContextNew,
+  Pkcs7VerifyContextAddCert, Pkcs7VerifyContextFree and
+  AuthenticodeVerifyWithContext services need to be enabled in
+  PcdCryptoServiceFamilyEnable of the crypto driver: a disabled service
+  ASSERTs when it is called in a DEBUG build.
+
+  Each certificate has a context of its own, rather than one context holding
+  all the certificates of the database: a context only tells that some of its
+  certificates verified the signature, while IsAllowedByDb() needs to know
+  which one did: it looks up the hash of that db certificate in dbx, and it
+  measures that certificate through SecureBootHook().
+
+  @param[in, out]  Entry            The X.509 certificate.
+  @param[in]       AuthData         Pointer to the Authenticode signature.
+  @param[in]       AuthDataSize     Size of the Authenticode signature in bytes.
+  @param[in]       ImageDigest      The digest of the image.
+  @param[in]       ImageDigestSize  Size of ImageDigest in bytes.
+
+  @retval TRUE   The signature is verified by the certificate.
+  @retval FALSE  The signature is not verified by the certificate.
+
+**/
+BOOLEAN
+VerifyWithCertEntry (
+  IN OUT SIGNATURE_ENTRY  *Entry,
+  IN     UINT8            *AuthData,
+  IN     UINTN            AuthDataSize,
+  IN     UINT8            *ImageDigest,
+  IN     UINTN            ImageDigestSize
+  )
+{
+  UINT8  *Cert;
+  UINTN  CertSize;
+
+  Cert     = Entry->Signature->SignatureData;
+  CertSize = GetSignatureDataSize (Entry);
+
+  if ((Entry->VerifyContext == NULL) && mVerifyContextSupported) {
+    Entry->VerifyContext = Pkcs7VerifyContextNew ();
+    if (Entry->VerifyContext == NULL) {
+      DEBUG ((DEBUG_WARN, "DxeImageVerificationLib: No PKCS#7 verification context, using AuthenticodeVerify().\n"));
+      mVerifyContextSupported = FALSE;
+    } else if (!Pkcs7VerifyContextAddCert (Entry->VerifyContext, Cert, CertSize)) {
+      Pkcs7VerifyContextFree (Entry->VerifyContext);
+      Entry->VerifyContext = NULL;
+    }
+  }
+
+  if (Entry->VerifyContext == NULL) {
+    //
+    // Let AuthenticodeVerify() decode the certificate again, and fail if it
+    // is not valid.
+    //
+    return AuthenticodeVerify (AuthData, AuthDataSize, Cert, CertSize, ImageDigest, ImageDigestSize);
+  }
+
+  return AuthenticodeVerifyWithContext (AuthData, AuthDataSize, Entry->VerifyContext, ImageDigest, ImageDigestSize);
+}
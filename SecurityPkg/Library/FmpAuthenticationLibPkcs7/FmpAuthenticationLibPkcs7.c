@@ -31,6 +31,97 @@
 #include <Protocol/FirmwareManagement.h>
 #include <Guid/SystemResourceTable.h>
 
+//
+// The same public keys are used again for every FMP image that is checked or
+// updated, so their PKCS#7 verification contexts are kept.
+//
+#define MAX_CACHED_VERIFY_CONTEXT  4
+
+typedef struct {
+  UINT8    *PublicKeyData;
+  UINTN    PublicKeyDataLength;
+  VOID     *VerifyContext;
+} CACHED_VERIFY_CONTEXT;
+
+CACHED_VERIFY_CONTEXT  mCachedVerifyContext[MAX_CACHED_VERIFY_CONTEXT];
+UINTN                  mNextCachedVerifyContext;
+
+//
+// FALSE once Pkcs7VerifyContextNew() has failed: the verification contexts are
+// then not supported, and Pkcs7Verify() is used instead. With the EDK II
+// Crypto Protocol, the context services need to be enabled in
+// PcdCryptoServiceFamilyEnable, or they ASSERT in DEBUG builds.
+//
+BOOLEAN  mVerifyContextSupported = TRUE;
+
+/**
+  Get the PKCS#7 verification context of a public key.
+
+  @param[in]  PublicKeyData           The public key data used to validate the signature.
+  @param[in]  PublicKeyDataLength     The length of the public key data.
+
+  @return The PKCS#7 verification context holding the public key, or NULL if it
+          cannot be created.
+**/
+VOID *
+GetVerifyContext (
+  IN CONST UINT8  *PublicKeyData,
+  IN UINTN        PublicKeyDataLength
+  )
+{
+  CACHED_VERIFY_CONTEXT  *Cached;
+  VOID                   *VerifyContext;
+  UINT8                  *KeyCopy;
+  UINTN                  Index;
+
+  for (Index = 0; Index < MAX_CACHED_VERIFY_CONTEXT; Index++) {
+    Cached = &mCachedVerifyContext[Index];
+    if ((Cached->VerifyContext != NULL) &&
+        (Cached->PublicKeyDataLength == PublicKeyDataLength) &&
+        (CompareMem (Cached->PublicKeyData, PublicKeyData, PublicKeyDataLength) == 0))
+    {
+      return Cached->VerifyContext;
+    }
+  }
+
+  if (!mVerifyContextSupported) {
+    return NULL;
+  }
+
+  VerifyContext = Pkcs7VerifyContextNew ();
+  if (VerifyContext == NULL) {
+    DEBUG ((DEBUG_WARN, "FmpAuthenticationLibPkcs7: No PKCS#7 verification context, using Pkcs7Verify().\n"));
+    mVerifyContextSupported = FALSE;
+    return NULL;
+  }
+
+  KeyCopy = AllocateCopyPool (PublicKeyDataLength, PublicKeyData);
+  if ((KeyCopy == NULL) || !Pkcs7VerifyContextAddCert (VerifyContext, PublicKeyData, PublicKeyDataLength)) {
+    if (KeyCopy != NULL) {
+      FreePool (KeyCopy);
+    }
+
+    Pkcs7VerifyContextFree (VerifyContext);
+    return NULL;
+  }
+
+  //
+  // Replace the oldest context.
+  //
+  Cached = &mCachedVerifyContext[mNextCachedVerifyContext];
+  if (Cached->VerifyContext != NULL) {
+    Pkcs7VerifyContextFree (Cached->VerifyContext);
+    FreePool (Cached->PublicKeyData);
+  }
+
+  Cached->PublicKeyData       = KeyCopy;
+  Cached->PublicKeyDataLength = PublicKeyDataLength;
+  Cached->VerifyContext       = VerifyContext;
+  mNextCachedVerifyContext    = (mNextCachedVerifyContext + 1) % MAX_CACHED_VERIFY_CONTEXT;
+
+  return VerifyContext;
+}
+
 /**
   The handler is used to do the authentication for FMP capsule based upon
   EFI_FIRMWARE_IMAGE_AUTHENTICATION.
@@ -67,6 +158,7 @@ FmpAuthenticatedHandlerPkcs7 (
   VOID           *P7Data;
   UINTN          P7Length;
   VOID           *TempBuffer;
+  VOID           *VerifyContext;
 
   DEBUG ((DEBUG_INFO, "FmpAuthenticatedHandlerPkcs7 - Image: 0x%08x - 0x%08x\n", (UINTN)Image, (UINTN)ImageSize));
 
@@ -91,14 +183,26 @@ FmpAuthenticatedHandlerPkcs7 (
     &Image->MonotonicCount,
     sizeof (Image->MonotonicCount)
     );
-  CryptoStatus = Pkcs7Verify (
-                   P7Data,
-                   P7Length,
-                   PublicKeyData,
-                   PublicKeyDataLength,
-                   (UINT8 *)TempBuffer,
-                   ImageSize - Image->AuthInfo.Hdr.dwLength
-                   );
+  VerifyContext = GetVerifyContext (PublicKeyData, PublicKeyDataLength);
+  if (VerifyContext != NULL) {
+    CryptoStatus = Pkcs7VerifyWithContext (
+                     P7Data,
+                     P7Length,
+                     VerifyContext,
+                     (UINT8 *)TempBuffer,
+                     ImageSize - Image->AuthInfo.Hdr.dwLength
+                     );
+  } else {
+    CryptoStatus = Pkcs7Verify (
+                     P7Data,
+                     P7Length,
+                     PublicKeyData,
+                     PublicKeyDataLength,
+                     (UINT8 *)TempBuffer,
+                     ImageSize - Image->AuthInfo.Hdr.dwLength
+                     );
+  }
+
   FreePool (TempBuffer);
   if (!CryptoStatus) {
     //
@@ -15,6 +15,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/HashLib.h>
 #include <Protocol/Tcg2Protocol.h>
 
+#include "HashLibBaseCryptoRouterCommon.h"
+
 typedef struct {
   EFI_GUID    Guid;
   UINT32      Mask;
@@ -72,3 +74,53 @@ Tpm2SetHashToDigestList (
     );
   DigestList->count++;
 }
+
+/**
+  Feed data to the hash handlers of all the enabled banks in a single pass.
+
+  The data is fed in pieces of HASH_UPDATE_CHUNK_SIZE bytes, and each piece is
+  hashed for every enabled bank before the next piece is read. So the data is
+  read from memory once, instead of once per bank.
+
+  @param HashInterface      Array of the registered hash interfaces.
+  @param HashInterfaceCount Number of entries in HashInterface.
+  @param HashMask           Mask of the enabled banks, e.g. PcdTpm2HashMask.
+  @param HashCtx            Array of the hash contexts, one per HashInterface.
+  @param DataToHash         Data to be hashed.
+  @param DataToHashLen      Data size.
+**/
+VOID
+EFIAPI
+HashUpdateAllBanks (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN UINT32          HashMask,
+  IN HASH_HANDLE     *HashCtx,
+  IN VOID            *DataToHash,
+  IN UINTN           DataToHashLen
+  )
+{
+  BOOLEAN  Enabled[HASH_COUNT];
+  UINTN    Index;
+  UINT8    *Data;
+  UINTN    Size;
+
+  ASSERT (HashInterfaceCount <= HASH_COUNT);
+
+  for (Index = 0; Index < HashInterfaceCount; Index++) {
+    Enabled[Index] = (BOOLEAN)((Tpm2GetHashMaskFromAlgo (&HashInterface[Index].HashGuid) & HashMask) != 0);
+  }
+
+  Data = DataToHash;
+  do {
+    Size = MIN (DataToHashLen, HASH_UPDATE_CHUNK_SIZE);
+    for (Index = 0; Index < HashInterfaceCount; Index++) {
+      if (Enabled[Index]) {
+        HashInterface[Index].HashUpdate (HashCtx[Index], Data, Size);
+      }
+    }
+
+    Data          += Size;
+    DataToHashLen -= Size;
+  } while (DataToHashLen != 0);
+}
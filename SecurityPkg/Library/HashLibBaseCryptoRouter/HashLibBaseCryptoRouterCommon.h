@@ -35,4 +35,35 @@ Tpm2SetHashToDigestList (
   IN TPML_DIGEST_VALUES      *Digest
   );
 
+//
+// Size of the pieces HashUpdateAllBanks() feeds the data to the hash handlers
+// in. A piece stays in the processor cache while it is hashed for every bank.
+//
+#define HASH_UPDATE_CHUNK_SIZE  SIZE_64KB
+
+/**
+  Feed data to the hash handlers of all the enabled banks in a single pass.
+
+  The data is fed in pieces of HASH_UPDATE_CHUNK_SIZE bytes, and each piece is
+  hashed for every enabled bank before the next piece is read. So the data is
+  read from memory once, instead of once per bank.
+
+  @param HashInterface      Array of the registered hash interfaces.
+  @param HashInterfaceCount Number of entries in HashInterface.
+  @param HashMask           Mask of the enabled banks, e.g. PcdTpm2HashMask.
+  @param HashCtx            Array of the hash contexts, one per HashInterface.
+  @param DataToHash         Data to be hashed.
+  @param DataToHashLen      Data size.
+**/
+VOID
+EFIAPI
+HashUpdateAllBanks (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN UINT32          HashMask,
+  IN HASH_HANDLE     *HashCtx,
+  IN VOID            *DataToHash,
+  IN UINTN           DataToHashLen
+  );
+
 #endif
@@ -16,9 +16,23 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/PcdLib.h>
 #include <Library/HashLib.h>
+#include <Library/TimerLib.h>
 
 #include "HashLibBaseCryptoRouterCommon.h"
 
+//
+// State of a hash sequence, HASH_HANDLE points to it.
+//
+typedef struct {
+  HASH_HANDLE    HashCtx[HASH_COUNT];
+  //
+  // Number of bytes hashed, and the performance counter ticks spent hashing
+  // them for all the banks.
+  //
+  UINT64         DataLength;
+  UINT64         HashTicks;
+} HASH_SEQUENCE;
+
 HASH_INTERFACE  mHashInterface[HASH_COUNT] = {
   {
     { 0 }, NULL, NULL, NULL
@@ -29,6 +43,30 @@ UINTN           mHashInterfaceCount = 0;
 UINT32  mSupportedHashMaskLast    = 0;
 UINT32  mSupportedHashMaskCurrent = 0;
 
+BOOLEAN  mHashCounterCountsUp = TRUE;
+
+/**
+  Get the number of performance counter ticks elapsed since StartTicks.
+
+  @param StartTicks  The performance counter value at the start.
+
+  @return The number of ticks elapsed.
+**/
+UINT64
+InternalHashGetElapsedTicks (
+  IN UINT64  StartTicks
+  )
+{
+  UINT64  EndTicks;
+
+  EndTicks = GetPerformanceCounter ();
+  if (mHashCounterCountsUp) {
+    return EndTicks - StartTicks;
+  }
+
+  return StartTicks - EndTicks;
+}
+
 /**
   Check mismatch of supported HashMask between modules
   that may link different HashInstanceLib instances.
@@ -64,9 +102,9 @@ HashStart (
   OUT HASH_HANDLE  *HashHandle
   )
 {
-  HASH_HANDLE  *HashCtx;
-  UINTN        Index;
-  UINT32       HashMask;
+  HASH_SEQUENCE  *HashSequence;
+  UINTN          Index;
+  UINT32         HashMask;
 
   if (mHashInterfaceCount == 0) {
     return EFI_UNSUPPORTED;
@@ -74,17 +112,17 @@ HashStart (
 
   CheckSupportedHashMaskMismatch ();
 
-  HashCtx = AllocatePool (sizeof (*HashCtx) * mHashInterfaceCount);
-  ASSERT (HashCtx != NULL);
+  HashSequence = AllocateZeroPool (sizeof (*HashSequence));
+  ASSERT (HashSequence != NULL);
 
   for (Index = 0; Index < mHashInterfaceCount; Index++) {
     HashMask = Tpm2GetHashMaskFromAlgo (&mHashInterface[Index].HashGuid);
     if ((HashMask & PcdGet32 (PcdTpm2HashMask)) != 0) {
-      mHashInterface[Index].HashInit (&HashCtx[Index]);
+      mHashInterface[Index].HashInit (&HashSequence->HashCtx[Index]);
     }
   }
 
-  *HashHandle = (HASH_HANDLE)HashCtx;
+  *HashHandle = (HASH_HANDLE)HashSequence;
 
   return EFI_SUCCESS;
 }
@@ -106,9 +144,8 @@ HashUpdate (
   IN UINTN        DataToHashLen
   )
 {
-  HASH_HANDLE  *HashCtx;
-  UINTN        Index;
-  UINT32       HashMask;
+  HASH_SEQUENCE  *HashSequence;
+  UINT64         StartTicks;
 
   if (mHashInterfaceCount == 0) {
     return EFI_UNSUPPORTED;
@@ -116,14 +153,19 @@ HashUpdate (
 
   CheckSupportedHashMaskMismatch ();
 
-  HashCtx = (HASH_HANDLE *)HashHandle;
+  HashSequence = (HASH_SEQUENCE *)HashHandle;
 
-  for (Index = 0; Index < mHashInterfaceCount; Index++) {
-    HashMask = Tpm2GetHashMaskFromAlgo (&mHashInterface[Index].HashGuid);
-    if ((HashMask & PcdGet32 (PcdTpm2HashMask)) != 0) {
-      mHashInterface[Index].HashUpdate (HashCtx[Index], DataToHash, DataToHashLen);
-    }
-  }
+  StartTicks = GetPerformanceCounter ();
+  HashUpdateAllBanks (
+    mHashInterface,
+    mHashInterfaceCount,
+    PcdGet32 (PcdTpm2HashMask),
+    HashSequence->HashCtx,
+    DataToHash,
+    DataToHashLen
+    );
+  HashSequence->HashTicks  += InternalHashGetElapsedTicks (StartTicks);
+  HashSequence->DataLength += DataToHashLen;
 
   return EFI_SUCCESS;
 }
@@ -150,10 +192,11 @@ HashCompleteAndExtend (
   )
 {
   TPML_DIGEST_VALUES  Digest;
-  HASH_HANDLE         *HashCtx;
+  HASH_SEQUENCE       *HashSequence;
   UINTN               Index;
   EFI_STATUS          Status;
   UINT32              HashMask;
+  UINT64              StartTicks;
 
   if (mHashInterfaceCount == 0) {
     return EFI_UNSUPPORTED;
@@ -161,19 +204,40 @@ HashCompleteAndExtend (
 
   CheckSupportedHashMaskMismatch ();
 
-  HashCtx = (HASH_HANDLE *)HashHandle;
+  HashSequence = (HASH_SEQUENCE *)HashHandle;
   ZeroMem (DigestList, sizeof (*DigestList));
 
+  StartTicks = GetPerformanceCounter ();
+  HashUpdateAllBanks (
+    mHashInterface,
+    mHashInterfaceCount,
+    PcdGet32 (PcdTpm2HashMask),
+    HashSequence->HashCtx,
+    DataToHash,
+    DataToHashLen
+    );
+
   for (Index = 0; Index < mHashInterfaceCount; Index++) {
     HashMask = Tpm2GetHashMaskFromAlgo (&mHashInterface[Index].HashGuid);
     if ((HashMask & PcdGet32 (PcdTpm2HashMask)) != 0) {
-      mHashInterface[Index].HashUpdate (HashCtx[Index], DataToHash, DataToHashLen);
-      mHashInterface[Index].HashFinal (HashCtx[Index], &Digest);
+      mHashInterface[Index].HashFinal (HashSequence->HashCtx[Index], &Digest);
       Tpm2SetHashToDigestList (DigestList, &Digest);
     }
   }
 
-  FreePool (HashCtx);
+  HashSequence->HashTicks  += InternalHashGetElapsedTicks (StartTicks);
+  HashSequence->DataLength += DataToHashLen;
+
+  DEBUG ((
+    DEBUG_INFO,
+    "HashLib: %ld bytes for PCR %d hashed into %d banks in %ld us\n",
+    HashSequence->DataLength,
+    PcrIndex,
+    DigestList->count,
+    DivU64x32 (GetTimeInNanoSecond (HashSequence->HashTicks), 1000)
+    ));
+
+  FreePool (HashSequence);
 
   Status = Tpm2PcrExtend (
              PcrIndex,
@@ -293,6 +357,11 @@ HashLibBaseCryptoRouterDxeConstructor (
   )
 {
   EFI_STATUS  Status;
+  UINT64      CounterStart;
+  UINT64      CounterEnd;
+
+  GetPerformanceCounterProperties (&CounterStart, &CounterEnd);
+  mHashCounterCountsUp = (BOOLEAN)(CounterEnd >= CounterStart);
 
   //
   // Record hash algorithm bitmap of LAST module which also consumes HashLib.
@@ -185,8 +185,6 @@ HashUpdate (
 {
   HASH_INTERFACE_HOB  *HashInterfaceHob;
   HASH_HANDLE         *HashCtx;
-  UINTN               Index;
-  UINT32              HashMask;
 
   HashInterfaceHob = InternalGetHashInterfaceHob (&gEfiCallerIdGuid);
   if (HashInterfaceHob == NULL) {
@@ -201,12 +199,14 @@ HashUpdate (
 
   HashCtx = (HASH_HANDLE *)HashHandle;
 
-  for (Index = 0; Index < HashInterfaceHob->HashInterfaceCount; Index++) {
-    HashMask = Tpm2GetHashMaskFromAlgo (&HashInterfaceHob->HashInterface[Index].HashGuid);
-    if ((HashMask & PcdGet32 (PcdTpm2HashMask)) != 0) {
-      HashInterfaceHob->HashInterface[Index].HashUpdate (HashCtx[Index], DataToHash, DataToHashLen);
-    }
-  }
+  HashUpdateAllBanks (
+    HashInterfaceHob->HashInterface,
+    HashInterfaceHob->HashInterfaceCount,
+    PcdGet32 (PcdTpm2HashMask),
+    HashCtx,
+    DataToHash,
+    DataToHashLen
+    );
 
   return EFI_SUCCESS;
 }
@@ -253,10 +253,18 @@ HashCompleteAndExtend (
   HashCtx = (HASH_HANDLE *)HashHandle;
   ZeroMem (DigestList, sizeof (*DigestList));
 
+  HashUpdateAllBanks (
+    HashInterfaceHob->HashInterface,
+    HashInterfaceHob->HashInterfaceCount,
+    PcdGet32 (PcdTpm2HashMask),
+    HashCtx,
+    DataToHash,
+    DataToHashLen
+    );
+
   for (Index = 0; Index < HashInterfaceHob->HashInterfaceCount; Index++) {
     HashMask = Tpm2GetHashMaskFromAlgo (&HashInterfaceHob->HashInterface[Index].HashGuid);
     if ((HashMask & PcdGet32 (PcdTpm2HashMask)) != 0) {
-      HashInterfaceHob->HashInterface[Index].HashUpdate (HashCtx[Index], DataToHash, DataToHashLen);
       HashInterfaceHob->HashInterface[Index].HashFinal (HashCtx[Index], &Digest);
       Tpm2SetHashToDigestList (DigestList, &Digest);
     }
@@ -0,0 +1,162 @@
+/** @file
+  Timing and reporting services for benchmarks run by unit tests.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include "UnitTestBenchmarkLibInternal.h"
+
+/**
+  Read the free-running cycle counter of the processor.
+
+  @return The current value of the cycle counter, or 0 if the processor has no
+          cycle counter that can be read.
+
+**/
+STATIC
+UINT64
+ReadCycleCounter (
+  VOID
+  )
+{
+ #if defined (MDE_CPU_IA32) || defined (MDE_CPU_X64)
+  return AsmReadTsc ();
+ #else
+  return 0;
+ #endif
+}
+
+/**
+  Start timing a benchmark.
+
+  @param[out]  Benchmark  The benchmark to start.
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkStart (
+  OUT UNIT_TEST_BENCHMARK  *Benchmark
+  )
+{
+  Benchmark->Cycles      = 0;
+  Benchmark->Nanoseconds = 0;
+  Benchmark->StartTime   = InternalBenchmarkReadTime ();
+  Benchmark->StartCycles = ReadCycleCounter ();
+}
+
+/**
+  Stop timing a benchmark and record the cycles and time it took.
+
+  @param[in, out]  Benchmark  The benchmark started by UnitTestBenchmarkStart().
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkStop (
+  IN OUT UNIT_TEST_BENCHMARK  *Benchmark
+  )
+{
+  Benchmark->Cycles      = ReadCycleCounter () - Benchmark->StartCycles;
+  Benchmark->Nanoseconds = InternalBenchmarkTimeToNanoseconds (
+                             Benchmark->Cycles,
+                             InternalBenchmarkReadTime () - Benchmark->StartTime
+                             );
+}
+
+/**
+  Log the throughput of a benchmark in cycles per byte and in MB/s.
+
+  @param[in]  Operation  The name of the operation that was timed.
+  @param[in]  Benchmark  The benchmark stopped by UnitTestBenchmarkStop().
+  @param[in]  DataSize   The number of bytes the operation processed.
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkLogThroughput (
+  IN CONST CHAR8                *Operation,
+  IN CONST UNIT_TEST_BENCHMARK  *Benchmark,
+  IN UINT64                     DataSize
+  )
+{
+  UINT64  CentiCyclesPerByte;
+
+  if (DataSize == 0) {
+    return;
+  }
+
+  if (Benchmark->Cycles != 0) {
+    CentiCyclesPerByte = DivU64x64Remainder (MultU64x32 (Benchmark->Cycles, 100), DataSize, NULL);
+    UT_LOG_INFO (
+      "%a: %Lu bytes in %Lu cycles, %Lu.%02Lu cycles/byte\n",
+      Operation,
+      DataSize,
+      Benchmark->Cycles,
+      DivU64x32 (CentiCyclesPerByte, 100),
+      ModU64x32 (CentiCyclesPerByte, 100)
+      );
+  }
+
+  if (Benchmark->Nanoseconds != 0) {
+    //
+    // Bytes per nanosecond times 1000 is 10^6 bytes per second.
+    //
+    UT_LOG_INFO (
+      "%a: %Lu bytes in %Lu ns, %Lu MB/s\n",
+      Operation,
+      DataSize,
+      Benchmark->Nanoseconds,
+      DivU64x64Remainder (MultU64x32 (DataSize, 1000), Benchmark->Nanoseconds, NULL)
+      );
+  }
+
+  if ((Benchmark->Cycles == 0) && (Benchmark->Nanoseconds == 0)) {
+    UT_LOG_INFO ("%a: %Lu bytes, no timer\n", Operation, DataSize);
+  }
+}
+
+/**
+  Log the rate of a benchmark in cycles per call and in calls per second.
+
+  @param[in]  Operation  The name of the operation that was timed.
+  @param[in]  Benchmark  The benchmark stopped by UnitTestBenchmarkStop().
+  @param[in]  Count      The number of times the operation was called.
+
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkLogRate (
+  IN CONST CHAR8                *Operation,
+  IN CONST UNIT_TEST_BENCHMARK  *Benchmark,
+  IN UINT64                     Count
+  )
+{
+  if (Count == 0) {
+    return;
+  }
+
+  if (Benchmark->Cycles != 0) {
+    UT_LOG_INFO (
+      "%a: %Lu calls in %Lu cycles, %Lu cycles/call\n",
+      Operation,
+      Count,
+      Benchmark->Cycles,
+      DivU64x64Remainder (Benchmark->Cycles, Count, NULL)
+      );
+  }
+
+  if (Benchmark->Nanoseconds != 0) {
+    UT_LOG_INFO (
+      "%a: %Lu calls in %Lu ns, %Lu calls/s\n",
+      Operation,
+      Count,
+      Benchmark->Nanoseconds,
+      DivU64x64Remainder (MultU64x32 (Count, 1000000000), Benchmark->Nanoseconds, NULL)
+      );
+  }
+
+  if ((Benchmark->Cycles == 0) && (Benchmark->Nanoseconds == 0)) {
+    UT_LOG_INFO ("%a: %Lu calls, no timer\n", Operation, Count);
+  }
+}
@@ -0,0 +1,43 @@
+/** @file
+  Internal functions of the UnitTestBenchmarkLib instances.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef UNIT_TEST_BENCHMARK_LIB_INTERNAL_H_
+#define UNIT_TEST_BENCHMARK_LIB_INTERNAL_H_
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/UnitTestBenchmarkLib.h>
+
+/**
+  Read the time used to measure benchmarks.
+
+  @return The current time, in units private to the library instance.
+
+**/
+UINT64
+InternalBenchmarkReadTime (
+  VOID
+  );
+
+/**
+  Convert the difference of two values returned by InternalBenchmarkReadTime()
+  to nanoseconds.
+
+  @param[in]  Cycles  The number of cycles measured over the same interval.
+  @param[in]  Time    The difference of the two times.
+
+  @return The interval in nanoseconds, or 0 if it is not known.
+
+**/
+UINT64
+InternalBenchmarkTimeToNanoseconds (
+  IN UINT64  Cycles,
+  IN UINT64  Time
+  );
+
+#endif
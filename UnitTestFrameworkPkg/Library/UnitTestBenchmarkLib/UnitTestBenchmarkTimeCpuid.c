@@ -0,0 +1,100 @@
+/** @file
+  Benchmark time derived from the cycle counter and the frequency reported by
+  CPUID.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include "UnitTestBenchmarkLibInternal.h"
+
+#if defined (MDE_CPU_IA32) || defined (MDE_CPU_X64)
+  #include <Register/Intel/Cpuid.h>
+#endif
+
+/**
+  Get the frequency of the cycle counter.
+
+  The frequency is taken from the CPUID Time Stamp Counter leaf, or else from
+  the processor base frequency reported by CPUID.
+
+  @return The frequency of the cycle counter in Hz, or 0 if it is not known.
+
+**/
+STATIC
+UINT64
+GetCycleCounterFrequency (
+  VOID
+  )
+{
+ #if defined (MDE_CPU_IA32) || defined (MDE_CPU_X64)
+  UINT32  MaxLeaf;
+  UINT32  Eax;
+  UINT32  Ebx;
+  UINT32  Ecx;
+
+  AsmCpuid (CPUID_SIGNATURE, &MaxLeaf, NULL, NULL, NULL);
+  if (MaxLeaf >= CPUID_TIME_STAMP_COUNTER) {
+    AsmCpuid (CPUID_TIME_STAMP_COUNTER, &Eax, &Ebx, &Ecx, NULL);
+    if ((Eax != 0) && (Ebx != 0) && (Ecx != 0)) {
+      return DivU64x32 (MultU64x32 (Ecx, Ebx), Eax);
+    }
+  }
+
+  if (MaxLeaf >= CPUID_PROCESSOR_FREQUENCY) {
+    AsmCpuid (CPUID_PROCESSOR_FREQUENCY, &Eax, NULL, NULL, NULL);
+    if ((Eax & MAX_UINT16) != 0) {
+      return MultU64x32 (Eax & MAX_UINT16, 1000000);
+    }
+  }
+
+ #endif
+  return 0;
+}
+
+/**
+  Read the time used to measure benchmarks.
+
+  This instance has no clock of its own, so the time is derived from the cycle
+  counter.
+
+  @return 0.
+
+**/
+UINT64
+InternalBenchmarkReadTime (
+  VOID
+  )
+{
+  return 0;
+}
+
+/**
+  Convert the difference of two values returned by InternalBenchmarkReadTime()
+  to nanoseconds.
+
+  @param[in]  Cycles  The number of cycles measured over the same interval.
+  @param[in]  Time    The difference of the two times.
+
+  @return The interval in nanoseconds, or 0 if it is not known.
+
+**/
+UINT64
+InternalBenchmarkTimeToNanoseconds (
+  IN UINT64  Cycles,
+  IN UINT64  Time
+  )
+{
+  UINT64  Frequency;
+  UINT64  Seconds;
+  UINT64  Remainder;
+
+  Frequency = GetCycleCounterFrequency ();
+  if ((Frequency == 0) || (Cycles == 0)) {
+    return 0;
+  }
+
+  Seconds = DivU64x64Remainder (Cycles, Frequency, &Remainder);
+  return MultU64x32 (Seconds, 1000000000) +
+         DivU64x64Remainder (MultU64x32 (Remainder, 1000000000), Frequency, NULL);
+}
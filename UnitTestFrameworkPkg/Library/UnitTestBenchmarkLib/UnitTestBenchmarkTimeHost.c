@@ -0,0 +1,45 @@
+/** @file
+  Benchmark time measured with the processor time of the host process.
+
+  Copyright (c) 2022, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <time.h>
+
+#include "UnitTestBenchmarkLibInternal.h"
+
+/**
+  Read the time used to measure benchmarks.
+
+  @return The processor time used by the host process, in units of
+          1/CLOCKS_PER_SEC seconds.
+
+**/
+UINT64
+InternalBenchmarkReadTime (
+  VOID
+  )
+{
+  return (UINT64)clock ();
+}
+
+/**
+  Convert the difference of two values returned by InternalBenchmarkReadTime()
+  to nanoseconds.
+
+  @param[in]  Cycles  The number of cycles measured over the same interval.
+  @param[in]  Time    The difference of the two times.
+
+  @return The interval in nanoseconds, or 0 if it was too short for the host
+          clock.
+
+**/
+UINT64
+InternalBenchmarkTimeToNanoseconds (
+  IN UINT64  Cycles,
+  IN UINT64  Time
+  )
+{
+  return DivU64x64Remainder (MultU64x32 (Time, 1000000000), CLOCKS_PER_SEC, NULL);
+}